@@ -0,0 +1,143 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdCanny.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE __m256i LoadU8(const uint8_t* src)
+        {
+            return _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)src));
+        }
+
+        SIMD_INLINE void CannyGradient(const uint8_t* src0, const uint8_t* src1, const uint8_t* src2, size_t x, int16_t* dx, int16_t* dy, int16_t* mag)
+        {
+            __m256i s00 = LoadU8(src0 + x - 1), s01 = LoadU8(src0 + x), s02 = LoadU8(src0 + x + 1);
+            __m256i s10 = LoadU8(src1 + x - 1), s12 = LoadU8(src1 + x + 1);
+            __m256i s20 = LoadU8(src2 + x - 1), s21 = LoadU8(src2 + x), s22 = LoadU8(src2 + x + 1);
+            __m256i _dx = _mm256_sub_epi16(_mm256_add_epi16(_mm256_add_epi16(s02, s22), _mm256_slli_epi16(s12, 1)), _mm256_add_epi16(_mm256_add_epi16(s00, s20), _mm256_slli_epi16(s10, 1)));
+            __m256i _dy = _mm256_sub_epi16(_mm256_add_epi16(_mm256_add_epi16(s20, s22), _mm256_slli_epi16(s21, 1)), _mm256_add_epi16(_mm256_add_epi16(s00, s02), _mm256_slli_epi16(s01, 1)));
+            _mm256_storeu_si256((__m256i*)(dx + x), _dx);
+            _mm256_storeu_si256((__m256i*)(dy + x), _dy);
+            _mm256_storeu_si256((__m256i*)(mag + x), _mm256_add_epi16(_mm256_abs_epi16(_dx), _mm256_abs_epi16(_dy)));
+        }
+
+        static void CannyGradientRow(const uint8_t* src0, const uint8_t* src1, const uint8_t* src2, size_t width, int16_t* dx, int16_t* dy, int16_t* mag)
+        {
+            if (width < HA + 2)
+            {
+                Base::CannyGradientRow(src0, src1, src2, width, dx, dy, mag);
+                return;
+            }
+            Base::CannyGradient(src0, src1, src2, 0, 0, 1, dx, dy, mag);
+            size_t x = 1;
+            for (; x + HA < width; x += HA)
+                CannyGradient(src0, src1, src2, x, dx, dy, mag);
+            if (x < width - 1)
+                CannyGradient(src0, src1, src2, width - 1 - HA, dx, dy, mag);
+            Base::CannyGradient(src0, src1, src2, width - 2, width - 1, width - 1, dx, dy, mag);
+        }
+
+        SIMD_INLINE __m256i CannyGreater(__m256i a, __m256i b)
+        {
+            return _mm256_cmpgt_epi32(_mm256_madd_epi16(a, b), _mm256_setzero_si256());
+        }
+
+        SIMD_INLINE void CannyNonMax(const int16_t* dx, const int16_t* dy, const int16_t* mag0, const int16_t* mag1, const int16_t* mag2,
+            size_t x, __m256i low, __m256i high, __m256i kHor, __m256i kVer, uint8_t* map)
+        {
+            __m256i _dx = _mm256_loadu_si256((__m256i*)(dx + x));
+            __m256i _dy = _mm256_loadu_si256((__m256i*)(dy + x));
+            __m256i m = _mm256_loadu_si256((__m256i*)(mag1 + x));
+            __m256i ax = _mm256_abs_epi16(_dx), ay = _mm256_abs_epi16(_dy);
+            __m256i lo = _mm256_unpacklo_epi16(ax, ay), hi = _mm256_unpackhi_epi16(ax, ay);
+            __m256i hor = _mm256_packs_epi32(CannyGreater(lo, kHor), CannyGreater(hi, kHor));
+            __m256i ver = _mm256_packs_epi32(CannyGreater(lo, kVer), CannyGreater(hi, kVer));
+            __m256i neg = _mm256_srai_epi16(_mm256_xor_si256(_dx, _dy), 15);
+            __m256i hMax = _mm256_andnot_si256(_mm256_cmpgt_epi16(_mm256_loadu_si256((__m256i*)(mag1 + x + 1)), m), _mm256_cmpgt_epi16(m, _mm256_loadu_si256((__m256i*)(mag1 + x - 1))));
+            __m256i vMax = _mm256_andnot_si256(_mm256_cmpgt_epi16(_mm256_loadu_si256((__m256i*)(mag2 + x)), m), _mm256_cmpgt_epi16(m, _mm256_loadu_si256((__m256i*)(mag0 + x))));
+            __m256i pMax = _mm256_and_si256(_mm256_cmpgt_epi16(m, _mm256_loadu_si256((__m256i*)(mag0 + x - 1))), _mm256_cmpgt_epi16(m, _mm256_loadu_si256((__m256i*)(mag2 + x + 1))));
+            __m256i nMax = _mm256_and_si256(_mm256_cmpgt_epi16(m, _mm256_loadu_si256((__m256i*)(mag0 + x + 1))), _mm256_cmpgt_epi16(m, _mm256_loadu_si256((__m256i*)(mag2 + x - 1))));
+            __m256i max = _mm256_blendv_epi8(_mm256_blendv_epi8(_mm256_blendv_epi8(pMax, nMax, neg), vMax, ver), hMax, hor);
+            __m256i weak = _mm256_and_si256(max, _mm256_cmpgt_epi16(m, low));
+            __m256i strong = _mm256_and_si256(weak, _mm256_cmpgt_epi16(m, high));
+            __m256i value = _mm256_sub_epi16(_mm256_setzero_si256(), _mm256_add_epi16(weak, strong));
+            _mm_storeu_si128((__m128i*)(map + x), _mm_packus_epi16(_mm256_castsi256_si128(value), _mm256_extracti128_si256(value, 1)));
+        }
+
+        static void CannyNonMaxRow(const int16_t* dx, const int16_t* dy, const int16_t* mag0, const int16_t* mag1, const int16_t* mag2, size_t width, int16_t low, int16_t high, uint8_t* map)
+        {
+            if (width < HA)
+            {
+                Base::CannyNonMaxRow(dx, dy, mag0, mag1, mag2, width, low, high, map);
+                return;
+            }
+            __m256i _low = _mm256_set1_epi16(low), _high = _mm256_set1_epi16(high);
+            __m256i kHor = _mm256_unpacklo_epi16(_mm256_set1_epi16(Base::CANNY_TG22_NUM), _mm256_set1_epi16(-Base::CANNY_TG22_DEN));
+            __m256i kVer = _mm256_unpacklo_epi16(_mm256_set1_epi16(-Base::CANNY_TG22_DEN), _mm256_set1_epi16(Base::CANNY_TG22_NUM));
+            size_t widthHA = AlignLo(width, HA);
+            for (size_t x = 0; x < widthHA; x += HA)
+                CannyNonMax(dx, dy, mag0, mag1, mag2, x, _low, _high, kHor, kVer, map);
+            if (widthHA < width)
+                CannyNonMax(dx, dy, mag0, mag1, mag2, width - HA, _low, _high, kHor, kVer, map);
+        }
+
+        static void CannyEdgesRow(const uint8_t* map, size_t width, uint8_t* dst)
+        {
+            if (width < A)
+            {
+                Base::CannyEdgesRow(map, width, dst);
+                return;
+            }
+            __m256i strong = _mm256_set1_epi8(2);
+            size_t widthA = AlignLo(width, A);
+            for (size_t x = 0; x < widthA; x += A)
+                _mm256_storeu_si256((__m256i*)(dst + x), _mm256_cmpeq_epi8(_mm256_loadu_si256((__m256i*)(map + x)), strong));
+            if (widthA < width)
+                _mm256_storeu_si256((__m256i*)(dst + width - A), _mm256_cmpeq_epi8(_mm256_loadu_si256((__m256i*)(map + width - A)), strong));
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        CannyEdgeDetector::CannyEdgeDetector()
+        {
+            _gradient = CannyGradientRow;
+            _nonMax = CannyNonMaxRow;
+            _edges = CannyEdgesRow;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void Canny(const uint8_t* src, size_t srcStride, size_t width, size_t height, int lowThreshold, int highThreshold, uint8_t* dst, size_t dstStride)
+        {
+            CannyEdgeDetector detector;
+            detector.Run(src, srcStride, width, height, lowThreshold, highThreshold, dst, dstStride);
+        }
+    }
+#endif
+}
@@ -0,0 +1,207 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdCustomFilter.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        static void ToFloat8u(const uint8_t* src, size_t size, float* dst)
+        {
+            size_t sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeF; i += F)
+                _mm256_storeu_ps(dst + i, _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)(src + i)))));
+            for (; i < size; ++i)
+                dst[i] = float(src[i]);
+        }
+
+        static void ToFloat16u(const uint8_t* src, size_t size, float* dst)
+        {
+            const uint16_t* src16u = (const uint16_t*)src;
+            size_t sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeF; i += F)
+                _mm256_storeu_ps(dst + i, _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm_loadu_si128((__m128i*)(src16u + i)))));
+            for (; i < size; ++i)
+                dst[i] = float(src16u[i]);
+        }
+
+        SIMD_INLINE __m256i ToInt32u(const float* src, const __m256& max)
+        {
+            __m256 value = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(src), _mm256_setzero_ps()), max);
+            return _mm256_cvttps_epi32(_mm256_add_ps(value, _mm256_set1_ps(0.5f)));
+        }
+
+        static void FromFloat8u(const float* src, size_t size, uint8_t* dst)
+        {
+            size_t sizeQF = AlignLo(size, QF), sizeF = AlignLo(size, F), i = 0;
+            __m256 max = _mm256_set1_ps(255.0f);
+            for (; i < sizeQF; i += QF)
+            {
+                __m256i i0 = ToInt32u(src + i + 0 * F, max);
+                __m256i i1 = ToInt32u(src + i + 1 * F, max);
+                __m256i i2 = ToInt32u(src + i + 2 * F, max);
+                __m256i i3 = ToInt32u(src + i + 3 * F, max);
+                _mm256_storeu_si256((__m256i*)(dst + i), PackI16ToU8(PackI32ToI16(i0, i1), PackI32ToI16(i2, i3)));
+            }
+            for (; i < sizeF; i += F)
+            {
+                __m256i i0 = ToInt32u(src + i, max);
+                _mm_storel_epi64((__m128i*)(dst + i), _mm256_castsi256_si128(PackI16ToU8(PackI32ToI16(i0, K_ZERO), K_ZERO)));
+            }
+            for (; i < size; ++i)
+                dst[i] = (uint8_t)Base::CustomFilterRound(src[i], 255.0f);
+        }
+
+        static void FromFloat16u(const float* src, size_t size, uint8_t* dst)
+        {
+            uint16_t* dst16u = (uint16_t*)dst;
+            size_t sizeDF = AlignLo(size, DF), i = 0;
+            __m256 max = _mm256_set1_ps(65535.0f);
+            for (; i < sizeDF; i += DF)
+            {
+                __m256i i0 = ToInt32u(src + i + 0, max);
+                __m256i i1 = ToInt32u(src + i + F, max);
+                _mm256_storeu_si256((__m256i*)(dst16u + i), PackU32ToI16(i0, i1));
+            }
+            for (; i < size; ++i)
+                dst16u[i] = (uint16_t)Base::CustomFilterRound(src[i], 65535.0f);
+        }
+
+        template<bool add> void RowFilter(const float* src, size_t size, size_t step, const float* weight, size_t kernel, float* dst)
+        {
+            size_t sizeQF = AlignLo(size, QF), sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeQF; i += QF)
+            {
+                __m256 s0 = add ? _mm256_loadu_ps(dst + i + 0 * F) : _mm256_setzero_ps();
+                __m256 s1 = add ? _mm256_loadu_ps(dst + i + 1 * F) : _mm256_setzero_ps();
+                __m256 s2 = add ? _mm256_loadu_ps(dst + i + 2 * F) : _mm256_setzero_ps();
+                __m256 s3 = add ? _mm256_loadu_ps(dst + i + 3 * F) : _mm256_setzero_ps();
+                for (size_t k = 0; k < kernel; ++k)
+                {
+                    const float* ps = src + i + k * step;
+                    __m256 w = _mm256_set1_ps(weight[k]);
+                    s0 = _mm256_fmadd_ps(w, _mm256_loadu_ps(ps + 0 * F), s0);
+                    s1 = _mm256_fmadd_ps(w, _mm256_loadu_ps(ps + 1 * F), s1);
+                    s2 = _mm256_fmadd_ps(w, _mm256_loadu_ps(ps + 2 * F), s2);
+                    s3 = _mm256_fmadd_ps(w, _mm256_loadu_ps(ps + 3 * F), s3);
+                }
+                _mm256_storeu_ps(dst + i + 0 * F, s0);
+                _mm256_storeu_ps(dst + i + 1 * F, s1);
+                _mm256_storeu_ps(dst + i + 2 * F, s2);
+                _mm256_storeu_ps(dst + i + 3 * F, s3);
+            }
+            for (; i < sizeF; i += F)
+            {
+                __m256 s0 = add ? _mm256_loadu_ps(dst + i) : _mm256_setzero_ps();
+                for (size_t k = 0; k < kernel; ++k)
+                    s0 = _mm256_fmadd_ps(_mm256_set1_ps(weight[k]), _mm256_loadu_ps(src + i + k * step), s0);
+                _mm256_storeu_ps(dst + i, s0);
+            }
+            for (; i < size; ++i)
+            {
+                float sum = add ? dst[i] : 0.0f;
+                for (size_t k = 0; k < kernel; ++k)
+                    sum += weight[k] * src[i + k * step];
+                dst[i] = sum;
+            }
+        }
+
+        static void ColFilter(const float* const* rows, size_t size, const float* weight, size_t kernel, float* dst)
+        {
+            size_t sizeQF = AlignLo(size, QF), sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeQF; i += QF)
+            {
+                __m256 s0 = _mm256_setzero_ps();
+                __m256 s1 = _mm256_setzero_ps();
+                __m256 s2 = _mm256_setzero_ps();
+                __m256 s3 = _mm256_setzero_ps();
+                for (size_t k = 0; k < kernel; ++k)
+                {
+                    const float* ps = rows[k] + i;
+                    __m256 w = _mm256_set1_ps(weight[k]);
+                    s0 = _mm256_fmadd_ps(w, _mm256_loadu_ps(ps + 0 * F), s0);
+                    s1 = _mm256_fmadd_ps(w, _mm256_loadu_ps(ps + 1 * F), s1);
+                    s2 = _mm256_fmadd_ps(w, _mm256_loadu_ps(ps + 2 * F), s2);
+                    s3 = _mm256_fmadd_ps(w, _mm256_loadu_ps(ps + 3 * F), s3);
+                }
+                _mm256_storeu_ps(dst + i + 0 * F, s0);
+                _mm256_storeu_ps(dst + i + 1 * F, s1);
+                _mm256_storeu_ps(dst + i + 2 * F, s2);
+                _mm256_storeu_ps(dst + i + 3 * F, s3);
+            }
+            for (; i < sizeF; i += F)
+            {
+                __m256 s0 = _mm256_setzero_ps();
+                for (size_t k = 0; k < kernel; ++k)
+                    s0 = _mm256_fmadd_ps(_mm256_set1_ps(weight[k]), _mm256_loadu_ps(rows[k] + i), s0);
+                _mm256_storeu_ps(dst + i, s0);
+            }
+            for (; i < size; ++i)
+            {
+                float sum = 0.0f;
+                for (size_t k = 0; k < kernel; ++k)
+                    sum += weight[k] * rows[k][i];
+                dst[i] = sum;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        CustomFilterDefault::CustomFilterDefault(const CustomFilterParam& param, const float* kernelX, const float* kernelY)
+            : Sse41::CustomFilterDefault(param, kernelX, kernelY)
+        {
+            switch (_param.type)
+            {
+            case SimdFilterChannel8u: _toFloat = ToFloat8u, _fromFloat = FromFloat8u; break;
+            case SimdFilterChannel16u: _toFloat = ToFloat16u, _fromFloat = FromFloat16u; break;
+            default: break;
+            }
+            _rowFilter = RowFilter<false>;
+            _rowFilterAdd = RowFilter<true>;
+            _colFilter = ColFilter;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* CustomFilterSeparableInit(size_t width, size_t height, size_t channels, SimdFilterChannelType type, const float* kernelX, size_t sizeX, const float* kernelY, size_t sizeY, SimdFilterBorderType border)
+        {
+            CustomFilterParam param(width, height, channels, type, sizeX, sizeY, true, border, sizeof(void*));
+            if (!param.Valid() || kernelX == NULL || kernelY == NULL)
+                return NULL;
+            return new CustomFilterDefault(param, kernelX, kernelY);
+        }
+
+        void* CustomFilter2dInit(size_t width, size_t height, size_t channels, SimdFilterChannelType type, const float* kernel, size_t sizeX, size_t sizeY, SimdFilterBorderType border)
+        {
+            CustomFilterParam param(width, height, channels, type, sizeX, sizeY, false, border, sizeof(void*));
+            if (!param.Valid() || kernel == NULL)
+                return NULL;
+            return new CustomFilterDefault(param, kernel, NULL);
+        }
+    }
+#endif
+}
@@ -2178,6 +2178,8 @@ namespace Simd
 
         bool ImageJpegLoader::FromStream()
         {
+            if (_param.scale != 1)
+                return Sse41::ImageJpegLoader::FromStream();
             int x, y, comp;
             jpeg__context s;
             s.io.eof = jpeg__stdio_eof;
@@ -2221,6 +2223,11 @@ namespace Simd
             }
             return false;
         }
+
+        bool ImageJpegLoader::FromStreamRoi(size_t left, size_t top, size_t right, size_t bottom)
+        {
+            return ImageLoader::FromStreamRoi(left, top, right, bottom);
+        }
     }
 #endif
 }
@@ -0,0 +1,294 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdImageLoad.h"
+#include "Simd/SimdImageLoadPng.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        template<int N> SIMD_INLINE __m128i LoadPixel(const uint8_t* p);
+
+        template<> SIMD_INLINE __m128i LoadPixel<1>(const uint8_t* p)
+        {
+            return _mm_cvtsi32_si128(p[0]);
+        }
+
+        template<> SIMD_INLINE __m128i LoadPixel<2>(const uint8_t* p)
+        {
+            return _mm_cvtsi32_si128(*(uint16_t*)p);
+        }
+
+        template<> SIMD_INLINE __m128i LoadPixel<3>(const uint8_t* p)
+        {
+            return _mm_cvtsi32_si128(*(uint16_t*)p | (p[2] << 16));
+        }
+
+        template<> SIMD_INLINE __m128i LoadPixel<4>(const uint8_t* p)
+        {
+            return _mm_cvtsi32_si128(*(int32_t*)p);
+        }
+
+        template<> SIMD_INLINE __m128i LoadPixel<6>(const uint8_t* p)
+        {
+            return _mm_insert_epi16(_mm_cvtsi32_si128(*(int32_t*)p), *(uint16_t*)(p + 4), 2);
+        }
+
+        template<> SIMD_INLINE __m128i LoadPixel<8>(const uint8_t* p)
+        {
+            return _mm_loadl_epi64((__m128i*)p);
+        }
+
+        template<int N> SIMD_INLINE void StorePixel(uint8_t* p, __m128i a);
+
+        template<> SIMD_INLINE void StorePixel<1>(uint8_t* p, __m128i a)
+        {
+            p[0] = (uint8_t)_mm_cvtsi128_si32(a);
+        }
+
+        template<> SIMD_INLINE void StorePixel<2>(uint8_t* p, __m128i a)
+        {
+            *(uint16_t*)p = (uint16_t)_mm_cvtsi128_si32(a);
+        }
+
+        template<> SIMD_INLINE void StorePixel<3>(uint8_t* p, __m128i a)
+        {
+            uint32_t val = _mm_cvtsi128_si32(a);
+            *(uint16_t*)p = (uint16_t)val;
+            p[2] = (uint8_t)(val >> 16);
+        }
+
+        template<> SIMD_INLINE void StorePixel<4>(uint8_t* p, __m128i a)
+        {
+            *(int32_t*)p = _mm_cvtsi128_si32(a);
+        }
+
+        template<> SIMD_INLINE void StorePixel<6>(uint8_t* p, __m128i a)
+        {
+            *(int32_t*)p = _mm_cvtsi128_si32(a);
+            *(uint16_t*)(p + 4) = (uint16_t)_mm_extract_epi16(a, 2);
+        }
+
+        template<> SIMD_INLINE void StorePixel<8>(uint8_t* p, __m128i a)
+        {
+            _mm_storel_epi64((__m128i*)p, a);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<int N> SIMD_INLINE __m128i SubPrefix(__m128i a)
+        {
+            a = _mm_add_epi8(a, _mm_slli_si128(a, N));
+            if (2 * N < 16)
+                a = _mm_add_epi8(a, _mm_slli_si128(a, 2 * N));
+            if (4 * N < 16)
+                a = _mm_add_epi8(a, _mm_slli_si128(a, 4 * N));
+            if (8 * N < 16)
+                a = _mm_add_epi8(a, _mm_slli_si128(a, 8 * N));
+            return a;
+        }
+
+        template<int N> SIMD_INLINE __m128i SubCarry()
+        {
+            const int step = 16 / N * N;
+            SIMD_ALIGNED(16) int8_t idx[16];
+            for (int i = 0; i < 16; ++i)
+                idx[i] = int8_t(step - N + i % N);
+            return _mm_load_si128((__m128i*)idx);
+        }
+
+        template<int N> void DecodeSub(const uint8_t* curr, size_t size, uint8_t* dst)
+        {
+            const size_t step = 16 / N * N;
+            __m128i carry = _mm_setzero_si128(), shuffle = SubCarry<N>();
+            size_t i = 0;
+            for (; i + 16 <= size; i += step)
+            {
+                __m128i sum = _mm_add_epi8(SubPrefix<N>(_mm_loadu_si128((__m128i*)(curr + i))), carry);
+                _mm_storeu_si128((__m128i*)(dst + i), sum);
+                carry = _mm_shuffle_epi8(sum, shuffle);
+            }
+            for (; i < size; ++i)
+                dst[i] = curr[i] + (i < N ? 0 : dst[i - N]);
+        }
+
+        static void DecodeLine1(const uint8_t* curr, const uint8_t* prev, int width, int srcN, int dstN, uint8_t* dst)
+        {
+            size_t size = size_t(width) * srcN;
+            if (srcN == dstN)
+            {
+                switch (srcN)
+                {
+                case 1: DecodeSub<1>(curr, size, dst); return;
+                case 2: DecodeSub<2>(curr, size, dst); return;
+                case 3: DecodeSub<3>(curr, size, dst); return;
+                case 4: DecodeSub<4>(curr, size, dst); return;
+                case 6: DecodeSub<6>(curr, size, dst); return;
+                case 8: DecodeSub<8>(curr, size, dst); return;
+                }
+            }
+            Base::DecodeLine1(curr, prev, width, srcN, dstN, dst);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static void DecodeLine2(const uint8_t* curr, const uint8_t* prev, int width, int srcN, int dstN, uint8_t* dst)
+        {
+            if (srcN == dstN)
+            {
+                size_t size = size_t(width) * srcN, sizeA = AlignLo(size, A), i = 0;
+                for (; i < sizeA; i += A)
+                    _mm256_storeu_si256((__m256i*)(dst + i), _mm256_add_epi8(_mm256_loadu_si256((__m256i*)(curr + i)), _mm256_loadu_si256((__m256i*)(prev + i))));
+                for (; i < size; ++i)
+                    dst[i] = curr[i] + prev[i];
+            }
+            else
+                Base::DecodeLine2(curr, prev, width, srcN, dstN, dst);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<int N> void DecodeAvg(const uint8_t* curr, const uint8_t* prev, size_t size, uint8_t* dst)
+        {
+            __m128i a = _mm_setzero_si128();
+            for (size_t i = 0; i < size; i += N)
+            {
+                __m128i b = LoadPixel<N>(prev + i);
+                __m128i avg = _mm_sub_epi8(_mm_avg_epu8(a, b), _mm_and_si128(_mm_xor_si128(a, b), Sse41::K8_01));
+                a = _mm_add_epi8(LoadPixel<N>(curr + i), avg);
+                StorePixel<N>(dst + i, a);
+            }
+        }
+
+        static void DecodeLine3(const uint8_t* curr, const uint8_t* prev, int width, int srcN, int dstN, uint8_t* dst)
+        {
+            size_t size = size_t(width) * srcN;
+            if (srcN == dstN)
+            {
+                switch (srcN)
+                {
+                case 1: DecodeAvg<1>(curr, prev, size, dst); return;
+                case 2: DecodeAvg<2>(curr, prev, size, dst); return;
+                case 3: DecodeAvg<3>(curr, prev, size, dst); return;
+                case 4: DecodeAvg<4>(curr, prev, size, dst); return;
+                case 6: DecodeAvg<6>(curr, prev, size, dst); return;
+                case 8: DecodeAvg<8>(curr, prev, size, dst); return;
+                }
+            }
+            Base::DecodeLine3(curr, prev, width, srcN, dstN, dst);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<int N> void DecodePaeth(const uint8_t* curr, const uint8_t* prev, size_t size, uint8_t* dst)
+        {
+            __m128i a = _mm_setzero_si128(), c = _mm_setzero_si128();
+            for (size_t i = 0; i < size; i += N)
+            {
+                __m128i b = _mm_cvtepu8_epi16(LoadPixel<N>(prev + i));
+                __m128i bc = _mm_sub_epi16(b, c), ac = _mm_sub_epi16(a, c);
+                __m128i pa = _mm_abs_epi16(bc), pb = _mm_abs_epi16(ac), pc = _mm_abs_epi16(_mm_add_epi16(bc, ac));
+                __m128i min = _mm_min_epi16(_mm_min_epi16(pa, pb), pc);
+                __m128i pred = _mm_blendv_epi8(c, b, _mm_cmpeq_epi16(min, pb));
+                pred = _mm_blendv_epi8(pred, a, _mm_cmpeq_epi16(min, pa));
+                a = _mm_and_si128(_mm_add_epi16(_mm_cvtepu8_epi16(LoadPixel<N>(curr + i)), pred), Sse41::K16_00FF);
+                StorePixel<N>(dst + i, _mm_packus_epi16(a, a));
+                c = b;
+            }
+        }
+
+        static void DecodeLine4(const uint8_t* curr, const uint8_t* prev, int width, int srcN, int dstN, uint8_t* dst)
+        {
+            size_t size = size_t(width) * srcN;
+            if (srcN == dstN)
+            {
+                switch (srcN)
+                {
+                case 1: DecodePaeth<1>(curr, prev, size, dst); return;
+                case 2: DecodePaeth<2>(curr, prev, size, dst); return;
+                case 3: DecodePaeth<3>(curr, prev, size, dst); return;
+                case 4: DecodePaeth<4>(curr, prev, size, dst); return;
+                case 6: DecodePaeth<6>(curr, prev, size, dst); return;
+                case 8: DecodePaeth<8>(curr, prev, size, dst); return;
+                }
+            }
+            Base::DecodeLine4(curr, prev, width, srcN, dstN, dst);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static void ExpandPalette(const uint8_t* src, size_t size, int outN, const uint8_t* palette, uint8_t* dst)
+        {
+            const int32_t* pal = (const int32_t*)palette;
+            size_t size8 = AlignLo(size, 8), i = 0;
+            if (outN == 3)
+            {
+                for (; i < size8; i += 8, dst += 24)
+                {
+                    __m256i bgra = _mm256_i32gather_epi32(pal, _mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)(src + i))), 4);
+                    __m256i bgr = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(bgra, K8_SHUFFLE_BGRA_TO_BGR), K32_PERMUTE_BGRA_TO_BGR);
+                    _mm_storeu_si128((__m128i*)dst, _mm256_castsi256_si128(bgr));
+                    _mm_storel_epi64((__m128i*)(dst + 16), _mm256_extracti128_si256(bgr, 1));
+                }
+            }
+            else if (outN == 4)
+            {
+                for (; i < size8; i += 8, dst += 32)
+                    _mm256_storeu_si256((__m256i*)dst, _mm256_i32gather_epi32(pal, _mm256_cvtepu8_epi32(_mm_loadl_epi64((__m128i*)(src + i))), 4));
+            }
+            Base::ExpandPalette(src + i, size - i, outN, palette, dst);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        const __m256i K8_SHUFFLE_SWAP_16 = SIMD_MM256_SETR_EPI8(
+            0x1, 0x0, 0x3, 0x2, 0x5, 0x4, 0x7, 0x6, 0x9, 0x8, 0xB, 0xA, 0xD, 0xC, 0xF, 0xE,
+            0x1, 0x0, 0x3, 0x2, 0x5, 0x4, 0x7, 0x6, 0x9, 0x8, 0xB, 0xA, 0xD, 0xC, 0xF, 0xE);
+
+        static void Expand16(uint8_t* data, size_t size)
+        {
+            size_t bytes = size * 2, bytesA = AlignLo(bytes, A), i = 0;
+            for (; i < bytesA; i += A)
+                _mm256_storeu_si256((__m256i*)(data + i), _mm256_shuffle_epi8(_mm256_loadu_si256((__m256i*)(data + i)), K8_SHUFFLE_SWAP_16));
+            Base::Expand16(data + i, (bytes - i) / 2);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        ImagePngLoader::ImagePngLoader(const ImageLoaderParam& param)
+            : Base::ImagePngLoader(param)
+        {
+            _decodeLine[1] = Avx2::DecodeLine1;
+            _decodeLine[2] = Avx2::DecodeLine2;
+            _decodeLine[3] = Avx2::DecodeLine3;
+            _decodeLine[4] = Avx2::DecodeLine4;
+            _expandPalette = Avx2::ExpandPalette;
+            _expand16 = Avx2::Expand16;
+        }
+    }
+#endif
+}
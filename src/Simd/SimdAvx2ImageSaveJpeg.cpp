@@ -202,6 +202,17 @@ namespace Simd
             }
         }
 
+        SIMD_INLINE void SubUvH(const float* src, float* dst)
+        {
+            __m256 _0_5 = _mm256_set1_ps(0.5f);
+            for (int yy = 0; yy < 8; yy += 1)
+            {
+                _mm256_storeu_ps(dst, _mm256_mul_ps(PermutedHorizontalAdd(_mm256_loadu_ps(src + 0), _mm256_loadu_ps(src + 64)), _0_5));
+                src += 8;
+                dst += 8;
+            }
+        }
+
         void JpegWriteBlockSubs(OutputMemoryStream& stream, int width, int height, const uint8_t* red,
             const uint8_t* green, const uint8_t* blue, int stride, const float* fY, const float* fUv, int dc[3])
         {
@@ -321,6 +332,73 @@ namespace Simd
             }
         }
 
+        void JpegWriteBlock422(OutputMemoryStream& stream, int width, int height, const uint8_t* red,
+            const uint8_t* green, const uint8_t* blue, int stride, const float* fY, const float* fUv, int dc[3])
+        {
+            bool gray = red == green && red == blue;
+            __m256 k[10];
+            if(!gray)
+                RgbToYuvInit(k);
+            int& DCY = dc[0], & DCU = dc[1], & DCV = dc[2];
+            int width16 = width & (~15);
+            Base::BitBuf bitBuf;
+            for (int y = 0; y < height; y += 8)
+            {
+                int x = 0;
+                SIMD_ALIGNED(32) float Y[128], U[128], V[128];
+                SIMD_ALIGNED(32) float subU[64], subV[64];
+                for (; x < width16; x += 16)
+                {
+                    if (gray)
+                    {
+                        GrayToY(red + x, stride, height - y, Y, 8);
+                        GrayToY(red + x + 8, stride, height - y, Y + 64, 8);
+                    }
+                    else
+                    {
+                        RgbToYuv(red + x, green + x, blue + x, stride, height - y, k, Y, U, V, 8);
+                        RgbToYuv(red + x + 8, green + x + 8, blue + x + 8, stride, height - y, k, Y + 64, U + 64, V + 64, 8);
+                    }
+                    DCY = JpegProcessDu(bitBuf, Y + 0, 8, fY, DCY, Base::HuffmanYdc, Base::HuffmanYac);
+                    DCY = JpegProcessDu(bitBuf, Y + 64, 8, fY, DCY, Base::HuffmanYdc, Base::HuffmanYac);
+                    if (gray)
+                        Base::JpegProcessDuGrayUv(bitBuf);
+                    else
+                    {
+                        SubUvH(U, subU);
+                        SubUvH(V, subV);
+                        DCU = JpegProcessDu(bitBuf, subU, 8, fUv, DCU, Base::HuffmanUVdc, Base::HuffmanUVac);
+                        DCV = JpegProcessDu(bitBuf, subV, 8, fUv, DCV, Base::HuffmanUVdc, Base::HuffmanUVac);
+                    }
+                    if (bitBuf.Full())
+                    {
+                        Base::WriteBits(stream, bitBuf.data, bitBuf.size);
+                        bitBuf.Clear();
+                    }
+                }
+                for (; x < width; x += 16)
+                {
+                    if (gray)
+                        Base::GrayToY16x8(red + x, stride, height - y, width - x, Y);
+                    else
+                        Base::RgbToYuv16x8(red + x, green + x, blue + x, stride, height - y, width - x, Y, U, V);
+                    DCY = JpegProcessDu(bitBuf, Y + 0, 8, fY, DCY, Base::HuffmanYdc, Base::HuffmanYac);
+                    DCY = JpegProcessDu(bitBuf, Y + 64, 8, fY, DCY, Base::HuffmanYdc, Base::HuffmanYac);
+                    if (gray)
+                        Base::JpegProcessDuGrayUv(bitBuf);
+                    else
+                    {
+                        SubUvH(U, subU);
+                        SubUvH(V, subV);
+                        DCU = JpegProcessDu(bitBuf, subU, 8, fUv, DCU, Base::HuffmanUVdc, Base::HuffmanUVac);
+                        DCV = JpegProcessDu(bitBuf, subV, 8, fUv, DCV, Base::HuffmanUVdc, Base::HuffmanUVac);
+                    }
+                }
+            }
+            Base::WriteBits(stream, bitBuf.data, bitBuf.size);
+            bitBuf.Clear();
+        }
+
         void JpegWriteBlockNv12(OutputMemoryStream& stream, int width, int height, const uint8_t* ySrc, int yStride,
             const uint8_t* uvSrc, int uvStride, const float* fY, const float* fUv, int dc[3])
         {
@@ -457,7 +535,12 @@ namespace Simd
                         break;
                     }
                 }
-                _writeBlock = _subSample ? JpegWriteBlockSubs : JpegWriteBlockFull;
+                if (_sampling == SimdJpegSampling420)
+                    _writeBlock = JpegWriteBlockSubs;
+                else if (_sampling == SimdJpegSampling422)
+                    _writeBlock = JpegWriteBlock422;
+                else
+                    _writeBlock = JpegWriteBlockFull;
             }
             else
             {
@@ -0,0 +1,93 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdImageSave.h"
+#include "Simd/SimdImageQoi.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE __m256i QoiCodes(__m256i px, __m256i pr)
+        {
+            static const __m256i LUMA_SHUFFLE = SIMD_MM256_SETR_EPI8(
+                0x1, -1, 0x1, -1, 0x5, -1, 0x5, -1, 0x9, -1, 0x9, -1, 0xD, -1, 0xD, -1,
+                0x1, -1, 0x1, -1, 0x5, -1, 0x5, -1, 0x9, -1, 0x9, -1, 0xD, -1, 0xD, -1);
+            __m256i dv = _mm256_sub_epi8(px, pr);
+            __m256i alphaEq = _mm256_cmpeq_epi32(_mm256_and_si256(dv, _mm256_set1_epi32(0xFF000000)), _mm256_setzero_si256());
+            __m256i b1 = _mm256_add_epi8(dv, _mm256_set1_epi32(0x00020202));
+            __m256i diffOk = _mm256_cmpeq_epi32(_mm256_and_si256(b1, _mm256_set1_epi32(0x00FCFCFC)), _mm256_setzero_si256());
+            __m256i diff = _mm256_or_si256(_mm256_or_si256(_mm256_set1_epi32(Base::QoiOpDiff), _mm256_slli_epi32(_mm256_and_si256(b1, _mm256_set1_epi32(0x3)), 4)),
+                _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(b1, 6), _mm256_set1_epi32(0xC)), _mm256_and_si256(_mm256_srli_epi32(b1, 16), _mm256_set1_epi32(0x3))));
+            __m256i lv = _mm256_add_epi8(_mm256_sub_epi8(dv, _mm256_shuffle_epi8(dv, LUMA_SHUFFLE)), _mm256_set1_epi32(0x00082008));
+            __m256i lumaOk = _mm256_cmpeq_epi32(_mm256_and_si256(lv, _mm256_set1_epi32(0x00F0C0F0)), _mm256_setzero_si256());
+            __m256i luma = _mm256_or_si256(_mm256_or_si256(_mm256_set1_epi32(Base::QoiOpLuma << 8), _mm256_and_si256(lv, _mm256_set1_epi32(0x3F00))),
+                _mm256_or_si256(_mm256_slli_epi32(_mm256_and_si256(lv, _mm256_set1_epi32(0xF)), 4), _mm256_and_si256(_mm256_srli_epi32(lv, 16), _mm256_set1_epi32(0xF))));
+            __m256i code = _mm256_and_si256(luma, lumaOk);
+            code = _mm256_blendv_epi8(code, diff, diffOk);
+            code = _mm256_blendv_epi8(_mm256_set1_epi32(Base::QoiCodeRgba), code, alphaEq);
+            __m256i hash = _mm256_madd_epi16(_mm256_maddubs_epi16(px, _mm256_set1_epi32(0x0B070503)), _mm256_set1_epi16(1));
+            return _mm256_or_si256(code, _mm256_slli_epi32(_mm256_and_si256(hash, _mm256_set1_epi32(63)), 16));
+        }
+
+        void QoiEncodeCodes(const uint8_t* rgba, size_t size, uint32_t prev, uint32_t* codes)
+        {
+            if (size == 0)
+                return;
+            const uint32_t* src = (const uint32_t*)rgba;
+            codes[0] = Base::QoiCode(src[0], prev);
+            size_t i = 1;
+            for (; i + 8 <= size; i += 8)
+            {
+                __m256i px = _mm256_loadu_si256((__m256i*)(src + i));
+                __m256i pr = _mm256_loadu_si256((__m256i*)(src + i - 1));
+                _mm256_storeu_si256((__m256i*)(codes + i), QoiCodes(px, pr));
+            }
+            for (; i < size; ++i)
+                codes[i] = Base::QoiCode(src[i], src[i - 1]);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        ImageQoiSaver::ImageQoiSaver(const ImageSaverParam& param)
+            : Sse41::ImageQoiSaver(param)
+        {
+            _encodeCodes = Avx2::QoiEncodeCodes;
+            if (_param.width >= A)
+            {
+                switch (_param.format)
+                {
+                case SimdPixelFormatGray8: _toRgba = Avx2::GrayToBgra; break;
+                case SimdPixelFormatBgr24: _toRgba = Avx2::RgbToBgra; break;
+                case SimdPixelFormatBgra32: _convert = Avx2::BgraToRgba; break;
+                case SimdPixelFormatRgb24: _toRgba = Avx2::BgrToBgra; break;
+                default: break;
+                }
+            }
+        }
+    }
+#endif
+}
@@ -0,0 +1,81 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdMorphology.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        static void Min8u(const uint8_t* a, const uint8_t* b, size_t size, uint8_t* dst)
+        {
+            size_t sizeA = AlignLo(size, A), i = 0;
+            for (; i < sizeA; i += A)
+                _mm256_storeu_si256((__m256i*)(dst + i), _mm256_min_epu8(_mm256_loadu_si256((__m256i*)(a + i)), _mm256_loadu_si256((__m256i*)(b + i))));
+            for (; i < size; ++i)
+                dst[i] = Base::MinU8(a[i], b[i]);
+        }
+
+        static void Max8u(const uint8_t* a, const uint8_t* b, size_t size, uint8_t* dst)
+        {
+            size_t sizeA = AlignLo(size, A), i = 0;
+            for (; i < sizeA; i += A)
+                _mm256_storeu_si256((__m256i*)(dst + i), _mm256_max_epu8(_mm256_loadu_si256((__m256i*)(a + i)), _mm256_loadu_si256((__m256i*)(b + i))));
+            for (; i < size; ++i)
+                dst[i] = Base::MaxU8(a[i], b[i]);
+        }
+
+        static void Sub8u(const uint8_t* a, const uint8_t* b, size_t size, uint8_t* dst)
+        {
+            size_t sizeA = AlignLo(size, A), i = 0;
+            for (; i < sizeA; i += A)
+                _mm256_storeu_si256((__m256i*)(dst + i), _mm256_subs_epu8(_mm256_loadu_si256((__m256i*)(a + i)), _mm256_loadu_si256((__m256i*)(b + i))));
+            for (; i < size; ++i)
+                dst[i] = Base::SaturatedSubtractionU8(a[i], b[i]);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        MorphologyDefault::MorphologyDefault(const MorphologyParam& param)
+            : Sse41::MorphologyDefault(param)
+        {
+            _min = Min8u;
+            _max = Max8u;
+            _sub = Sub8u;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* MorphologyInit(size_t width, size_t height, size_t channels, SimdMorphologyOperationType operation, SimdMorphologyElementType element, size_t sizeX, size_t sizeY)
+        {
+            MorphologyParam param(width, height, channels, operation, element, sizeX, sizeY, sizeof(void*));
+            if (!param.Valid())
+                return NULL;
+            return new MorphologyDefault(param);
+        }
+    }
+#endif
+}
@@ -0,0 +1,203 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdNms.h"
+#include "Simd/SimdExp.h"
+#include "Simd/SimdLoad.h"
+#include "Simd/SimdStore.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE __m256 Sigmoid(__m256 value)
+        {
+            __m256 _1 = _mm256_set1_ps(1.0f);
+            return _mm256_div_ps(_1, _mm256_add_ps(_1, Exponent(_mm256_sub_ps(_mm256_setzero_ps(), value))));
+        }
+
+        template<SimdBoxDecodeType type> SIMD_INLINE void NmsDecodeBoxes(const float* src, const float* anchors, size_t stride, const __m256* params, float* dst)
+        {
+            __m256 s0 = _mm256_loadu_ps(src + 0 * stride), s1 = _mm256_loadu_ps(src + 1 * stride);
+            __m256 s2 = _mm256_loadu_ps(src + 2 * stride), s3 = _mm256_loadu_ps(src + 3 * stride);
+            __m256 a0 = _mm256_loadu_ps(anchors + 0 * stride), a1 = _mm256_loadu_ps(anchors + 1 * stride);
+            __m256 a2 = _mm256_loadu_ps(anchors + 2 * stride), a3 = _mm256_loadu_ps(anchors + 3 * stride);
+            __m256 cx, cy, w, h;
+            if (type == SimdBoxDecodeCenterSize)
+            {
+                cx = _mm256_add_ps(a0, _mm256_mul_ps(_mm256_mul_ps(s0, params[0]), a2));
+                cy = _mm256_add_ps(a1, _mm256_mul_ps(_mm256_mul_ps(s1, params[1]), a3));
+                w = _mm256_mul_ps(a2, Exponent(_mm256_mul_ps(s2, params[2])));
+                h = _mm256_mul_ps(a3, Exponent(_mm256_mul_ps(s3, params[3])));
+            }
+            else if (type == SimdBoxDecodeYoloV3)
+            {
+                cx = _mm256_mul_ps(_mm256_add_ps(Sigmoid(s0), a0), params[0]);
+                cy = _mm256_mul_ps(_mm256_add_ps(Sigmoid(s1), a1), params[0]);
+                w = _mm256_mul_ps(a2, Exponent(s2));
+                h = _mm256_mul_ps(a3, Exponent(s3));
+            }
+            else
+            {
+                __m256 _2 = _mm256_set1_ps(2.0f), _05 = _mm256_set1_ps(0.5f);
+                cx = _mm256_mul_ps(_mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(Sigmoid(s0), _2), _05), a0), params[0]);
+                cy = _mm256_mul_ps(_mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(Sigmoid(s1), _2), _05), a1), params[0]);
+                __m256 sw = _mm256_mul_ps(Sigmoid(s2), _2), sh = _mm256_mul_ps(Sigmoid(s3), _2);
+                w = _mm256_mul_ps(_mm256_mul_ps(sw, sw), a2);
+                h = _mm256_mul_ps(_mm256_mul_ps(sh, sh), a3);
+            }
+            __m256 hw = _mm256_mul_ps(w, _mm256_set1_ps(0.5f)), hh = _mm256_mul_ps(h, _mm256_set1_ps(0.5f));
+            _mm256_storeu_ps(dst + 0 * stride, _mm256_sub_ps(cx, hw));
+            _mm256_storeu_ps(dst + 1 * stride, _mm256_sub_ps(cy, hh));
+            _mm256_storeu_ps(dst + 2 * stride, _mm256_add_ps(cx, hw));
+            _mm256_storeu_ps(dst + 3 * stride, _mm256_add_ps(cy, hh));
+        }
+
+        template<SimdBoxDecodeType type> void NmsDecodeBoxes(const float* src, const float* anchors, size_t size, size_t stride, const float* params, float* dst)
+        {
+            __m256 _params[4];
+            for (size_t i = 0; i < 4; ++i)
+                _params[i] = _mm256_set1_ps(params[i]);
+            size_t sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeF; i += F)
+                NmsDecodeBoxes<type>(src + i, anchors + i, stride, _params, dst + i);
+            if (i < size)
+                Base::NmsDecodeBoxes32f(src + i, anchors + i, size - i, stride, type, params, dst + i);
+        }
+
+        void NmsDecodeBoxes32f(const float* src, const float* anchors, size_t size, size_t stride, SimdBoxDecodeType type, const float* params, float* dst)
+        {
+            float buf[4] = { params[0], type == SimdBoxDecodeCenterSize ? params[1] : params[0], 
+                type == SimdBoxDecodeCenterSize ? params[2] : params[0], type == SimdBoxDecodeCenterSize ? params[3] : params[0] };
+            switch (type)
+            {
+            case SimdBoxDecodeCenterSize: NmsDecodeBoxes<SimdBoxDecodeCenterSize>(src, anchors, size, stride, buf, dst); break;
+            case SimdBoxDecodeYoloV3: NmsDecodeBoxes<SimdBoxDecodeYoloV3>(src, anchors, size, stride, buf, dst); break;
+            case SimdBoxDecodeYoloV5: NmsDecodeBoxes<SimdBoxDecodeYoloV5>(src, anchors, size, stride, buf, dst); break;
+            default: assert(0);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE __m256 NmsIou(__m256 ax0, __m256 ay0, __m256 ax1, __m256 ay1, __m256 aArea, __m256 bx0, __m256 by0, __m256 bx1, __m256 by1, __m256 bArea)
+        {
+            __m256 _0 = _mm256_setzero_ps();
+            __m256 w = _mm256_max_ps(_mm256_sub_ps(_mm256_min_ps(ax1, bx1), _mm256_max_ps(ax0, bx0)), _0);
+            __m256 h = _mm256_max_ps(_mm256_sub_ps(_mm256_min_ps(ay1, by1), _mm256_max_ps(ay0, by0)), _0);
+            __m256 inter = _mm256_mul_ps(w, h);
+            __m256 uni = _mm256_sub_ps(_mm256_add_ps(aArea, bArea), inter);
+            return _mm256_and_ps(_mm256_div_ps(inter, uni), _mm256_cmp_ps(uni, _0, _CMP_GT_OQ));
+        }
+
+        void NmsIou32f(const float* boxes, size_t stride, size_t size, const float* box, float* iou)
+        {
+            const float* x0 = boxes + 0 * stride, * y0 = boxes + 1 * stride, * x1 = boxes + 2 * stride, * y1 = boxes + 3 * stride;
+            __m256 ax0 = _mm256_set1_ps(box[0]), ay0 = _mm256_set1_ps(box[1]), ax1 = _mm256_set1_ps(box[2]), ay1 = _mm256_set1_ps(box[3]);
+            __m256 aArea = _mm256_set1_ps((box[2] - box[0]) * (box[3] - box[1]));
+            size_t sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeF; i += F)
+            {
+                __m256 bx0 = _mm256_loadu_ps(x0 + i), by0 = _mm256_loadu_ps(y0 + i), bx1 = _mm256_loadu_ps(x1 + i), by1 = _mm256_loadu_ps(y1 + i);
+                __m256 bArea = _mm256_mul_ps(_mm256_sub_ps(bx1, bx0), _mm256_sub_ps(by1, by0));
+                _mm256_storeu_ps(iou + i, NmsIou(ax0, ay0, ax1, ay1, aArea, bx0, by0, bx1, by1, bArea));
+            }
+            if (i < size)
+                Base::NmsIou32f(boxes + i, stride, size - i, box, iou + i);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        size_t NmsFilter(const float* scores, size_t size, float threshold, uint32_t* idx)
+        {
+            __m256 _threshold = _mm256_set1_ps(threshold);
+            size_t sizeF = AlignLo(size, F), i = 0, count = 0;
+            for (; i < sizeF; i += F)
+            {
+                int mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(scores + i), _threshold, _CMP_GT_OQ));
+                for (; mask; mask &= mask - 1)
+                    idx[count++] = uint32_t(i + _tzcnt_u32(mask));
+            }
+            for (; i < size; ++i)
+                if (scores[i] > threshold)
+                    idx[count++] = (uint32_t)i;
+            return count;
+        }
+
+        template<SimdNmsType type> SIMD_INLINE void NmsSuppress(const Base::NmsBoxes& boxes, size_t i, __m256 ax0, __m256 ay0, __m256 ax1, __m256 ay1, 
+            __m256 aArea, __m256i aCls, __m256 threshold, float sigma)
+        {
+            __m256 iou = NmsIou(ax0, ay0, ax1, ay1, aArea, _mm256_loadu_ps(boxes.x0 + i), _mm256_loadu_ps(boxes.y0 + i), 
+                _mm256_loadu_ps(boxes.x1 + i), _mm256_loadu_ps(boxes.y1 + i), _mm256_loadu_ps(boxes.area + i));
+            __m256 same = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_loadu_si256((__m256i*)(boxes.cls + i)), aCls));
+            __m256 score = _mm256_loadu_ps(boxes.score + i);
+            if (type == SimdNmsHard)
+                score = _mm256_blendv_ps(score, _mm256_set1_ps(-FLT_MAX), _mm256_and_ps(same, _mm256_cmp_ps(iou, threshold, _CMP_GT_OQ)));
+            else if (type == SimdNmsSoftLinear)
+                score = _mm256_blendv_ps(score, _mm256_mul_ps(score, _mm256_sub_ps(_mm256_set1_ps(1.0f), iou)), _mm256_and_ps(same, _mm256_cmp_ps(iou, threshold, _CMP_GT_OQ)));
+            else
+            {
+                float _iou[F], _score[F];
+                _mm256_storeu_ps(_iou, iou);
+                _mm256_storeu_ps(_score, score);
+                int mask = _mm256_movemask_ps(same);
+                for (size_t j = 0; j < F; ++j)
+                    if (mask & (1 << j))
+                        _score[j] = Base::NmsDecay(_score[j], _iou[j], type, 0.0f, sigma);
+                score = _mm256_loadu_ps(_score);
+            }
+            _mm256_storeu_ps(boxes.score + i, score);
+        }
+
+        template<SimdNmsType type> void NmsSuppress(const Base::NmsBoxes& boxes, size_t curr, size_t begin, size_t end, float threshold, float sigma)
+        {
+            __m256 ax0 = _mm256_set1_ps(boxes.x0[curr]), ay0 = _mm256_set1_ps(boxes.y0[curr]), ax1 = _mm256_set1_ps(boxes.x1[curr]), ay1 = _mm256_set1_ps(boxes.y1[curr]);
+            __m256 aArea = _mm256_set1_ps(boxes.area[curr]), _threshold = _mm256_set1_ps(threshold);
+            __m256i aCls = _mm256_set1_epi32(boxes.cls[curr]);
+            size_t endF = begin + AlignLo(end - begin, F), i = begin;
+            for (; i < endF; i += F)
+                NmsSuppress<type>(boxes, i, ax0, ay0, ax1, ay1, aArea, aCls, _threshold, sigma);
+            if (i < end)
+                Base::NmsSuppress(boxes, curr, i, end, type, threshold, sigma);
+        }
+
+        void NmsSuppress(const Base::NmsBoxes& boxes, size_t curr, size_t begin, size_t end, SimdNmsType type, float threshold, float sigma)
+        {
+            switch (type)
+            {
+            case SimdNmsHard: NmsSuppress<SimdNmsHard>(boxes, curr, begin, end, threshold, sigma); break;
+            case SimdNmsSoftLinear: NmsSuppress<SimdNmsSoftLinear>(boxes, curr, begin, end, threshold, sigma); break;
+            case SimdNmsSoftGaussian: NmsSuppress<SimdNmsSoftGaussian>(boxes, curr, begin, end, threshold, sigma); break;
+            default: assert(0);
+            }
+        }
+
+        size_t Nms32f(const float* boxes, size_t stride, const float* scores, const uint32_t* classes, size_t size, float scoreThreshold, size_t topK,
+            SimdNmsType type, float iouThreshold, float sigma, size_t keepTopK, uint32_t* indices, float* outScores)
+        {
+            return Base::NmsRun(boxes, stride, scores, classes, size, scoreThreshold, topK, type, iouThreshold, sigma, keepTopK, indices, outScores, NmsFilter, NmsSuppress);
+        }
+    }
+#endif
+}
@@ -24,6 +24,7 @@
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdStore.h"
 #include "Simd/SimdCompare.h"
+#include "Simd/SimdSegmentation.h"
 
 namespace Simd
 {
@@ -204,7 +205,7 @@ namespace Simd
         void SegmentationShrinkRegion(const uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t index,
             ptrdiff_t * left, ptrdiff_t * top, ptrdiff_t * right, ptrdiff_t * bottom)
         {
-            assert(*right - *left >= A && *bottom > *top);
+            assert(*right - *left >= (ptrdiff_t)A && *bottom > *top);
             assert(*left >= 0 && *right <= (ptrdiff_t)width && *top >= 0 && *bottom <= (ptrdiff_t)height);
 
             size_t fullWidth = *right - *left;
@@ -277,6 +278,51 @@ namespace Simd
                 }
             }
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE uint32_t SegmentationBits32(const uint8_t* mask, __m256i index)
+        {
+            return _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((__m256i*)mask), index));
+        }
+
+        SIMD_INLINE void SegmentationRunsBits(uint32_t bits, int32_t x, bool& in, int32_t*& runs)
+        {
+            uint32_t edges = bits ^ ((bits << 1) | uint32_t(in ? 1 : 0));
+            for (; edges; edges &= edges - 1)
+                *runs++ = x + (int32_t)_tzcnt_u32(edges);
+            in = (bits >> 31) != 0;
+        }
+
+        static size_t SegmentationRuns(const uint8_t* mask, size_t width, uint8_t index, int32_t* runs)
+        {
+            int32_t* dst = runs;
+            bool in = false;
+            __m256i _index = _mm256_set1_epi8(index);
+            size_t widthA = AlignLo(width, A), x = 0;
+            for (; x < widthA; x += A)
+            {
+                uint32_t bits = SegmentationBits32(mask + x, _index);
+                if (bits != (in ? uint32_t(-1) : 0))
+                    SegmentationRunsBits(bits, (int32_t)x, in, dst);
+            }
+            Base::SegmentationRunsBytes(mask + x, width - x, index, (int32_t)x, in, dst);
+            if (in)
+                *dst++ = (int32_t)width;
+            return (dst - runs) / 2;
+        }
+
+        SegmentationComponentLabeler::SegmentationComponentLabeler()
+        {
+            _runs = SegmentationRuns;
+        }
+
+        size_t SegmentationLabelComponents(const uint8_t* mask, size_t maskStride, size_t width, size_t height, uint8_t index,
+            SimdSegmentationConnectivityType connectivity, uint32_t* labels, size_t labelsStride, SimdSegmentationComponent** components)
+        {
+            SegmentationComponentLabeler labeler;
+            return labeler.Run(mask, maskStride, width, height, index, connectivity, labels, labelsStride, components);
+        }
     }
 #endif//SIMD_AVX2_ENABLE
 }
@@ -0,0 +1,200 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetPreprocess.h"
+#include "Simd/SimdSynetPreprocessCommon.h"
+#include "Simd/SimdAvx2.h"
+#include "Simd/SimdLoad.h"
+#include "Simd/SimdStore.h"
+
+namespace Simd
+{
+#if defined(SIMD_AVX2_ENABLE) && defined(SIMD_SYNET_ENABLE)    
+    namespace Avx2
+    {
+        static void ResizeRowNearest(const float* src, size_t srcStride, size_t channels, const int32_t* idx, const float*, size_t width, float* dst, size_t dstStride)
+        {
+            size_t widthF = AlignLo(width, F);
+            for (size_t c = 0; c < channels; ++c)
+            {
+                size_t x = 0;
+                for (; x < widthF; x += F)
+                    _mm256_storeu_ps(dst + x, _mm256_i32gather_ps(src, _mm256_loadu_si256((__m256i*)(idx + x)), 4));
+                for (; x < width; ++x)
+                    dst[x] = src[idx[x]];
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        static void ResizeRowBilinear(const float* src, size_t srcStride, size_t channels, const int32_t* idx, const float* alpha, size_t width, float* dst, size_t dstStride)
+        {
+            size_t widthF = AlignLo(width, F);
+            for (size_t c = 0; c < channels; ++c)
+            {
+                size_t x = 0;
+                for (; x < widthF; x += F)
+                {
+                    __m256i _idx = _mm256_loadu_si256((__m256i*)(idx + x));
+                    __m256 s0 = _mm256_i32gather_ps(src + 0, _idx, 4);
+                    __m256 s1 = _mm256_i32gather_ps(src + 1, _idx, 4);
+                    _mm256_storeu_ps(dst + x, _mm256_fmadd_ps(_mm256_sub_ps(s1, s0), _mm256_loadu_ps(alpha + x), s0));
+                }
+                for (; x < width; ++x)
+                {
+                    const float* s = src + idx[x];
+                    dst[x] = s[0] + (s[1] - s[0]) * alpha[x];
+                }
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<SimdTensorDataType type> SIMD_INLINE void Store(uint8_t* dst, size_t index, __m256 value);
+
+        template<> SIMD_INLINE void Store<SimdTensorData32f>(uint8_t* dst, size_t index, __m256 value)
+        {
+            _mm256_storeu_ps((float*)dst + index, value);
+        }
+
+        template<> SIMD_INLINE void Store<SimdTensorData16b>(uint8_t* dst, size_t index, __m256 value)
+        {
+            __m256i bf16 = Float32ToBFloat16(value);
+            _mm_storeu_si128((__m128i*)((uint16_t*)dst + index), _mm_packus_epi32(_mm256_castsi256_si128(bf16), _mm256_extracti128_si256(bf16, 1)));
+        }
+
+        template<> SIMD_INLINE void Store<SimdTensorData8u>(uint8_t* dst, size_t index, __m256 value)
+        {
+            __m256i i32 = _mm256_cvtps_epi32(value);
+            __m128i i16 = _mm_packs_epi32(_mm256_castsi256_si128(i32), _mm256_extracti128_si256(i32, 1));
+            _mm_storel_epi64((__m128i*)(dst + index), _mm_packus_epi16(i16, Sse41::K_ZERO));
+        }
+
+        SIMD_INLINE __m256 Normalize(const float* src0, const float* src1, __m256 alpha, __m256 scale, __m256 shift)
+        {
+            __m256 s0 = _mm256_loadu_ps(src0);
+            __m256 value = _mm256_fmadd_ps(_mm256_sub_ps(_mm256_loadu_ps(src1), s0), alpha, s0);
+            return _mm256_fmadd_ps(value, scale, shift);
+        }
+
+        template<SimdTensorDataType type> void NormalizeRowNchw(const float* src0, const float* src1, size_t srcStride, float alpha, size_t width, size_t channels,
+            const float* scale, const float* shift, uint8_t* dst, size_t dstStride)
+        {
+            size_t widthF = AlignLo(width, F);
+            __m256 _alpha = _mm256_set1_ps(alpha);
+            for (size_t c = 0, o = 0; c < channels; ++c, o += dstStride)
+            {
+                __m256 _scale = _mm256_set1_ps(scale[c]);
+                __m256 _shift = _mm256_set1_ps(shift[c]);
+                size_t x = 0;
+                for (; x < widthF; x += F)
+                    Store<type>(dst, o + x, Normalize(src0 + x, src1 + x, _alpha, _scale, _shift));
+                for (; x < width; ++x)
+                    Base::SynetPreprocessNormalize<type>(src0 + x, src1 + x, alpha, scale[c], shift[c], dst, o + x);
+                src0 += srcStride;
+                src1 += srcStride;
+            }
+        }
+
+        template<SimdTensorDataType type> void NormalizeRowNhwc3(const float* src0, const float* src1, size_t srcStride, float alpha, size_t width, size_t,
+            const float* scale, const float* shift, uint8_t* dst, size_t)
+        {
+            size_t widthF = AlignLo(width, F), x = 0;
+            __m256 _alpha = _mm256_set1_ps(alpha), _scale[3], _shift[3];
+            for (size_t c = 0; c < 3; ++c)
+            {
+                _scale[c] = _mm256_set1_ps(scale[c]);
+                _shift[c] = _mm256_set1_ps(shift[c]);
+            }
+            for (; x < widthF; x += F)
+            {
+                __m256 b = Normalize(src0 + 0 * srcStride + x, src1 + 0 * srcStride + x, _alpha, _scale[0], _shift[0]);
+                __m256 g = Normalize(src0 + 1 * srcStride + x, src1 + 1 * srcStride + x, _alpha, _scale[1], _shift[1]);
+                __m256 r = Normalize(src0 + 2 * srcStride + x, src1 + 2 * srcStride + x, _alpha, _scale[2], _shift[2]);
+                __m256 bgLo = _mm256_unpacklo_ps(b, g), bgHi = _mm256_unpackhi_ps(b, g);
+                __m256 bgr0 = _mm256_shuffle_ps(bgLo, _mm256_shuffle_ps(r, bgLo, 0xA0), 0x84);
+                __m256 bgr1 = _mm256_shuffle_ps(_mm256_shuffle_ps(bgLo, r, 0x5F), bgHi, 0x48);
+                __m256 bgr2 = _mm256_shuffle_ps(_mm256_shuffle_ps(r, bgHi, 0xAA), _mm256_shuffle_ps(bgHi, r, 0xFF), 0x88);
+                Store<type>(dst, 3 * x + 0 * F, _mm256_permute2f128_ps(bgr0, bgr1, 0x20));
+                Store<type>(dst, 3 * x + 1 * F, _mm256_permute2f128_ps(bgr2, bgr0, 0x30));
+                Store<type>(dst, 3 * x + 2 * F, _mm256_permute2f128_ps(bgr1, bgr2, 0x31));
+            }
+            for (; x < width; ++x)
+                for (size_t c = 0, s = x; c < 3; ++c, s += srcStride)
+                    Base::SynetPreprocessNormalize<type>(src0 + s, src1 + s, alpha, scale[c], shift[c], dst, 3 * x + c);
+        }
+
+        template<SimdTensorDataType type> Base::SynetPreprocessBand::NormalizeRowPtr GetNormalizeRow(const SynetPreprocessParam& p)
+        {
+            return p.dstFormat == SimdTensorFormatNchw || p.channels == 1 ? NormalizeRowNchw<type> : NormalizeRowNhwc3<type>;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SynetPreprocessBand::SynetPreprocessBand(const SynetPreprocessParam& param)
+            : Sse41::SynetPreprocessBand(param)
+        {
+            const SynetPreprocessParam& p = _param;
+            if (p.srcW >= A)
+                _setInput = SynetSetInput;
+            if (p.srcW >= DA)
+            {
+                _deinterleaveUv = DeinterleaveUv;
+                _yuv420pToBgr = Yuv420pToBgrV2;
+            }
+            _resizeRow = p.IsNearest() || p.srcW == 1 ? ResizeRowNearest : ResizeRowBilinear;
+            switch (p.dstType)
+            {
+            case SimdTensorData32f: _normalizeRow = GetNormalizeRow<SimdTensorData32f>(p); break;
+            case SimdTensorData16b: _normalizeRow = GetNormalizeRow<SimdTensorData16b>(p); break;
+            case SimdTensorData8u: _normalizeRow = GetNormalizeRow<SimdTensorData8u>(p); break;
+            default:
+                assert(0);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetPreprocessInit(size_t srcW, size_t srcH, SimdPixelFormatType srcFormat, size_t dstW, size_t dstH, size_t channels,
+            SimdResizeMethodType method, const float* mean, const float* std, SimdTensorFormatType dstFormat, SimdTensorDataType dstType)
+        {
+            SynetPreprocessParam param(srcW, srcH, srcFormat, dstW, dstH, channels, method, mean, std, dstFormat, dstType);
+            if (!param.Valid())
+                return NULL;
+            return new SynetPreprocessBand(param);
+        }
+
+        void* SynetPreprocessYuv420Init(size_t srcW, size_t srcH, SimdYuvType yuvType, SimdBool nv12, SimdBool isRgb, size_t dstW, size_t dstH,
+            SimdResizeMethodType method, const float* mean, const float* std, SimdTensorFormatType dstFormat, SimdTensorDataType dstType)
+        {
+            SynetPreprocessParam param(srcW, srcH, isRgb ? SimdPixelFormatRgb24 : SimdPixelFormatBgr24, dstW, dstH, 3,
+                method, mean, std, dstFormat, dstType, yuvType, nv12 == SimdTrue);
+            if (!param.IsYuv() || !param.Valid())
+                return NULL;
+            return new SynetPreprocessBand(param);
+        }
+    }
+#endif
+}
@@ -0,0 +1,167 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetTopK.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdBFloat16.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdSse41.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#if defined(SIMD_AVX2_ENABLE) && defined(SIMD_SYNET_ENABLE)   
+    namespace Avx2
+    {
+        template<bool max> SIMD_INLINE __m256 Better(__m256 a, __m256 b)
+        {
+            return max ? _mm256_cmp_ps(a, b, _CMP_GT_OQ) : _mm256_cmp_ps(a, b, _CMP_LT_OQ);
+        }
+
+        template<bool max> int32_t ArgExtremum(const float* src, size_t count)
+        {
+            size_t countF = AlignLo(count, F), i = 0;
+            __m256 best = _mm256_set1_ps(src[0]);
+            __m256i index = _mm256_setzero_si256(), curr = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), step = _mm256_set1_epi32(F);
+            for (; i < countF; i += F)
+            {
+                __m256 value = _mm256_loadu_ps(src + i);
+                __m256 mask = Better<max>(value, best);
+                best = _mm256_blendv_ps(best, value, mask);
+                index = _mm256_blendv_epi8(index, curr, _mm256_castps_si256(mask));
+                curr = _mm256_add_epi32(curr, step);
+            }
+            float bests[F];
+            int32_t indices[F];
+            _mm256_storeu_ps(bests, best);
+            _mm256_storeu_si256((__m256i*)indices, index);
+            float value = bests[0];
+            int32_t result = indices[0];
+            for (size_t j = 1; j < F; ++j)
+            {
+                if (Base::SynetTopKBetter<max>(bests[j], value) || (bests[j] == value && indices[j] < result))
+                {
+                    value = bests[j];
+                    result = indices[j];
+                }
+            }
+            for (; i < count; ++i)
+            {
+                if (Base::SynetTopKBetter<max>(src[i], value))
+                {
+                    value = src[i];
+                    result = (int32_t)i;
+                }
+            }
+            return result;
+        }
+
+        template<bool max> void ArgExtremum(const float* src, size_t count, size_t inner, int32_t* dst)
+        {
+            size_t innerF = AlignLo(inner, F), i = 0;
+            for (; i < innerF; i += F)
+            {
+                const float* ps = src + i;
+                __m256 best = _mm256_loadu_ps(ps);
+                __m256i index = _mm256_setzero_si256();
+                for (size_t c = 1; c < count; ++c)
+                {
+                    ps += inner;
+                    __m256 value = _mm256_loadu_ps(ps);
+                    __m256 mask = Better<max>(value, best);
+                    best = _mm256_blendv_ps(best, value, mask);
+                    index = _mm256_blendv_epi8(index, _mm256_set1_epi32((int)c), _mm256_castps_si256(mask));
+                }
+                _mm256_storeu_si256((__m256i*)(dst + i), index);
+            }
+            for (; i < inner; ++i)
+                dst[i] = Base::SynetArgExtremum<max>(src + i, count, inner);
+        }
+
+        template<bool max> void SynetArgExtremum32f(const float* src, size_t outer, size_t count, size_t inner, int32_t* dst)
+        {
+            for (size_t o = 0; o < outer; ++o)
+            {
+                if (inner == 1)
+                    dst[0] = ArgExtremum<max>(src, count);
+                else
+                    ArgExtremum<max>(src, count, inner, dst);
+                src += count * inner;
+                dst += inner;
+            }
+        }
+
+        void SynetArgMax32f(const float* src, size_t outer, size_t count, size_t inner, int32_t* dst)
+        {
+            SynetArgExtremum32f<true>(src, outer, count, inner, dst);
+        }
+
+        void SynetArgMin32f(const float* src, size_t outer, size_t count, size_t inner, int32_t* dst)
+        {
+            SynetArgExtremum32f<false>(src, outer, count, inner, dst);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<bool max> void SynetTopKRow(const float* src, size_t count, size_t k, float* val, int32_t* idx)
+        {
+            Base::SynetTopKInit<max>(src, k, val, idx);
+            size_t i = k, count4F = k + AlignLo(count - k, 4 * F), countF = k + AlignLo(count - k, F);
+            __m256 threshold = _mm256_set1_ps(val[k - 1]);
+            for (; i < count4F; i += 4 * F)
+            {
+                __m256 mask0 = Better<max>(_mm256_loadu_ps(src + i + 0 * F), threshold);
+                __m256 mask1 = Better<max>(_mm256_loadu_ps(src + i + 1 * F), threshold);
+                __m256 mask2 = Better<max>(_mm256_loadu_ps(src + i + 2 * F), threshold);
+                __m256 mask3 = Better<max>(_mm256_loadu_ps(src + i + 3 * F), threshold);
+                if (_mm256_movemask_ps(_mm256_or_ps(_mm256_or_ps(mask0, mask1), _mm256_or_ps(mask2, mask3))))
+                {
+                    Base::SynetTopKUpdate<max>(src, i, i + 4 * F, k, val, idx);
+                    threshold = _mm256_set1_ps(val[k - 1]);
+                }
+            }
+            for (; i < countF; i += F)
+            {
+                if (_mm256_movemask_ps(Better<max>(_mm256_loadu_ps(src + i), threshold)))
+                {
+                    Base::SynetTopKUpdate<max>(src, i, i + F, k, val, idx);
+                    threshold = _mm256_set1_ps(val[k - 1]);
+                }
+            }
+            Base::SynetTopKUpdate<max>(src, i, count, k, val, idx);
+        }
+
+        void SynetTopK32f(const float* src, size_t outer, size_t count, size_t inner, size_t k, SimdBool largest, SimdBool sorted, float* dstVal, int32_t* dstIdx)
+        {
+            Base::SynetTopKRowPtr topKRow = largest ? SynetTopKRow<true> : SynetTopKRow<false>;
+            Base::SynetTopK(src, SimdTensorData32f, outer, count, inner, k, largest, sorted, dstVal, dstIdx, topKRow, NULL);
+        }
+
+        void SynetTopK16b(const uint16_t* src, size_t outer, size_t count, size_t inner, size_t k, SimdBool largest, SimdBool sorted, uint16_t* dstVal, int32_t* dstIdx)
+        {
+            Base::SynetTopKRowPtr topKRow = largest ? SynetTopKRow<true> : SynetTopKRow<false>;
+            Base::SynetTopK(src, SimdTensorData16b, outer, count, inner, k, largest, sorted, dstVal, dstIdx, topKRow, BFloat16ToFloat32);
+        }
+    }
+#endif
+}
@@ -0,0 +1,139 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdCanny.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        SIMD_INLINE __m512i LoadU8(const uint8_t* src, __mmask32 tail)
+        {
+            return _mm512_cvtepu8_epi16(_mm256_maskz_loadu_epi8(tail, src));
+        }
+
+        SIMD_INLINE void CannyGradient(const uint8_t* src0, const uint8_t* src1, const uint8_t* src2, size_t x, int16_t* dx, int16_t* dy, int16_t* mag, __mmask32 tail = -1)
+        {
+            __m512i s00 = LoadU8(src0 + x - 1, tail), s01 = LoadU8(src0 + x, tail), s02 = LoadU8(src0 + x + 1, tail);
+            __m512i s10 = LoadU8(src1 + x - 1, tail), s12 = LoadU8(src1 + x + 1, tail);
+            __m512i s20 = LoadU8(src2 + x - 1, tail), s21 = LoadU8(src2 + x, tail), s22 = LoadU8(src2 + x + 1, tail);
+            __m512i _dx = _mm512_sub_epi16(_mm512_add_epi16(_mm512_add_epi16(s02, s22), _mm512_slli_epi16(s12, 1)), _mm512_add_epi16(_mm512_add_epi16(s00, s20), _mm512_slli_epi16(s10, 1)));
+            __m512i _dy = _mm512_sub_epi16(_mm512_add_epi16(_mm512_add_epi16(s20, s22), _mm512_slli_epi16(s21, 1)), _mm512_add_epi16(_mm512_add_epi16(s00, s02), _mm512_slli_epi16(s01, 1)));
+            _mm512_mask_storeu_epi16(dx + x, tail, _dx);
+            _mm512_mask_storeu_epi16(dy + x, tail, _dy);
+            _mm512_mask_storeu_epi16(mag + x, tail, _mm512_add_epi16(_mm512_abs_epi16(_dx), _mm512_abs_epi16(_dy)));
+        }
+
+        static void CannyGradientRow(const uint8_t* src0, const uint8_t* src1, const uint8_t* src2, size_t width, int16_t* dx, int16_t* dy, int16_t* mag)
+        {
+            if (width < 2)
+            {
+                Base::CannyGradientRow(src0, src1, src2, width, dx, dy, mag);
+                return;
+            }
+            Base::CannyGradient(src0, src1, src2, 0, 0, 1, dx, dy, mag);
+            size_t x = 1;
+            for (; x + HA < width; x += HA)
+                CannyGradient(src0, src1, src2, x, dx, dy, mag);
+            if (x < width - 1)
+                CannyGradient(src0, src1, src2, x, dx, dy, mag, TailMask32(width - 1 - x));
+            Base::CannyGradient(src0, src1, src2, width - 2, width - 1, width - 1, dx, dy, mag);
+        }
+
+        SIMD_INLINE __mmask32 CannyGreater(__m512i ax, __m512i ay, __m512i k)
+        {
+            __m512i lo = _mm512_or_si512(_mm512_cvtepu16_epi32(_mm512_castsi512_si256(ax)), _mm512_slli_epi32(_mm512_cvtepu16_epi32(_mm512_castsi512_si256(ay)), 16));
+            __m512i hi = _mm512_or_si512(_mm512_cvtepu16_epi32(_mm512_extracti64x4_epi64(ax, 1)), _mm512_slli_epi32(_mm512_cvtepu16_epi32(_mm512_extracti64x4_epi64(ay, 1)), 16));
+            __mmask16 _lo = _mm512_cmpgt_epi32_mask(_mm512_madd_epi16(lo, k), _mm512_setzero_si512());
+            __mmask16 _hi = _mm512_cmpgt_epi32_mask(_mm512_madd_epi16(hi, k), _mm512_setzero_si512());
+            return __mmask32(_lo) | (__mmask32(_hi) << 16);
+        }
+
+        SIMD_INLINE void CannyNonMax(const int16_t* dx, const int16_t* dy, const int16_t* mag0, const int16_t* mag1, const int16_t* mag2,
+            size_t x, __m512i low, __m512i high, __m512i kHor, __m512i kVer, uint8_t* map, __mmask32 tail = -1)
+        {
+            __m512i _dx = _mm512_maskz_loadu_epi16(tail, dx + x);
+            __m512i _dy = _mm512_maskz_loadu_epi16(tail, dy + x);
+            __m512i m = _mm512_maskz_loadu_epi16(tail, mag1 + x);
+            __m512i ax = _mm512_abs_epi16(_dx), ay = _mm512_abs_epi16(_dy);
+            __mmask32 hor = CannyGreater(ax, ay, kHor);
+            __mmask32 ver = CannyGreater(ax, ay, kVer);
+            __mmask32 neg = _mm512_movepi16_mask(_mm512_xor_si512(_dx, _dy));
+            __mmask32 hMax = _mm512_cmpgt_epi16_mask(m, _mm512_maskz_loadu_epi16(tail, mag1 + x - 1)) & _mm512_cmpge_epi16_mask(m, _mm512_maskz_loadu_epi16(tail, mag1 + x + 1));
+            __mmask32 vMax = _mm512_cmpgt_epi16_mask(m, _mm512_maskz_loadu_epi16(tail, mag0 + x)) & _mm512_cmpge_epi16_mask(m, _mm512_maskz_loadu_epi16(tail, mag2 + x));
+            __mmask32 pMax = _mm512_cmpgt_epi16_mask(m, _mm512_maskz_loadu_epi16(tail, mag0 + x - 1)) & _mm512_cmpgt_epi16_mask(m, _mm512_maskz_loadu_epi16(tail, mag2 + x + 1));
+            __mmask32 nMax = _mm512_cmpgt_epi16_mask(m, _mm512_maskz_loadu_epi16(tail, mag0 + x + 1)) & _mm512_cmpgt_epi16_mask(m, _mm512_maskz_loadu_epi16(tail, mag2 + x - 1));
+            __mmask32 max = (hor & hMax) | (ver & vMax) | (~(hor | ver) & ((neg & nMax) | (~neg & pMax)));
+            __mmask32 weak = max & _mm512_cmpgt_epi16_mask(m, low);
+            __mmask32 strong = weak & _mm512_cmpgt_epi16_mask(m, high);
+            __m512i value = _mm512_add_epi16(_mm512_maskz_set1_epi16(weak, 1), _mm512_maskz_set1_epi16(strong, 1));
+            _mm256_mask_storeu_epi8(map + x, tail, _mm512_cvtepi16_epi8(value));
+        }
+
+        static void CannyNonMaxRow(const int16_t* dx, const int16_t* dy, const int16_t* mag0, const int16_t* mag1, const int16_t* mag2, size_t width, int16_t low, int16_t high, uint8_t* map)
+        {
+            __m512i _low = _mm512_set1_epi16(low), _high = _mm512_set1_epi16(high);
+            __m512i kHor = _mm512_unpacklo_epi16(_mm512_set1_epi16(Base::CANNY_TG22_NUM), _mm512_set1_epi16(-Base::CANNY_TG22_DEN));
+            __m512i kVer = _mm512_unpacklo_epi16(_mm512_set1_epi16(-Base::CANNY_TG22_DEN), _mm512_set1_epi16(Base::CANNY_TG22_NUM));
+            size_t widthHA = AlignLo(width, HA);
+            for (size_t x = 0; x < widthHA; x += HA)
+                CannyNonMax(dx, dy, mag0, mag1, mag2, x, _low, _high, kHor, kVer, map);
+            if (widthHA < width)
+                CannyNonMax(dx, dy, mag0, mag1, mag2, widthHA, _low, _high, kHor, kVer, map, TailMask32(width - widthHA));
+        }
+
+        static void CannyEdgesRow(const uint8_t* map, size_t width, uint8_t* dst)
+        {
+            __m512i strong = _mm512_set1_epi8(2);
+            size_t widthA = AlignLo(width, A);
+            for (size_t x = 0; x < widthA; x += A)
+                _mm512_storeu_si512(dst + x, _mm512_movm_epi8(_mm512_cmpeq_epi8_mask(_mm512_loadu_si512(map + x), strong)));
+            if (widthA < width)
+            {
+                __mmask64 tail = TailMask64(width - widthA);
+                _mm512_mask_storeu_epi8(dst + widthA, tail, _mm512_movm_epi8(_mm512_cmpeq_epi8_mask(_mm512_maskz_loadu_epi8(tail, map + widthA), strong)));
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        CannyEdgeDetector::CannyEdgeDetector()
+        {
+            _gradient = CannyGradientRow;
+            _nonMax = CannyNonMaxRow;
+            _edges = CannyEdgesRow;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void Canny(const uint8_t* src, size_t srcStride, size_t width, size_t height, int lowThreshold, int highThreshold, uint8_t* dst, size_t dstStride)
+        {
+            CannyEdgeDetector detector;
+            detector.Run(src, srcStride, width, height, lowThreshold, highThreshold, dst, dstStride);
+        }
+    }
+#endif
+}
@@ -145,6 +145,26 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        ImageQoiLoader::ImageQoiLoader(const ImageLoaderParam& param)
+            : Avx2::ImageQoiLoader(param)
+        {
+        }
+
+        void ImageQoiLoader::SetConverters()
+        {
+            Avx2::ImageQoiLoader::SetConverters();
+            switch (_param.format)
+            {
+            case SimdPixelFormatGray8: _toAny = Avx512bw::RgbaToGray; break;
+            case SimdPixelFormatBgr24: _toAny = Avx512bw::BgraToRgb; break;
+            case SimdPixelFormatBgra32: _toAny = Avx512bw::BgraToRgba; break;
+            case SimdPixelFormatRgb24: _toAny = Avx512bw::BgraToBgr; break;
+            default: break;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
         ImageLoader* CreateImageLoader(const ImageLoaderParam& param)
         {
             switch (param.file)
@@ -153,9 +173,11 @@ namespace Simd
             case SimdImageFilePgmBin: return new ImagePgmBinLoader(param);
             case SimdImageFilePpmTxt: return new ImagePpmTxtLoader(param);
             case SimdImageFilePpmBin: return new ImagePpmBinLoader(param);
-            case SimdImageFilePng: return new Sse41::ImagePngLoader(param);
-            case SimdImageFileJpeg: return new Avx2::ImageJpegLoader(param);
+            case SimdImageFilePng: return new ImagePngLoader(param);
+            case SimdImageFileJpeg: return new ImageJpegLoader(param);
             case SimdImageFileBmp: return new ImageBmpLoader(param);
+            case SimdImageFileQoi: return new ImageQoiLoader(param);
+            case SimdImageFileRaw: return new Base::ImageRawLoader(param);
             default:
                 return NULL;
             }
@@ -175,6 +197,67 @@ namespace Simd
             }
             return NULL;
         }
+
+        uint8_t* ImageLoadFromMemoryScaled(const uint8_t* data, size_t size, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format)
+        {
+            ImageLoaderParam param(data, size, *format, scale);
+            if (param.Validate())
+            {
+                Holder<ImageLoader> loader(CreateImageLoader(param));
+                if (loader)
+                {
+                    if (loader->FromStream())
+                        return loader->Release(stride, width, height, format);
+                }
+            }
+            return NULL;
+        }
+
+        bool ImageLoadBandsFromMemory(const uint8_t* data, size_t size, SimdPixelFormatType format, SimdImageBandCallbackPtr callback, void* user)
+        {
+            ImageLoaderParam param(data, size, format);
+            if (param.Validate() && callback)
+            {
+                Holder<ImageLoader> loader(CreateImageLoader(param));
+                if (loader)
+                    return loader->ToBands(callback, user);
+            }
+            return false;
+        }
+
+        uint8_t* ImageLoadRoiFromMemory(const uint8_t* data, size_t size, size_t left, size_t top, size_t right, size_t bottom, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format)
+        {
+            ImageLoaderParam param(data, size, *format);
+            if (param.Validate())
+            {
+                Holder<ImageLoader> loader(CreateImageLoader(param));
+                if (loader)
+                {
+                    if (loader->FromStreamRoi(left, top, right, bottom))
+                        return loader->Release(stride, width, height, format);
+                }
+            }
+            return NULL;
+        }
+
+        uint8_t* JpegLoadAsYuvFromMemory(const uint8_t* data, size_t size, SimdYuvLayoutType layout, size_t* width, size_t* height, uint8_t** planes, size_t* strides)
+        {
+            ImageLoaderParam param(data, size, SimdPixelFormatBgra32);
+            if (param.Validate() && param.file == SimdImageFileJpeg)
+            {
+                ImageJpegLoader loader(param);
+                return loader.ToYuv(layout, width, height, planes, strides);
+            }
+            return NULL;
+        }
+
+        void* JpegStreamDecoderInit(SimdPixelFormatType format, size_t frames)
+        {
+            if (!Base::JpegStreamDecoder::Valid(format, frames))
+                return NULL;
+            ImageLoaderParam param(NULL, 0, format);
+            return new Base::JpegStreamDecoder(new ImageJpegLoader(param), frames);
+        }
     }
 #endif
 }
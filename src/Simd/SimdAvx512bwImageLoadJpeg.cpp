@@ -0,0 +1,340 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdImageLoadJpeg.h"
+#include "Simd/SimdImageLoadJpegCommon.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdAvx2.h"
+#include "Simd/SimdAvx512bw.h"
+#include "Simd/SimdSet.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdYuvToBgr.h"
+#include "Simd/SimdInterleave.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        static void JpegIdctBlocks2(const int16_t* src, uint8_t* dst, int stride)
+        {
+#define SIMD_JPEG_IDCT_TYPE __m256i
+#define SIMD_JPEG_IDCT_OP(op) _mm256_##op
+#define SIMD_JPEG_IDCT_ZERO _mm256_setzero_si256()
+
+#define dct_load(row) \
+      _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)(src + row * 8))), \
+         _mm_loadu_si128((const __m128i*)(src + 64 + row * 8)), 1)
+
+#define dct_store(p, row) \
+      p = _mm256_permute4x64_epi64(p, 0xD8); \
+      _mm_storeu_si128((__m128i*)(dst + (row + 0) * stride), _mm256_castsi256_si128(p)); \
+      _mm_storeu_si128((__m128i*)(dst + (row + 1) * stride), _mm256_extracti128_si256(p, 1))
+
+            __m256i row0, row1, row2, row3, row4, row5, row6, row7;
+            __m256i tmp;
+
+            const __m256i rot0_0 = Avx2::SetInt16(Base::JpegIdctK00, Base::JpegIdctK00 + Base::JpegIdctK01);
+            const __m256i rot0_1 = Avx2::SetInt16(Base::JpegIdctK00 + Base::JpegIdctK02, Base::JpegIdctK00);
+            const __m256i rot1_0 = Avx2::SetInt16(Base::JpegIdctK03 + Base::JpegIdctK08, Base::JpegIdctK03);
+            const __m256i rot1_1 = Avx2::SetInt16(Base::JpegIdctK03, Base::JpegIdctK03 + Base::JpegIdctK09);
+            const __m256i rot2_0 = Avx2::SetInt16(Base::JpegIdctK10 + Base::JpegIdctK04, Base::JpegIdctK10);
+            const __m256i rot2_1 = Avx2::SetInt16(Base::JpegIdctK10, Base::JpegIdctK10 + Base::JpegIdctK06);
+            const __m256i rot3_0 = Avx2::SetInt16(Base::JpegIdctK11 + Base::JpegIdctK05, Base::JpegIdctK11);
+            const __m256i rot3_1 = Avx2::SetInt16(Base::JpegIdctK11, Base::JpegIdctK11 + Base::JpegIdctK07);
+            const __m256i bias_0 = _mm256_set1_epi32(512);
+            const __m256i bias_1 = _mm256_set1_epi32(65536 + (128 << 17));
+            row0 = dct_load(0);
+            row1 = dct_load(1);
+            row2 = dct_load(2);
+            row3 = dct_load(3);
+            row4 = dct_load(4);
+            row5 = dct_load(5);
+            row6 = dct_load(6);
+            row7 = dct_load(7);
+            SIMD_JPEG_IDCT_PASS(bias_0, 10);
+            SIMD_JPEG_IDCT_TRANSPOSE16();
+            SIMD_JPEG_IDCT_PASS(bias_1, 17);
+            {
+                SIMD_JPEG_IDCT_PACK_TRANSPOSE8(p0, p1, p2, p3);
+                dct_store(p0, 0);
+                dct_store(p2, 2);
+                dct_store(p1, 4);
+                dct_store(p3, 6);
+            }
+
+#undef SIMD_JPEG_IDCT_TYPE
+#undef SIMD_JPEG_IDCT_OP
+#undef SIMD_JPEG_IDCT_ZERO
+#undef dct_load
+#undef dct_store
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static void JpegDequantizeBlocks(int16_t* data, const uint16_t* dequant, int count)
+        {
+            __m512i q0 = _mm512_loadu_si512(dequant + 0);
+            __m512i q1 = _mm512_loadu_si512(dequant + HA);
+            for (int b = 0; b < count; ++b, data += 64)
+            {
+                _mm512_storeu_si512(data + 0, _mm512_mullo_epi16(_mm512_loadu_si512(data + 0), q0));
+                _mm512_storeu_si512(data + HA, _mm512_mullo_epi16(_mm512_loadu_si512(data + HA), q1));
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        const __m512i K16_JPEG_PREV = SIMD_MM512_SETR_EPI16(
+            0x3F, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+            0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E);
+        const __m512i K16_JPEG_NEXT = SIMD_MM512_SETR_EPI16(
+            0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10,
+            0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20);
+
+        class JpegUpsampleHv2
+        {
+            const uint8_t* _near, * _far;
+            size_t _size, _pos;
+            __m512i _last, _prev, _curr;
+
+            SIMD_INLINE __m512i Load(size_t pos) const
+            {
+                if (pos >= _size)
+                    return _last;
+                __mmask32 mask = TailMask32(_size - pos);
+                __m512i n = _mm512_cvtepu8_epi16(_mm256_maskz_loadu_epi8(mask, _near + pos));
+                __m512i f = _mm512_cvtepu8_epi16(_mm256_maskz_loadu_epi8(mask, _far + pos));
+                return _mm512_mask_mov_epi16(_last, mask, _mm512_add_epi16(_mm512_add_epi16(n, _mm512_add_epi16(n, n)), f));
+            }
+
+        public:
+            SIMD_INLINE void Init(const uint8_t* in_near, const uint8_t* in_far, size_t size)
+            {
+                _near = in_near;
+                _far = in_far;
+                _size = size;
+                _pos = 0;
+                _last = _mm512_set1_epi16(3 * in_near[size - 1] + in_far[size - 1]);
+                _prev = _mm512_set1_epi16(3 * in_near[0] + in_far[0]);
+                _curr = Load(0);
+            }
+
+            SIMD_INLINE __m512i Next()
+            {
+                __m512i next = Load(_pos + HA);
+                __m512i curr = _mm512_add_epi16(_mm512_add_epi16(_curr, _mm512_add_epi16(_curr, _curr)), K16_0008);
+                __m512i even = _mm512_add_epi16(curr, _mm512_permutex2var_epi16(_curr, K16_JPEG_PREV, _prev));
+                __m512i odd = _mm512_add_epi16(curr, _mm512_permutex2var_epi16(_curr, K16_JPEG_NEXT, next));
+                _prev = _curr;
+                _curr = next;
+                _pos += HA;
+                return _mm512_or_si512(_mm512_srli_epi16(even, 4), _mm512_slli_epi16(_mm512_srli_epi16(odd, 4), 8));
+            }
+        };
+
+        static uint8_t* JpegResampleRowHv2(uint8_t* out, const uint8_t* in_near, const uint8_t* in_far, int w, int)
+        {
+            JpegUpsampleHv2 upsample;
+            upsample.Init(in_near, in_far, w);
+            size_t size = 2 * size_t(w), sizeA = AlignLo(size, A), i = 0;
+            for (; i < sizeA; i += A)
+                _mm512_storeu_si512(out + i, upsample.Next());
+            if (i < size)
+                _mm512_mask_storeu_epi8(out + i, TailMask64(size - i), upsample.Next());
+            return out;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        struct JpegBgr
+        {
+            static const size_t N = 3;
+
+            template <bool mask> static SIMD_INLINE void Convert(const __m512i& y, const __m512i& u, const __m512i& v, const __m512i&, uint8_t* bgr, const __mmask64* tails)
+            {
+                __m512i b = YuvToBlue<Base::Trect871>(y, u);
+                __m512i g = YuvToGreen<Base::Trect871>(y, u, v);
+                __m512i r = YuvToRed<Base::Trect871>(y, v);
+                Store<false, mask>(bgr + 0 * A, InterleaveBgr<0>(b, g, r), tails[0]);
+                Store<false, mask>(bgr + 1 * A, InterleaveBgr<1>(b, g, r), tails[1]);
+                Store<false, mask>(bgr + 2 * A, InterleaveBgr<2>(b, g, r), tails[2]);
+            }
+        };
+
+        struct JpegRgb
+        {
+            static const size_t N = 3;
+
+            template <bool mask> static SIMD_INLINE void Convert(const __m512i& y, const __m512i& u, const __m512i& v, const __m512i&, uint8_t* rgb, const __mmask64* tails)
+            {
+                __m512i b = YuvToBlue<Base::Trect871>(y, u);
+                __m512i g = YuvToGreen<Base::Trect871>(y, u, v);
+                __m512i r = YuvToRed<Base::Trect871>(y, v);
+                Store<false, mask>(rgb + 0 * A, InterleaveBgr<0>(r, g, b), tails[0]);
+                Store<false, mask>(rgb + 1 * A, InterleaveBgr<1>(r, g, b), tails[1]);
+                Store<false, mask>(rgb + 2 * A, InterleaveBgr<2>(r, g, b), tails[2]);
+            }
+        };
+
+        struct JpegBgra
+        {
+            static const size_t N = 4;
+
+            template <bool mask> static SIMD_INLINE void Convert(const __m512i& y, const __m512i& u, const __m512i& v, const __m512i& a, uint8_t* bgra, const __mmask64* tails)
+            {
+                YuvToBgra<false, mask, Base::Trect871>(y, u, v, a, bgra, tails);
+            }
+        };
+
+        struct JpegRgba
+        {
+            static const size_t N = 4;
+
+            template <bool mask> static SIMD_INLINE void Convert(const __m512i& y, const __m512i& u, const __m512i& v, const __m512i& a, uint8_t* rgba, const __mmask64* tails)
+            {
+                __m512i b = _mm512_permutexvar_epi32(K32_PERMUTE_FOR_TWO_UNPACK, YuvToBlue<Base::Trect871>(y, u));
+                __m512i g = _mm512_permutexvar_epi32(K32_PERMUTE_FOR_TWO_UNPACK, YuvToGreen<Base::Trect871>(y, u, v));
+                __m512i r = _mm512_permutexvar_epi32(K32_PERMUTE_FOR_TWO_UNPACK, YuvToRed<Base::Trect871>(y, v));
+                __m512i rg0 = UnpackU8<0>(r, g);
+                __m512i rg1 = UnpackU8<1>(r, g);
+                __m512i ba0 = UnpackU8<0>(b, a);
+                __m512i ba1 = UnpackU8<1>(b, a);
+                Store<false, mask>(rgba + 0 * A, UnpackU16<0>(rg0, ba0), tails[0]);
+                Store<false, mask>(rgba + 1 * A, UnpackU16<1>(rg0, ba0), tails[1]);
+                Store<false, mask>(rgba + 2 * A, UnpackU16<0>(rg1, ba1), tails[2]);
+                Store<false, mask>(rgba + 3 * A, UnpackU16<1>(rg1, ba1), tails[3]);
+            }
+        };
+
+        template<class C> void JpegYuv420pToAny(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height, uint8_t* dst, size_t dstStride, uint8_t alpha)
+        {
+            size_t hL = height - 1, w2 = (width + 1) / 2, widthA = AlignLo(width, A), tail = width - widthA;
+            __mmask64 tails[C::N + 1];
+            tails[0] = TailMask64(tail);
+            for (size_t i = 0; i < C::N; ++i)
+                tails[1 + i] = TailMask64(tail * C::N - A * i);
+            __m512i a = _mm512_set1_epi8(alpha);
+            JpegUpsampleHv2 upU, upV;
+            for (size_t row = 0; row < height; row += 1)
+            {
+                size_t odd = row & 1;
+                upU.Init(u, odd ? (row == hL ? u : u + uStride) : (row == 0 ? u : u - uStride), w2);
+                upV.Init(v, odd ? (row == hL ? v : v + vStride) : (row == 0 ? v : v - vStride), w2);
+                size_t col = 0;
+                for (; col < widthA; col += A)
+                    C::template Convert<false>(_mm512_loadu_si512(y + col), upU.Next(), upV.Next(), a, dst + col * C::N, tails + 1);
+                if (col < width)
+                    C::template Convert<true>(_mm512_maskz_loadu_epi8(tails[0], y + col), upU.Next(), upV.Next(), a, dst + col * C::N, tails + 1);
+                y += yStride;
+                dst += dstStride;
+                if (odd)
+                {
+                    u += uStride;
+                    v += vStride;
+                }
+            }
+        }
+
+        void JpegYuv444pToRgba(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height, uint8_t* rgba, size_t rgbaStride, uint8_t alpha, SimdYuvType)
+        {
+            size_t widthA = AlignLo(width, A), tail = width - widthA;
+            __mmask64 tails[JpegRgba::N + 1];
+            tails[0] = TailMask64(tail);
+            for (size_t i = 0; i < JpegRgba::N; ++i)
+                tails[1 + i] = TailMask64(tail * JpegRgba::N - A * i);
+            __m512i a = _mm512_set1_epi8(alpha);
+            for (size_t row = 0; row < height; row += 1)
+            {
+                size_t col = 0;
+                for (; col < widthA; col += A)
+                    JpegRgba::Convert<false>(_mm512_loadu_si512(y + col), _mm512_loadu_si512(u + col), _mm512_loadu_si512(v + col), a, rgba + col * 4, tails + 1);
+                if (col < width)
+                    JpegRgba::Convert<true>(_mm512_maskz_loadu_epi8(tails[0], y + col), _mm512_maskz_loadu_epi8(tails[0], u + col),
+                        _mm512_maskz_loadu_epi8(tails[0], v + col), a, rgba + col * 4, tails + 1);
+                y += yStride;
+                u += uStride;
+                v += vStride;
+                rgba += rgbaStride;
+            }
+        }
+
+        void JpegYuv420pToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType)
+        {
+            JpegYuv420pToAny<JpegBgr>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, 0xFF);
+        }
+
+        void JpegYuv420pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType)
+        {
+            JpegYuv420pToAny<JpegRgb>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, 0xFF);
+        }
+
+        void JpegYuv420pToBgra(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType)
+        {
+            JpegYuv420pToAny<JpegBgra>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+        }
+
+        void JpegYuv420pToRgba(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height, uint8_t* rgba, size_t rgbaStride, uint8_t alpha, SimdYuvType)
+        {
+            JpegYuv420pToAny<JpegRgba>(y, yStride, u, uStride, v, vStride, width, height, rgba, rgbaStride, alpha);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        ImageJpegLoader::ImageJpegLoader(const ImageLoaderParam& param)
+            : Sse41::ImageJpegLoader(param)
+        {
+            if (_context->block_size == 8)
+                _context->idctBlocks2 = JpegIdctBlocks2;
+            _context->dequantizeBlocks = JpegDequantizeBlocks;
+            _context->resampleRowHv2 = JpegResampleRowHv2;
+            if (_param.format == SimdPixelFormatGray8)
+                _context->rgbaToAny = Avx512bw::RgbaToGray;
+            if (_param.format == SimdPixelFormatBgr24)
+            {
+                _context->yuv444pToBgr = Avx512bw::Yuv444pToBgrV2;
+                _context->yuv420pToBgr = Avx512bw::JpegYuv420pToBgr;
+                _context->rgbaToAny = Avx512bw::BgraToRgb;
+            }
+            if (_param.format == SimdPixelFormatBgra32)
+            {
+                _context->yuv444pToBgra = Avx512bw::Yuv444pToBgraV2;
+                _context->yuv420pToBgra = Avx512bw::JpegYuv420pToBgra;
+                _context->rgbaToAny = Avx512bw::BgraToRgba;
+            }
+            if (_param.format == SimdPixelFormatRgb24)
+            {
+                _context->yuv444pToBgr = Avx512bw::Yuv444pToRgbV2;
+                _context->yuv420pToBgr = Avx512bw::JpegYuv420pToRgb;
+                _context->rgbaToAny = Avx512bw::BgraToBgr;
+            }
+            if (_param.format == SimdPixelFormatRgba32)
+            {
+                _context->yuv444pToBgra = Avx512bw::JpegYuv444pToRgba;
+                _context->yuv420pToBgra = Avx512bw::JpegYuv420pToRgba;
+            }
+        }
+    }
+#endif
+}
@@ -0,0 +1,176 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdImageLoad.h"
+#include "Simd/SimdImageLoadPng.h"
+#include "Simd/SimdAvx512bw.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        static void DecodeLine2(const uint8_t* curr, const uint8_t* prev, int width, int srcN, int dstN, uint8_t* dst)
+        {
+            if (srcN == dstN)
+            {
+                size_t size = size_t(width) * srcN, sizeA = AlignLo(size, A), i = 0;
+                for (; i < sizeA; i += A)
+                    _mm512_storeu_si512(dst + i, _mm512_add_epi8(_mm512_loadu_si512(curr + i), _mm512_loadu_si512(prev + i)));
+                if (i < size)
+                {
+                    __mmask64 tail = TailMask64(size - i);
+                    _mm512_mask_storeu_epi8(dst + i, tail, _mm512_add_epi8(_mm512_maskz_loadu_epi8(tail, curr + i), _mm512_maskz_loadu_epi8(tail, prev + i)));
+                }
+            }
+            else
+                Base::DecodeLine2(curr, prev, width, srcN, dstN, dst);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static void DecodeLine3(const uint8_t* curr, const uint8_t* prev, int width, int srcN, int dstN, uint8_t* dst)
+        {
+            if (srcN == dstN)
+            {
+                __mmask16 mask = TailMask16(srcN);
+                __m128i a = _mm_setzero_si128();
+                for (size_t i = 0, size = size_t(width) * srcN; i < size; i += srcN)
+                {
+                    __m128i b = _mm_maskz_loadu_epi8(mask, prev + i);
+                    __m128i avg = _mm_sub_epi8(_mm_avg_epu8(a, b), _mm_and_si128(_mm_xor_si128(a, b), Sse41::K8_01));
+                    a = _mm_add_epi8(_mm_maskz_loadu_epi8(mask, curr + i), avg);
+                    _mm_mask_storeu_epi8(dst + i, mask, a);
+                }
+            }
+            else
+                Base::DecodeLine3(curr, prev, width, srcN, dstN, dst);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static void DecodeLine4(const uint8_t* curr, const uint8_t* prev, int width, int srcN, int dstN, uint8_t* dst)
+        {
+            if (srcN == dstN)
+            {
+                __mmask16 mask = TailMask16(srcN);
+                __m128i a = _mm_setzero_si128(), c = _mm_setzero_si128();
+                for (size_t i = 0, size = size_t(width) * srcN; i < size; i += srcN)
+                {
+                    __m128i b = _mm_cvtepu8_epi16(_mm_maskz_loadu_epi8(mask, prev + i));
+                    __m128i bc = _mm_sub_epi16(b, c), ac = _mm_sub_epi16(a, c);
+                    __m128i pa = _mm_abs_epi16(bc), pb = _mm_abs_epi16(ac), pc = _mm_abs_epi16(_mm_add_epi16(bc, ac));
+                    __m128i min = _mm_min_epi16(_mm_min_epi16(pa, pb), pc);
+                    __m128i pred = _mm_mask_mov_epi16(c, _mm_cmpeq_epi16_mask(min, pb), b);
+                    pred = _mm_mask_mov_epi16(pred, _mm_cmpeq_epi16_mask(min, pa), a);
+                    a = _mm_and_si128(_mm_add_epi16(_mm_cvtepu8_epi16(_mm_maskz_loadu_epi8(mask, curr + i)), pred), Sse41::K16_00FF);
+                    _mm_mask_storeu_epi8(dst + i, mask, _mm_packus_epi16(a, a));
+                    c = b;
+                }
+            }
+            else
+                Base::DecodeLine4(curr, prev, width, srcN, dstN, dst);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        const __m512i K8_SHUFFLE_BGRA_TO_BGR = SIMD_MM512_SETR_EPI8(
+            0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
+            0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
+            0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
+            0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1);
+
+        const __m512i K32_PERMUTE_BGRA_TO_BGR = SIMD_MM512_SETR_EPI32(0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1);
+
+        SIMD_INLINE __m512i GatherPalette(const uint8_t* src, const uint8_t* palette, __mmask16 mask = -1)
+        {
+            __m512i idx = _mm512_cvtepu8_epi32(_mm_maskz_loadu_epi8(mask, src));
+            return _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask, idx, palette, 4);
+        }
+
+        static void ExpandPalette(const uint8_t* src, size_t size, int outN, const uint8_t* palette, uint8_t* dst)
+        {
+            size_t sizeF = AlignLo(size, F), i = 0;
+            __mmask16 tail = TailMask16(size - sizeF);
+            if (outN == 3)
+            {
+                __mmask64 bgrMask = 0x0000FFFFFFFFFFFF;
+                for (; i < sizeF; i += F, dst += 3 * F)
+                {
+                    __m512i bgra = GatherPalette(src + i, palette);
+                    __m512i bgr = _mm512_permutexvar_epi32(K32_PERMUTE_BGRA_TO_BGR, _mm512_shuffle_epi8(bgra, K8_SHUFFLE_BGRA_TO_BGR));
+                    _mm512_mask_storeu_epi8(dst, bgrMask, bgr);
+                }
+                if (i < size)
+                {
+                    __m512i bgra = GatherPalette(src + i, palette, tail);
+                    __m512i bgr = _mm512_permutexvar_epi32(K32_PERMUTE_BGRA_TO_BGR, _mm512_shuffle_epi8(bgra, K8_SHUFFLE_BGRA_TO_BGR));
+                    _mm512_mask_storeu_epi8(dst, TailMask64((size - i) * 3), bgr);
+                }
+            }
+            else if (outN == 4)
+            {
+                for (; i < sizeF; i += F, dst += 4 * F)
+                    _mm512_storeu_si512(dst, GatherPalette(src + i, palette));
+                if (i < size)
+                    _mm512_mask_storeu_epi32(dst, tail, GatherPalette(src + i, palette, tail));
+            }
+            else
+                assert(0);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        const __m512i K8_SHUFFLE_SWAP_16 = SIMD_MM512_SETR_EPI8(
+            0x1, 0x0, 0x3, 0x2, 0x5, 0x4, 0x7, 0x6, 0x9, 0x8, 0xB, 0xA, 0xD, 0xC, 0xF, 0xE,
+            0x1, 0x0, 0x3, 0x2, 0x5, 0x4, 0x7, 0x6, 0x9, 0x8, 0xB, 0xA, 0xD, 0xC, 0xF, 0xE,
+            0x1, 0x0, 0x3, 0x2, 0x5, 0x4, 0x7, 0x6, 0x9, 0x8, 0xB, 0xA, 0xD, 0xC, 0xF, 0xE,
+            0x1, 0x0, 0x3, 0x2, 0x5, 0x4, 0x7, 0x6, 0x9, 0x8, 0xB, 0xA, 0xD, 0xC, 0xF, 0xE);
+
+        static void Expand16(uint8_t* data, size_t size)
+        {
+            size_t bytes = size * 2, bytesA = AlignLo(bytes, A), i = 0;
+            for (; i < bytesA; i += A)
+                _mm512_storeu_si512(data + i, _mm512_shuffle_epi8(_mm512_loadu_si512(data + i), K8_SHUFFLE_SWAP_16));
+            if (i < bytes)
+            {
+                __mmask64 tail = TailMask64(bytes - i);
+                _mm512_mask_storeu_epi8(data + i, tail, _mm512_shuffle_epi8(_mm512_maskz_loadu_epi8(tail, data + i), K8_SHUFFLE_SWAP_16));
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        ImagePngLoader::ImagePngLoader(const ImageLoaderParam& param)
+            : Avx2::ImagePngLoader(param)
+        {
+            _decodeLine[2] = Avx512bw::DecodeLine2;
+            _decodeLine[3] = Avx512bw::DecodeLine3;
+            _decodeLine[4] = Avx512bw::DecodeLine4;
+            _expandPalette = Avx512bw::ExpandPalette;
+            _expand16 = Avx512bw::Expand16;
+        }
+    }
+#endif
+}
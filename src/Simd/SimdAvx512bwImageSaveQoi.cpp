@@ -0,0 +1,97 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdImageSave.h"
+#include "Simd/SimdImageQoi.h"
+#include "Simd/SimdAvx512bw.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        SIMD_INLINE __m512i QoiCodes(__m512i px, __m512i pr)
+        {
+            static const __m512i LUMA_SHUFFLE = SIMD_MM512_SETR_EPI8(
+                0x1, -1, 0x1, -1, 0x5, -1, 0x5, -1, 0x9, -1, 0x9, -1, 0xD, -1, 0xD, -1,
+                0x1, -1, 0x1, -1, 0x5, -1, 0x5, -1, 0x9, -1, 0x9, -1, 0xD, -1, 0xD, -1,
+                0x1, -1, 0x1, -1, 0x5, -1, 0x5, -1, 0x9, -1, 0x9, -1, 0xD, -1, 0xD, -1,
+                0x1, -1, 0x1, -1, 0x5, -1, 0x5, -1, 0x9, -1, 0x9, -1, 0xD, -1, 0xD, -1);
+            __m512i dv = _mm512_sub_epi8(px, pr);
+            __mmask16 alphaEq = _mm512_testn_epi32_mask(dv, _mm512_set1_epi32(0xFF000000));
+            __m512i b1 = _mm512_add_epi8(dv, _mm512_set1_epi32(0x00020202));
+            __mmask16 diffOk = _mm512_testn_epi32_mask(b1, _mm512_set1_epi32(0x00FCFCFC));
+            __m512i diff = _mm512_or_si512(_mm512_or_si512(_mm512_set1_epi32(Base::QoiOpDiff), _mm512_slli_epi32(_mm512_and_si512(b1, _mm512_set1_epi32(0x3)), 4)),
+                _mm512_or_si512(_mm512_and_si512(_mm512_srli_epi32(b1, 6), _mm512_set1_epi32(0xC)), _mm512_and_si512(_mm512_srli_epi32(b1, 16), _mm512_set1_epi32(0x3))));
+            __m512i lv = _mm512_add_epi8(_mm512_sub_epi8(dv, _mm512_shuffle_epi8(dv, LUMA_SHUFFLE)), _mm512_set1_epi32(0x00082008));
+            __mmask16 lumaOk = _mm512_testn_epi32_mask(lv, _mm512_set1_epi32(0x00F0C0F0));
+            __m512i luma = _mm512_or_si512(_mm512_or_si512(_mm512_set1_epi32(Base::QoiOpLuma << 8), _mm512_and_si512(lv, _mm512_set1_epi32(0x3F00))),
+                _mm512_or_si512(_mm512_slli_epi32(_mm512_and_si512(lv, _mm512_set1_epi32(0xF)), 4), _mm512_and_si512(_mm512_srli_epi32(lv, 16), _mm512_set1_epi32(0xF))));
+            __m512i code = _mm512_maskz_mov_epi32(lumaOk, luma);
+            code = _mm512_mask_mov_epi32(code, diffOk, diff);
+            code = _mm512_mask_mov_epi32(_mm512_set1_epi32(Base::QoiCodeRgba), alphaEq, code);
+            __m512i hash = _mm512_madd_epi16(_mm512_maddubs_epi16(px, _mm512_set1_epi32(0x0B070503)), _mm512_set1_epi16(1));
+            return _mm512_or_si512(code, _mm512_slli_epi32(_mm512_and_si512(hash, _mm512_set1_epi32(63)), 16));
+        }
+
+        void QoiEncodeCodes(const uint8_t* rgba, size_t size, uint32_t prev, uint32_t* codes)
+        {
+            if (size == 0)
+                return;
+            const uint32_t* src = (const uint32_t*)rgba;
+            codes[0] = Base::QoiCode(src[0], prev);
+            size_t i = 1;
+            for (; i + 16 <= size; i += 16)
+            {
+                __m512i px = _mm512_loadu_si512(src + i);
+                __m512i pr = _mm512_loadu_si512(src + i - 1);
+                _mm512_storeu_si512(codes + i, QoiCodes(px, pr));
+            }
+            if (i < size)
+            {
+                __mmask16 tail = TailMask16(size - i);
+                __m512i px = _mm512_maskz_loadu_epi32(tail, src + i);
+                __m512i pr = _mm512_maskz_loadu_epi32(tail, src + i - 1);
+                _mm512_mask_storeu_epi32(codes + i, tail, QoiCodes(px, pr));
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        ImageQoiSaver::ImageQoiSaver(const ImageSaverParam& param)
+            : Avx2::ImageQoiSaver(param)
+        {
+            _encodeCodes = Avx512bw::QoiEncodeCodes;
+            switch (_param.format)
+            {
+            case SimdPixelFormatGray8: _toRgba = Avx512bw::GrayToBgra; break;
+            case SimdPixelFormatBgr24: _toRgba = Avx512bw::RgbToBgra; break;
+            case SimdPixelFormatBgra32: _convert = Avx512bw::BgraToRgba; break;
+            case SimdPixelFormatRgb24: _toRgba = Avx512bw::BgrToBgra; break;
+            default: break;
+            }
+        }
+    }
+#endif
+}
@@ -25,6 +25,7 @@
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdLoadBlock.h"
 #include "Simd/SimdStore.h"
+#include "Simd/SimdAvx2.h"
 
 namespace Simd
 {
@@ -648,6 +649,14 @@ namespace Simd
             else
                 MedianFilterSquare5x5<false>(src, srcStride, width, height, channelCount, dst, dstStride);
         }
+
+        //-----------------------------------------------------------------------------------------
+
+        void MedianFilterSquare(const uint8_t* src, size_t srcStride, size_t width, size_t height,
+            size_t channelCount, size_t radius, uint8_t* dst, size_t dstStride)
+        {
+            Avx2::MedianFilterSquare(src, srcStride, width, height, channelCount, radius, dst, dstStride);
+        }
     }
 #endif// SIMD_AVX512BW_ENABLE
 }
@@ -0,0 +1,212 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdNms.h"
+#include "Simd/SimdExp.h"
+#include "Simd/SimdLoad.h"
+#include "Simd/SimdStore.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        SIMD_INLINE __m512 Sigmoid(__m512 value)
+        {
+            __m512 _1 = _mm512_set1_ps(1.0f);
+            return _mm512_div_ps(_1, _mm512_add_ps(_1, Exponent(_mm512_sub_ps(_mm512_setzero_ps(), value))));
+        }
+
+        template<SimdBoxDecodeType type> SIMD_INLINE void NmsDecodeBoxes(const float* src, const float* anchors, size_t stride, const __m512* params, float* dst, __mmask16 tail = -1)
+        {
+            __m512 s0 = _mm512_maskz_loadu_ps(tail, src + 0 * stride), s1 = _mm512_maskz_loadu_ps(tail, src + 1 * stride);
+            __m512 s2 = _mm512_maskz_loadu_ps(tail, src + 2 * stride), s3 = _mm512_maskz_loadu_ps(tail, src + 3 * stride);
+            __m512 a0 = _mm512_maskz_loadu_ps(tail, anchors + 0 * stride), a1 = _mm512_maskz_loadu_ps(tail, anchors + 1 * stride);
+            __m512 a2 = _mm512_maskz_loadu_ps(tail, anchors + 2 * stride), a3 = _mm512_maskz_loadu_ps(tail, anchors + 3 * stride);
+            __m512 cx, cy, w, h;
+            if (type == SimdBoxDecodeCenterSize)
+            {
+                cx = _mm512_add_ps(a0, _mm512_mul_ps(_mm512_mul_ps(s0, params[0]), a2));
+                cy = _mm512_add_ps(a1, _mm512_mul_ps(_mm512_mul_ps(s1, params[1]), a3));
+                w = _mm512_mul_ps(a2, Exponent(_mm512_mul_ps(s2, params[2])));
+                h = _mm512_mul_ps(a3, Exponent(_mm512_mul_ps(s3, params[3])));
+            }
+            else if (type == SimdBoxDecodeYoloV3)
+            {
+                cx = _mm512_mul_ps(_mm512_add_ps(Sigmoid(s0), a0), params[0]);
+                cy = _mm512_mul_ps(_mm512_add_ps(Sigmoid(s1), a1), params[0]);
+                w = _mm512_mul_ps(a2, Exponent(s2));
+                h = _mm512_mul_ps(a3, Exponent(s3));
+            }
+            else
+            {
+                __m512 _2 = _mm512_set1_ps(2.0f), _05 = _mm512_set1_ps(0.5f);
+                cx = _mm512_mul_ps(_mm512_add_ps(_mm512_sub_ps(_mm512_mul_ps(Sigmoid(s0), _2), _05), a0), params[0]);
+                cy = _mm512_mul_ps(_mm512_add_ps(_mm512_sub_ps(_mm512_mul_ps(Sigmoid(s1), _2), _05), a1), params[0]);
+                __m512 sw = _mm512_mul_ps(Sigmoid(s2), _2), sh = _mm512_mul_ps(Sigmoid(s3), _2);
+                w = _mm512_mul_ps(_mm512_mul_ps(sw, sw), a2);
+                h = _mm512_mul_ps(_mm512_mul_ps(sh, sh), a3);
+            }
+            __m512 hw = _mm512_mul_ps(w, _mm512_set1_ps(0.5f)), hh = _mm512_mul_ps(h, _mm512_set1_ps(0.5f));
+            _mm512_mask_storeu_ps(dst + 0 * stride, tail, _mm512_sub_ps(cx, hw));
+            _mm512_mask_storeu_ps(dst + 1 * stride, tail, _mm512_sub_ps(cy, hh));
+            _mm512_mask_storeu_ps(dst + 2 * stride, tail, _mm512_add_ps(cx, hw));
+            _mm512_mask_storeu_ps(dst + 3 * stride, tail, _mm512_add_ps(cy, hh));
+        }
+
+        template<SimdBoxDecodeType type> void NmsDecodeBoxes(const float* src, const float* anchors, size_t size, size_t stride, const float* params, float* dst)
+        {
+            __m512 _params[4];
+            for (size_t i = 0; i < 4; ++i)
+                _params[i] = _mm512_set1_ps(params[i]);
+            size_t sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeF; i += F)
+                NmsDecodeBoxes<type>(src + i, anchors + i, stride, _params, dst + i);
+            if (i < size)
+                NmsDecodeBoxes<type>(src + i, anchors + i, stride, _params, dst + i, TailMask16(size - i));
+        }
+
+        void NmsDecodeBoxes32f(const float* src, const float* anchors, size_t size, size_t stride, SimdBoxDecodeType type, const float* params, float* dst)
+        {
+            float buf[4] = { params[0], type == SimdBoxDecodeCenterSize ? params[1] : params[0],
+                type == SimdBoxDecodeCenterSize ? params[2] : params[0], type == SimdBoxDecodeCenterSize ? params[3] : params[0] };
+            switch (type)
+            {
+            case SimdBoxDecodeCenterSize: NmsDecodeBoxes<SimdBoxDecodeCenterSize>(src, anchors, size, stride, buf, dst); break;
+            case SimdBoxDecodeYoloV3: NmsDecodeBoxes<SimdBoxDecodeYoloV3>(src, anchors, size, stride, buf, dst); break;
+            case SimdBoxDecodeYoloV5: NmsDecodeBoxes<SimdBoxDecodeYoloV5>(src, anchors, size, stride, buf, dst); break;
+            default: assert(0);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE __m512 NmsIou(__m512 ax0, __m512 ay0, __m512 ax1, __m512 ay1, __m512 aArea, __m512 bx0, __m512 by0, __m512 bx1, __m512 by1, __m512 bArea)
+        {
+            __m512 _0 = _mm512_setzero_ps();
+            __m512 w = _mm512_max_ps(_mm512_sub_ps(_mm512_min_ps(ax1, bx1), _mm512_max_ps(ax0, bx0)), _0);
+            __m512 h = _mm512_max_ps(_mm512_sub_ps(_mm512_min_ps(ay1, by1), _mm512_max_ps(ay0, by0)), _0);
+            __m512 inter = _mm512_mul_ps(w, h);
+            __m512 uni = _mm512_sub_ps(_mm512_add_ps(aArea, bArea), inter);
+            return _mm512_maskz_div_ps(_mm512_cmp_ps_mask(uni, _0, _CMP_GT_OQ), inter, uni);
+        }
+
+        SIMD_INLINE void NmsIou(const float* x0, const float* y0, const float* x1, const float* y1, __m512 ax0, __m512 ay0, __m512 ax1, __m512 ay1, 
+            __m512 aArea, float* iou, __mmask16 tail = -1)
+        {
+            __m512 bx0 = _mm512_maskz_loadu_ps(tail, x0), by0 = _mm512_maskz_loadu_ps(tail, y0);
+            __m512 bx1 = _mm512_maskz_loadu_ps(tail, x1), by1 = _mm512_maskz_loadu_ps(tail, y1);
+            __m512 bArea = _mm512_mul_ps(_mm512_sub_ps(bx1, bx0), _mm512_sub_ps(by1, by0));
+            _mm512_mask_storeu_ps(iou, tail, NmsIou(ax0, ay0, ax1, ay1, aArea, bx0, by0, bx1, by1, bArea));
+        }
+
+        void NmsIou32f(const float* boxes, size_t stride, size_t size, const float* box, float* iou)
+        {
+            const float* x0 = boxes + 0 * stride, * y0 = boxes + 1 * stride, * x1 = boxes + 2 * stride, * y1 = boxes + 3 * stride;
+            __m512 ax0 = _mm512_set1_ps(box[0]), ay0 = _mm512_set1_ps(box[1]), ax1 = _mm512_set1_ps(box[2]), ay1 = _mm512_set1_ps(box[3]);
+            __m512 aArea = _mm512_set1_ps((box[2] - box[0]) * (box[3] - box[1]));
+            size_t sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeF; i += F)
+                NmsIou(x0 + i, y0 + i, x1 + i, y1 + i, ax0, ay0, ax1, ay1, aArea, iou + i);
+            if (i < size)
+                NmsIou(x0 + i, y0 + i, x1 + i, y1 + i, ax0, ay0, ax1, ay1, aArea, iou + i, TailMask16(size - i));
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        size_t NmsFilter(const float* scores, size_t size, float threshold, uint32_t* idx)
+        {
+            __m512 _threshold = _mm512_set1_ps(threshold);
+            __m512i _idx = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), _F = _mm512_set1_epi32(F);
+            size_t sizeF = AlignLo(size, F), i = 0, count = 0;
+            for (; i < sizeF; i += F)
+            {
+                __mmask16 mask = _mm512_cmp_ps_mask(_mm512_loadu_ps(scores + i), _threshold, _CMP_GT_OQ);
+                _mm512_mask_compressstoreu_epi32(idx + count, mask, _idx);
+                count += _mm_popcnt_u32(mask);
+                _idx = _mm512_add_epi32(_idx, _F);
+            }
+            if (i < size)
+            {
+                __mmask16 mask = _mm512_cmp_ps_mask(_mm512_maskz_loadu_ps(TailMask16(size - i), scores + i), _threshold, _CMP_GT_OQ) & TailMask16(size - i);
+                _mm512_mask_compressstoreu_epi32(idx + count, mask, _idx);
+                count += _mm_popcnt_u32(mask);
+            }
+            return count;
+        }
+
+        template<SimdNmsType type> SIMD_INLINE void NmsSuppress(const Base::NmsBoxes& boxes, size_t i, __m512 ax0, __m512 ay0, __m512 ax1, __m512 ay1,
+            __m512 aArea, __m512i aCls, __m512 threshold, float sigma, __mmask16 tail = -1)
+        {
+            __m512 iou = NmsIou(ax0, ay0, ax1, ay1, aArea, _mm512_maskz_loadu_ps(tail, boxes.x0 + i), _mm512_maskz_loadu_ps(tail, boxes.y0 + i),
+                _mm512_maskz_loadu_ps(tail, boxes.x1 + i), _mm512_maskz_loadu_ps(tail, boxes.y1 + i), _mm512_maskz_loadu_ps(tail, boxes.area + i));
+            __mmask16 same = _mm512_mask_cmpeq_epi32_mask(tail, _mm512_maskz_loadu_epi32(tail, boxes.cls + i), aCls);
+            __m512 score = _mm512_maskz_loadu_ps(tail, boxes.score + i);
+            if (type == SimdNmsHard)
+                score = _mm512_mask_blend_ps(_mm512_mask_cmp_ps_mask(same, iou, threshold, _CMP_GT_OQ), score, _mm512_set1_ps(-FLT_MAX));
+            else if (type == SimdNmsSoftLinear)
+                score = _mm512_mask_mul_ps(score, _mm512_mask_cmp_ps_mask(same, iou, threshold, _CMP_GT_OQ), score, _mm512_sub_ps(_mm512_set1_ps(1.0f), iou));
+            else
+            {
+                float _iou[F], _score[F];
+                _mm512_storeu_ps(_iou, iou);
+                _mm512_storeu_ps(_score, score);
+                for (size_t j = 0; j < F; ++j)
+                    if (same & (1 << j))
+                        _score[j] = Base::NmsDecay(_score[j], _iou[j], type, 0.0f, sigma);
+                score = _mm512_loadu_ps(_score);
+            }
+            _mm512_mask_storeu_ps(boxes.score + i, tail, score);
+        }
+
+        template<SimdNmsType type> void NmsSuppress(const Base::NmsBoxes& boxes, size_t curr, size_t begin, size_t end, float threshold, float sigma)
+        {
+            __m512 ax0 = _mm512_set1_ps(boxes.x0[curr]), ay0 = _mm512_set1_ps(boxes.y0[curr]), ax1 = _mm512_set1_ps(boxes.x1[curr]), ay1 = _mm512_set1_ps(boxes.y1[curr]);
+            __m512 aArea = _mm512_set1_ps(boxes.area[curr]), _threshold = _mm512_set1_ps(threshold);
+            __m512i aCls = _mm512_set1_epi32(boxes.cls[curr]);
+            size_t endF = begin + AlignLo(end - begin, F), i = begin;
+            for (; i < endF; i += F)
+                NmsSuppress<type>(boxes, i, ax0, ay0, ax1, ay1, aArea, aCls, _threshold, sigma);
+            if (i < end)
+                NmsSuppress<type>(boxes, i, ax0, ay0, ax1, ay1, aArea, aCls, _threshold, sigma, TailMask16(end - i));
+        }
+
+        void NmsSuppress(const Base::NmsBoxes& boxes, size_t curr, size_t begin, size_t end, SimdNmsType type, float threshold, float sigma)
+        {
+            switch (type)
+            {
+            case SimdNmsHard: NmsSuppress<SimdNmsHard>(boxes, curr, begin, end, threshold, sigma); break;
+            case SimdNmsSoftLinear: NmsSuppress<SimdNmsSoftLinear>(boxes, curr, begin, end, threshold, sigma); break;
+            case SimdNmsSoftGaussian: NmsSuppress<SimdNmsSoftGaussian>(boxes, curr, begin, end, threshold, sigma); break;
+            default: assert(0);
+            }
+        }
+
+        size_t Nms32f(const float* boxes, size_t stride, const float* scores, const uint32_t* classes, size_t size, float scoreThreshold, size_t topK,
+            SimdNmsType type, float iouThreshold, float sigma, size_t keepTopK, uint32_t* indices, float* outScores)
+        {
+            return Base::NmsRun(boxes, stride, scores, classes, size, scoreThreshold, topK, type, iouThreshold, sigma, keepTopK, indices, outScores, NmsFilter, NmsSuppress);
+        }
+    }
+#endif
+}
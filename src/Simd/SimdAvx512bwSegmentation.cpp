@@ -24,6 +24,7 @@
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdStore.h"
 #include "Simd/SimdCompare.h"
+#include "Simd/SimdSegmentation.h"
 
 namespace Simd
 {
@@ -284,6 +285,42 @@ namespace Simd
                 }
             }
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static size_t SegmentationRuns(const uint8_t* mask, size_t width, uint8_t index, int32_t* runs)
+        {
+            int32_t* dst = runs;
+            bool in = false;
+            __m512i _index = _mm512_set1_epi8(index);
+            for (size_t x = 0; x < width; x += A)
+            {
+                __mmask64 tail = TailMask64(width - x);
+                uint64_t bits = _mm512_mask_cmpeq_epi8_mask(tail, _mm512_maskz_loadu_epi8(tail, mask + x), _index);
+                if (bits != (in ? uint64_t(-1) : 0))
+                {
+                    uint64_t edges = bits ^ ((bits << 1) | uint64_t(in ? 1 : 0));
+                    for (; edges; edges &= edges - 1)
+                        *dst++ = int32_t(x + FirstNotZero64(edges));
+                    in = (bits >> 63) != 0;
+                }
+            }
+            if (in)
+                *dst++ = (int32_t)width;
+            return (dst - runs) / 2;
+        }
+
+        SegmentationComponentLabeler::SegmentationComponentLabeler()
+        {
+            _runs = SegmentationRuns;
+        }
+
+        size_t SegmentationLabelComponents(const uint8_t* mask, size_t maskStride, size_t width, size_t height, uint8_t index,
+            SimdSegmentationConnectivityType connectivity, uint32_t* labels, size_t labelsStride, SimdSegmentationComponent** components)
+        {
+            SegmentationComponentLabeler labeler;
+            return labeler.Run(mask, maskStride, width, height, index, connectivity, labels, labelsStride, components);
+        }
     }
 #endif//SIMD_AVX512BW_ENABLE
 }
@@ -0,0 +1,204 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetPreprocess.h"
+#include "Simd/SimdSynetPreprocessCommon.h"
+#include "Simd/SimdAvx512bw.h"
+#include "Simd/SimdLoad.h"
+#include "Simd/SimdStore.h"
+
+namespace Simd
+{
+#if defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_SYNET_ENABLE)    
+    namespace Avx512bw
+    {
+        static void ResizeRowNearest(const float* src, size_t srcStride, size_t channels, const int32_t* idx, const float*, size_t width, float* dst, size_t dstStride)
+        {
+            size_t widthF = AlignLo(width, F);
+            __mmask16 tail = TailMask16(width - widthF);
+            for (size_t c = 0; c < channels; ++c)
+            {
+                size_t x = 0;
+                for (; x < widthF; x += F)
+                    _mm512_storeu_ps(dst + x, _mm512_i32gather_ps(_mm512_loadu_si512(idx + x), src, 4));
+                if (tail)
+                {
+                    __m512i _idx = _mm512_maskz_loadu_epi32(tail, idx + x);
+                    _mm512_mask_storeu_ps(dst + x, tail, _mm512_mask_i32gather_ps(_mm512_setzero_ps(), tail, _idx, src, 4));
+                }
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        SIMD_INLINE void ResizeBilinear(const float* src, const int32_t* idx, const float* alpha, float* dst, __mmask16 mask = -1)
+        {
+            __m512i _idx = _mm512_maskz_loadu_epi32(mask, idx);
+            __m512 s0 = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), mask, _idx, src + 0, 4);
+            __m512 s1 = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), mask, _idx, src + 1, 4);
+            _mm512_mask_storeu_ps(dst, mask, _mm512_fmadd_ps(_mm512_sub_ps(s1, s0), _mm512_maskz_loadu_ps(mask, alpha), s0));
+        }
+
+        static void ResizeRowBilinear(const float* src, size_t srcStride, size_t channels, const int32_t* idx, const float* alpha, size_t width, float* dst, size_t dstStride)
+        {
+            size_t widthF = AlignLo(width, F);
+            __mmask16 tail = TailMask16(width - widthF);
+            for (size_t c = 0; c < channels; ++c)
+            {
+                size_t x = 0;
+                for (; x < widthF; x += F)
+                    ResizeBilinear(src, idx + x, alpha + x, dst + x);
+                if (tail)
+                    ResizeBilinear(src, idx + x, alpha + x, dst + x, tail);
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<SimdTensorDataType type> SIMD_INLINE void Store(uint8_t* dst, size_t index, __m512 value, __mmask16 mask = -1);
+
+        template<> SIMD_INLINE void Store<SimdTensorData32f>(uint8_t* dst, size_t index, __m512 value, __mmask16 mask)
+        {
+            _mm512_mask_storeu_ps((float*)dst + index, mask, value);
+        }
+
+        template<> SIMD_INLINE void Store<SimdTensorData16b>(uint8_t* dst, size_t index, __m512 value, __mmask16 mask)
+        {
+            _mm256_mask_storeu_epi16((uint16_t*)dst + index, mask, _mm512_cvtepi32_epi16(Float32ToBFloat16(value)));
+        }
+
+        template<> SIMD_INLINE void Store<SimdTensorData8u>(uint8_t* dst, size_t index, __m512 value, __mmask16 mask)
+        {
+            __m512i i32 = _mm512_max_epi32(_mm512_cvtps_epi32(value), K_ZERO);
+            _mm_mask_storeu_epi8(dst + index, mask, _mm512_cvtusepi32_epi8(i32));
+        }
+
+        SIMD_INLINE __m512 Normalize(const float* src0, const float* src1, __m512 alpha, __m512 scale, __m512 shift, __mmask16 mask = -1)
+        {
+            __m512 s0 = _mm512_maskz_loadu_ps(mask, src0);
+            __m512 value = _mm512_fmadd_ps(_mm512_sub_ps(_mm512_maskz_loadu_ps(mask, src1), s0), alpha, s0);
+            return _mm512_fmadd_ps(value, scale, shift);
+        }
+
+        template<SimdTensorDataType type> void NormalizeRowNchw(const float* src0, const float* src1, size_t srcStride, float alpha, size_t width, size_t channels,
+            const float* scale, const float* shift, uint8_t* dst, size_t dstStride)
+        {
+            size_t widthF = AlignLo(width, F);
+            __mmask16 tail = TailMask16(width - widthF);
+            __m512 _alpha = _mm512_set1_ps(alpha);
+            for (size_t c = 0, o = 0; c < channels; ++c, o += dstStride)
+            {
+                __m512 _scale = _mm512_set1_ps(scale[c]);
+                __m512 _shift = _mm512_set1_ps(shift[c]);
+                size_t x = 0;
+                for (; x < widthF; x += F)
+                    Store<type>(dst, o + x, Normalize(src0 + x, src1 + x, _alpha, _scale, _shift));
+                if (tail)
+                    Store<type>(dst, o + x, Normalize(src0 + x, src1 + x, _alpha, _scale, _shift, tail), tail);
+                src0 += srcStride;
+                src1 += srcStride;
+            }
+        }
+
+        const __m512i K32_INTERLEAVE_BG_0 = SIMD_MM512_SETR_EPI32(0x00, 0x10, 0x00, 0x01, 0x11, 0x00, 0x02, 0x12, 0x00, 0x03, 0x13, 0x00, 0x04, 0x14, 0x00, 0x05);
+        const __m512i K32_INTERLEAVE_BG_1 = SIMD_MM512_SETR_EPI32(0x15, 0x00, 0x06, 0x16, 0x00, 0x07, 0x17, 0x00, 0x08, 0x18, 0x00, 0x09, 0x19, 0x00, 0x0A, 0x1A);
+        const __m512i K32_INTERLEAVE_BG_2 = SIMD_MM512_SETR_EPI32(0x00, 0x0B, 0x1B, 0x00, 0x0C, 0x1C, 0x00, 0x0D, 0x1D, 0x00, 0x0E, 0x1E, 0x00, 0x0F, 0x1F, 0x00);
+        const __m512i K32_INTERLEAVE_BGR_0 = SIMD_MM512_SETR_EPI32(0x00, 0x01, 0x10, 0x03, 0x04, 0x11, 0x06, 0x07, 0x12, 0x09, 0x0A, 0x13, 0x0C, 0x0D, 0x14, 0x0F);
+        const __m512i K32_INTERLEAVE_BGR_1 = SIMD_MM512_SETR_EPI32(0x00, 0x15, 0x02, 0x03, 0x16, 0x05, 0x06, 0x17, 0x08, 0x09, 0x18, 0x0B, 0x0C, 0x19, 0x0E, 0x0F);
+        const __m512i K32_INTERLEAVE_BGR_2 = SIMD_MM512_SETR_EPI32(0x1A, 0x01, 0x02, 0x1B, 0x04, 0x05, 0x1C, 0x07, 0x08, 0x1D, 0x0A, 0x0B, 0x1E, 0x0D, 0x0E, 0x1F);
+
+        template<SimdTensorDataType type> void NormalizeRowNhwc3(const float* src0, const float* src1, size_t srcStride, float alpha, size_t width, size_t,
+            const float* scale, const float* shift, uint8_t* dst, size_t)
+        {
+            size_t widthF = AlignLo(width, F), x = 0;
+            __m512 _alpha = _mm512_set1_ps(alpha), _scale[3], _shift[3];
+            for (size_t c = 0; c < 3; ++c)
+            {
+                _scale[c] = _mm512_set1_ps(scale[c]);
+                _shift[c] = _mm512_set1_ps(shift[c]);
+            }
+            for (; x < widthF; x += F)
+            {
+                __m512 b = Normalize(src0 + 0 * srcStride + x, src1 + 0 * srcStride + x, _alpha, _scale[0], _shift[0]);
+                __m512 g = Normalize(src0 + 1 * srcStride + x, src1 + 1 * srcStride + x, _alpha, _scale[1], _shift[1]);
+                __m512 r = Normalize(src0 + 2 * srcStride + x, src1 + 2 * srcStride + x, _alpha, _scale[2], _shift[2]);
+                Store<type>(dst, 3 * x + 0 * F, _mm512_permutex2var_ps(_mm512_permutex2var_ps(b, K32_INTERLEAVE_BG_0, g), K32_INTERLEAVE_BGR_0, r));
+                Store<type>(dst, 3 * x + 1 * F, _mm512_permutex2var_ps(_mm512_permutex2var_ps(b, K32_INTERLEAVE_BG_1, g), K32_INTERLEAVE_BGR_1, r));
+                Store<type>(dst, 3 * x + 2 * F, _mm512_permutex2var_ps(_mm512_permutex2var_ps(b, K32_INTERLEAVE_BG_2, g), K32_INTERLEAVE_BGR_2, r));
+            }
+            for (; x < width; ++x)
+                for (size_t c = 0, s = x; c < 3; ++c, s += srcStride)
+                    Base::SynetPreprocessNormalize<type>(src0 + s, src1 + s, alpha, scale[c], shift[c], dst, 3 * x + c);
+        }
+
+        template<SimdTensorDataType type> Base::SynetPreprocessBand::NormalizeRowPtr GetNormalizeRow(const SynetPreprocessParam& p)
+        {
+            return p.dstFormat == SimdTensorFormatNchw || p.channels == 1 ? NormalizeRowNchw<type> : NormalizeRowNhwc3<type>;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SynetPreprocessBand::SynetPreprocessBand(const SynetPreprocessParam& param)
+            : Avx2::SynetPreprocessBand(param)
+        {
+            const SynetPreprocessParam& p = _param;
+            if (p.srcW >= A)
+                _setInput = SynetSetInput;
+            _deinterleaveUv = DeinterleaveUv;
+            _yuv420pToBgr = Yuv420pToBgrV2;
+            _resizeRow = p.IsNearest() || p.srcW == 1 ? ResizeRowNearest : ResizeRowBilinear;
+            switch (p.dstType)
+            {
+            case SimdTensorData32f: _normalizeRow = GetNormalizeRow<SimdTensorData32f>(p); break;
+            case SimdTensorData16b: _normalizeRow = GetNormalizeRow<SimdTensorData16b>(p); break;
+            case SimdTensorData8u: _normalizeRow = GetNormalizeRow<SimdTensorData8u>(p); break;
+            default:
+                assert(0);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetPreprocessInit(size_t srcW, size_t srcH, SimdPixelFormatType srcFormat, size_t dstW, size_t dstH, size_t channels,
+            SimdResizeMethodType method, const float* mean, const float* std, SimdTensorFormatType dstFormat, SimdTensorDataType dstType)
+        {
+            SynetPreprocessParam param(srcW, srcH, srcFormat, dstW, dstH, channels, method, mean, std, dstFormat, dstType);
+            if (!param.Valid())
+                return NULL;
+            return new SynetPreprocessBand(param);
+        }
+
+        void* SynetPreprocessYuv420Init(size_t srcW, size_t srcH, SimdYuvType yuvType, SimdBool nv12, SimdBool isRgb, size_t dstW, size_t dstH,
+            SimdResizeMethodType method, const float* mean, const float* std, SimdTensorFormatType dstFormat, SimdTensorDataType dstType)
+        {
+            SynetPreprocessParam param(srcW, srcH, isRgb ? SimdPixelFormatRgb24 : SimdPixelFormatBgr24, dstW, dstH, 3,
+                method, mean, std, dstFormat, dstType, yuvType, nv12 == SimdTrue);
+            if (!param.IsYuv() || !param.Valid())
+                return NULL;
+            return new SynetPreprocessBand(param);
+        }
+    }
+#endif
+}
@@ -0,0 +1,147 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetTopK.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdBFloat16.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdSse41.h"
+#include "Simd/SimdAvx2.h"
+#include "Simd/SimdAvx512bw.h"
+
+namespace Simd
+{
+#if defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_SYNET_ENABLE)   
+    namespace Avx512bw
+    {
+        template<bool max> SIMD_INLINE __mmask16 Better(__m512 a, __m512 b)
+        {
+            return _mm512_cmp_ps_mask(a, b, max ? _CMP_GT_OQ : _CMP_LT_OQ);
+        }
+
+        template<bool max> int32_t ArgExtremum(const float* src, size_t count)
+        {
+            __m512 best = _mm512_set1_ps(src[0]);
+            __m512i index = _mm512_setzero_si512(), step = _mm512_set1_epi32(F);
+            __m512i curr = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+            for (size_t i = 0; i < count; i += F)
+            {
+                __mmask16 tail = TailMask16(count - i);
+                __m512 value = _mm512_maskz_loadu_ps(tail, src + i);
+                __mmask16 mask = Better<max>(value, best) & tail;
+                best = _mm512_mask_blend_ps(mask, best, value);
+                index = _mm512_mask_mov_epi32(index, mask, curr);
+                curr = _mm512_add_epi32(curr, step);
+            }
+            float value = max ? _mm512_reduce_max_ps(best) : _mm512_reduce_min_ps(best);
+            __mmask16 equal = _mm512_cmp_ps_mask(best, _mm512_set1_ps(value), _CMP_EQ_OQ);
+            return _mm512_mask_reduce_min_epi32(equal, index);
+        }
+
+        template<bool max> void ArgExtremum(const float* src, size_t count, size_t inner, int32_t* dst)
+        {
+            for (size_t i = 0; i < inner; i += F)
+            {
+                __mmask16 tail = TailMask16(inner - i);
+                const float* ps = src + i;
+                __m512 best = _mm512_maskz_loadu_ps(tail, ps);
+                __m512i index = _mm512_setzero_si512();
+                for (size_t c = 1; c < count; ++c)
+                {
+                    ps += inner;
+                    __m512 value = _mm512_maskz_loadu_ps(tail, ps);
+                    __mmask16 mask = Better<max>(value, best);
+                    best = _mm512_mask_blend_ps(mask, best, value);
+                    index = _mm512_mask_mov_epi32(index, mask, _mm512_set1_epi32((int)c));
+                }
+                _mm512_mask_storeu_epi32(dst + i, tail, index);
+            }
+        }
+
+        template<bool max> void SynetArgExtremum32f(const float* src, size_t outer, size_t count, size_t inner, int32_t* dst)
+        {
+            for (size_t o = 0; o < outer; ++o)
+            {
+                if (inner == 1)
+                    dst[0] = ArgExtremum<max>(src, count);
+                else
+                    ArgExtremum<max>(src, count, inner, dst);
+                src += count * inner;
+                dst += inner;
+            }
+        }
+
+        void SynetArgMax32f(const float* src, size_t outer, size_t count, size_t inner, int32_t* dst)
+        {
+            SynetArgExtremum32f<true>(src, outer, count, inner, dst);
+        }
+
+        void SynetArgMin32f(const float* src, size_t outer, size_t count, size_t inner, int32_t* dst)
+        {
+            SynetArgExtremum32f<false>(src, outer, count, inner, dst);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<bool max> void SynetTopKRow(const float* src, size_t count, size_t k, float* val, int32_t* idx)
+        {
+            Base::SynetTopKInit<max>(src, k, val, idx);
+            size_t i = k, count4F = k + AlignLo(count - k, 4 * F);
+            __m512 threshold = _mm512_set1_ps(val[k - 1]);
+            for (; i < count4F; i += 4 * F)
+            {
+                __mmask16 mask0 = Better<max>(_mm512_loadu_ps(src + i + 0 * F), threshold);
+                __mmask16 mask1 = Better<max>(_mm512_loadu_ps(src + i + 1 * F), threshold);
+                __mmask16 mask2 = Better<max>(_mm512_loadu_ps(src + i + 2 * F), threshold);
+                __mmask16 mask3 = Better<max>(_mm512_loadu_ps(src + i + 3 * F), threshold);
+                if (mask0 | mask1 | mask2 | mask3)
+                {
+                    Base::SynetTopKUpdate<max>(src, i, i + 4 * F, k, val, idx);
+                    threshold = _mm512_set1_ps(val[k - 1]);
+                }
+            }
+            for (; i < count; i += F)
+            {
+                __mmask16 tail = TailMask16(count - i);
+                if (Better<max>(_mm512_maskz_loadu_ps(tail, src + i), threshold) & tail)
+                {
+                    Base::SynetTopKUpdate<max>(src, i, Simd::Min(i + F, count), k, val, idx);
+                    threshold = _mm512_set1_ps(val[k - 1]);
+                }
+            }
+        }
+
+        void SynetTopK32f(const float* src, size_t outer, size_t count, size_t inner, size_t k, SimdBool largest, SimdBool sorted, float* dstVal, int32_t* dstIdx)
+        {
+            Base::SynetTopKRowPtr topKRow = largest ? SynetTopKRow<true> : SynetTopKRow<false>;
+            Base::SynetTopK(src, SimdTensorData32f, outer, count, inner, k, largest, sorted, dstVal, dstIdx, topKRow, NULL);
+        }
+
+        void SynetTopK16b(const uint16_t* src, size_t outer, size_t count, size_t inner, size_t k, SimdBool largest, SimdBool sorted, uint16_t* dstVal, int32_t* dstIdx)
+        {
+            Base::SynetTopKRowPtr topKRow = largest ? SynetTopKRow<true> : SynetTopKRow<false>;
+            Base::SynetTopK(src, SimdTensorData16b, outer, count, inner, k, largest, sorted, dstVal, dstIdx, topKRow, BFloat16ToFloat32);
+        }
+    }
+#endif
+}
@@ -36,6 +36,8 @@ namespace Simd
 
         void SetThreadNumber(size_t threadNumber);
 
+        void SetLocalThreadNumber(size_t threadNumber);
+
         uint32_t Crc32(const void* src, size_t size);
 
         uint32_t Crc32c(const void * src, size_t size);
@@ -355,6 +357,9 @@ namespace Simd
         void MedianFilterSquare5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height,
             size_t channelCount, uint8_t * dst, size_t dstStride);
 
+        void MedianFilterSquare(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+            size_t channelCount, size_t radius, uint8_t * dst, size_t dstStride);
+
         void NeuralConvert(const uint8_t * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride, int inversion);
 
         void NeuralProductSum(const float * a, const float * b, size_t size, float * sum);
@@ -452,6 +457,9 @@ namespace Simd
 
         void SegmentationFillSingleHoles(uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t index);
 
+        size_t SegmentationLabelComponents(const uint8_t * mask, size_t maskStride, size_t width, size_t height, uint8_t index,
+            SimdSegmentationConnectivityType connectivity, uint32_t * labels, size_t labelsStride, SimdSegmentationComponent ** components);
+
         void SegmentationPropagate2x2(const uint8_t * parent, size_t parentStride, size_t width, size_t height,
             uint8_t * child, size_t childStride, const uint8_t * difference, size_t differenceStride,
             uint8_t currentIndex, uint8_t invalidIndex, uint8_t emptyIndex, uint8_t differenceThreshold);
@@ -482,6 +490,8 @@ namespace Simd
 
         void SobelDyAbsSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum);
 
+        void Canny(const uint8_t * src, size_t srcStride, size_t width, size_t height, int lowThreshold, int highThreshold, uint8_t * dst, size_t dstStride);
+
         void ContourMetrics(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
 
         void ContourMetricsMasked(const uint8_t * src, size_t srcStride, size_t width, size_t height,
@@ -535,6 +545,10 @@ namespace Simd
         void SynetAdd8i(const uint8_t* aData, const float* aScale, const float* aShift, const uint8_t* bData, const float* bScale, const float* bShift,
             uint8_t* cData, const float* cScale, const float* cShift, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format, SimdSynetCompatibilityType compatibility);
 
+        void SynetArgMax32f(const float* src, size_t outer, size_t count, size_t inner, int32_t* dst);
+
+        void SynetArgMin32f(const float* src, size_t outer, size_t count, size_t inner, int32_t* dst);
+
         void SynetChannelSum16b(const uint16_t* src, size_t channels, size_t spatial, SimdTensorFormatType format, float* sum);
 
         void SynetConvert32fTo8u(const float* src, size_t batch, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* scale, const float* shift, uint8_t* dst, SimdSynetCompatibilityType compatibility);
@@ -617,6 +631,10 @@ namespace Simd
 
         void SynetTiledScale2D32f(const float* src, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* ver, const float* hor, float* dst);
         
+        void SynetTopK32f(const float* src, size_t outer, size_t count, size_t inner, size_t k, SimdBool largest, SimdBool sorted, float* dstVal, int32_t* dstIdx);
+
+        void SynetTopK16b(const uint16_t* src, size_t outer, size_t count, size_t inner, size_t k, SimdBool largest, SimdBool sorted, uint16_t* dstVal, int32_t* dstIdx);
+
         void SynetUnaryOperation32f(const float* src, size_t size, SimdSynetUnaryOperation32fType type, float* dst);
 
         void TextureBoostedSaturatedGradient(const uint8_t * src, size_t srcStride, size_t width, size_t height,
@@ -0,0 +1,195 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdCanny.h"
+#include "Simd/SimdBase.h"
+
+#include <vector>
+
+namespace Simd
+{
+    namespace Base
+    {
+        void CannyGradientRow(const uint8_t* src0, const uint8_t* src1, const uint8_t* src2, size_t width, int16_t* dx, int16_t* dy, int16_t* mag)
+        {
+            if (width == 1)
+            {
+                CannyGradient(src0, src1, src2, 0, 0, 0, dx, dy, mag);
+                return;
+            }
+            CannyGradient(src0, src1, src2, 0, 0, 1, dx, dy, mag);
+            for (size_t x = 1; x < width - 1; ++x)
+                CannyGradient(src0, src1, src2, x - 1, x, x + 1, dx, dy, mag);
+            CannyGradient(src0, src1, src2, width - 2, width - 1, width - 1, dx, dy, mag);
+        }
+
+        void CannyNonMaxRow(const int16_t* dx, const int16_t* dy, const int16_t* mag0, const int16_t* mag1, const int16_t* mag2, size_t width, int16_t low, int16_t high, uint8_t* map)
+        {
+            for (size_t x = 0; x < width; ++x)
+            {
+                int m = mag1[x];
+                bool max = false;
+                if (m > low)
+                {
+                    switch (CannyDirection(dx[x], dy[x]))
+                    {
+                    case 0: max = m > mag1[x - 1] && m >= mag1[x + 1]; break;
+                    case 1: max = m > mag0[x - 1] && m > mag2[x + 1]; break;
+                    case 2: max = m > mag0[x] && m >= mag2[x]; break;
+                    default: max = m > mag0[x + 1] && m > mag2[x - 1]; break;
+                    }
+                }
+                map[x] = max ? (m > high ? 2 : 1) : 0;
+            }
+        }
+
+        void CannyEdgesRow(const uint8_t* map, size_t width, uint8_t* dst)
+        {
+            for (size_t x = 0; x < width; ++x)
+                dst[x] = map[x] == 2 ? 0xFF : 0;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        typedef std::vector<uint8_t*> CannyStack;
+
+        static void CannyStrong(uint8_t* map, size_t width, CannyStack& stack)
+        {
+            size_t width8 = AlignLo(width, 8), x = 0;
+            for (; x < width8; x += 8)
+            {
+                if ((*(uint64_t*)(map + x) & 0x0202020202020202) == 0)
+                    continue;
+                for (size_t i = x; i < x + 8; ++i)
+                    if (map[i] == 2)
+                        stack.push_back(map + i);
+            }
+            for (; x < width; ++x)
+                if (map[x] == 2)
+                    stack.push_back(map + x);
+        }
+
+        static void CannyHysteresis(const uint8_t* lo, const uint8_t* hi, ptrdiff_t stride, CannyStack& stack)
+        {
+            const ptrdiff_t offsets[8] = { -stride - 1, -stride, -stride + 1, -1, 1, stride - 1, stride, stride + 1 };
+            while (stack.size())
+            {
+                uint8_t* p = stack.back();
+                stack.pop_back();
+                for (size_t i = 0; i < 8; ++i)
+                {
+                    uint8_t* n = p + offsets[i];
+                    if (n >= lo && n < hi && *n == 1)
+                    {
+                        *n = 2;
+                        stack.push_back(n);
+                    }
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        CannyEdgeDetector::CannyEdgeDetector()
+        {
+            _gradient = CannyGradientRow;
+            _nonMax = CannyNonMaxRow;
+            _edges = CannyEdgesRow;
+        }
+
+        void CannyEdgeDetector::Run(const uint8_t* src, size_t srcStride, size_t width, size_t height, int lowThreshold, int highThreshold, uint8_t* dst, size_t dstStride)
+        {
+            if (lowThreshold > highThreshold)
+                Swap(lowThreshold, highThreshold);
+            int16_t low = (int16_t)Simd::RestrictRange(lowThreshold, -1, 0x7FFF);
+            int16_t high = (int16_t)Simd::RestrictRange(highThreshold, -1, 0x7FFF);
+
+            size_t stride = width + 2, threads = GetThreadNumber();
+            Array8u map(stride * (height + 2), true);
+            std::vector<size_t> bands(threads + 1, 0);
+            Simd::Parallel(0, height, [&](size_t thread, size_t begin, size_t end)
+            {
+                Array16i buf(stride * 9, true);
+                int16_t* dx[3], * dy[3], * mag[3];
+                for (size_t i = 0; i < 3; ++i)
+                {
+                    dx[i] = buf.data + (i * 3 + 0) * stride;
+                    dy[i] = buf.data + (i * 3 + 1) * stride;
+                    mag[i] = buf.data + (i * 3 + 2) * stride + 1;
+                }
+                auto gradient = [&](ptrdiff_t row, size_t i)
+                {
+                    if (row < 0 || row >= (ptrdiff_t)height)
+                        memset(mag[i], 0, width * sizeof(int16_t));
+                    else
+                    {
+                        const uint8_t* src1 = src + row * srcStride;
+                        const uint8_t* src0 = row > 0 ? src1 - srcStride : src1;
+                        const uint8_t* src2 = row < (ptrdiff_t)height - 1 ? src1 + srcStride : src1;
+                        _gradient(src0, src1, src2, width, dx[i], dy[i], mag[i]);
+                    }
+                };
+                size_t prev = 0, curr = 1, next = 2;
+                gradient(begin - 1, prev);
+                gradient(begin, curr);
+                for (size_t y = begin; y < end; ++y)
+                {
+                    gradient(y + 1, next);
+                    _nonMax(dx[curr], dy[curr], mag[prev], mag[curr], mag[next], width, low, high, map.data + (y + 1) * stride + 1);
+                    size_t tmp = prev;
+                    prev = curr, curr = next, next = tmp;
+                }
+
+                CannyStack stack;
+                for (size_t y = begin; y < end; ++y)
+                    CannyStrong(map.data + (y + 1) * stride + 1, width, stack);
+                CannyHysteresis(map.data + (begin + 1) * stride, map.data + (end + 1) * stride, stride, stack);
+                bands[thread + 1] = end;
+            }, threads, 16);
+
+            CannyStack stack;
+            for (size_t t = 1; t < bands.size(); ++t)
+            {
+                if (bands[t] == 0 || bands[t] == height)
+                    continue;
+                CannyStrong(map.data + bands[t] * stride + 1, width, stack);
+                CannyStrong(map.data + (bands[t] + 1) * stride + 1, width, stack);
+            }
+            CannyHysteresis(map.data, map.data + map.size, stride, stack);
+
+            for (size_t y = 0; y < height; ++y)
+                _edges(map.data + (y + 1) * stride + 1, width, dst + y * dstStride);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void Canny(const uint8_t* src, size_t srcStride, size_t width, size_t height, int lowThreshold, int highThreshold, uint8_t* dst, size_t dstStride)
+        {
+            CannyEdgeDetector detector;
+            detector.Run(src, srcStride, width, height, lowThreshold, highThreshold, dst, dstStride);
+        }
+    }
+}
@@ -0,0 +1,268 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdDefs.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdCustomFilter.h"
+
+namespace Simd
+{
+    CustomFilterParam::CustomFilterParam(size_t w, size_t h, size_t c, SimdFilterChannelType t, size_t sx, size_t sy, bool s, SimdFilterBorderType b, size_t a)
+        : width(w)
+        , height(h)
+        , channels(c)
+        , type(t)
+        , sizeX(sx)
+        , sizeY(sy)
+        , separable(s)
+        , border(b)
+        , align(a)
+    {
+    }
+
+    bool CustomFilterParam::Valid() const
+    {
+        return
+            height > 0 &&
+            width > 0 &&
+            channels > 0 && channels <= 4 &&
+            (type == SimdFilterChannel8u || type == SimdFilterChannel16u || type == SimdFilterChannel32f) &&
+            sizeX > 0 && sizeY > 0 &&
+            (border == SimdFilterBorderReplicate || border == SimdFilterBorderReflect || border == SimdFilterBorderConstant) &&
+            align >= sizeof(float);
+    }
+
+    size_t CustomFilterParam::ElementSize() const
+    {
+        switch (type)
+        {
+        case SimdFilterChannel8u: return 1;
+        case SimdFilterChannel16u: return 2;
+        case SimdFilterChannel32f: return 4;
+        default: return 0;
+        }
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    CustomFilter::CustomFilter(const CustomFilterParam& param)
+        : _param(param)
+    {
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        static void ToFloat8u(const uint8_t* src, size_t size, float* dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = float(src[i]);
+        }
+
+        static void ToFloat16u(const uint8_t* src, size_t size, float* dst)
+        {
+            const uint16_t* src16u = (const uint16_t*)src;
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = float(src16u[i]);
+        }
+
+        static void ToFloat32f(const uint8_t* src, size_t size, float* dst)
+        {
+            memcpy(dst, src, size * sizeof(float));
+        }
+
+        static void FromFloat8u(const float* src, size_t size, uint8_t* dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = (uint8_t)CustomFilterRound(src[i], 255.0f);
+        }
+
+        static void FromFloat16u(const float* src, size_t size, uint8_t* dst)
+        {
+            uint16_t* dst16u = (uint16_t*)dst;
+            for (size_t i = 0; i < size; ++i)
+                dst16u[i] = (uint16_t)CustomFilterRound(src[i], 65535.0f);
+        }
+
+        static void FromFloat32f(const float* src, size_t size, uint8_t* dst)
+        {
+            memcpy(dst, src, size * sizeof(float));
+        }
+
+        template<bool add> void RowFilter(const float* src, size_t size, size_t step, const float* weight, size_t kernel, float* dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                float sum = add ? dst[i] : 0.0f;
+                for (size_t k = 0; k < kernel; ++k)
+                    sum += weight[k] * src[i + k * step];
+                dst[i] = sum;
+            }
+        }
+
+        static void ColFilter(const float* const* rows, size_t size, const float* weight, size_t kernel, float* dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                float sum = 0.0f;
+                for (size_t k = 0; k < kernel; ++k)
+                    sum += weight[k] * rows[k][i];
+                dst[i] = sum;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        CustomFilterDefault::CustomFilterDefault(const CustomFilterParam& param, const float* kernelX, const float* kernelY)
+            : Simd::CustomFilter(param)
+        {
+            _size = _param.width * _param.channels;
+            _rowStride = AlignHi(_size, _param.align / sizeof(float));
+            _padStride = AlignHi(_size + (_param.sizeX - 1) * _param.channels, _param.align / sizeof(float));
+            _kernelX.Assign(kernelX, _param.separable ? _param.sizeX : _param.sizeX * _param.sizeY);
+            if (_param.separable)
+                _kernelY.Assign(kernelY, _param.sizeY);
+            switch (_param.type)
+            {
+            case SimdFilterChannel8u: _toFloat = ToFloat8u, _fromFloat = FromFloat8u; break;
+            case SimdFilterChannel16u: _toFloat = ToFloat16u, _fromFloat = FromFloat16u; break;
+            default: _toFloat = ToFloat32f, _fromFloat = FromFloat32f; break;
+            }
+            _rowFilter = RowFilter<false>;
+            _rowFilterAdd = RowFilter<true>;
+            _colFilter = ColFilter;
+        }
+
+        void CustomFilterDefault::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        {
+            const CustomFilterParam& p = _param;
+            size_t threads = GetThreadNumber();
+            size_t bufSize = p.separable ? _padStride + (p.sizeY + 1) * _rowStride : p.sizeY * _padStride + _rowStride;
+            if (_buffers.size() < threads)
+                _buffers.resize(threads);
+            Simd::Parallel(0, p.height, [&](size_t thread, size_t begin, size_t end)
+            {
+                if (_buffers[thread].size < bufSize)
+                    _buffers[thread].Resize(bufSize);
+                if (p.separable)
+                    RunSeparable(src, srcStride, begin, end, _buffers[thread].data, dst, dstStride);
+                else
+                    Run2d(src, srcStride, begin, end, _buffers[thread].data, dst, dstStride);
+            }, threads, Simd::Max<size_t>(p.sizeY, 16));
+        }
+
+        void CustomFilterDefault::LoadRow(const uint8_t* src, size_t srcStride, ptrdiff_t row, float* pad) const
+        {
+            const CustomFilterParam& p = _param;
+            size_t size = _size + (p.sizeX - 1) * p.channels;
+            row = CustomFilterBorder(row, p.height, p.border);
+            if (row < 0)
+            {
+                memset(pad, 0, size * sizeof(float));
+                return;
+            }
+            ptrdiff_t anchor = p.sizeX / 2, tail = p.sizeX - 1 - anchor, width = p.width;
+            _toFloat(src + row * srcStride, _size, pad + anchor * p.channels);
+            for (ptrdiff_t x = -anchor; x < width + tail; ++x)
+            {
+                if (x == 0)
+                    x = width;
+                ptrdiff_t map = CustomFilterBorder(x, width, p.border);
+                float* dst = pad + (x + anchor) * p.channels;
+                for (size_t c = 0; c < p.channels; ++c)
+                    dst[c] = map < 0 ? 0.0f : pad[(map + anchor) * p.channels + c];
+            }
+        }
+
+        void CustomFilterDefault::RunSeparable(const uint8_t* src, size_t srcStride, size_t begin, size_t end, float* buf, uint8_t* dst, size_t dstStride) const
+        {
+            const CustomFilterParam& p = _param;
+            ptrdiff_t sizeY = p.sizeY, anchor = p.sizeY / 2;
+            float* pad = buf, * ring = buf + _padStride, * acc = ring + sizeY * _rowStride;
+            Array<const float*> rows(sizeY);
+            for (ptrdiff_t v = begin - anchor, last = begin - anchor + sizeY - 1; v < last; ++v)
+            {
+                LoadRow(src, srcStride, v, pad);
+                _rowFilter(pad, _size, p.channels, _kernelX.data, p.sizeX, ring + ((v % sizeY + sizeY) % sizeY) * _rowStride);
+            }
+            for (size_t y = begin; y < end; ++y)
+            {
+                ptrdiff_t top = y - anchor, v = top + sizeY - 1;
+                LoadRow(src, srcStride, v, pad);
+                _rowFilter(pad, _size, p.channels, _kernelX.data, p.sizeX, ring + ((v % sizeY + sizeY) % sizeY) * _rowStride);
+                for (ptrdiff_t k = 0; k < sizeY; ++k)
+                    rows[k] = ring + (((top + k) % sizeY + sizeY) % sizeY) * _rowStride;
+                if (p.type == SimdFilterChannel32f)
+                    _colFilter(rows.data, _size, _kernelY.data, sizeY, (float*)(dst + y * dstStride));
+                else
+                {
+                    _colFilter(rows.data, _size, _kernelY.data, sizeY, acc);
+                    _fromFloat(acc, _size, dst + y * dstStride);
+                }
+            }
+        }
+
+        void CustomFilterDefault::Run2d(const uint8_t* src, size_t srcStride, size_t begin, size_t end, float* buf, uint8_t* dst, size_t dstStride) const
+        {
+            const CustomFilterParam& p = _param;
+            ptrdiff_t sizeY = p.sizeY, anchor = p.sizeY / 2;
+            float* ring = buf, * acc = buf + sizeY * _padStride;
+            for (ptrdiff_t v = begin - anchor, last = begin - anchor + sizeY - 1; v < last; ++v)
+                LoadRow(src, srcStride, v, ring + ((v % sizeY + sizeY) % sizeY) * _padStride);
+            for (size_t y = begin; y < end; ++y)
+            {
+                ptrdiff_t top = y - anchor, v = top + sizeY - 1;
+                LoadRow(src, srcStride, v, ring + ((v % sizeY + sizeY) % sizeY) * _padStride);
+                float* out = p.type == SimdFilterChannel32f ? (float*)(dst + y * dstStride) : acc;
+                for (ptrdiff_t k = 0; k < sizeY; ++k)
+                {
+                    const float* row = ring + (((top + k) % sizeY + sizeY) % sizeY) * _padStride;
+                    (k ? _rowFilterAdd : _rowFilter)(row, _size, p.channels, _kernelX.data + k * p.sizeX, p.sizeX, out);
+                }
+                if (p.type != SimdFilterChannel32f)
+                    _fromFloat(acc, _size, dst + y * dstStride);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* CustomFilterSeparableInit(size_t width, size_t height, size_t channels, SimdFilterChannelType type, const float* kernelX, size_t sizeX, const float* kernelY, size_t sizeY, SimdFilterBorderType border)
+        {
+            CustomFilterParam param(width, height, channels, type, sizeX, sizeY, true, border, sizeof(void*));
+            if (!param.Valid() || kernelX == NULL || kernelY == NULL)
+                return NULL;
+            return new CustomFilterDefault(param, kernelX, kernelY);
+        }
+
+        void* CustomFilter2dInit(size_t width, size_t height, size_t channels, SimdFilterChannelType type, const float* kernel, size_t sizeX, size_t sizeY, SimdFilterBorderType border)
+        {
+            CustomFilterParam param(width, height, channels, type, sizeX, sizeY, false, border, sizeof(void*));
+            if (!param.Valid() || kernel == NULL)
+                return NULL;
+            return new CustomFilterDefault(param, kernel, NULL);
+        }
+    }
+}
@@ -22,12 +22,17 @@
 * SOFTWARE.
 */
 #include "Simd/SimdImageLoad.h"
+#include "Simd/SimdImageRaw.h"
 #include "Simd/SimdArray.h"
 #include "Simd/SimdCpu.h"
 #include "Simd/SimdBase.h"
+#include "Simd/SimdResizer.h"
+#include "Simd/SimdParallel.hpp"
 
 #include <stdio.h>
 
+#include <atomic>
+
 #if defined(_MSC_VER)
 #pragma warning (push)
 #pragma warning (disable: 4996)
@@ -35,29 +40,164 @@
 
 namespace Simd
 {
-    uint8_t* ImageLoadFromFile(const ImageLoadFromMemoryPtr loader, const char* path, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format)
+    static bool ReadFile(const char* path, Array8u& buffer)
     {
-        uint8_t* data = NULL;
+        bool result = false;
         ::FILE* file = ::fopen(path, "rb");
         if (file)
         {
             ::fseek(file, 0, SEEK_END);
-            Array8u buffer(::ftell(file));
+            buffer.Resize(::ftell(file));
             ::fseek(file, 0, SEEK_SET);
-            if (::fread(buffer.data, 1, buffer.size, file) == buffer.size)
-                data = loader(buffer.data, buffer.size, stride, width, height, format);
+            result = ::fread(buffer.data, 1, buffer.size, file) == buffer.size;
             ::fclose(file);
         }
-        return data;
+        return result;
+    }
+
+    uint8_t* ImageLoadFromFile(const ImageLoadFromMemoryPtr loader, const char* path, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format)
+    {
+        Array8u buffer;
+        return ReadFile(path, buffer) ? loader(buffer.data, buffer.size, stride, width, height, format) : NULL;
+    }
+
+    uint8_t* ImageLoadFromFileScaled(const ImageLoadFromMemoryScaledPtr loader, const char* path, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format)
+    {
+        Array8u buffer;
+        return ReadFile(path, buffer) ? loader(buffer.data, buffer.size, scale, stride, width, height, format) : NULL;
+    }
+
+    namespace
+    {
+        struct ImageBuffer
+        {
+            uint8_t* data;
+            size_t stride, width, height, next;
+            SimdPixelFormatType format;
+        };
+
+        SimdBool ImageBufferBand(void* user, const uint8_t* band, size_t stride, size_t width, size_t height, size_t row, size_t rows, SimdPixelFormatType format)
+        {
+            ImageBuffer& dst = *(ImageBuffer*)user;
+            size_t size = width * View<Allocator>::PixelSize((View<Allocator>::Format)format);
+            if (width != dst.width || height != dst.height || row != dst.next || size > dst.stride ||
+                (dst.format != SimdPixelFormatNone && dst.format != format))
+                return SimdFalse;
+            for (size_t r = 0; r < rows; ++r)
+                memcpy(dst.data + (row + r) * dst.stride, band + r * stride, size);
+            dst.next = row + rows;
+            return SimdTrue;
+        }
+    }
+
+    SimdBool ImageLoadToBuffer(const ImageLoadBandsFromMemoryPtr loader, const uint8_t* data, size_t size, uint8_t* dst, size_t stride, size_t width, size_t height, SimdPixelFormatType format)
+    {
+        if (dst == NULL)
+            return SimdFalse;
+        ImageBuffer buffer;
+        buffer.data = dst;
+        buffer.stride = stride;
+        buffer.width = width;
+        buffer.height = height;
+        buffer.next = 0;
+        buffer.format = format;
+        return loader(data, size, format, ImageBufferBand, &buffer) && buffer.next == height ? SimdTrue : SimdFalse;
+    }
+
+    namespace
+    {
+        struct BatchResizer
+        {
+            size_t srcW, srcH, dstW, dstH, channels;
+            void* resizer;
+
+            BatchResizer() : srcW(0), srcH(0), dstW(0), dstH(0), channels(0), resizer(NULL) {}
+            ~BatchResizer() { delete (Deletable*)resizer; }
+
+            Resizer* Get(const ResizerInitPtr init, size_t sW, size_t sH, size_t dW, size_t dH, size_t c, SimdResizeMethodType method)
+            {
+                if (resizer == NULL || sW != srcW || sH != srcH || dW != dstW || dH != dstH || c != channels)
+                {
+                    delete (Deletable*)resizer;
+                    resizer = init(sW, sH, dW, dH, c, SimdResizeChannelByte, method);
+                    srcW = sW, srcH = sH, dstW = dW, dstH = dH, channels = c;
+                }
+                return (Resizer*)resizer;
+            }
+        };
+
+        SIMD_INLINE size_t BatchJpegScale(size_t srcW, size_t srcH, size_t dstW, size_t dstH)
+        {
+            for (size_t scale = 8; scale > 1; scale /= 2)
+                if (srcW >= dstW * scale * 2 && srcH >= dstH * scale * 2)
+                    return scale;
+            return 1;
+        }
+
+        bool ImageLoadBatchItem(const ImageLoadFromMemoryScaledPtr loader, const ResizerInitPtr resizerInit, BatchResizer& batchResizer, SimdImageLoadItem& item, SimdResizeMethodType method)
+        {
+            item.image = NULL;
+            if (item.width == 0 && item.height == 0)
+                return (item.image = loader(item.data, item.size, 1, &item.stride, &item.width, &item.height, &item.format)) != NULL;
+            SimdImageFileType file;
+            size_t srcW, srcH;
+            SimdPixelFormatType srcF;
+            if (!Base::ImageLoadInfoFromMemory(item.data, item.size, &file, &srcW, &srcH, &srcF))
+                return false;
+            size_t dstW = item.width, dstH = item.height;
+            if (dstW == 0)
+                dstW = Max<size_t>((srcW * dstH + srcH / 2) / srcH, 1);
+            if (dstH == 0)
+                dstH = Max<size_t>((srcH * dstW + srcW / 2) / srcW, 1);
+            size_t scale = file == SimdImageFileJpeg ? BatchJpegScale(srcW, srcH, dstW, dstH) : 1;
+            size_t stride;
+            uint8_t* image = loader(item.data, item.size, scale, &stride, &srcW, &srcH, &item.format);
+            if (image == NULL)
+                return false;
+            if (srcW == dstW && srcH == dstH)
+            {
+                item.image = image, item.stride = stride, item.width = dstW, item.height = dstH;
+                return true;
+            }
+            size_t channels = View<Allocator>::PixelSize((View<Allocator>::Format)item.format);
+            Resizer* resizer = batchResizer.Get(resizerInit, srcW, srcH, dstW, dstH, channels, method);
+            if (resizer)
+            {
+                item.stride = AlignHi(dstW * channels, SIMD_ALIGN);
+                item.image = (uint8_t*)Allocate(item.stride * dstH, SIMD_ALIGN);
+                resizer->Run(image, stride, item.image, item.stride);
+                item.width = dstW, item.height = dstH;
+            }
+            Free(image);
+            return item.image != NULL;
+        }
+    }
+
+    size_t ImageLoadBatchFromMemory(const ImageLoadFromMemoryScaledPtr loader, const ResizerInitPtr resizerInit, SimdImageLoadItem* items, size_t count, SimdResizeMethodType method)
+    {
+        std::atomic<size_t> next(0), done(0);
+        size_t threads = Min(Base::GetThreadNumber(), count);
+        Parallel(0, threads, [&](size_t thread, size_t begin, size_t end)
+        {
+            BatchResizer resizer;
+            for (size_t i = next++; i < count; i = next++)
+            {
+                items[i].status = ImageLoadBatchItem(loader, resizerInit, resizer, items[i], method) ? SimdTrue : SimdFalse;
+                if (items[i].status)
+                    done++;
+            }
+        }, threads);
+        return done;
     }
 
     //-------------------------------------------------------------------------------------------------
 
-    ImageLoaderParam::ImageLoaderParam(const uint8_t* d, size_t s, SimdPixelFormatType f)
+    ImageLoaderParam::ImageLoaderParam(const uint8_t* d, size_t s, SimdPixelFormatType f, size_t sc)
         : data(d)
         , size(s)
         , format(f)
         , file(SimdImageFileUndefined)
+        , scale(sc)
     {
     }
 
@@ -82,6 +222,8 @@ namespace Simd
             const uint8_t SIGNATURE[8] = { 137, 80, 78, 71, 13, 10, 26, 10 };
             if(memcmp(data, SIGNATURE, 8) == 0)
                 file = SimdImageFilePng;
+            if (memcmp(data, ImageRawSignature, 8) == 0)
+                file = SimdImageFileRaw;
         }
         if (size >= 2)
         {
@@ -90,8 +232,13 @@ namespace Simd
             if (data[0] == 'B' && data[1] == 'M')
                 file = SimdImageFileBmp;
         }
+        if (size >= 4)
+        {
+            if (data[0] == 'q' && data[1] == 'o' && data[2] == 'i' && data[3] == 'f')
+                file = SimdImageFileQoi;
+        }
         return
-            file != SimdImageFileUndefined && 
+            file != SimdImageFileUndefined && (scale == 1 || scale == 2 || scale == 4 || scale == 8) &&
                 (format == SimdPixelFormatNone || format == SimdPixelFormatGray8 || 
                 format == SimdPixelFormatBgr24 || format == SimdPixelFormatBgra32 || 
                 format == SimdPixelFormatRgb24 || format == SimdPixelFormatRgba32);
@@ -112,6 +259,8 @@ namespace Simd
             case SimdImageFilePng: return new ImagePngLoader(param);
             case SimdImageFileJpeg: return new ImageJpegLoader(param);
             case SimdImageFileBmp: return new ImageBmpLoader(param);
+            case SimdImageFileQoi: return new ImageQoiLoader(param);
+            case SimdImageFileRaw: return new ImageRawLoader(param);
             default:
                 return NULL;
             }
@@ -131,6 +280,196 @@ namespace Simd
             }
             return NULL;
         }
+
+        uint8_t* ImageLoadFromMemoryScaled(const uint8_t* data, size_t size, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format)
+        {
+            ImageLoaderParam param(data, size, *format, scale);
+            if (param.Validate())
+            {
+                Holder<ImageLoader> loader(CreateImageLoader(param));
+                if (loader)
+                {
+                    if (loader->FromStream())
+                        return loader->Release(stride, width, height, format);
+                }
+            }
+            return NULL;
+        }
+
+        bool ImageLoadBandsFromMemory(const uint8_t* data, size_t size, SimdPixelFormatType format, SimdImageBandCallbackPtr callback, void* user)
+        {
+            ImageLoaderParam param(data, size, format);
+            if (param.Validate() && callback)
+            {
+                Holder<ImageLoader> loader(CreateImageLoader(param));
+                if (loader)
+                    return loader->ToBands(callback, user);
+            }
+            return false;
+        }
+
+        uint8_t* ImageLoadRoiFromMemory(const uint8_t* data, size_t size, size_t left, size_t top, size_t right, size_t bottom, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format)
+        {
+            ImageLoaderParam param(data, size, *format);
+            if (param.Validate())
+            {
+                Holder<ImageLoader> loader(CreateImageLoader(param));
+                if (loader)
+                {
+                    if (loader->FromStreamRoi(left, top, right, bottom))
+                        return loader->Release(stride, width, height, format);
+                }
+            }
+            return NULL;
+        }
+
+        static bool JpegReadSize(InputMemoryStream& stream, uint32_t& width, uint32_t& height)
+        {
+            if (!stream.Seek(2))
+                return false;
+            for (;;)
+            {
+                uint8_t marker;
+                if (!stream.Read8u(marker) || marker != 0xFF)
+                    return false;
+                while (marker == 0xFF)
+                {
+                    if (!stream.Read8u(marker))
+                        return false;
+                }
+                if (marker == 0x01 || (marker >= 0xD0 && marker <= 0xD8))
+                    continue;
+                if (marker == 0xD9 || marker == 0xDA)
+                    return false;
+                uint16_t length;
+                if (!stream.ReadBe16u(length) || length < 2)
+                    return false;
+                if (marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC)
+                {
+                    uint8_t precision;
+                    uint16_t h, w;
+                    if (!stream.Read8u(precision) || !stream.ReadBe16u(h) || !stream.ReadBe16u(w))
+                        return false;
+                    width = w;
+                    height = h;
+                    return true;
+                }
+                if (!stream.Skip(length - 2))
+                    return false;
+            }
+        }
+
+        static bool BmpReadSize(InputMemoryStream& stream, uint32_t& width, uint32_t& height, uint16_t& bpp)
+        {
+            uint32_t headerSize;
+            if (!stream.Seek(14) || !stream.Read32u(headerSize))
+                return false;
+            if (headerSize == 12)
+            {
+                uint16_t w, h;
+                if (!stream.Read16u(w) || !stream.Read16u(h))
+                    return false;
+                width = w;
+                height = h;
+            }
+            else if (!stream.Read32u(width) || !stream.Read32u(height))
+                return false;
+            uint16_t planes;
+            return stream.Read16u(planes) && stream.Read16u(bpp);
+        }
+
+        bool ImageLoadInfoFromMemory(const uint8_t* data, size_t size, SimdImageFileType* file, size_t* width, size_t* height, SimdPixelFormatType* format)
+        {
+            ImageLoaderParam param(data, size, SimdPixelFormatNone);
+            if (!param.Validate())
+                return false;
+            InputMemoryStream stream(data, size);
+            uint32_t w = 0, h = 0;
+            SimdPixelFormatType f = SimdPixelFormatNone;
+            switch (param.file)
+            {
+            case SimdImageFilePgmTxt:
+            case SimdImageFilePgmBin:
+            case SimdImageFilePpmTxt:
+            case SimdImageFilePpmBin:
+                if (!stream.Seek(3) || !stream.ReadUnsigned(w) || !stream.ReadUnsigned(h))
+                    return false;
+                f = param.file == SimdImageFilePgmTxt || param.file == SimdImageFilePgmBin ? SimdPixelFormatGray8 : SimdPixelFormatRgb24;
+                break;
+            case SimdImageFilePng:
+            {
+                uint32_t length, type;
+                if (!stream.Seek(8) || !stream.ReadBe32u(length) || !stream.ReadBe32u(type) || type != 0x49484452 || 
+                    !stream.ReadBe32u(w) || !stream.ReadBe32u(h))
+                    return false;
+                f = SimdPixelFormatRgba32;
+                break;
+            }
+            case SimdImageFileJpeg:
+                if (!JpegReadSize(stream, w, h))
+                    return false;
+                f = SimdPixelFormatRgb24;
+                break;
+            case SimdImageFileBmp:
+            {
+                uint16_t bpp;
+                if (!BmpReadSize(stream, w, h, bpp))
+                    return false;
+                f = bpp == 32 ? SimdPixelFormatBgra32 : SimdPixelFormatBgr24;
+                break;
+            }
+            case SimdImageFileQoi:
+            {
+                uint8_t channels;
+                if (!stream.Seek(4) || !stream.ReadBe32u(w) || !stream.ReadBe32u(h) || !stream.Read8u(channels))
+                    return false;
+                f = channels == 4 ? SimdPixelFormatRgba32 : SimdPixelFormatRgb24;
+                break;
+            }
+            case SimdImageFileRaw:
+            {
+                ImageRawHeader header;
+                if (!stream.Read(header) || !header.Valid(size))
+                    return false;
+                w = header.width;
+                h = header.height;
+                f = (SimdPixelFormatType)header.format;
+                break;
+            }
+            default:
+                return false;
+            }
+            if (w == 0 || h == 0)
+                return false;
+            if (file)
+                *file = param.file;
+            if (width)
+                *width = w;
+            if (height)
+                *height = h;
+            if (format)
+                *format = f;
+            return true;
+        }
+
+        uint8_t* JpegLoadAsYuvFromMemory(const uint8_t* data, size_t size, SimdYuvLayoutType layout, size_t* width, size_t* height, uint8_t** planes, size_t* strides)
+        {
+            ImageLoaderParam param(data, size, SimdPixelFormatBgra32);
+            if (param.Validate() && param.file == SimdImageFileJpeg)
+            {
+                ImageJpegLoader loader(param);
+                return loader.ToYuv(layout, width, height, planes, strides);
+            }
+            return NULL;
+        }
+
+        void* JpegStreamDecoderInit(SimdPixelFormatType format, size_t frames)
+        {
+            if (!JpegStreamDecoder::Valid(format, frames))
+                return NULL;
+            ImageLoaderParam param(NULL, 0, format);
+            return new JpegStreamDecoder(new ImageJpegLoader(param), frames);
+        }
     }
 }
 
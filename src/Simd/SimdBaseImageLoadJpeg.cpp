@@ -113,10 +113,24 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
-        JpegContext::JpegContext(InputMemoryStream* s)
+        JpegContext::JpegContext(InputMemoryStream* s, size_t scale)
             : stream(s)
             , img_n(0)
+            , scale_shift(scale == 8 ? 3 : (scale == 4 ? 2 : (scale == 2 ? 1 : 0)))
+            , band_callback(NULL)
+            , band_user(NULL)
+            , band_format(SimdPixelFormatNone)
+            , band_window(0)
+            , band_units(0)
+            , band_emit(0)
+            , band_done(0)
+            , luma_only(0)
+            , roi(0)
+            , roi_skip(0)
+            , idctBlocks2(NULL)
         {
+            block_size = 8 >> scale_shift;
+            memset(huff_key_size, 0, sizeof(huff_key_size));
         }
 
         void JpegContext::Reset()
@@ -129,6 +143,7 @@ namespace Simd
             marker = JpegMarkerNone;
             todo = restart_interval ? restart_interval : 0x7fffffff;
             eob_run = 0;
+            roi_skip = 0;
         }
 
         //-------------------------------------------------------------------------------------------------
@@ -524,6 +539,108 @@ namespace Simd
                 JpegIdct<int, uint8_t, 1>(buf + 8 * i, dst);
         }
 
+        // Reduced size IDCT (jidctred.c from IJG libjpeg): 4x4 and 2x2 outputs are computed from all 8x8 coefficients.
+
+        const int JpegIdctRedBits = 13;
+        const int JpegIdctRedPass = 2;
+
+        SIMD_INLINE int JpegIdctRedConst(float value)
+        {
+            return int(value * float(1 << JpegIdctRedBits) + 0.5f);
+        }
+
+        const int JpegIdctRedK00 = JpegIdctRedConst(1.847759065f);
+        const int JpegIdctRedK01 = JpegIdctRedConst(0.765366865f);
+        const int JpegIdctRedK02 = JpegIdctRedConst(0.211164243f);
+        const int JpegIdctRedK03 = JpegIdctRedConst(1.451774981f);
+        const int JpegIdctRedK04 = JpegIdctRedConst(2.172734803f);
+        const int JpegIdctRedK05 = JpegIdctRedConst(1.061594337f);
+        const int JpegIdctRedK06 = JpegIdctRedConst(0.509795579f);
+        const int JpegIdctRedK07 = JpegIdctRedConst(0.601344887f);
+        const int JpegIdctRedK08 = JpegIdctRedConst(0.899976223f);
+        const int JpegIdctRedK09 = JpegIdctRedConst(2.562915447f);
+        const int JpegIdctRedK10 = JpegIdctRedConst(0.720959822f);
+        const int JpegIdctRedK11 = JpegIdctRedConst(0.850430095f);
+        const int JpegIdctRedK12 = JpegIdctRedConst(1.272758580f);
+        const int JpegIdctRedK13 = JpegIdctRedConst(3.624509785f);
+
+        template<class S, class D, int s> SIMD_INLINE void JpegIdct4(const S* src, D* dst)
+        {
+            const int shift = s == 8 ? JpegIdctRedBits - JpegIdctRedPass + 1 : JpegIdctRedBits + JpegIdctRedPass + 4;
+            const int round = (1 << (shift - 1)) + (s == 8 ? 0 : 128 << shift);
+            int t0 = src[s * 0] * (1 << (JpegIdctRedBits + 1));
+            int t2 = src[s * 2] * JpegIdctRedK00 - src[s * 6] * JpegIdctRedK01;
+            int x0 = t0 + t2 + round;
+            int x1 = t0 - t2 + round;
+            int z1 = src[s * 7], z2 = src[s * 5], z3 = src[s * 3], z4 = src[s * 1];
+            t0 = z4 * JpegIdctRedK05 + z2 * JpegIdctRedK03 - z1 * JpegIdctRedK02 - z3 * JpegIdctRedK04;
+            t2 = z4 * JpegIdctRedK09 + z3 * JpegIdctRedK08 - z1 * JpegIdctRedK06 - z2 * JpegIdctRedK07;
+            if (s == 8)
+            {
+                dst[0] = (x0 + t2) >> shift;
+                dst[24] = (x0 - t2) >> shift;
+                dst[8] = (x1 + t0) >> shift;
+                dst[16] = (x1 - t0) >> shift;
+            }
+            else
+            {
+                dst[0] = RestrictRange((x0 + t2) >> shift);
+                dst[3] = RestrictRange((x0 - t2) >> shift);
+                dst[1] = RestrictRange((x1 + t0) >> shift);
+                dst[2] = RestrictRange((x1 - t0) >> shift);
+            }
+        }
+
+        static void JpegIdctBlock4x4(const int16_t* src, uint8_t* dst, int stride)
+        {
+            int buf[32];
+            for (int i = 0; i < 8; ++i)
+                if (i != 4)
+                    JpegIdct4<short, int, 8>(src + i, buf + i);
+            for (int i = 0; i < 4; ++i, dst += stride)
+                JpegIdct4<int, uint8_t, 1>(buf + 8 * i, dst);
+        }
+
+        template<class S, class D, int s> SIMD_INLINE void JpegIdct2(const S* src, D* dst)
+        {
+            const int shift = s == 8 ? JpegIdctRedBits - JpegIdctRedPass + 2 : JpegIdctRedBits + JpegIdctRedPass + 5;
+            const int round = (1 << (shift - 1)) + (s == 8 ? 0 : 128 << shift);
+            int x0 = src[s * 0] * (1 << (JpegIdctRedBits + 2)) + round;
+            int t0 = src[s * 1] * JpegIdctRedK13 + src[s * 5] * JpegIdctRedK11 - src[s * 3] * JpegIdctRedK12 - src[s * 7] * JpegIdctRedK10;
+            if (s == 8)
+            {
+                dst[0] = (x0 + t0) >> shift;
+                dst[8] = (x0 - t0) >> shift;
+            }
+            else
+            {
+                dst[0] = RestrictRange((x0 + t0) >> shift);
+                dst[1] = RestrictRange((x0 - t0) >> shift);
+            }
+        }
+
+        static void JpegIdctBlock2x2(const int16_t* src, uint8_t* dst, int stride)
+        {
+            int buf[16];
+            for (int i = 1; i < 8; i += 2)
+                JpegIdct2<short, int, 8>(src + i, buf + i);
+            JpegIdct2<short, int, 8>(src, buf);
+            for (int i = 0; i < 2; ++i, dst += stride)
+                JpegIdct2<int, uint8_t, 1>(buf + 8 * i, dst);
+        }
+
+        static void JpegIdctBlock1x1(const int16_t* src, uint8_t* dst, int stride)
+        {
+            dst[0] = RestrictRange((src[0] + 1028) >> 3);
+        }
+
+        static void JpegDequantizeBlocks(int16_t* data, const uint16_t* dequant, int count)
+        {
+            for (int b = 0; b < count; ++b, data += 64)
+                for (int k = 0; k < 64; ++k)
+                    data[k] *= dequant[k];
+        }
+
         static uint8_t JpegGetMarker(JpegContext* j)
         {
             uint8_t x;
@@ -541,34 +658,106 @@ namespace Simd
             return x;
         }
 
+        static int JpegBandRow(JpegContext* z);
+
+        static void JpegSkipEntropyData(JpegContext* z, int restart)
+        {
+            if (z->marker == JpegMarkerNone || (!restart && z->NeedRestart()))
+            {
+                InputMemoryStream* s = z->stream;
+                z->marker = JpegMarkerNone;
+                while (!s->Eof())
+                {
+                    const uint8_t* p = (const uint8_t*)memchr(s->Current(), 0xFF, s->Size() - s->Pos());
+                    s->Seek(p ? p - s->Data() + 1 : s->Size());
+                    int m = s->Get8u();
+                    while (m == 0xFF)
+                        m = s->Get8u();
+                    if (m == 0 || (!restart && m >= 0xD0 && m <= 0xD7))
+                        continue;
+                    z->marker = (unsigned char)m;
+                    break;
+                }
+            }
+            z->code_buffer = 0;
+            z->code_bits = 0;
+            z->nomore = 1;
+        }
+
+        const int JpegRoiMinWidth = 64; // SIMD color converters need rows not shorter than vector width.
+
+        SIMD_INLINE int JpegRoiRows(int beg, int end, int y0, int y1)
+        {
+            return beg <= end && beg < y1 && end >= y0;
+        }
+
+        SIMD_INLINE int JpegRoiIdle(JpegContext* z, int index, int stride, int x0, int y0, int x1, int y1)
+        {
+            if (z->roi && z->restart_interval && z->todo == z->restart_interval)
+            {
+                int beg = index, end = index + z->restart_interval - 1;
+                int rb = beg / stride, re = end / stride, cb = beg % stride, ce = end % stride;
+                int used = rb == re ? JpegRoiRows(rb, rb, y0, y1) && cb < x1 && ce >= x0 :
+                    JpegRoiRows(rb + 1, re - 1, y0, y1) || (JpegRoiRows(rb, rb, y0, y1) && cb < x1) || (JpegRoiRows(re, re, y0, y1) && ce >= x0);
+                z->roi_skip = !used;
+                if (z->roi_skip)
+                    JpegSkipEntropyData(z, 1);
+            }
+            return z->roi_skip;
+        }
+
+
         static int JpegParseEntropyCodedData(JpegContext* z)
         {
             z->Reset();
             if (!z->progressive)
             {
-                SIMD_ALIGNED(16) short data[64];
+                SIMD_ALIGNED(32) short data[128];
                 if (z->scan_n == 1) 
                 {
                     int n = z->order[0];
-                    int w = (z->img_comp[n].x + 7) >> 3;
-                    int h = (z->img_comp[n].y + 7) >> 3;
+                    int w = z->img_comp[n].bw;
+                    int h = z->img_comp[n].bh;
+                    const JpegImgComp& c = z->img_comp[n];
+                    int pair = z->idctBlocks2 ? 1 : 0, luma = z->luma_only && n > 0;
                     for (int j = 0; j < h; ++j) 
                     {
+                        uint8_t* dst = z->img_comp[n].data + z->img_comp[n].w2 * (j * z->block_size - z->img_comp[n].top);
                         for (int i = 0; i < w; ++i) 
                         {
-                            int ha = z->img_comp[n].ha;
-                            if (!JpegDecodeBlock(z, data, z->huff_dc + z->img_comp[n].hd, z->huff_ac + ha, z->huff_ac[ha].fast_ac, n, z->dequant[z->img_comp[n].tq])) 
+                            int ha = z->img_comp[n].ha, second = i & pair;
+                            int skip = luma || j < c.ry0 || j >= c.ry1 || i < c.rx0 || i >= c.rx1;
+                            if (JpegRoiIdle(z, j * w + i, w, c.rx0, c.ry0, c.rx1, c.ry1))
+                                skip = 1;
+                            else if (!JpegDecodeBlock(z, data + 64 * second, z->huff_dc + z->img_comp[n].hd, z->huff_ac + ha, z->huff_ac[ha].fast_ac, n, z->dequant[z->img_comp[n].tq])) 
                                 return 0;
-                            z->idctBlock(data, z->img_comp[n].data + z->img_comp[n].w2 * j * 8 + i * 8, z->img_comp[n].w2);
+                            if (!skip)
+                            {
+                                if (second)
+                                    z->idctBlocks2(data, dst + (i - 1) * z->block_size, z->img_comp[n].w2);
+                                else if (!pair || i + 1 == w)
+                                    z->idctBlock(data, dst + i * z->block_size, z->img_comp[n].w2);
+                            }
                             if (--z->todo <= 0) 
                             {
                                 if (z->code_bits < 24) 
                                     JpegGrowBufferUnsafe(z);
-                                if (!z->NeedRestart()) 
+                                if (!z->NeedRestart())
+                                {
+                                    if (pair && !second && !skip && i + 1 < w)
+                                        z->idctBlock(data, dst + i * z->block_size, z->img_comp[n].w2);
                                     return 1;
+                                }
                                 z->Reset();
                             }
                         }
+                        if (z->band_window && !JpegBandRow(z))
+                            return 0;
+                        if (z->roi && j + 1 == c.ry1 && j + 1 < h)
+                        {
+                            JpegSkipEntropyData(z, 0);
+                            return 1;
+                        }
                     }
                     return 1;
                 }
@@ -576,21 +765,41 @@ namespace Simd
                 {
                     for (int j = 0; j < z->img_mcu_y; ++j) 
                     {
+                        int rows = j >= z->roi_mcu_y0 && j < z->roi_mcu_y1;
                         for (int i = 0; i < z->img_mcu_x; ++i)
                         {
-                            for (int k = 0; k < z->scan_n; ++k)
+                            int used = rows && i >= z->roi_mcu_x0 && i < z->roi_mcu_x1;
+                            int idle = JpegRoiIdle(z, j * z->img_mcu_x + i, z->img_mcu_x, z->roi_mcu_x0, z->roi_mcu_y0, z->roi_mcu_x1, z->roi_mcu_y1);
+                            for (int k = 0; k < z->scan_n && !idle; ++k)
                             {
                                 int n = z->order[k];
+                                int ha = z->img_comp[n].ha;
                                 for (int y = 0; y < z->img_comp[n].v; ++y)
                                 {
-                                    for (int x = 0; x < z->img_comp[n].h; ++x)
+                                    int y2 = (j * z->img_comp[n].v + y) * z->block_size, x = 0;
+                                    uint8_t* dst = z->img_comp[n].data + z->img_comp[n].w2 * (y2 - z->img_comp[n].top) + i * z->img_comp[n].h * z->block_size;
+                                    if ((z->luma_only && n > 0) || !used)
+                                    {
+                                        for (; x < z->img_comp[n].h; ++x)
+                                            if (!JpegDecodeBlock(z, data, z->huff_dc + z->img_comp[n].hd, z->huff_ac + ha, z->huff_ac[ha].fast_ac, n, z->dequant[z->img_comp[n].tq]))
+                                                return 0;
+                                    }
+                                    if (z->idctBlocks2)
+                                    {
+                                        for (; x + 1 < z->img_comp[n].h; x += 2)
+                                        {
+                                            if (!JpegDecodeBlock(z, data + 0, z->huff_dc + z->img_comp[n].hd, z->huff_ac + ha, z->huff_ac[ha].fast_ac, n, z->dequant[z->img_comp[n].tq]))
+                                                return 0;
+                                            if (!JpegDecodeBlock(z, data + 64, z->huff_dc + z->img_comp[n].hd, z->huff_ac + ha, z->huff_ac[ha].fast_ac, n, z->dequant[z->img_comp[n].tq]))
+                                                return 0;
+                                            z->idctBlocks2(data, dst + x * z->block_size, z->img_comp[n].w2);
+                                        }
+                                    }
+                                    for (; x < z->img_comp[n].h; ++x)
                                     {
-                                        int x2 = (i * z->img_comp[n].h + x) * 8;
-                                        int y2 = (j * z->img_comp[n].v + y) * 8;
-                                        int ha = z->img_comp[n].ha;
                                         if (!JpegDecodeBlock(z, data, z->huff_dc + z->img_comp[n].hd, z->huff_ac + ha, z->huff_ac[ha].fast_ac, n, z->dequant[z->img_comp[n].tq])) 
                                             return 0;
-                                        z->idctBlock(data, z->img_comp[n].data + z->img_comp[n].w2 * y2 + x2, z->img_comp[n].w2);
+                                        z->idctBlock(data, dst + x * z->block_size, z->img_comp[n].w2);
                                     }
                                 }
                             }
@@ -603,6 +812,13 @@ namespace Simd
                                 z->Reset();
                             }
                         }
+                        if (z->band_window && !JpegBandRow(z))
+                            return 0;
+                        if (z->roi && j + 1 == z->roi_mcu_y1 && j + 1 < z->img_mcu_y)
+                        {
+                            JpegSkipEntropyData(z, 0);
+                            return 1;
+                        }
                     }
                     return 1;
                 }
@@ -612,19 +828,21 @@ namespace Simd
                 if (z->scan_n == 1) 
                 {
                     int n = z->order[0];
-                    int w = (z->img_comp[n].x + 7) >> 3;
-                    int h = (z->img_comp[n].y + 7) >> 3;
+                    int w = z->img_comp[n].bw;
+                    int h = z->img_comp[n].bh;
+                    const JpegImgComp& c = z->img_comp[n];
                     for (int j = 0; j < h; ++j) 
                     {
                         for (int i = 0; i < w; ++i) 
                         {
                             short* data = z->img_comp[n].coeff + 64 * (i + j * z->img_comp[n].coeffW);
-                            if (z->spec_start == 0) 
+                            int idle = JpegRoiIdle(z, j * w + i, w, c.rx0, c.ry0, c.rx1, c.ry1);
+                            if (!idle && z->spec_start == 0) 
                             {
                                 if (!JpegDecodeBlockProgDc(z, data, &z->huff_dc[z->img_comp[n].hd], n))
                                     return 0;
                             }
-                            else 
+                            else if (!idle)
                             {
                                 int ha = z->img_comp[n].ha;
                                 if (!JpegDecodeBlockProgAc(z, data, &z->huff_ac[ha], z->huff_ac[ha].fast_ac))
@@ -639,6 +857,11 @@ namespace Simd
                                 z->Reset();
                             }
                         }
+                        if (z->roi && j + 1 == c.ry1 && j + 1 < h)
+                        {
+                            JpegSkipEntropyData(z, 0);
+                            return 1;
+                        }
                     }
                     return 1;
                 }
@@ -648,7 +871,8 @@ namespace Simd
                     {
                         for (int i = 0; i < z->img_mcu_x; ++i)
                         {
-                            for (int k = 0; k < z->scan_n; ++k)
+                            int idle = JpegRoiIdle(z, j * z->img_mcu_x + i, z->img_mcu_x, z->roi_mcu_x0, z->roi_mcu_y0, z->roi_mcu_x1, z->roi_mcu_y1);
+                            for (int k = 0; k < z->scan_n && !idle; ++k)
                             {
                                 int n = z->order[k];
                                 for (int y = 0; y < z->img_comp[n].v; ++y)
@@ -672,6 +896,11 @@ namespace Simd
                                 z->Reset();
                             }
                         }
+                        if (z->roi && j + 1 == z->roi_mcu_y1 && j + 1 < z->img_mcu_y)
+                        {
+                            JpegSkipEntropyData(z, 0);
+                            return 1;
+                        }
                     }
                     return 1;
                 }
@@ -680,19 +909,28 @@ namespace Simd
 
         static void JpegFinish(JpegContext* z)
         {
-            for (int n = 0; n < z->img_n; ++n) 
+            for (int n = 0, end = z->luma_only ? 1 : z->img_n; n < end; ++n) 
             {
-                int w = (z->img_comp[n].x + 7) >> 3;
-                int h = (z->img_comp[n].y + 7) >> 3;
-                for (int j = 0; j < h; ++j) 
+                int w = Min(z->img_comp[n].bw, z->img_comp[n].rx1);
+                int h = Min(z->img_comp[n].bh, z->img_comp[n].ry1);
+                const uint16_t* dequant = z->dequant[z->img_comp[n].tq];
+                for (int j = z->img_comp[n].ry0; j < h; ++j) 
                 {
-                    for (int i = 0; i < w; ++i) 
+                    short* data = z->img_comp[n].coeff + 64 * j * z->img_comp[n].coeffW;
+                    uint8_t* dst = z->img_comp[n].data + z->img_comp[n].w2 * (j * z->block_size - z->img_comp[n].top);
+                    int i = z->img_comp[n].rx0;
+                    if (z->idctBlocks2)
                     {
-                        short* data = z->img_comp[n].coeff + 64 * (i + j * z->img_comp[n].coeffW);
-                        const uint16_t* dequant = z->dequant[z->img_comp[n].tq];
-                        for (int k = 0; k < 64; ++k)
-                            data[k] *= dequant[k];
-                        z->idctBlock(data, z->img_comp[n].data + z->img_comp[n].w2 * j * 8 + i * 8, z->img_comp[n].w2);
+                        for (; i + 1 < w; i += 2)
+                        {
+                            z->dequantizeBlocks(data + 64 * i, dequant, 2);
+                            z->idctBlocks2(data + 64 * i, dst + i * z->block_size, z->img_comp[n].w2);
+                        }
+                    }
+                    for (; i < w; ++i) 
+                    {
+                        z->dequantizeBlocks(data + 64 * i, dequant, 1);
+                        z->idctBlock(data + 64 * i, dst + i * z->block_size, z->img_comp[n].w2);
                     }
                 }
             }
@@ -730,7 +968,7 @@ namespace Simd
             case 0xC4: 
                 L = z->stream->GetBe16u() - 2;
                 while (L > 0) {
-                    uint8_t* v;
+                    uint8_t key[16 + 256];
                     int sizes[16], i, n = 0;
                     int q = z->stream->Get8u();
                     int tc = q >> 4;
@@ -739,27 +977,27 @@ namespace Simd
                         return JpegLoadError("bad DHT header", "Corrupt JPEG");
                     for (i = 0; i < 16; ++i) 
                     {
-                        sizes[i] = z->stream->Get8u();
+                        key[i] = z->stream->Get8u();
+                        sizes[i] = key[i];
                         n += sizes[i];
                     }
-                    L -= 17;
-                    if (tc == 0) 
-                    {
-                        if (!z->huff_dc[th].Build(sizes)) 
-                            return 0;
-                        v = z->huff_dc[th].values;
-                    }
-                    else 
-                    {
-                        if (!z->huff_ac[th].Build(sizes)) 
-                            return 0;
-                        v = z->huff_ac[th].values;
-                    }
+                    if (n > 256)
+                        return JpegLoadError("bad DHT header", "Corrupt JPEG");
                     for (i = 0; i < n; ++i)
-                        v[i] = z->stream->Get8u();
+                        key[16 + i] = z->stream->Get8u();
+                    L -= 17 + n;
+                    int size = 16 + n;
+                    if (z->huff_key_size[tc][th] == size && memcmp(z->huff_key[tc][th], key, size) == 0)
+                        continue;
+                    z->huff_key_size[tc][th] = 0;
+                    JpegHuffman& huffman = tc == 0 ? z->huff_dc[th] : z->huff_ac[th];
+                    if (!huffman.Build(sizes)) 
+                        return 0;
+                    memcpy(huffman.values, key + 16, n);
                     if (tc != 0)
-                        z->huff_ac[th].BuildFastAc();
-                    L -= n;
+                        huffman.BuildFastAc();
+                    memcpy(z->huff_key[tc][th], key, size);
+                    z->huff_key_size[tc][th] = size;
                 }
                 return L == 0;
             }
@@ -917,23 +1155,118 @@ namespace Simd
             {
                 z->img_comp[i].x = (z->img_x * z->img_comp[i].h + h_max - 1) / h_max;
                 z->img_comp[i].y = (z->img_y * z->img_comp[i].v + v_max - 1) / v_max;
-                z->img_comp[i].w2 = z->img_mcu_x * z->img_comp[i].h * 8;
-                z->img_comp[i].h2 = z->img_mcu_y * z->img_comp[i].v * 8;
+                z->img_comp[i].bw = (z->img_comp[i].x + 7) >> 3;
+                z->img_comp[i].bh = (z->img_comp[i].y + 7) >> 3;
+                z->img_comp[i].w2 = z->img_mcu_x * z->img_comp[i].h * z->block_size;
+                z->img_comp[i].h2 = z->img_mcu_y * z->img_comp[i].v * z->block_size;
                 z->img_comp[i].coeff = 0;
-                z->img_comp[i].bufD.Resize(z->img_comp[i].w2 * z->img_comp[i].h2);
-                if (z->img_comp[i].bufD.Empty())
-                    return JpegLoadError("outofmem", "Out of memory");
-                z->img_comp[i].data = z->img_comp[i].bufD.data;
                 if (z->progressive) 
                 {
-                    z->img_comp[i].coeffW = z->img_comp[i].w2 / 8;
-                    z->img_comp[i].coeffH = z->img_comp[i].h2 / 8;
-                    z->img_comp[i].bufC.Resize(z->img_comp[i].w2 * z->img_comp[i].h2);
+                    z->img_comp[i].coeffW = z->img_mcu_x * z->img_comp[i].h;
+                    z->img_comp[i].coeffH = z->img_mcu_y * z->img_comp[i].v;
+                    z->img_comp[i].bufC.Resize(z->img_comp[i].coeffW * z->img_comp[i].coeffH * 64);
                     if (z->img_comp[i].bufC.Empty())
                         return JpegLoadError("outofmem", "Out of memory");
                     z->img_comp[i].coeff = z->img_comp[i].bufC.data;
                 }
             }
+            if (z->scale_shift)
+            {
+                int s = z->scale_shift, a = (1 << s) - 1;
+                z->img_x = (z->img_x + a) >> s;
+                z->img_y = (z->img_y + a) >> s;
+                for (int i = 0; i < z->img_n; ++i)
+                {
+                    z->img_comp[i].x = (z->img_comp[i].x + a) >> s;
+                    z->img_comp[i].y = (z->img_comp[i].y + a) >> s;
+                }
+            }
+            return 1;
+        }
+
+        SIMD_INLINE int JpegBandUnitRows(const JpegContext* z, int i)
+        {
+            return (z->scan_n == 1 ? 1 : z->img_comp[i].v) * z->block_size;
+        }
+
+        static int JpegAllocate(JpegContext* z)
+        {
+            z->band_window = z->band_callback && !z->progressive && z->scan_n == z->img_n;
+            if (z->band_window)
+            {
+                int rows = (z->scan_n == 1 ? 1 : z->img_v_max) * z->block_size;
+                z->band_units = int(ImageLoaderBandRows + rows - 1) / rows;
+                z->band_emit = 0;
+                z->band_done = 0;
+            }
+            if (z->img_n != 3 || z->rgb == 3 || (z->app14_color_transform == 0 && !z->jfif))
+                z->luma_only = 0;
+            z->roi_mcu_x0 = 0, z->roi_mcu_x1 = z->img_mcu_x;
+            z->roi_mcu_y0 = 0, z->roi_mcu_y1 = z->img_mcu_y;
+            if (z->roi)
+            {
+                if (z->roi_right > (int)z->img_x || z->roi_bottom > (int)z->img_y)
+                    return JpegLoadError("bad ROI", "ROI is out of image");
+                if (z->roi_right - z->roi_left < JpegRoiMinWidth)
+                {
+                    int width = Min(JpegRoiMinWidth, (int)z->img_x);
+                    z->roi_left = Min(z->roi_left, (int)z->img_x - width);
+                    z->roi_right = Max(z->roi_right, z->roi_left + width);
+                }
+                const int margin = 8;
+                int mcuW = z->img_h_max * z->block_size, mcuH = z->img_v_max * z->block_size;
+                z->roi_mcu_x0 = Max(z->roi_left - margin, 0) / mcuW;
+                z->roi_mcu_x1 = Min((z->roi_right + margin + mcuW - 1) / mcuW, z->img_mcu_x);
+                z->roi_mcu_y0 = Max(z->roi_top - margin, 0) / mcuH;
+                z->roi_mcu_y1 = Min((z->roi_bottom + margin + mcuH - 1) / mcuH, z->img_mcu_y);
+            }
+            for (int i = 0; i < z->img_n; ++i)
+            {
+                JpegImgComp& c = z->img_comp[i];
+                c.rx0 = z->roi_mcu_x0 * c.h & ~1;
+                c.rx1 = AlignHi(z->roi_mcu_x1 * c.h, 2);
+                c.ry0 = z->roi_mcu_y0 * c.v;
+                c.ry1 = z->roi_mcu_y1 * c.v;
+            }
+            for (int i = 0; i < z->img_n; ++i)
+            {
+                JpegImgComp& c = z->img_comp[i];
+                int top = 0, h2 = c.h2;
+                if (z->band_window)
+                    h2 = (z->band_units + 2) * JpegBandUnitRows(z, i);
+                else if (z->roi)
+                    top = c.ry0 * z->block_size, h2 = (c.ry1 - c.ry0) * z->block_size;
+                c.bufD.Resize(c.w2 * h2);
+                if (c.bufD.Empty())
+                    return JpegLoadError("outofmem", "Out of memory");
+                c.data = c.bufD.data;
+                c.top = top;
+            }
+            return 1;
+        }
+
+        static int JpegEmitBand(JpegContext* z, int beg, int end);
+
+        static int JpegBandRow(JpegContext* z)
+        {
+            int total = z->scan_n == 1 ? z->img_comp[z->order[0]].bh : z->img_mcu_y;
+            int rows = (z->scan_n == 1 ? 1 : z->img_v_max) * z->block_size;
+            int done = ++z->band_done;
+            if (done == total)
+                return JpegEmitBand(z, z->band_emit * rows, z->img_y);
+            if (done - z->band_emit == z->band_units + 1)
+            {
+                if (!JpegEmitBand(z, z->band_emit * rows, Min((done - 1) * rows, (int)z->img_y)))
+                    return 0;
+                z->band_emit = done - 1;
+                for (int i = 0; i < z->img_n; ++i)
+                {
+                    JpegImgComp& c = z->img_comp[i];
+                    int unit = JpegBandUnitRows(z, i), top = (z->band_emit - 1) * unit;
+                    memmove(c.data, c.data + (top - c.top) * c.w2, 2 * unit * c.w2);
+                    c.top = top;
+                }
+            }
             return 1;
         }
 
@@ -978,8 +1311,22 @@ namespace Simd
                 {
                     if (!JpegProcessScanHeader(j)) 
                         return 0;
+                    if (j->img_comp[0].data == NULL)
+                    {
+                        if (!JpegAllocate(j))
+                            return 0;
+                    }
+                    else if (j->band_window)
+                        return JpegLoadError("multiple scans", "JPEG format not supported: band decoding of multiple scans");
                     if (!JpegParseEntropyCodedData(j))
                         return 0;
+                    if (j->band_window)
+                    {
+                        int total = j->scan_n == 1 ? j->img_comp[j->order[0]].bh : j->img_mcu_y;
+                        while (j->band_done < total)
+                            if (!JpegBandRow(j))
+                                return 0;
+                    }
                     if (j->marker == JpegMarkerNone) 
                     {
                         while (!j->stream->Eof()) 
@@ -999,7 +1346,7 @@ namespace Simd
                     uint32_t NL = j->stream->GetBe16u();
                     if (Ld != 4) 
                         return JpegLoadError("bad DNL len", "Corrupt JPEG");
-                    if (NL != j->img_y) 
+                    if (((NL + (1 << j->scale_shift) - 1) >> j->scale_shift) != j->img_y)
                         return JpegLoadError("bad DNL height", "Corrupt JPEG");
                 }
                 else 
@@ -1009,6 +1356,8 @@ namespace Simd
                 }
                 m = JpegGetMarker(j);
             }
+            if (j->img_comp[0].data == NULL)
+                return JpegLoadError("no SOS", "Corrupt JPEG");
             if (j->progressive)
                 JpegFinish(j);
             return 1;
@@ -1095,8 +1444,7 @@ namespace Simd
         struct JpegResample
         {
             ResampleRowPtr resample;
-            uint8_t* line0, * line1;
-            int hs, vs, w_lores, ystep, ypos;
+            int hs, vs, w_lores;
         };
 
         SIMD_INLINE uint8_t JpegBlinn(uint8_t x, uint8_t y)
@@ -1105,7 +1453,7 @@ namespace Simd
             return (uint8_t)((t + (t >> 8)) >> 8);
         }
 
-        static int JpegToRgba(JpegContext* z)
+        static int JpegToRgba(JpegContext* z, int beg, int end, uint8_t* dst)
         {
             const int n = 4;
             int is_rgb = z->img_n == 3 && (z->rgb == 3 || (z->app14_color_transform == 0 && !z->jfif));
@@ -1122,10 +1470,7 @@ namespace Simd
 
                 r->hs = z->img_h_max / z->img_comp[k].h;
                 r->vs = z->img_v_max / z->img_comp[k].v;
-                r->ystep = r->vs >> 1;
                 r->w_lores = (z->img_x + r->hs - 1) / r->hs;
-                r->ypos = 0;
-                r->line0 = r->line1 = z->img_comp[k].data;
 
                 if (r->hs == 1 && r->vs == 1) 
                     r->resample = JpegResampleRow1;
@@ -1138,27 +1483,20 @@ namespace Simd
                 else                               
                     r->resample = JpegResampleRowGeneric;
             }
-            z->out.Resize(n * z->img_x * z->img_y + 1);
-            if (z->out.Empty()) 
-                return JpegLoadError("outofmem", "Out of memory");
-            for (unsigned int j = 0; j < z->img_y; ++j) 
+            for (int j = beg; j < end; ++j) 
             {
-                uint8_t* out = z->out.data + n * z->img_x * j;
+                uint8_t* out = dst + n * z->img_x * (j - beg);
                 for (int k = 0; k < z->img_n; ++k)
                 {
                     JpegResample* r = &res_comp[k];
-                    int y_bot = r->ystep >= (r->vs >> 1);
-                    coutput[k] = r->resample(z->img_comp[k].bufL.data,
-                        y_bot ? r->line1 : r->line0,
-                        y_bot ? r->line0 : r->line1,
+                    const JpegImgComp& c = z->img_comp[k];
+                    int pos = (j + (r->vs >> 1)) / r->vs, step = (j + (r->vs >> 1)) % r->vs;
+                    int line1 = Min(pos, c.y - 1), line0 = Max(0, Min(pos - 1, c.y - 1));
+                    int y_bot = step >= (r->vs >> 1);
+                    coutput[k] = r->resample(c.bufL.data,
+                        c.data + ((y_bot ? line1 : line0) - c.top) * c.w2,
+                        c.data + ((y_bot ? line0 : line1) - c.top) * c.w2,
                         r->w_lores, r->hs);
-                    if (++r->ystep >= r->vs)
-                    {
-                        r->ystep = 0;
-                        r->line0 = r->line1;
-                        if (++r->ypos < z->img_comp[k].y)
-                            r->line1 += z->img_comp[k].w2;
-                    }
                 }
                 uint8_t* y = coutput[0];
                 if (z->img_n == 3) 
@@ -1333,17 +1671,124 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        static int JpegConvert(JpegContext* z, SimdPixelFormatType format, int left, int width, int beg, int end, uint8_t* dst, size_t stride)
+        {
+            const JpegImgComp* c = z->img_comp;
+            if (CanCopyGray(*z) && format == SimdPixelFormatGray8)
+            {
+                Base::Copy(c[0].data + (beg - c[0].top) * c[0].w2 + left, c[0].w2, width, end - beg, 1, dst, stride);
+                return 1;
+            }
+            if (IsYuv420(*z))
+            {
+                int lo = Max(beg - 2, 0) & ~1, hi = Min(end + 2, (int)z->img_y);
+                int lx = Max(left - 2, 0) & ~1, hx = Min(left + width + 2, (int)z->img_x);
+                const uint8_t* y = c[0].data + (lo - c[0].top) * c[0].w2 + lx;
+                const uint8_t* u = c[1].data + (lo / 2 - c[1].top) * c[1].w2 + lx / 2;
+                const uint8_t* v = c[2].data + (lo / 2 - c[2].top) * c[2].w2 + lx / 2;
+                dst -= (beg - lo) * stride + (left - lx) * View<Allocator>::PixelSize((View<Allocator>::Format)format);
+                switch (format)
+                {
+                case SimdPixelFormatBgr24:
+                case SimdPixelFormatRgb24:
+                    z->yuv420pToBgr(y, c[0].w2, u, c[1].w2, v, c[2].w2, hx - lx, hi - lo, dst, stride, SimdYuvTrect871);
+                    return 1;
+                case SimdPixelFormatBgra32:
+                case SimdPixelFormatRgba32:
+                    z->yuv420pToBgra(y, c[0].w2, u, c[1].w2, v, c[2].w2, hx - lx, hi - lo, dst, stride, 0xFF, SimdYuvTrect871);
+                    return 1;
+                default:
+                    assert(false && "Unsupported pixel format for YUV 420 conversion.");
+                    return 0;
+                }
+            }
+            if (IsYuv444(*z))
+            {
+                const uint8_t* y = c[0].data + (beg - c[0].top) * c[0].w2 + left;
+                const uint8_t* u = c[1].data + (beg - c[1].top) * c[1].w2 + left;
+                const uint8_t* v = c[2].data + (beg - c[2].top) * c[2].w2 + left;
+                switch (format)
+                {
+                case SimdPixelFormatBgr24:
+                case SimdPixelFormatRgb24:
+                    z->yuv444pToBgr(y, c[0].w2, u, c[1].w2, v, c[2].w2, width, end - beg, dst, stride, SimdYuvTrect871);
+                    return 1;
+                case SimdPixelFormatBgra32:
+                case SimdPixelFormatRgba32:
+                    z->yuv444pToBgra(y, c[0].w2, u, c[1].w2, v, c[2].w2, width, end - beg, dst, stride, 0xFF, SimdYuvTrect871);
+                    return 1;
+                default:
+                    assert(false && "Unsupported pixel format for YUV 444 conversion.");
+                    return 0;
+                }
+            }
+            size_t size = 4 * z->img_x * (end - beg) + 1;
+            if (z->out.size < size)
+            {
+                z->out.Resize(size);
+                if (z->out.Empty())
+                    return JpegLoadError("outofmem", "Out of memory");
+            }
+            if (JpegToRgba(z, beg, end, z->out.data))
+            {
+                switch (format)
+                {
+                case SimdPixelFormatRgba32:
+                    Base::Copy(z->out.data + 4 * left, 4 * z->img_x, width, end - beg, 4, dst, stride);
+                    return 1;
+                case SimdPixelFormatGray8:
+                case SimdPixelFormatBgr24:
+                case SimdPixelFormatBgra32:
+                case SimdPixelFormatRgb24:
+                    z->rgbaToAny(z->out.data + 4 * left, width, end - beg, 4 * z->img_x, dst, stride);
+                    return 1;
+                default:
+                    assert(false && "Unsupported pixel format for JPEG conversion.");
+                    return 0;
+                }
+            }
+            return 0;
+        }
+
+        static int JpegEmitBand(JpegContext* z, int beg, int end)
+        {
+            size_t stride = z->img_x * View<Allocator>::PixelSize((View<Allocator>::Format)z->band_format);
+            size_t size = (end - beg + 4) * stride;
+            if (z->band_buf.size < size)
+            {
+                z->band_buf.Resize(size);
+                if (z->band_buf.Empty())
+                    return JpegLoadError("outofmem", "Out of memory");
+            }
+            uint8_t* dst = z->band_buf.data + 2 * stride;
+            if (!JpegConvert(z, z->band_format, 0, z->img_x, beg, end, dst, stride))
+                return 0;
+            return z->band_callback(z->band_user, dst, stride, z->img_x, z->img_y, beg, end - beg, z->band_format) ? 1 : 0;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
         ImageJpegLoader::ImageJpegLoader(const ImageLoaderParam& param)
             : ImageLoader(param)
-            , _context(new JpegContext(&_stream))
+            , _context(new JpegContext(&_stream, param.scale))
         {
-            _context->idctBlock = JpegIdctBlock;
+            switch (_context->block_size)
+            {
+            case 1: _context->idctBlock = JpegIdctBlock1x1; break;
+            case 2: _context->idctBlock = JpegIdctBlock2x2; break;
+            case 4: _context->idctBlock = JpegIdctBlock4x4; break;
+            default: _context->idctBlock = JpegIdctBlock; break;
+            }
+            _context->dequantizeBlocks = JpegDequantizeBlocks;
             _context->resampleRowHv2 = JpegResampleRowHv2;
             _context->yuvToRgbRow = JpegYuvToRgbRow;
             if (_param.format == SimdPixelFormatNone)
                 _param.format = SimdPixelFormatRgb24;
             if (_param.format == SimdPixelFormatGray8)
+            {
                 _context->rgbaToAny = Base::RgbaToGray;
+                _context->luma_only = 1;
+            }
             if (_param.format == SimdPixelFormatBgr24)
             {
                 _context->yuv444pToBgr = Base::Yuv444pToBgrV2;
@@ -1380,70 +1825,193 @@ namespace Simd
             if (!JpegDecode(_context))
                 return false;
             _image.Recreate(_context->img_x, _context->img_y, (Image::Format)_param.format);
-            if (CanCopyGray(*_context) && _param.format == SimdPixelFormatGray8)
-            {
-                Base::Copy(_context->img_comp[0].data, _context->img_comp[0].w2, _context->img_x, _context->img_y, 1, _image.data, _image.stride);
+            return JpegConvert(_context, _param.format, 0, _context->img_x, 0, _context->img_y, _image.data, _image.stride) != 0;
+        }
+
+        bool ImageJpegLoader::ToBands(SimdImageBandCallbackPtr callback, void* user)
+        {
+            _context->band_callback = callback;
+            _context->band_user = user;
+            _context->band_format = _param.format;
+            if (!JpegDecode(_context))
+                return false;
+            if (_context->band_window)
                 return true;
+            for (int row = 0, height = _context->img_y; row < height; row += (int)ImageLoaderBandRows)
+            {
+                if (!JpegEmitBand(_context, row, Min(row + (int)ImageLoaderBandRows, height)))
+                    return false;
             }
-            if (IsYuv420(*_context))
+            return true;
+        }
+
+        bool ImageJpegLoader::FromStreamRoi(size_t left, size_t top, size_t right, size_t bottom)
+        {
+            if (left >= right || top >= bottom)
+                return false;
+            JpegContext* z = _context;
+            z->roi = 1;
+            z->roi_left = (int)left;
+            z->roi_top = (int)top;
+            z->roi_right = (int)right;
+            z->roi_bottom = (int)bottom;
+            if (!JpegDecode(z))
+                return false;
+            _image.Recreate(right - left, bottom - top, (Image::Format)_param.format);
+            int width = z->roi_right - z->roi_left;
+            size_t pixel = _image.PixelSize(), stride = (width + 8) * pixel;
+            Array8u buf((_image.height + 6) * stride);
+            if (buf.Empty())
+                return false;
+            uint8_t* dst = buf.data + 4 * stride + 4 * pixel;
+            if (!JpegConvert(z, _param.format, z->roi_left, width, z->roi_top, z->roi_bottom, dst, stride))
+                return false;
+            Base::Copy(dst + (left - z->roi_left) * pixel, stride, _image.width, _image.height, pixel, _image.data, _image.stride);
+            return true;
+        }
+
+        bool ImageJpegLoader::DecodeFrame(const uint8_t* data, size_t size, Image& frame)
+        {
+            _param.data = data;
+            _param.size = size;
+            _stream.Init(data, size);
+            _context->luma_only = _param.format == SimdPixelFormatGray8 ? 1 : 0;
+            if (!JpegDecode(_context))
+                return false;
+            if (frame.width != _context->img_x || frame.height != _context->img_y || frame.format != (Image::Format)_param.format)
+                frame.Recreate(_context->img_x, _context->img_y, (Image::Format)_param.format);
+            return JpegConvert(_context, _param.format, 0, _context->img_x, 0, _context->img_y, frame.data, frame.stride) != 0;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        JpegStreamDecoder::JpegStreamDecoder(ImageJpegLoader* loader, size_t frames)
+            : _loader(loader)
+            , _frames(new Image[frames])
+            , _count(frames)
+            , _index(0)
+        {
+        }
+
+        JpegStreamDecoder::~JpegStreamDecoder()
+        {
+            delete[] _frames;
+            delete _loader;
+        }
+
+        const uint8_t* JpegStreamDecoder::Decode(const uint8_t* data, size_t size, size_t* stride, size_t* width, size_t* height)
+        {
+            if (data == NULL || size < 2 || data[0] != 0xFF || data[1] != JpegMarkerSoi)
+                return NULL;
+            Image& frame = _frames[_index];
+            if (!_loader->DecodeFrame(data, size, frame))
+                return NULL;
+            _index = (_index + 1) % _count;
+            *stride = frame.stride;
+            *width = frame.width;
+            *height = frame.height;
+            return frame.data;
+        }
+
+        bool JpegStreamDecoder::Valid(SimdPixelFormatType format, size_t frames)
+        {
+            return frames > 0 && (format == SimdPixelFormatNone || format == SimdPixelFormatGray8 ||
+                format == SimdPixelFormatBgr24 || format == SimdPixelFormatBgra32 ||
+                format == SimdPixelFormatRgb24 || format == SimdPixelFormatRgba32);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static void JpegChromaToPlane(const uint8_t* src, size_t srcStride, int srcW, int srcH, int h, int hMax, int v, int vMax,
+            int d, uint8_t* dst, size_t dstStride, int step, int dstW, int dstH)
+        {
+            if (h * d == hMax && v * d == vMax)
             {
-                switch (_param.format)
+                for (int y = 0; y < dstH; ++y, src += srcStride, dst += dstStride)
+                    for (int x = 0; x < dstW; ++x)
+                        dst[x * step] = src[x];
+                return;
+            }
+            for (int y = 0; y < dstH; ++y, dst += dstStride)
+            {
+                int yb = Min(y * d * v / vMax, srcH - 1), ye = Max(yb + 1, Min(((y + 1) * d - 1) * v / vMax + 1, srcH));
+                for (int x = 0; x < dstW; ++x)
                 {
-                case SimdPixelFormatBgr24:
-                case SimdPixelFormatRgb24:
-                    _context->yuv420pToBgr(_context->img_comp[0].data, _context->img_comp[0].w2, _context->img_comp[1].data, _context->img_comp[1].w2,
-                        _context->img_comp[2].data, _context->img_comp[2].w2, _context->img_x, _context->img_y, _image.data, _image.stride, SimdYuvTrect871);
-                    return true;
-                case SimdPixelFormatBgra32:
-                case SimdPixelFormatRgba32:
-                    _context->yuv420pToBgra(_context->img_comp[0].data, _context->img_comp[0].w2, _context->img_comp[1].data, _context->img_comp[1].w2,
-                        _context->img_comp[2].data, _context->img_comp[2].w2, _context->img_x, _context->img_y, _image.data, _image.stride, 0xFF, SimdYuvTrect871);
-                    return true;
-				default:
-					assert(false && "Unsupported pixel format for YUV 420 conversion.");
-					return false;
+                    int xb = Min(x * d * h / hMax, srcW - 1), xe = Max(xb + 1, Min(((x + 1) * d - 1) * h / hMax + 1, srcW));
+                    int sum = 0, count = (ye - yb) * (xe - xb);
+                    for (int sy = yb; sy < ye; ++sy)
+                        for (int sx = xb; sx < xe; ++sx)
+                            sum += src[sy * srcStride + sx];
+                    dst[x * step] = uint8_t((sum + count / 2) / count);
                 }
             }
-            if (IsYuv444(*_context))
+        }
+
+        uint8_t* ImageJpegLoader::ToYuv(SimdYuvLayoutType layout, size_t* width, size_t* height, uint8_t** planes, size_t* strides)
+        {
+            _context->luma_only = layout == SimdYuvLayoutGray8 ? 1 : 0;
+            if (!JpegDecode(_context))
+                return NULL;
+            JpegContext* z = _context;
+            const JpegImgComp* c = z->img_comp;
+            int w = z->img_x, h = z->img_y, d = layout == SimdYuvLayoutYuv444p ? 1 : 2;
+            int cw = (w + d - 1) / d, ch = (h + d - 1) / d;
+            size_t yStride = AlignHi(w, SIMD_ALIGN), uStride = 0, vStride = 0;
+            if (layout == SimdYuvLayoutYuv420p || layout == SimdYuvLayoutYuv444p)
+                uStride = vStride = AlignHi(cw, SIMD_ALIGN);
+            else if (layout == SimdYuvLayoutNv12)
+                uStride = AlignHi(2 * cw, SIMD_ALIGN);
+            else if (layout != SimdYuvLayoutGray8)
+                return NULL;
+            uint8_t* y = (uint8_t*)Allocate(yStride * h + (uStride + vStride) * ch);
+            if (y == NULL)
+                return NULL;
+            uint8_t* u = uStride ? y + yStride * h : NULL;
+            uint8_t* v = vStride ? u + uStride * ch : NULL;
+            int uStep = layout == SimdYuvLayoutNv12 ? 2 : 1;
+            uint8_t* vDst = layout == SimdYuvLayoutNv12 ? u + 1 : v;
+            size_t vDstStride = layout == SimdYuvLayoutNv12 ? uStride : vStride;
+            if (z->img_n == 3 && CanCopyGray(*z))
             {
-                switch (_param.format)
+                Base::Copy(c[0].data, c[0].w2, w, h, 1, y, yStride);
+                if (u)
                 {
-                case SimdPixelFormatBgr24:
-                case SimdPixelFormatRgb24:
-                    _context->yuv444pToBgr(_context->img_comp[0].data, _context->img_comp[0].w2, _context->img_comp[1].data, _context->img_comp[1].w2,
-                        _context->img_comp[2].data, _context->img_comp[2].w2, _context->img_x, _context->img_y, _image.data, _image.stride, SimdYuvTrect871);
-                    return true;
-                case SimdPixelFormatBgra32:
-                case SimdPixelFormatRgba32:
-                    _context->yuv444pToBgra(_context->img_comp[0].data, _context->img_comp[0].w2, _context->img_comp[1].data, _context->img_comp[1].w2,
-                        _context->img_comp[2].data, _context->img_comp[2].w2, _context->img_x, _context->img_y, _image.data, _image.stride, 0xFF, SimdYuvTrect871);
-                    return true;
-				default:
-					assert(false && "Unsupported pixel format for YUV 444 conversion.");
-					return false;
+                    JpegChromaToPlane(c[1].data, c[1].w2, c[1].x, c[1].y, c[1].h, z->img_h_max, c[1].v, z->img_v_max, d, u, uStride, uStep, cw, ch);
+                    JpegChromaToPlane(c[2].data, c[2].w2, c[2].x, c[2].y, c[2].h, z->img_h_max, c[2].v, z->img_v_max, d, vDst, vDstStride, uStep, cw, ch);
                 }
             }
-            if (JpegToRgba(_context))
-            {
-                size_t stride = 4 * _context->img_x;
-				switch (_param.format)
-				{
-				case SimdPixelFormatRgba32:
-                    Base::Copy(_context->out.data, stride, _context->img_x, _context->img_y, 4, _image.data, _image.stride);
-					return true;
-				case SimdPixelFormatGray8:
-				case SimdPixelFormatBgr24:
-				case SimdPixelFormatBgra32:
-				case SimdPixelFormatRgb24:
-                    _context->rgbaToAny(_context->out.data, _context->img_x, _context->img_y, stride, _image.data, _image.stride);
-					return true;
-				default:
-					assert(false && "Unsupported pixel format for JPEG conversion.");
-					return false;
-				}
-                return true;
+            else if (z->img_n == 1)
+            {
+                Base::Copy(c[0].data, c[0].w2, w, h, 1, y, yStride);
+                if (u)
+                    memset(u, 128, (uStride + vStride) * ch);
+            }
+            else
+            {
+                size_t bgraStride = 4 * w, planeStride = w;
+                Array8u buf(bgraStride * h + 2 * planeStride * h);
+                uint8_t* bgra = buf.data, * u444 = bgra + bgraStride * h, * v444 = u444 + planeStride * h;
+                if (buf.Empty() || !JpegConvert(z, SimdPixelFormatBgra32, 0, w, 0, h, bgra, bgraStride))
+                {
+                    Free(y);
+                    return NULL;
+                }
+                Base::BgraToYuv444pV2(bgra, bgraStride, w, h, y, yStride, u444, planeStride, v444, planeStride, SimdYuvTrect871);
+                if (u)
+                {
+                    JpegChromaToPlane(u444, planeStride, w, h, 1, 1, 1, 1, d, u, uStride, uStep, cw, ch);
+                    JpegChromaToPlane(v444, planeStride, w, h, 1, 1, 1, 1, d, vDst, vDstStride, uStep, cw, ch);
+                }
             }
-            return false;
+            *width = w;
+            *height = h;
+            planes[0] = y;
+            planes[1] = u;
+            planes[2] = v;
+            strides[0] = yStride;
+            strides[1] = uStride;
+            strides[2] = vStride;
+            return y;
         }
     }
 }
@@ -36,13 +36,26 @@ namespace Simd
     {
         namespace Zlib
         {
-            const size_t ZFAST_BITS = 9;
+            const size_t ZFAST_BITS = 10;
             const size_t ZFAST_SIZE = 1 << ZFAST_BITS;
             const size_t ZFAST_MASK = ZFAST_SIZE - 1;
 
+            const uint32_t ZPAIR_TWO = 1 << 24;
+            const size_t ZOUT_SLACK = 258 + 16;
+
+            static SIMD_INLINE int BitRev16(int n)
+            {
+                n = ((n & 0xAAAA) >> 1) | ((n & 0x5555) << 1);
+                n = ((n & 0xCCCC) >> 2) | ((n & 0x3333) << 2);
+                n = ((n & 0xF0F0) >> 4) | ((n & 0x0F0F) << 4);
+                n = ((n & 0xFF00) >> 8) | ((n & 0x00FF) << 8);
+                return n;
+            }
+
             struct Zhuffman
             {
                 uint16_t fast[ZFAST_SIZE];
+                uint32_t pair[ZFAST_SIZE];
                 uint16_t firstCode[16];
                 int maxCode[17];
                 uint16_t firstSymbol[16];
@@ -87,7 +100,7 @@ namespace Simd
                             value[c] = (uint16_t)i;
                             if (s <= (int)ZFAST_BITS)
                             {
-                                int j = ZlibBitRev(nextCode[s], s);
+                                int j = BitRev16(nextCode[s]) >> (16 - s);
                                 while (j < (1 << ZFAST_BITS))
                                 {
                                     fast[j] = fastv;
@@ -99,16 +112,23 @@ namespace Simd
                     }
                     return 1;
                 }
-            };
 
-            static SIMD_INLINE int BitRev16(int n)
-            {
-                n = ((n & 0xAAAA) >> 1) | ((n & 0x5555) << 1);
-                n = ((n & 0xCCCC) >> 2) | ((n & 0x3333) << 2);
-                n = ((n & 0xF0F0) >> 4) | ((n & 0x0F0F) << 4);
-                n = ((n & 0xFF00) >> 8) | ((n & 0x00FF) << 8);
-                return n;
-            }
+                //pair table: (bits << 16) | symbol, or ZPAIR_TWO | (bits << 16) | (literal1 << 8) | literal0 if two short literals fit in ZFAST_BITS.
+                void BuildPairs()
+                {
+                    for (size_t i = 0; i < ZFAST_SIZE; ++i)
+                    {
+                        uint32_t b0 = fast[i], s0 = b0 >> 9, v0 = b0 & 511;
+                        pair[i] = (s0 << 16) | v0;
+                        if (b0 && v0 < 256 && s0 < ZFAST_BITS)
+                        {
+                            uint32_t b1 = fast[i >> s0], s1 = b1 >> 9, v1 = b1 & 511;
+                            if (b1 && v1 < 256 && s0 + s1 <= ZFAST_BITS)
+                                pair[i] = ZPAIR_TWO | ((s0 + s1) << 16) | (v1 << 8) | v0;
+                        }
+                    }
+                }
+            };
 
             static SIMD_INLINE int ZhuffmanDecode(InputMemoryStream& is, const Zhuffman& z)
             {
@@ -143,91 +163,105 @@ namespace Simd
                 }
             }
 
-            static int ParseHuffmanBlock(InputMemoryStream& is, const Zhuffman& zLength, const Zhuffman& zDistance, OutputMemoryStream& os)
-            {
-                static const int zlengthBase[31] = { 3,4,5,6,7,8,9,10,11,13, 15,17,19,23,27,31,35,43,51,59, 67,83,99,115,131,163,195,227,258,0,0 };
-                static const int zlengthExtra[31] = { 0,0,0,0,0,0,0,0,1,1,1,1,2,2,2,2,3,3,3,3,4,4,4,4,5,5,5,5,0,0,0 };
-                static const int zdistBase[32] = { 1,2,3,4,5,7,9,13,17,25,33,49,65,97,129,193, 257,385,513,769,1025,1537,2049,3073,4097,6145,8193,12289,16385,24577,0,0 };
-                static const int zdistExtra[32] = { 0,0,0,0,1,1,2,2,3,3,4,4,5,5,6,6,7,7,8,8,9,9,10,10,11,11,12,12,13,13 };
-
-                SIMD_PERF_FUNC();
-
-                uint8_t* beg = os.Data(), * dst = os.Current(), * end = beg + os.Capacity();
-                for (;;)
-                {
-                    int z = ZhuffmanDecode(is, zLength);
-                    if (z < 256)
-                    {
-                        if (z < 0)
-                            return CorruptPngError("bad huffman code");
-                        if (dst >= end)
-                        {
-                            os.Reserve(end - beg + 1);
-                            beg = os.Data();
-                            dst = os.Current();
-                            end = beg + os.Capacity();
-                        }
-                        *dst++ = (uint8_t)z;
-                    }
-                    else
-                    {
-                        int len, dist;
-                        if (z == 256)
-                        {
-                            os.Seek(dst - beg);
-                            return 1;
-                        }
-                        z -= 257;
-                        len = zlengthBase[z];
-                        if (zlengthExtra[z])
-                            len += (int)is.ReadBits(zlengthExtra[z]);
-                        z = ZhuffmanDecode(is, zDistance);
-                        if (z < 0)
-                            return CorruptPngError("bad huffman code");
-                        dist = zdistBase[z];
-                        if (zdistExtra[z])
-                            dist += (int)is.ReadBits(zdistExtra[z]);
-                        if (dst - beg < dist)
-                            return CorruptPngError("bad dist");
-                        if (dst + len > end)
-                        {
-                            os.Reserve(dst - beg + len);
-                            beg = os.Data();
-                            dst = os.Current();
-                            end = beg + os.Capacity();
-                        }
-                        if (dist == 1)
-                        {
-                            uint8_t val = dst[-dist];
-                            if (len < 16)
-                            {
-                                while (len--)
-                                    *dst++ = val;
-                            }
-                            else
-                            {
-                                memset(dst, val, len);
-                                dst += len;
-                            }
-                        }
-                        else
-                        {
-                            uint8_t* src = dst - dist;
-                            if (dist < len || len < 16)
-                            {
-                                while(len--)
-                                    *dst++ = *src++;
-                            }
-                            else
-                            {
-                                memcpy(dst, src, len);
-                                dst += len;
-                            }                        
-                        }
-                    }
-                }
-            }
-
+            static SIMD_INLINE void ReserveOutput(OutputMemoryStream& os, uint8_t*& beg, uint8_t*& dst, uint8_t*& end, size_t size)
+            {
+                os.Seek(dst - beg);
+                os.Reserve(os.Pos() + size);
+                beg = os.Data();
+                dst = os.Current();
+                end = beg + os.Capacity();
+            }
+
+            static int ParseHuffmanBlock(InputMemoryStream& is, const Zhuffman& zLength, const Zhuffman& zDistance, OutputMemoryStream& os)
+            {
+                static const int zlengthBase[31] = { 3,4,5,6,7,8,9,10,11,13, 15,17,19,23,27,31,35,43,51,59, 67,83,99,115,131,163,195,227,258,0,0 };
+                static const int zlengthExtra[31] = { 0,0,0,0,0,0,0,0,1,1,1,1,2,2,2,2,3,3,3,3,4,4,4,4,5,5,5,5,0,0,0 };
+                static const int zdistBase[32] = { 1,2,3,4,5,7,9,13,17,25,33,49,65,97,129,193, 257,385,513,769,1025,1537,2049,3073,4097,6145,8193,12289,16385,24577,0,0 };
+                static const int zdistExtra[32] = { 0,0,0,0,1,1,2,2,3,3,4,4,5,5,6,6,7,7,8,8,9,9,10,10,11,11,12,12,13,13 };
+
+                SIMD_PERF_FUNC();
+
+                uint8_t* beg = os.Data(), * dst = os.Current(), * end = beg + os.Capacity();
+                for (;;)
+                {
+                    if (dst + ZOUT_SLACK > end)
+                        ReserveOutput(os, beg, dst, end, ZOUT_SLACK);
+                    if (is.BitCount() < 16)
+                    {
+                        if (is.Eof())
+                            return CorruptPngError("bad huffman code");
+                        is.FillBits();
+                    }
+                    int z;
+                    uint32_t pair = zLength.pair[is.BitBuffer() & ZFAST_MASK];
+                    if (pair)
+                    {
+                        int s = (pair >> 16) & 31;
+                        is.BitBuffer() >>= s;
+                        is.BitCount() -= s;
+                        if (pair & ZPAIR_TWO)
+                        {
+                            dst[0] = (uint8_t)pair;
+                            dst[1] = (uint8_t)(pair >> 8);
+                            dst += 2;
+                            continue;
+                        }
+                        z = pair & 511;
+                    }
+                    else
+                        z = ZhuffmanDecode(is, zLength);
+                    if (z < 256)
+                    {
+                        if (z < 0)
+                            return CorruptPngError("bad huffman code");
+                        *dst++ = (uint8_t)z;
+                    }
+                    else
+                    {
+                        int len, dist;
+                        if (z == 256)
+                        {
+                            os.Seek(dst - beg);
+                            return 1;
+                        }
+                        z -= 257;
+                        len = zlengthBase[z];
+                        if (zlengthExtra[z])
+                            len += (int)is.ReadBits(zlengthExtra[z]);
+                        z = ZhuffmanDecode(is, zDistance);
+                        if (z < 0)
+                            return CorruptPngError("bad huffman code");
+                        dist = zdistBase[z];
+                        if (zdistExtra[z])
+                            dist += (int)is.ReadBits(zdistExtra[z]);
+                        if (dst - beg < dist)
+                            return CorruptPngError("bad dist");
+                        uint8_t* src = dst - dist;
+                        if (dist >= 8)
+                        {
+                            uint8_t* stop = dst + len;
+                            do
+                            {
+                                memcpy(dst, src, 8);
+                                dst += 8;
+                                src += 8;
+                            } while (dst < stop);
+                            dst = stop;
+                        }
+                        else if (dist == 1)
+                        {
+                            memset(dst, dst[-1], len);
+                            dst += len;
+                        }
+                        else
+                        {
+                            while (len--)
+                                *dst++ = *src++;
+                        }
+                    }
+                }
+            }
+
             static int ComputeHuffmanCodes(InputMemoryStream& is, Zhuffman& zLength, Zhuffman& zDistance)
             {
                 static const uint8_t length_dezigzag[19] = { 16,17,18,0,8,7,9,6,10,5,11,4,12,3,13,2,14,1,15 };
@@ -361,6 +395,7 @@ namespace Simd
                             if (!ComputeHuffmanCodes(is, zLength, zDistance))
                                 return false;
                         }
+                        zLength.BuildPairs();
                         if (!ParseHuffmanBlock(is, zLength, zDistance, os))
                             return false;
                     }
@@ -373,7 +408,7 @@ namespace Simd
 
         static const uint8_t DepthScaleTable[9] = { 0, 0xff, 0x55, 0, 0x11, 0,0,0, 0x01 };
 
-        static void DecodeLine0(const uint8_t* curr, const uint8_t* prev, int width, int srcN, int dstN, uint8_t* dst)
+        void DecodeLine0(const uint8_t* curr, const uint8_t* prev, int width, int srcN, int dstN, uint8_t* dst)
         {
             if (srcN == dstN)
                 memcpy(dst, curr, width * srcN);
@@ -392,7 +427,7 @@ namespace Simd
             }
         }
 
-        static void DecodeLine1(const uint8_t* curr, const uint8_t* prev, int width, int srcN, int dstN, uint8_t* dst)
+        void DecodeLine1(const uint8_t* curr, const uint8_t* prev, int width, int srcN, int dstN, uint8_t* dst)
         {
             if (srcN == dstN)
             {
@@ -423,7 +458,7 @@ namespace Simd
             }
         }
 
-        static void DecodeLine2(const uint8_t* curr, const uint8_t* prev, int width, int srcN, int dstN, uint8_t* dst)
+        void DecodeLine2(const uint8_t* curr, const uint8_t* prev, int width, int srcN, int dstN, uint8_t* dst)
         {
             if (srcN == dstN)
             {
@@ -446,7 +481,7 @@ namespace Simd
             }
         }
 
-        static void DecodeLine3(const uint8_t* curr, const uint8_t* prev, int width, int srcN, int dstN, uint8_t* dst)
+        void DecodeLine3(const uint8_t* curr, const uint8_t* prev, int width, int srcN, int dstN, uint8_t* dst)
         {
             if (srcN == dstN)
             {
@@ -479,7 +514,7 @@ namespace Simd
             }
         }
 
-        static void DecodeLine4(const uint8_t* curr, const uint8_t* prev, int width, int srcN, int dstN, uint8_t* dst)
+        void DecodeLine4(const uint8_t* curr, const uint8_t* prev, int width, int srcN, int dstN, uint8_t* dst)
         {
             if (srcN == dstN)
             {
@@ -512,7 +547,7 @@ namespace Simd
             }
         }
 
-        static void DecodeLine5(const uint8_t* curr, const uint8_t* prev, int width, int srcN, int dstN, uint8_t* dst)
+        void DecodeLine5(const uint8_t* curr, const uint8_t* prev, int width, int srcN, int dstN, uint8_t* dst)
         {
             if (srcN == dstN)
             {
@@ -543,7 +578,7 @@ namespace Simd
             }
         }
 
-        static void DecodeLine6(const uint8_t* curr, const uint8_t* prev, int width, int srcN, int dstN, uint8_t* dst)
+        void DecodeLine6(const uint8_t* curr, const uint8_t* prev, int width, int srcN, int dstN, uint8_t* dst)
         {
             if (srcN == dstN)
             {
@@ -601,7 +636,7 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
-        static void ExpandPalette(const uint8_t* src, size_t size, int outN, const uint8_t* palette, uint8_t* dst)
+        void ExpandPalette(const uint8_t* src, size_t size, int outN, const uint8_t* palette, uint8_t* dst)
         {
             if (outN == 3)
             {
@@ -630,6 +665,13 @@ namespace Simd
                 assert(0);
         }
 
+        void Expand16(uint8_t* data, size_t size)
+        {
+            uint16_t* data16 = (uint16_t*)data;
+            for (size_t i = 0; i < size; ++i, data += 2)
+                data16[i] = (data[0] << 8) | data[1];
+        }
+
         //-------------------------------------------------------------------------------------------------
 
         template<class T> SIMD_INLINE uint8_t Convert(int r, int g, int b)
@@ -800,6 +842,7 @@ namespace Simd
             _decodeLine[5] = Base::DecodeLine5;
             _decodeLine[6] = Base::DecodeLine6;
             _expandPalette = Base::ExpandPalette;
+            _expand16 = Base::Expand16;
         }
 
         void ImagePngLoader::SetConverter()
@@ -846,6 +889,63 @@ namespace Simd
             return true;
         }
 
+        bool ImagePngLoader::ToBands(SimdImageBandCallbackPtr callback, void* user)
+        {
+            SIMD_PERF_FUNC();
+
+            if (!ParseFile())
+                return false;
+            if (_interlace)
+            {
+                _stream.Seek(0);
+                return ImageLoader::ToBands(callback, user);
+            }
+
+            InputMemoryStream zSrc = MergedDataStream();
+            OutputMemoryStream zDst(AlignHi(size_t(_width) * _depth, 8) * _height * _channels + _height);
+            if (!Zlib::Decode(zSrc, zDst, !_iPhone))
+                return false;
+            uint32_t img_width_bytes = (_channels * _width * _depth + 7) >> 3;
+            if (zDst.Size() < (img_width_bytes + 1) * _height)
+                return static_cast<bool>(CorruptPngError("not enough pixels"));
+
+            uint32_t decN = _outN;
+            _outN = _paletteChannels ? Max(_paletteChannels, decN) : decN;
+            SetConverter();
+            uint32_t outN = _outN;
+            _outN = decN;
+
+            size_t band = ImageLoaderBandRows, stride = _width * decN * (_depth == 16 ? 2 : 1);
+            Array8u rows((band + 1) * stride), palette(_paletteChannels ? band * _width * outN : 0);
+            _image.Recreate(_width, band, (Image::Format)_param.format);
+            uint8_t* dst = rows.data + stride;
+            for (uint32_t row = 0; row < _height; row += (uint32_t)band)
+            {
+                uint32_t count = Min((uint32_t)band, _height - row);
+                if (!UnfilterRows(zDst.Data(), _width, row, row + count, dst))
+                    return false;
+                memcpy(rows.data, dst + (count - 1) * stride, stride);
+                ExpandRows(_width, count, dst);
+                if (_hasTrans)
+                {
+                    if (_depth == 16)
+                        ComputeTransparency((uint16_t*)dst, _width * count, decN, _tc16);
+                    else
+                        ComputeTransparency(dst, _width * count, decN, _tc);
+                }
+                const uint8_t* src = dst;
+                if (_paletteChannels)
+                {
+                    _expandPalette(dst, _width * count, outN, _palette.data, palette.data);
+                    src = palette.data;
+                }
+                _converter(src, _width, count, _width * outN, _image.data, _image.stride);
+                if (!callback(user, _image.data, _image.stride, _width, _height, row, count, _param.format))
+                    return false;
+            }
+            return true;
+        }
+
         bool ImagePngLoader::ParseFile()
         {
             _first = true, _iPhone = false, _hasTrans = false;
@@ -947,6 +1047,7 @@ namespace Simd
             if (_color > 6 || (_color == 3 && _depth == 16))
                 return false;
             _paletteChannels = 0;
+            _paletteSize = 0;
             if (_color == 3)
                 _paletteChannels = 3;
             else if (_color & 1)
@@ -977,8 +1078,9 @@ namespace Simd
                 return false;
             if (_stream.CanRead(chunk.size))
             {
-                _palette.Resize(length * 4);
+                _palette.Resize(256 * 4, true);
                 BgrToBgra(_stream.Current(), length, 1, length, _palette.data, _palette.size, 0xFF);
+                _paletteSize = (uint32_t)length;
                 _stream.Skip(chunk.size);
                 return true;
             }
@@ -994,7 +1096,7 @@ namespace Simd
                 return false;
             if (_paletteChannels)
             {
-                if (_palette.size == 0 || chunk.size > _palette.size || !_stream.CanRead(chunk.size))
+                if (_paletteSize == 0 || chunk.size > _paletteSize || !_stream.CanRead(chunk.size))
                     return false;
                 _paletteChannels = 4;
                 for (size_t i = 0; i < chunk.size; ++i)
@@ -1091,19 +1193,12 @@ namespace Simd
 
         bool ImagePngLoader::CreateImageRaw(const uint8_t* data, uint32_t size, uint32_t width, uint32_t height)
         {
-            static const uint8_t FirstRowFilter[5] = { 0, 1, 0, 5, 6 };
             int bytes = (_depth == 16 ? 2 : 1);
-            uint32_t i, j, stride = width * _outN * bytes;
             uint32_t img_len, img_width_bytes;
-            int k;
-            int width_ = width;
-
-            int output_bytes = _outN * bytes;
-            int filter_bytes = _channels * bytes;
 
             assert(_outN == _channels || _outN == _channels + 1);
 
-            _buffer.Resize(width * height * output_bytes);
+            _buffer.Resize(width * height * _outN * bytes);
             if (_buffer.Empty())
                 return static_cast<bool>(PngLoadError("outofmem", "Out of memory"));
 
@@ -1113,10 +1208,27 @@ namespace Simd
             if (size < img_len)
                 return static_cast<bool>(CorruptPngError("not enough pixels"));
 
-            for (j = 0; j < height; ++j)
+            if (!UnfilterRows(data, width, 0, height, _buffer.data))
+                return false;
+            ExpandRows(width, height, _buffer.data);
+            return true;
+        }
+
+        bool ImagePngLoader::UnfilterRows(const uint8_t* data, uint32_t width, uint32_t beg, uint32_t end, uint8_t* dst)
+        {
+            static const uint8_t FirstRowFilter[5] = { 0, 1, 0, 5, 6 };
+            int bytes = (_depth == 16 ? 2 : 1);
+            uint32_t j, stride = width * _outN * bytes;
+            uint32_t img_width_bytes = (_channels * width * _depth + 7) >> 3;
+            int width_ = width;
+
+            int output_bytes = _outN * bytes;
+            int filter_bytes = _channels * bytes;
+
+            data += (img_width_bytes + 1) * beg;
+            for (j = beg; j < end; ++j)
             {
-                uint8_t* cur = _buffer.data + stride * j;
-                uint8_t* prior;
+                uint8_t* cur = dst + stride * (j - beg);
                 int filter = *data++;
 
                 if (filter > 4)
@@ -1130,7 +1242,6 @@ namespace Simd
                     filter_bytes = 1;
                     width_ = img_width_bytes;
                 }
-                prior = cur - stride;
                 if (j == 0)
                     filter = FirstRowFilter[filter];
 
@@ -1139,12 +1250,21 @@ namespace Simd
                 _decodeLine[filter](data, cur - stride, size, filter_bytes, dstN, cur);
                 data += size * filter_bytes;
             }
+            return true;
+        }
+
+        void ImagePngLoader::ExpandRows(uint32_t width, uint32_t rows, uint8_t* dst)
+        {
+            int bytes = (_depth == 16 ? 2 : 1);
+            uint32_t j, stride = width * _outN * bytes;
+            uint32_t img_width_bytes = (_channels * width * _depth + 7) >> 3;
+            int k;
             if (_depth < 8)
             {
-                for (j = 0; j < height; ++j)
+                for (j = 0; j < rows; ++j)
                 {
-                    uint8_t* cur = _buffer.data + stride * j;
-                    const uint8_t* in = _buffer.data + stride * j + width * _outN - img_width_bytes;
+                    uint8_t* cur = dst + stride * j;
+                    const uint8_t* in = dst + stride * j + width * _outN - img_width_bytes;
                     uint8_t scale = (_color == 0) ? DepthScaleTable[_depth] : 1;
                     if (_depth == 4)
                     {
@@ -1196,7 +1316,7 @@ namespace Simd
                     if (_channels != _outN)
                     {
                         int q;
-                        cur = _buffer.data + stride * j;
+                        cur = dst + stride * j;
                         if (_channels == 1)
                         {
                             for (q = width - 1; q >= 0; --q)
@@ -1220,13 +1340,7 @@ namespace Simd
                 }
             }
             else if (_depth == 16)
-            {
-                uint8_t* cur = _buffer.data;
-                uint16_t* cur16 = (uint16_t*)cur;
-                for (i = 0; i < width * height * _outN; ++i, cur16++, cur += 2)
-                    *cur16 = (cur[0] << 8) | cur[1];
-            }
-            return 1;
+                _expand16(dst, width * rows * _outN);
         }
 
         void ImagePngLoader::ExpandPalette()
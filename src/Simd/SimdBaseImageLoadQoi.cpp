@@ -0,0 +1,140 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdImageLoad.h"
+#include "Simd/SimdImageQoi.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        SIMD_INLINE uint32_t QoiAdd(uint32_t px, int dr, int dg, int db)
+        {
+            return (px & 0xFF000000) | uint8_t(px + dr) | uint8_t((px >> 8) + dg) << 8 | uint8_t((px >> 16) + db) << 16;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        ImageQoiLoader::ImageQoiLoader(const ImageLoaderParam& param)
+            : ImageLoader(param)
+            , _toAny(NULL)
+        {
+        }
+
+        bool ImageQoiLoader::FromStream()
+        {
+            if (!ParseHeader())
+                return false;
+
+            _image.Recreate(_width, _height, (Image::Format)_param.format);
+
+            SetConverters();
+            if (_toAny)
+                _buffer.Resize(_width * 4);
+
+            const uint8_t* src = _stream.Current(), * end = _stream.Data() + _stream.Size();
+            uint32_t index[64] = { 0 }, px = QoiPixelInit;
+            int run = 0;
+            for (size_t row = 0; row < _image.height; ++row)
+            {
+                uint32_t* dst = _toAny ? (uint32_t*)_buffer.data : _image.Row<uint32_t>(row);
+                for (size_t col = 0; col < _image.width; ++col)
+                {
+                    if (run > 0)
+                        run--;
+                    else
+                    {
+                        if (src + 5 > end)
+                            return false;
+                        int b1 = *src++;
+                        if (b1 == QoiOpRgb)
+                        {
+                            px = (px & 0xFF000000) | src[0] | src[1] << 8 | src[2] << 16;
+                            src += 3;
+                        }
+                        else if (b1 == QoiOpRgba)
+                        {
+                            px = src[0] | src[1] << 8 | src[2] << 16 | uint32_t(src[3]) << 24;
+                            src += 4;
+                        }
+                        else
+                        {
+                            switch (b1 & QoiMask)
+                            {
+                            case QoiOpIndex:
+                                px = index[b1];
+                                break;
+                            case QoiOpDiff:
+                                px = QoiAdd(px, (b1 >> 4 & 3) - 2, (b1 >> 2 & 3) - 2, (b1 & 3) - 2);
+                                break;
+                            case QoiOpLuma:
+                            {
+                                int b2 = *src++, vg = (b1 & 0x3F) - 32;
+                                px = QoiAdd(px, vg - 8 + (b2 >> 4), vg, vg - 8 + (b2 & 0xF));
+                                break;
+                            }
+                            default:
+                                run = b1 & 0x3F;
+                                break;
+                            }
+                        }
+                        index[QoiHash(px)] = px;
+                    }
+                    dst[col] = px;
+                }
+                if (_toAny)
+                    _toAny(_buffer.data, _image.width, 1, _image.width * 4, _image.Row<uint8_t>(row), _image.stride);
+            }
+
+            return true;
+        }
+
+        bool ImageQoiLoader::ParseHeader()
+        {
+            uint8_t colorspace;
+            if (_stream.Get8u() != 'q' || _stream.Get8u() != 'o' || _stream.Get8u() != 'i' || _stream.Get8u() != 'f')
+                return false;
+            if (!_stream.ReadBe32u(_width) || !_stream.ReadBe32u(_height) || !_stream.Read8u(_channels) || !_stream.Read8u(colorspace))
+                return false;
+            if (_width == 0 || _height == 0 || (_channels != 3 && _channels != 4) || colorspace > 1)
+                return false;
+            if (_param.format == SimdPixelFormatNone)
+                _param.format = _channels == 4 ? SimdPixelFormatRgba32 : SimdPixelFormatRgb24;
+            return true;
+        }
+
+        void ImageQoiLoader::SetConverters()
+        {
+            switch (_param.format)
+            {
+            case SimdPixelFormatGray8: _toAny = Base::RgbaToGray; break;
+            case SimdPixelFormatBgr24: _toAny = Base::BgraToRgb; break;
+            case SimdPixelFormatBgra32: _toAny = Base::BgraToRgba; break;
+            case SimdPixelFormatRgb24: _toAny = Base::BgraToBgr; break;
+            default: break;
+            }
+        }
+    }
+}
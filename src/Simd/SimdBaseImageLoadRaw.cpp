@@ -0,0 +1,182 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdImageLoad.h"
+#include "Simd/SimdImageRaw.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdBase.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace Simd
+{
+    namespace Base
+    {
+        ImageRawLoader::ImageRawLoader(const ImageLoaderParam& param)
+            : ImageLoader(param)
+        {
+        }
+
+        bool ImageRawLoader::FromStream()
+        {
+            ImageRawHeader header;
+            if (!_stream.Read(header) || !header.Valid(_param.size))
+                return false;
+            SimdPixelFormatType format = (SimdPixelFormatType)header.format;
+            if (_param.format == SimdPixelFormatNone)
+                _param.format = format;
+
+            _image.Recreate(header.width, header.height, (Image::Format)_param.format);
+            const uint8_t* src = _param.data + header.offset;
+            if (_param.format == format)
+            {
+                size_t size = _image.width * _image.PixelSize();
+                for (size_t row = 0; row < _image.height; ++row, src += header.stride)
+                    memcpy(_image.Row<uint8_t>(row), src, size);
+                return true;
+            }
+
+            typedef void (*ToRgbaPtr)(const uint8_t* src, size_t width, size_t height, size_t srcStride, uint8_t* rgba, size_t rgbaStride, uint8_t alpha);
+            typedef void (*ToAnyPtr)(const uint8_t* src, size_t width, size_t height, size_t srcStride, uint8_t* dst, size_t dstStride);
+            ToRgbaPtr toRgba = NULL;
+            ToAnyPtr swap = NULL, fromRgba = NULL;
+            switch (format)
+            {
+            case SimdPixelFormatGray8: toRgba = Base::GrayToBgra; break;
+            case SimdPixelFormatBgr24: toRgba = Base::RgbToBgra; break;
+            case SimdPixelFormatBgra32: swap = Base::BgraToRgba; break;
+            case SimdPixelFormatRgb24: toRgba = Base::BgrToBgra; break;
+            default: break;
+            }
+            switch (_param.format)
+            {
+            case SimdPixelFormatGray8: fromRgba = Base::RgbaToGray; break;
+            case SimdPixelFormatBgr24: fromRgba = Base::BgraToRgb; break;
+            case SimdPixelFormatBgra32: fromRgba = Base::BgraToRgba; break;
+            case SimdPixelFormatRgb24: fromRgba = Base::BgraToBgr; break;
+            default: break;
+            }
+            Array8u buffer(_image.width * 4);
+            for (size_t row = 0; row < _image.height; ++row, src += header.stride)
+            {
+                const uint8_t* rgba = src;
+                if (toRgba)
+                    toRgba(src, _image.width, 1, header.stride, buffer.data, buffer.size, 0xFF), rgba = buffer.data;
+                else if (swap)
+                    swap(src, _image.width, 1, header.stride, buffer.data, buffer.size), rgba = buffer.data;
+                if (fromRgba)
+                    fromRgba(rgba, _image.width, 1, buffer.size, _image.Row<uint8_t>(row), _image.stride);
+                else
+                    memcpy(_image.Row<uint8_t>(row), rgba, buffer.size);
+            }
+            return true;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        ImageRawMapping::ImageRawMapping()
+            : _data(NULL)
+            , _size(0)
+#if defined(_WIN32)
+            , _file(INVALID_HANDLE_VALUE)
+            , _mapping(NULL)
+#else
+            , _file(-1)
+#endif
+        {
+        }
+
+        ImageRawMapping::~ImageRawMapping()
+        {
+#if defined(_WIN32)
+            if (_data)
+                ::UnmapViewOfFile(_data);
+            if (_mapping)
+                ::CloseHandle((HANDLE)_mapping);
+            if (_file != INVALID_HANDLE_VALUE)
+                ::CloseHandle((HANDLE)_file);
+#else
+            if (_data)
+                ::munmap((void*)_data, _size);
+            if (_file != -1)
+                ::close(_file);
+#endif
+        }
+
+        bool ImageRawMapping::Open(const char* path)
+        {
+#if defined(_WIN32)
+            _file = ::CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+            if (_file == INVALID_HANDLE_VALUE)
+                return false;
+            LARGE_INTEGER size;
+            if (!::GetFileSizeEx((HANDLE)_file, &size) || size.QuadPart < (LONGLONG)sizeof(ImageRawHeader))
+                return false;
+            _size = (size_t)size.QuadPart;
+            _mapping = ::CreateFileMappingA((HANDLE)_file, NULL, PAGE_READONLY, 0, 0, NULL);
+            if (_mapping == NULL)
+                return false;
+            _data = (const uint8_t*)::MapViewOfFile((HANDLE)_mapping, FILE_MAP_READ, 0, 0, 0);
+            if (_data == NULL)
+                return false;
+#else
+            _file = ::open(path, O_RDONLY);
+            if (_file == -1)
+                return false;
+            struct stat info;
+            if (::fstat(_file, &info) != 0 || info.st_size < (off_t)sizeof(ImageRawHeader))
+                return false;
+            _size = (size_t)info.st_size;
+            void* data = ::mmap(NULL, _size, PROT_READ, MAP_SHARED, _file, 0);
+            if (data == MAP_FAILED)
+                return false;
+            _data = (const uint8_t*)data;
+#endif
+            return ((const ImageRawHeader*)_data)->Valid(_size);
+        }
+
+        void* ImageRawMapFile(const char* path, const uint8_t** data, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format)
+        {
+            ImageRawMapping* mapping = new ImageRawMapping();
+            if (!mapping->Open(path))
+            {
+                delete mapping;
+                return NULL;
+            }
+            const ImageRawHeader& header = *(const ImageRawHeader*)mapping->Data();
+            *data = mapping->Data() + header.offset;
+            *stride = header.stride;
+            *width = header.width;
+            *height = header.height;
+            *format = (SimdPixelFormatType)header.format;
+            return mapping;
+        }
+    }
+}
@@ -25,9 +25,11 @@
 #include "Simd/SimdImageSave.h"
 #include "Simd/SimdCpu.h"
 #include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
 
 #include <stdio.h>
 
+#include <atomic>
 #include <memory>
 #include <sstream>
 
@@ -68,11 +70,15 @@ namespace Simd
                 else if (ext == "jpg" || ext == "jpeg")
                 {
                     file = SimdImageFileJpeg;
-                    if (quality == 100)
-                        quality = 85;
+                    if ((quality & 0xFF) == 100)
+                        quality = (quality & ~0xFF) | 85;
                 }
                 else if (ext == "bmp")
                     file = SimdImageFileBmp;
+                else if (ext == "qoi")
+                    file = SimdImageFileQoi;
+                else if (ext == "simd")
+                    file = SimdImageFileRaw;
             }
         }
         size_t size;
@@ -91,6 +97,72 @@ namespace Simd
         return result;
     }
 
+    namespace
+    {
+        struct ImageBuffer
+        {
+            uint8_t* data;
+            size_t capacity, size;
+        };
+
+        SimdBool ImageBufferWrite(void* user, const uint8_t* data, size_t size)
+        {
+            ImageBuffer& buffer = *(ImageBuffer*)user;
+            if (buffer.size + size <= buffer.capacity)
+                memcpy(buffer.data + buffer.size, data, size);
+            buffer.size += size;
+            return SimdTrue;
+        }
+    }
+
+    SimdBool ImageSaveToBuffer(const ImageSaveToSinkPtr saver, const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, uint8_t* dst, size_t capacity, size_t* size)
+    {
+        ImageBuffer buffer;
+        buffer.data = dst;
+        buffer.capacity = dst ? capacity : 0;
+        buffer.size = 0;
+        bool result = saver(src, stride, width, height, format, file, quality, ImageBufferWrite, &buffer);
+        if (size)
+            *size = result ? buffer.size : 0;
+        return result && buffer.size <= buffer.capacity ? SimdTrue : SimdFalse;
+    }
+
+    size_t ImageSaveBatchToMemory(const ImageSaveToMemoryPtr saver, SimdImageSaveItem* items, size_t count)
+    {
+        std::atomic<size_t> next(0), done(0);
+        size_t threads = Min(Base::GetThreadNumber(), count);
+        Parallel(0, threads, [&](size_t thread, size_t begin, size_t end)
+        {
+            if (threads > 1)
+                Base::SetLocalThreadNumber(1);
+            for (size_t i = next++; i < count; i = next++)
+            {
+                SimdImageSaveItem& item = items[i];
+                item.size = 0;
+                item.data = saver(item.image, item.stride, item.width, item.height, item.format, item.file, item.quality, &item.size);
+                item.status = item.data ? SimdTrue : SimdFalse;
+                if (item.status)
+                    done++;
+            }
+            if (threads > 1)
+                Base::SetLocalThreadNumber(0);
+        }, threads);
+        return done;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool ImageSaver::ToSink(const uint8_t* src, size_t stride, SimdImageWriteCallbackPtr callback, void* user)
+    {
+        static thread_local OutputMemoryStream cache;
+        _stream.Swap(cache);
+        _stream.Clear();
+        bool result = ToStream(src, stride) && callback(user, _stream.Data(), _stream.Size());
+        _stream.Clear();
+        _stream.Swap(cache);
+        return result;
+    }
+
     //-------------------------------------------------------------------------------------------------
 
     namespace Base
@@ -106,6 +178,8 @@ namespace Simd
             case SimdImageFilePng:    return new ImagePngSaver(param);
             case SimdImageFileJpeg:   return new ImageJpegSaver(param);
             case SimdImageFileBmp:   return new ImageBmpSaver(param);
+            case SimdImageFileQoi:   return new ImageQoiSaver(param);
+            case SimdImageFileRaw:   return new ImageRawSaver(param);
             default:
                 return NULL;
             }
@@ -125,6 +199,18 @@ namespace Simd
             }
             return NULL;
         }
+
+        bool ImageSaveToSink(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, SimdImageWriteCallbackPtr callback, void* user)
+        {
+            ImageSaverParam param(width, height, format, file, quality);
+            if (param.Validate() && callback)
+            {
+                Holder<ImageSaver> saver(CreateImageSaver(param));
+                if (saver)
+                    return saver->ToSink(src, stride, callback, user);
+            }
+            return false;
+        }
     }
 }
 
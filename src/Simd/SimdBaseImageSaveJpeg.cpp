@@ -25,6 +25,7 @@
 #include "Simd/SimdImageSave.h"
 #include "Simd/SimdImageSaveJpeg.h"
 #include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
@@ -294,6 +295,51 @@ namespace Simd
             bitBuf.Clear();
         }
 
+        void JpegWriteBlock422(OutputMemoryStream& stream, int width, int height, const uint8_t* red,
+            const uint8_t* green, const uint8_t* blue, int stride, const float* fY, const float* fUv, int dc[3])
+        {
+            int& DCY = dc[0], & DCU = dc[1], & DCV = dc[2];
+            float Y[128], U[128], V[128];
+            float subU[64], subV[64];
+            bool gray = red == green && red == blue;
+            Base::BitBuf bitBuf;
+            for (int y = 0; y < height; y += 8)
+            {
+                for (int x = 0; x < width; x += 16)
+                {
+                    if (gray)
+                        Base::GrayToY16x8(red + x, stride, height - y, width - x, Y);
+                    else
+                        Base::RgbToYuv16x8(red + x, green + x, blue + x, stride, height - y, width - x, Y, U, V);
+                    DCY = JpegProcessDu(bitBuf, Y + 0, 8, fY, DCY, Base::HuffmanYdc, Base::HuffmanYac);
+                    DCY = JpegProcessDu(bitBuf, Y + 64, 8, fY, DCY, Base::HuffmanYdc, Base::HuffmanYac);
+                    if (gray)
+                        Base::JpegProcessDuGrayUv(bitBuf);
+                    else
+                    {
+                        for (int yy = 0, pos = 0; yy < 8; ++yy)
+                        {
+                            for (int xx = 0; xx < 8; ++xx, ++pos)
+                            {
+                                int j = (xx & 4) * 16 + yy * 8 + (xx & 3) * 2;
+                                subU[pos] = (U[j + 0] + U[j + 1]) * 0.5f;
+                                subV[pos] = (V[j + 0] + V[j + 1]) * 0.5f;
+                            }
+                        }
+                        DCU = JpegProcessDu(bitBuf, subU, 8, fUv, DCU, Base::HuffmanUVdc, Base::HuffmanUVac);
+                        DCV = JpegProcessDu(bitBuf, subV, 8, fUv, DCV, Base::HuffmanUVdc, Base::HuffmanUVac);
+                    }
+                    if (bitBuf.Full())
+                    {
+                        Base::WriteBits(stream, bitBuf.data, bitBuf.size);
+                        bitBuf.Clear();
+                    }
+                }
+            }
+            Base::WriteBits(stream, bitBuf.data, bitBuf.size);
+            bitBuf.Clear();
+        }
+
         void JpegWriteBlockNv12(OutputMemoryStream& stream, int width, int height, const uint8_t* ySrc, int yStride,
             const uint8_t* uvSrc, int uvStride, const float* fY, const float* fUv, int dc[3])
         {
@@ -367,6 +413,270 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        static const uint8_t DC_LUM_COD[] = { 0, 0, 1, 5, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0 };
+        static const uint8_t DC_LUM_VAL[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+        static const uint8_t AC_LUM_COD[] = { 0, 0, 2, 1, 3, 3, 2, 4, 3, 5, 5, 4, 4, 0, 0, 1, 0x7d };
+        static const uint8_t AC_LUM_VAL[] = {
+           0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 
+           0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 
+           0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 
+           0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 
+           0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 
+           0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2, 
+           0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa
+        };
+        static const uint8_t DC_CHR_COD[] = { 0, 0, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0 };
+        static const uint8_t DC_CHR_VAL[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+        static const uint8_t AC_CHR_COD[] = { 0, 0, 2, 1, 2, 4, 4, 3, 4, 7, 5, 4, 4, 0, 1, 2, 0x77 };
+        static const uint8_t AC_CHR_VAL[] = {
+           0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13, 0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 
+           0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0, 0x15, 0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26, 
+           0x27, 0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 
+           0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 
+           0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 
+           0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 
+           0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa
+        };
+
+        static const uint16_t FILL_BITS[] = { 0x7F, 7 };
+
+        struct JpegHuffmanDecoder
+        {
+            int maxCode[17], minCode[17], valPtr[17];
+            const uint8_t* vals;
+
+            JpegHuffmanDecoder(const uint8_t* cod, const uint8_t* val)
+                : vals(val)
+            {
+                for (int l = 1, code = 0, k = 0; l <= 16; ++l)
+                {
+                    valPtr[l] = k;
+                    minCode[l] = code;
+                    code += cod[l];
+                    k += cod[l];
+                    maxCode[l] = cod[l] ? code - 1 : -1;
+                    code <<= 1;
+                }
+            }
+        };
+
+        static const JpegHuffmanDecoder JpegHuffmanDcDecoders[2] = { JpegHuffmanDecoder(DC_LUM_COD, DC_LUM_VAL), JpegHuffmanDecoder(DC_CHR_COD, DC_CHR_VAL) };
+        static const JpegHuffmanDecoder JpegHuffmanAcDecoders[2] = { JpegHuffmanDecoder(AC_LUM_COD, AC_LUM_VAL), JpegHuffmanDecoder(AC_CHR_COD, AC_CHR_VAL) };
+
+        class JpegBitReader
+        {
+            const uint8_t* _data, * _end;
+            uint32_t _buffer;
+            int _count;
+
+            SIMD_INLINE void Fill()
+            {
+                while (_count <= 24)
+                {
+                    uint32_t byte = _data < _end ? *_data++ : 0xFF;
+                    if (byte == 0xFF && _data < _end && *_data == 0)
+                        _data++;
+                    _buffer |= byte << (24 - _count);
+                    _count += 8;
+                }
+            }
+
+        public:
+            JpegBitReader(const uint8_t* data, size_t size)
+                : _data(data)
+                , _end(data + size)
+                , _buffer(0)
+                , _count(0)
+            {
+            }
+
+            SIMD_INLINE uint16_t Bits(int count)
+            {
+                Fill();
+                uint16_t value = uint16_t(_buffer >> (32 - count));
+                _buffer <<= count;
+                _count -= count;
+                return value;
+            }
+
+            SIMD_INLINE int Symbol(const JpegHuffmanDecoder& decoder)
+            {
+                Fill();
+                for (int l = 1; l <= 16; ++l)
+                {
+                    int code = int(_buffer >> (32 - l));
+                    if (code <= decoder.maxCode[l])
+                    {
+                        _buffer <<= l;
+                        _count -= l;
+                        return decoder.vals[decoder.valPtr[l] + code - decoder.minCode[l]];
+                    }
+                }
+                return 0;
+            }
+        };
+
+        struct JpegHuffmanCounter
+        {
+            uint32_t* freq;
+
+            JpegHuffmanCounter(uint32_t * f)
+                : freq(f)
+            {
+            }
+
+            SIMD_INLINE void Symbol(int table, int symbol)
+            {
+                freq[table * 256 + symbol]++;
+            }
+
+            SIMD_INLINE void Bits(uint16_t value, int count)
+            {
+            }
+        };
+
+        struct JpegHuffmanWriter
+        {
+            OutputMemoryStream& stream;
+            const uint16_t(*codes)[256][2];
+            Base::BitBuf bitBuf;
+
+            JpegHuffmanWriter(OutputMemoryStream& s, const uint16_t(*c)[256][2])
+                : stream(s)
+                , codes(c)
+            {
+            }
+
+            SIMD_INLINE void Symbol(int table, int symbol)
+            {
+                bitBuf.Push(codes[table][symbol]);
+                if (bitBuf.Full())
+                {
+                    Base::WriteBits(stream, bitBuf.data, bitBuf.size);
+                    bitBuf.Clear();
+                }
+            }
+
+            SIMD_INLINE void Bits(uint16_t value, int count)
+            {
+                uint16_t bits[2] = { value, uint16_t(count) };
+                bitBuf.Push(bits);
+            }
+
+            SIMD_INLINE void Flush()
+            {
+                Base::WriteBits(stream, bitBuf.data, bitBuf.size);
+                bitBuf.Clear();
+                Base::WriteBits(stream, FILL_BITS);
+            }
+        };
+
+        template<class Sink> void JpegTranscode(const uint8_t* data, size_t size, int mcus, int lumas, Sink& sink)
+        {
+            JpegBitReader reader(data, size);
+            for (int m = 0; m < mcus; ++m)
+            {
+                for (int b = 0, blocks = lumas + 2; b < blocks; ++b)
+                {
+                    int t = b < lumas ? 0 : 1;
+                    int s = reader.Symbol(JpegHuffmanDcDecoders[t]);
+                    sink.Symbol(t * 2 + 0, s);
+                    if (s)
+                        sink.Bits(reader.Bits(s), s);
+                    for (int k = 1; k < 64;)
+                    {
+                        int rs = reader.Symbol(JpegHuffmanAcDecoders[t]);
+                        sink.Symbol(t * 2 + 1, rs);
+                        if ((rs & 15) == 0)
+                        {
+                            if (rs != 0xF0)
+                                break;
+                            k += 16;
+                        }
+                        else
+                        {
+                            sink.Bits(reader.Bits(rs & 15), rs & 15);
+                            k += (rs >> 4) + 1;
+                        }
+                    }
+                }
+            }
+        }
+
+        static int JpegOptimalHuffman(const uint32_t* src, uint8_t* bits, uint8_t* vals, uint16_t codes[256][2])
+        {
+            const int MAX_LEN = 64;
+            uint64_t freq[257];
+            int size[257], next[257], count[MAX_LEN + 1];
+            for (int i = 0; i < 256; ++i)
+                freq[i] = src[i];
+            freq[256] = 1;
+            for (int i = 0; i < 257; ++i)
+                size[i] = 0, next[i] = -1;
+            for (;;)
+            {
+                int c1 = -1, c2 = -1;
+                for (int i = 0; i < 257; ++i)
+                    if (freq[i] && (c1 < 0 || freq[i] <= freq[c1]))
+                        c1 = i;
+                for (int i = 0; i < 257; ++i)
+                    if (freq[i] && i != c1 && (c2 < 0 || freq[i] <= freq[c2]))
+                        c2 = i;
+                if (c2 < 0)
+                    break;
+                freq[c1] += freq[c2];
+                freq[c2] = 0;
+                for (size[c1]++; next[c1] >= 0; size[c1]++)
+                    c1 = next[c1];
+                next[c1] = c2;
+                for (size[c2]++; next[c2] >= 0; size[c2]++)
+                    c2 = next[c2];
+            }
+            memset(count, 0, sizeof(count));
+            for (int i = 0; i < 257; ++i)
+                if (size[i])
+                    count[size[i]]++;
+            for (int l = MAX_LEN; l > 16; --l)
+            {
+                while (count[l] > 0)
+                {
+                    int j = l - 2;
+                    while (count[j] == 0)
+                        j--;
+                    count[l] -= 2;
+                    count[l - 1]++;
+                    count[j + 1] += 2;
+                    count[j]--;
+                }
+            }
+            for (int l = 16; l > 0; --l)
+            {
+                if (count[l])
+                {
+                    count[l]--;
+                    break;
+                }
+            }
+            int n = 0;
+            for (int l = 1; l <= MAX_LEN; ++l)
+                for (int i = 0; i < 256; ++i)
+                    if (size[i] == l)
+                        vals[n++] = uint8_t(i);
+            memset(codes, 0, 256 * 2 * sizeof(uint16_t));
+            for (int l = 1, k = 0, code = 0; l <= 16; ++l, code <<= 1)
+            {
+                bits[l - 1] = uint8_t(count[l]);
+                for (int i = 0; i < count[l]; ++i, ++k, ++code)
+                {
+                    codes[vals[k]][0] = uint16_t(code);
+                    codes[vals[k]][1] = uint16_t(l);
+                }
+            }
+            return n;
+        }
+
+        //---------------------------------------------------------------------
+
         ImageJpegSaver::ImageJpegSaver(const ImageSaverParam& param)
             : ImageSaver(param)
             , _deintBgra(NULL)
@@ -395,7 +705,12 @@ namespace Simd
                 default:
                     break;
                 }
-                _writeBlock = _subSample ? JpegWriteBlockSubs : JpegWriteBlockFull;
+                if (_sampling == SimdJpegSampling420)
+                    _writeBlock = JpegWriteBlockSubs;
+                else if (_sampling == SimdJpegSampling422)
+                    _writeBlock = JpegWriteBlock422;
+                else
+                    _writeBlock = JpegWriteBlockFull;
             }
             else
             {
@@ -415,10 +730,14 @@ namespace Simd
             static const float AASF[] = { 1.0f * 2.828427125f, 1.387039845f * 2.828427125f, 
                 1.306562965f * 2.828427125f, 1.175875602f * 2.828427125f, 1.0f * 2.828427125f, 
                 0.785694958f * 2.828427125f, 0.541196100f * 2.828427125f, 0.275899379f * 2.828427125f };
-            _quality = _param.quality;
-            _quality = _quality ? _quality : 90;
-            _subSample = (_quality <= 90 || _param.yuvType != SimdYuvUnknown) ? 1 : 0;
-            _quality = _quality < 1 ? 1 : _quality > 100 ? 100 : _quality;
+            _quality = _param.quality & 0xFF;
+            _quality = _quality ? Simd::Min(_quality, 100) : 90;
+            _sampling = _param.quality & SimdJpegSampling444;
+            if (_sampling == SimdJpegSamplingAuto)
+                _sampling = _quality <= 90 ? SimdJpegSampling420 : SimdJpegSampling444;
+            if (_param.yuvType != SimdYuvUnknown)
+                _sampling = SimdJpegSampling420;
+            _optimize = (_param.quality & SimdJpegOptimizeHuffman) != 0;
             _quality = _quality < 50 ? 5000 / _quality : 200 - _quality * 2;
             for (size_t i = 0; i < 64; ++i)
             {
@@ -436,136 +755,211 @@ namespace Simd
                     _fUv[i] = 1.0f / (_uUv[ZigZag[i]] * AASF[y] * AASF[x]);
                 }
             }
-            _block = _subSample ? 16 : 8;
-            _width = (int)AlignHi(_param.width, _block);
+            _block = _sampling == SimdJpegSampling420 ? 16 : 8;
+            _width = (int)AlignHi(_param.width, _sampling == SimdJpegSampling444 ? 8 : 16);
+            _cols = _width / (_sampling == SimdJpegSampling444 ? 8 : 16);
             if (_param.format != SimdPixelFormatGray8 && _param.yuvType == SimdYuvUnknown)
                 _buffer.Resize(_width * _block * 3);
+            int rows = (int)DivHi(_param.height, _block), threads = (int)Base::GetThreadNumber();
+            _slice = threads > 1 ? Simd::Min((int)DivHi(rows, threads), 0xFFFF / _cols) : rows;
+            _slices = (int)DivHi(rows, _slice);
         }
 
         void ImageJpegSaver::WriteHeader()
         {
-            static const uint8_t DC_LUM_COD[] = { 0, 0, 1, 5, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0 };
-            static const uint8_t DC_LUM_VAL[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
-            static const uint8_t AC_LUM_COD[] = { 0, 0, 2, 1, 3, 3, 2, 4, 3, 5, 5, 4, 4, 0, 0, 1, 0x7d };
-            static const uint8_t AC_LUM_VAL[] = {
-               0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 
-               0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 
-               0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 
-               0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 
-               0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 
-               0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2, 
-               0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa
-            };
-            static const uint8_t DC_CHR_COD[] = { 0, 0, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0 };
-            static const uint8_t DC_CHR_VAL[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
-            static const uint8_t AC_CHR_COD[] = { 0, 0, 2, 1, 2, 4, 4, 3, 4, 7, 5, 4, 4, 0, 1, 2, 0x77 };
-            static const uint8_t AC_CHR_VAL[] = {
-               0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13, 0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 
-               0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0, 0x15, 0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26, 
-               0x27, 0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 
-               0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 
-               0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 
-               0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 
-               0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa
-            };
             static const uint8_t head0[] = { 0xFF, 0xD8, 0xFF, 0xE0, 0, 0x10, 'J', 'F', 'I', 'F', 0, 1, 1, 0, 0, 1, 0, 1, 0, 0, 0xFF, 0xDB, 0, 0x84, 0 };
             static const uint8_t head2[] = { 0xFF, 0xDA, 0, 0xC, 3, 1, 0, 2, 0x11, 3, 0x11, 0, 0x3F, 0 };
+            const uint8_t factor = _sampling == SimdJpegSampling420 ? 0x22 : (_sampling == SimdJpegSampling422 ? 0x21 : 0x11);
             const uint8_t head1[] = { 0xFF, 0xC0, 0, 0x11, 8,  uint8_t(_param.height >> 8),  uint8_t(_param.height),  uint8_t(_param.width >> 8),  
-                uint8_t(_param.width), 3, 1, uint8_t(_subSample ? 0x22 : 0x11), 0, 2, 0x11, 1, 3, 0x11, 1, 0xFF, 0xC4, 0x01, 0xA2, 0 };
+                uint8_t(_param.width), 3, 1, factor, 0, 2, 0x11, 1, 3, 0x11, 1 };
             _stream.Write(head0, sizeof(head0));
             _stream.Write(_uY, 64);
             _stream.Write8u(1);
             _stream.Write(_uUv, 64);
             _stream.Write(head1, sizeof(head1));
-            _stream.Write(DC_LUM_COD + 1, sizeof(DC_LUM_COD) - 1);
-            _stream.Write(DC_LUM_VAL, sizeof(DC_LUM_VAL));
-            _stream.Write8u(0x10); // HTYACinfo
-            _stream.Write(AC_LUM_COD + 1, sizeof(AC_LUM_COD) - 1);
-            _stream.Write(AC_LUM_VAL, sizeof(AC_LUM_VAL));
-            _stream.Write8u(1); // HTUDCinfo
-            _stream.Write(DC_CHR_COD + 1, sizeof(DC_CHR_COD) - 1);
-            _stream.Write(DC_CHR_VAL, sizeof(DC_CHR_VAL));
-            _stream.Write8u(0x11); // HTUACinfo
-            _stream.Write(AC_CHR_COD + 1, sizeof(AC_CHR_COD) - 1);
-            _stream.Write(AC_CHR_VAL, sizeof(AC_CHR_VAL));
+            if (_optimize)
+            {
+                _stream.Write8u(0xFF);
+                _stream.Write8u(0xC4);
+                _stream.Write8u(uint8_t((_huffman.size + 2) >> 8));
+                _stream.Write8u(uint8_t(_huffman.size + 2));
+                _stream.Write(_huffman.data, _huffman.size);
+            }
+            else
+            {
+                static const uint8_t dht[] = { 0xFF, 0xC4, 0x01, 0xA2, 0 };
+                _stream.Write(dht, sizeof(dht));
+                _stream.Write(DC_LUM_COD + 1, sizeof(DC_LUM_COD) - 1);
+                _stream.Write(DC_LUM_VAL, sizeof(DC_LUM_VAL));
+                _stream.Write8u(0x10); // HTYACinfo
+                _stream.Write(AC_LUM_COD + 1, sizeof(AC_LUM_COD) - 1);
+                _stream.Write(AC_LUM_VAL, sizeof(AC_LUM_VAL));
+                _stream.Write8u(1); // HTUDCinfo
+                _stream.Write(DC_CHR_COD + 1, sizeof(DC_CHR_COD) - 1);
+                _stream.Write(DC_CHR_VAL, sizeof(DC_CHR_VAL));
+                _stream.Write8u(0x11); // HTUACinfo
+                _stream.Write(AC_CHR_COD + 1, sizeof(AC_CHR_COD) - 1);
+                _stream.Write(AC_CHR_VAL, sizeof(AC_CHR_VAL));
+            }
+            if (_slices > 1)
+            {
+                const uint8_t dri[] = { 0xFF, 0xDD, 0, 4, uint8_t(_slice * _cols >> 8), uint8_t(_slice * _cols) };
+                _stream.Write(dri, sizeof(dri));
+            }
             _stream.Write(head2, sizeof(head2));
         }
 
-        bool ImageJpegSaver::ToStream(const uint8_t* src, size_t stride)
+        void ImageJpegSaver::OptimizeHuffman(OutputMemoryStream* streams)
         {
-            Init();
-            WriteHeader();
-            uint8_t* r = _buffer.data, * g = r + _width * _block,* b = g + _width * _block;
-            int dc[3] = { 0, 0, 0 };
-            for (int row = 0; row < (int)_param.height; row += _block)
+            static const uint8_t ids[4] = { 0x00, 0x10, 0x01, 0x11 };
+            int lumas = _sampling == SimdJpegSampling420 ? 4 : (_sampling == SimdJpegSampling422 ? 2 : 1);
+            std::vector<int> mcus(_slices);
+            for (int s = 0; s < _slices; ++s)
+                mcus[s] = (int)DivHi(Simd::Min(_slice * _block, (int)_param.height - s * _slice * _block), _block) * _cols;
+            std::vector<uint32_t> freq(_slices * 4 * 256, 0);
+            Simd::Parallel(0, _slices, [&](size_t thread, size_t begin, size_t end)
             {
-                int block = Simd::Min(row + _block, (int)_param.height) - row;
-                switch (_param.format)
+                for (size_t s = begin; s < end; ++s)
                 {
-                case SimdPixelFormatBgr24:
-                    _deintBgr(src, stride, _param.width, block, b, _width, g, _width, r, _width);
-                    break;
-                case SimdPixelFormatBgra32:
-                    _deintBgra(src, stride, _param.width, block, b, _width, g, _width, r, _width, NULL, 0);
-                    break;
-                case SimdPixelFormatRgb24:
-                    _deintBgr(src, stride, _param.width, block, r, _width, g, _width, b, _width);
-                    break;
-                case SimdPixelFormatRgba32:
-                    _deintBgra(src, stride, _param.width, block, r, _width, g, _width, b, _width, NULL, 0);
-                    break;
-                default: 
-                    break;
+                    JpegHuffmanCounter counter(freq.data() + s * 4 * 256);
+                    JpegTranscode(streams[s].Data(), streams[s].Size(), mcus[s], lumas, counter);
+                }
+            }, Base::GetThreadNumber());
+            for (int s = 1; s < _slices; ++s)
+                for (int i = 0; i < 4 * 256; ++i)
+                    freq[i] += freq[s * 4 * 256 + i];
+            uint16_t codes[4][256][2];
+            uint8_t dht[4 * (1 + 16 + 256)];
+            size_t size = 0;
+            for (int t = 0; t < 4; ++t)
+            {
+                dht[size] = ids[t];
+                size += 1 + 16 + JpegOptimalHuffman(freq.data() + t * 256, dht + size + 1, dht + size + 1 + 16, codes[t]);
+            }
+            _huffman.Assign(dht, size);
+            Simd::Parallel(0, _slices, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t s = begin; s < end; ++s)
+                {
+                    OutputMemoryStream stream(streams[s].Size());
+                    JpegHuffmanWriter writer(stream, codes);
+                    JpegTranscode(streams[s].Data(), streams[s].Size(), mcus[s], lumas, writer);
+                    writer.Flush();
+                    streams[s].Swap(stream);
+                }
+            }, Base::GetThreadNumber());
+        }
+
+        template<class WriteSlice> void ImageJpegSaver::WriteSlices(const WriteSlice& writeSlice)
+        {
+            if (_slices == 1 && !_optimize)
+            {
+                WriteHeader();
+                writeSlice(_stream, 0, (int)_param.height, _buffer.data);
+                Base::WriteBits(_stream, FILL_BITS);
+            }
+            else
+            {
+                std::vector<OutputMemoryStream> streams(_slices);
+                Simd::Parallel(0, _slices, [&](size_t thread, size_t begin, size_t end)
+                {
+                    Array8u buffer(_buffer.size);
+                    for (size_t s = begin; s < end; ++s)
+                    {
+                        int beg = (int)s * _slice * _block;
+                        writeSlice(streams[s], beg, Simd::Min(beg + _slice * _block, (int)_param.height), buffer.data);
+                        Base::WriteBits(streams[s], FILL_BITS);
+                    }
+                }, Base::GetThreadNumber());
+                if (_optimize)
+                    OptimizeHuffman(streams.data());
+                WriteHeader();
+                for (int s = 0; s < _slices; ++s)
+                {
+                    _stream.Write(streams[s].Data(), streams[s].Size());
+                    if (s < _slices - 1)
+                    {
+                        _stream.Write8u(0xFF);
+                        _stream.Write8u(uint8_t(0xD0 + (s & 7)));
+                    }
                 }
-                if(_param.format == SimdPixelFormatGray8)
-                    _writeBlock(_stream, (int)_param.width, block, src, src, src, (int)stride, _fY, _fUv, dc);
-                else
-                    _writeBlock(_stream, (int)_param.width, block, r, g, b, _width, _fY, _fUv, dc);
-                src += block * stride;
             }
-            static const uint16_t FILL_BITS[] = { 0x7F, 7 };
-            Base::WriteBits(_stream, FILL_BITS);
             _stream.Write8u(0xFF);
             _stream.Write8u(0xD9);
+        }
+
+        bool ImageJpegSaver::ToStream(const uint8_t* src, size_t stride)
+        {
+            Init();
+            WriteSlices([&](OutputMemoryStream& stream, int beg, int end, uint8_t* buffer)
+            {
+                const uint8_t* s = src + beg * stride;
+                uint8_t* r = buffer, * g = r + _width * _block, * b = g + _width * _block;
+                int dc[3] = { 0, 0, 0 };
+                for (int row = beg; row < end; row += _block)
+                {
+                    int block = Simd::Min(row + _block, end) - row;
+                    switch (_param.format)
+                    {
+                    case SimdPixelFormatBgr24:
+                        _deintBgr(s, stride, _param.width, block, b, _width, g, _width, r, _width);
+                        break;
+                    case SimdPixelFormatBgra32:
+                        _deintBgra(s, stride, _param.width, block, b, _width, g, _width, r, _width, NULL, 0);
+                        break;
+                    case SimdPixelFormatRgb24:
+                        _deintBgr(s, stride, _param.width, block, r, _width, g, _width, b, _width);
+                        break;
+                    case SimdPixelFormatRgba32:
+                        _deintBgra(s, stride, _param.width, block, r, _width, g, _width, b, _width, NULL, 0);
+                        break;
+                    default:
+                        break;
+                    }
+                    if (_param.format == SimdPixelFormatGray8)
+                        _writeBlock(stream, (int)_param.width, block, s, s, s, (int)stride, _fY, _fUv, dc);
+                    else
+                        _writeBlock(stream, (int)_param.width, block, r, g, b, _width, _fY, _fUv, dc);
+                    s += block * stride;
+                }
+            });
             return true;
         }
 
         bool ImageJpegSaver::ToStream(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride)
         {
             Init();
-            WriteHeader();
-            int dc[3] = { 0, 0, 0 };
-            for (int row = 0; row < (int)_param.height; row += _block)
+            WriteSlices([&](OutputMemoryStream& stream, int beg, int end, uint8_t* buffer)
             {
-                int block = Simd::Min(row + _block, (int)_param.height) - row;
-                _writeNv12Block(_stream, (int)_param.width, block, y, (int)yStride, uv, (int)uvStride, _fY, _fUv, dc);
-                y += block * yStride;
-                uv += (block / 2) * uvStride;
-            }
-            static const uint16_t FILL_BITS[] = { 0x7F, 7 };
-            Base::WriteBits(_stream, FILL_BITS);
-            _stream.Write8u(0xFF);
-            _stream.Write8u(0xD9);
+                const uint8_t* sy = y + beg * yStride, * suv = uv + beg / 2 * uvStride;
+                int dc[3] = { 0, 0, 0 };
+                for (int row = beg; row < end; row += _block)
+                {
+                    int block = Simd::Min(row + _block, end) - row;
+                    _writeNv12Block(stream, (int)_param.width, block, sy, (int)yStride, suv, (int)uvStride, _fY, _fUv, dc);
+                    sy += block * yStride;
+                    suv += (block / 2) * uvStride;
+                }
+            });
             return true;
         }
 
         bool ImageJpegSaver::ToStream(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride)
         {
             Init();
-            WriteHeader();
-            int dc[3] = { 0, 0, 0 };
-            for (int row = 0; row < (int)_param.height; row += _block)
-            {
-                int block = Simd::Min(row + _block, (int)_param.height) - row;
-                _writeYuv420pBlock(_stream, (int)_param.width, block, y, (int)yStride, u, (int)uStride, v, (int)vStride, _fY, _fUv, dc);
-                y += block * yStride;
-                u += (block / 2) * uStride;
-                v += (block / 2) * vStride;
-            }
-            static const uint16_t FILL_BITS[] = { 0x7F, 7 };
-            Base::WriteBits(_stream, FILL_BITS);
-            _stream.Write8u(0xFF);
-            _stream.Write8u(0xD9);
+            WriteSlices([&](OutputMemoryStream& stream, int beg, int end, uint8_t* buffer)
+            {
+                const uint8_t* sy = y + beg * yStride, * su = u + beg / 2 * uStride, * sv = v + beg / 2 * vStride;
+                int dc[3] = { 0, 0, 0 };
+                for (int row = beg; row < end; row += _block)
+                {
+                    int block = Simd::Min(row + _block, end) - row;
+                    _writeYuv420pBlock(stream, (int)_param.width, block, sy, (int)yStride, su, (int)uStride, sv, (int)vStride, _fY, _fUv, dc);
+                    sy += block * yStride;
+                    su += (block / 2) * uStride;
+                    sv += (block / 2) * vStride;
+                }
+            });
             return true;
         }
 
@@ -26,6 +26,9 @@
 #include "Simd/SimdImageSavePng.h"
 #include "Simd/SimdBase.h"
 #include "Simd/SimdCpu.h"
+#include "Simd/SimdParallel.hpp"
+
+#include <algorithm>
 
 namespace Simd
 {
@@ -74,88 +77,275 @@ namespace Simd
             return (hi << 16) | lo;
         }
 
-        void ZlibCompress(uint8_t* data, int size, int quality, OutputMemoryStream& stream)
+        static uint32_t ZlibAdler32Combine(uint32_t adler1, uint32_t adler2, size_t size2)
         {
-            const int ZHASH = 16384;
-            if (quality < 5)
-                quality = 5;
-            const int basket = quality * 2;
-            Array32i hashTable(ZHASH * basket);
-            memset(hashTable.data, -1, hashTable.RawSize());
+            const uint32_t BASE = 65521;
+            uint32_t rem = uint32_t(size2 % BASE);
+            uint32_t lo = adler1 & 0xFFFF, hi = (rem * lo) % BASE;
+            lo += (adler2 & 0xFFFF) + BASE - 1;
+            hi += (adler1 >> 16) + (adler2 >> 16) + BASE - rem;
+            if (lo >= BASE)
+                lo -= BASE;
+            if (lo >= BASE)
+                lo -= BASE;
+            if (hi >= BASE * 2)
+                hi -= BASE * 2;
+            if (hi >= BASE)
+                hi -= BASE;
+            return (hi << 16) | lo;
+        }
 
-            stream.Write(uint8_t(0x78));
-            stream.Write(uint8_t(0x5e));
-            stream.WriteBits(1, 1);
-            stream.WriteBits(1, 2);
+        static uint8_t ZlibLenCode[259], ZlibDistCode[512], ZlibFixedLitLens[288], ZlibFixedDistLens[30];
+        static uint16_t ZlibFixedLitCodes[288], ZlibFixedDistCodes[30];
 
-            int i = 0, j;
-            while (i < size - 3)
+        SIMD_INLINE int ZlibDistIndex(int dist)
+        {
+            return ZlibDistCode[dist <= 256 ? dist - 1 : 256 + ((dist - 1) >> 7)];
+        }
+
+        static void ZlibBuildLengths(const uint32_t* freq, int size, int limit, uint8_t* lens)
+        {
+            int syms[286], n = 0;
+            for (int i = 0; i < size; ++i)
+            {
+                lens[i] = 0;
+                if (freq[i])
+                    syms[n++] = i;
+            }
+            if (n < 2)
             {
-                int h = ZlibHash(data + i) & (ZHASH - 1), best = 3;
-                uint8_t* bestLoc = 0;
-                int* hList = hashTable.data + h * basket;
-                for (j = 0; hList[j] != -1 && j < basket; ++j)
+                int sym = n ? syms[0] : 0;
+                lens[sym] = 1;
+                lens[sym ? 0 : 1] = 1;
+                return;
+            }
+            std::sort(syms, syms + n, [freq](int a, int b) { return freq[a] < freq[b] || (freq[a] == freq[b] && a < b); });
+            uint32_t weight[286 * 2];
+            int parent[286 * 2], depth[286 * 2], bl[32] = { 0 };
+            for (int i = 0; i < n; ++i)
+                weight[i] = freq[syms[i]];
+            for (int leaf = 0, node = n, next = n; next < 2 * n - 1; ++next)
+            {
+                int a = (leaf < n && (node >= next || weight[leaf] <= weight[node])) ? leaf++ : node++;
+                int b = (leaf < n && (node >= next || weight[leaf] <= weight[node])) ? leaf++ : node++;
+                weight[next] = weight[a] + weight[b];
+                parent[a] = next;
+                parent[b] = next;
+            }
+            depth[2 * n - 2] = 0;
+            for (int i = 2 * n - 3; i >= 0; --i)
+                depth[i] = depth[parent[i]] + 1;
+            for (int i = 0; i < n; ++i)
+                bl[Min(depth[i], limit)]++;
+            uint32_t total = 0;
+            for (int l = 1; l <= limit; ++l)
+                total += bl[l] << (limit - l);
+            for (; total != (1u << limit); total--)
+            {
+                bl[limit]--;
+                for (int l = limit - 1; l > 0; --l)
                 {
-                    if (hList[j] > i - 32768)
+                    if (bl[l])
                     {
-                        int d = ZlibCount(data + hList[j], data + i, size - i);
-                        if (d >= best)
-                        {
-                            best = d;
-                            bestLoc = data + hList[j];
-                        }
+                        bl[l]--;
+                        bl[l + 1] += 2;
+                        break;
                     }
                 }
-                if (j == basket)
+            }
+            for (int l = limit, i = 0; l > 0; --l)
+                for (int c = bl[l]; c > 0; --c)
+                    lens[syms[i++]] = uint8_t(l);
+        }
+
+        static void ZlibBuildCodes(const uint8_t* lens, int size, uint16_t* codes)
+        {
+            int bl[16] = { 0 }, next[16] = { 0 };
+            for (int i = 0; i < size; ++i)
+                bl[lens[i]]++;
+            bl[0] = 0;
+            for (int l = 1, code = 0; l < 16; ++l)
+            {
+                code = (code + bl[l - 1]) << 1;
+                next[l] = code;
+            }
+            for (int i = 0; i < size; ++i)
+            {
+                if (lens[i])
                 {
-                    memcpy(hList, hList + quality, quality * sizeof(int));
-                    memset(hList + quality, -1, quality * sizeof(int));
-                    j = quality;
+                    int code = next[lens[i]]++, rev = 0;
+                    for (int b = 0; b < lens[i]; ++b, code >>= 1)
+                        rev = (rev << 1) | (code & 1);
+                    codes[i] = uint16_t(rev);
                 }
-                hList[j] = i;
+            }
+        }
 
-                if (bestLoc)
+        static bool ZlibCodeTablesInit()
+        {
+            for (int c = 0; c < 29; ++c)
+                for (int l = ZlibLenC[c]; l < ZlibLenC[c + 1] && l <= 258; ++l)
+                    ZlibLenCode[l] = uint8_t(c);
+            for (int c = 0; c < 30; ++c)
+            {
+                for (int d = ZlibDistC[c]; d < ZlibDistC[c + 1]; ++d)
                 {
-                    h = ZlibHash(data + i + 1) & (ZHASH - 1);
-                    int* hList = hashTable.data + h * basket;
-                    for (j = 0; hList[j] != -1 && j < basket; ++j)
-                    {
-                        if (hList[j] > i - 32767)
-                        {
-                            int e = ZlibCount(data + hList[j], data + i + 1, size - i - 1);
-                            if (e > best)
-                            {
-                                bestLoc = NULL;
-                                break;
-                            }
-                        }
-                    }
+                    if (d <= 256)
+                        ZlibDistCode[d - 1] = uint8_t(c);
+                    else
+                        ZlibDistCode[256 + ((d - 1) >> 7)] = uint8_t(c);
                 }
+            }
+            for (int i = 0; i < 288; ++i)
+                ZlibFixedLitLens[i] = i < 144 ? 8 : i < 256 ? 9 : i < 280 ? 7 : 8;
+            for (int i = 0; i < 30; ++i)
+                ZlibFixedDistLens[i] = 5;
+            ZlibBuildCodes(ZlibFixedLitLens, 288, ZlibFixedLitCodes);
+            ZlibBuildCodes(ZlibFixedDistLens, 30, ZlibFixedDistCodes);
+            return true;
+        }
 
-                if (bestLoc)
+        static size_t ZlibTokensBits(const uint32_t* tokens, size_t count, const uint8_t* litLens, const uint8_t* distLens)
+        {
+            size_t bits = litLens[256];
+            for (size_t i = 0; i < count; ++i)
+            {
+                uint32_t len = tokens[i] & 0xFFFF, dist = tokens[i] >> 16;
+                if (dist)
                 {
-                    int d = (int)(data + i - bestLoc);
-                    assert(d <= 32767 && best <= 258);
-                    for (j = 0; best > Base::ZlibLenC[j + 1] - 1; ++j);
-                    Base::ZlibHuff(j + 257, stream);
-                    if (Base::ZlibLenEb[j])
-                        stream.WriteBits(best - Base::ZlibLenC[j], Base::ZlibLenEb[j]);
-                    for (j = 0; d > Base::ZlibDistC[j + 1] - 1; ++j);
-                    stream.WriteBits(Base::ZlibBitRev(j, 5), 5);
-                    if (Base::ZlibDistEb[j])
-                        stream.WriteBits(d - Base::ZlibDistC[j], Base::ZlibDistEb[j]);
-                    i += best;
+                    int lc = ZlibLenCode[len], dc = ZlibDistIndex(dist);
+                    bits += litLens[257 + lc] + ZlibLenEb[lc] + distLens[dc] + ZlibDistEb[dc];
                 }
                 else
+                    bits += litLens[len];
+            }
+            return bits;
+        }
+
+        static void ZlibWriteTokens(const uint32_t* tokens, size_t count, const uint8_t* litLens, const uint16_t* litCodes, 
+            const uint8_t* distLens, const uint16_t* distCodes, OutputMemoryStream& stream)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                uint32_t len = tokens[i] & 0xFFFF, dist = tokens[i] >> 16;
+                if (dist)
                 {
-                    ZlibHuffB(data[i], stream);
-                    ++i;
+                    int lc = ZlibLenCode[len], dc = ZlibDistIndex(dist);
+                    stream.WriteBits(litCodes[257 + lc], litLens[257 + lc]);
+                    if (ZlibLenEb[lc])
+                        stream.WriteBits(len - ZlibLenC[lc], ZlibLenEb[lc]);
+                    stream.WriteBits(distCodes[dc], distLens[dc]);
+                    if (ZlibDistEb[dc])
+                        stream.WriteBits(dist - ZlibDistC[dc], ZlibDistEb[dc]);
                 }
+                else
+                    stream.WriteBits(litCodes[len], litLens[len]);
             }
-            for (; i < size; ++i)
-                ZlibHuffB(data[i], stream);
-            ZlibHuff(256, stream);
-            stream.FlushBits();
+            stream.WriteBits(litCodes[256], litLens[256]);
+        }
+
+        void ZlibWriteBlock(const uint32_t* tokens, size_t count, bool last, OutputMemoryStream& stream)
+        {
+            static const bool tablesInited = ZlibCodeTablesInit();
+            (void)tablesInited;
+            static const uint8_t ORDER[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+            uint32_t litFreq[286] = { 0 }, distFreq[30] = { 0 }, clFreq[19] = { 0 };
+            for (size_t i = 0; i < count; ++i)
+            {
+                uint32_t len = tokens[i] & 0xFFFF, dist = tokens[i] >> 16;
+                if (dist)
+                {
+                    litFreq[257 + ZlibLenCode[len]]++;
+                    distFreq[ZlibDistIndex(dist)]++;
+                }
+                else
+                    litFreq[len]++;
+            }
+            litFreq[256] = 1;
+
+            uint8_t litLens[288], distLens[30], clLens[19], all[286 + 30], rle[286 + 30], ext[286 + 30];
+            uint16_t litCodes[288], distCodes[30], clCodes[19];
+            ZlibBuildLengths(litFreq, 286, 15, litLens);
+            ZlibBuildLengths(distFreq, 30, 15, distLens);
+            int hlit = 286, hdist = 30, hclen = 19, n = 0;
+            while (hlit > 257 && litLens[hlit - 1] == 0)
+                hlit--;
+            while (hdist > 1 && distLens[hdist - 1] == 0)
+                hdist--;
+            memcpy(all, litLens, hlit);
+            memcpy(all + hlit, distLens, hdist);
+            for (int i = 0, total = hlit + hdist; i < total;)
+            {
+                int val = all[i], run = 1;
+                while (i + run < total && all[i + run] == val)
+                    run++;
+                i += run;
+                if (val == 0)
+                {
+                    for (; run >= 11; n++)
+                    {
+                        int r = Min(run, 138);
+                        rle[n] = 18, ext[n] = uint8_t(r - 11), run -= r;
+                    }
+                    if (run >= 3)
+                        rle[n] = 17, ext[n++] = uint8_t(run - 3), run = 0;
+                }
+                else
+                {
+                    rle[n] = uint8_t(val), ext[n++] = 0, run--;
+                    for (; run >= 3; n++)
+                    {
+                        int r = Min(run, 6);
+                        rle[n] = 16, ext[n] = uint8_t(r - 3), run -= r;
+                    }
+                }
+                for (; run > 0; run--)
+                    rle[n] = uint8_t(val), ext[n++] = 0;
+            }
+            for (int i = 0; i < n; ++i)
+                clFreq[rle[i]]++;
+            ZlibBuildLengths(clFreq, 19, 7, clLens);
+            while (hclen > 4 && clLens[ORDER[hclen - 1]] == 0)
+                hclen--;
+
+            static const uint8_t CL_EB[19] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 3, 7 };
+            size_t dynamic = 14 + 3 * hclen + ZlibTokensBits(tokens, count, litLens, distLens);
+            for (int i = 0; i < n; ++i)
+                dynamic += clLens[rle[i]] + CL_EB[rle[i]];
+            size_t fixed = ZlibTokensBits(tokens, count, ZlibFixedLitLens, ZlibFixedDistLens);
+
+            stream.WriteBits(last ? 1 : 0, 1);
+            if (fixed <= dynamic)
+            {
+                stream.WriteBits(1, 2);
+                ZlibWriteTokens(tokens, count, ZlibFixedLitLens, ZlibFixedLitCodes, ZlibFixedDistLens, ZlibFixedDistCodes, stream);
+            }
+            else
+            {
+                ZlibBuildCodes(litLens, 286, litCodes);
+                ZlibBuildCodes(distLens, 30, distCodes);
+                ZlibBuildCodes(clLens, 19, clCodes);
+                stream.WriteBits(2, 2);
+                stream.WriteBits(hlit - 257, 5);
+                stream.WriteBits(hdist - 1, 5);
+                stream.WriteBits(hclen - 4, 4);
+                for (int i = 0; i < hclen; ++i)
+                    stream.WriteBits(clLens[ORDER[i]], 3);
+                for (int i = 0; i < n; ++i)
+                {
+                    stream.WriteBits(clCodes[rle[i]], clLens[rle[i]]);
+                    if (CL_EB[rle[i]])
+                        stream.WriteBits(ext[i], CL_EB[rle[i]]);
+                }
+                ZlibWriteTokens(tokens, count, litLens, litCodes, distLens, distCodes, stream);
+            }
+        }
+
+        void ZlibCompress(uint8_t* data, int size, int quality, OutputMemoryStream& stream)
+        {
+            stream.Write(uint8_t(0x78));
+            stream.Write(uint8_t(0x5e));
+            Base::ZlibDeflate<Base::ZlibCount>(data, size, quality, true, stream);
             stream.WriteBe32u(ZlibAdler32(data, size));
         }
 
@@ -293,6 +483,10 @@ namespace Simd
                 break;
             }
             _size = _param.width * _channels;
+            if (_param.quality <= 0 || _param.quality > 70)
+                _compression = COMPRESSION;
+            else
+                _compression = _param.quality > 40 ? 4 : (_param.quality > 10 ? 2 : 0);
             if (_param.format == SimdPixelFormatBgr24)
             {
                 _convert = Base::BgrToRgb;
@@ -313,6 +507,8 @@ namespace Simd
             _encode[5] = Base::EncodeLine5;
             _encode[6] = Base::EncodeLine6;
             _compress = Base::ZlibCompress;
+            _deflate = Base::ZlibDeflate<Base::ZlibCount>;
+            _adler32 = Base::ZlibAdler32;
         }
 
         bool ImagePngSaver::ToStream(const uint8_t* src, size_t stride)
@@ -323,14 +519,55 @@ namespace Simd
                 src = _buff.data;
                 stride = _size;
             }
-            for (size_t row = 0; row < _param.height; ++row)
+            size_t threads = Base::GetThreadNumber(), rows = Simd::Max(DivHi(_param.height, threads), DivHi(SEGMENT_MIN, _size + 1));
+            size_t segments = DivHi(_param.height, rows);
+            OutputMemoryStream zlib(Simd::Min(_param.width * _param.height, Base::AlgCacheL1()));
+            if (segments == 1)
+            {
+                FilterRows(src, stride, 0, _param.height, _line.data);
+                _compress(_filt.data, (int)_filt.size, _compression, zlib);
+            }
+            else
+            {
+                std::vector<OutputMemoryStream> streams(segments);
+                std::vector<uint32_t> adlers(segments);
+                Simd::Parallel(0, segments, [&](size_t thread, size_t begin, size_t end)
+                {
+                    Array8i line(_size * FILTERS);
+                    for (size_t s = begin; s < end; ++s)
+                    {
+                        size_t beg = s * rows, last = Simd::Min(beg + rows, _param.height);
+                        FilterRows(src, stride, beg, last, line.data);
+                        uint8_t* data = _filt.data + beg * (_size + 1);
+                        int size = int((last - beg) * (_size + 1));
+                        _deflate(data, size, _compression, s == segments - 1, streams[s]);
+                        adlers[s] = _adler32(data, size);
+                    }
+                }, threads);
+                uint32_t adler = 1;
+                zlib.Write(uint8_t(0x78));
+                zlib.Write(uint8_t(0x5e));
+                for (size_t s = 0; s < segments; ++s)
+                {
+                    zlib.Write(streams[s].Data(), streams[s].Size());
+                    adler = ZlibAdler32Combine(adler, adlers[s], (Simd::Min((s + 1) * rows, _param.height) - s * rows) * (_size + 1));
+                }
+                zlib.WriteBe32u(adler);
+            }
+            WriteToStream(zlib.Data(), zlib.Size());
+            return true;
+        }
+
+        void ImagePngSaver::FilterRows(const uint8_t* src, size_t stride, size_t begin, size_t end, int8_t* line)
+        {
+            for (size_t row = begin; row < end; ++row)
             {
                 int bestFilter = 0, bestSum = INT_MAX;
                 for (int filter = 0; filter < FILTERS; filter++)
                 {
                     static const int TYPES[] = { 0, 1, 0, 5, 6, 0, 1, 2, 3, 4 };
                     int type = TYPES[filter + (row ? 1 : 0) * FILTERS];
-                    int sum = _encode[type](src + stride * row, stride, _channels, _size, _line.data + _size * filter);
+                    int sum = _encode[type](src + stride * row, stride, _channels, _size, line + _size * filter);
                     if (sum < bestSum)
                     {
                         bestSum = sum;
@@ -338,12 +575,8 @@ namespace Simd
                     }
                 }
                 _filt[row * (_size + 1)] = (uint8_t)bestFilter;
-                memcpy(_filt.data + row * (_size + 1) + 1, _line.data + _size * bestFilter, _size);
+                memcpy(_filt.data + row * (_size + 1) + 1, line + _size * bestFilter, _size);
             }
-            OutputMemoryStream zlib(Simd::Min(_param.width * _param.height, Base::AlgCacheL1()));
-            _compress(_filt.data, (int)_filt.size, COMPRESSION, zlib);
-            WriteToStream(zlib.Data(), zlib.Size());
-            return true;
         }
 
         SIMD_INLINE void WriteCrc32(OutputMemoryStream& stream, size_t size)
@@ -0,0 +1,149 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdImageSave.h"
+#include "Simd/SimdImageQoi.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        void QoiEncodeCodes(const uint8_t* rgba, size_t size, uint32_t prev, uint32_t* codes)
+        {
+            const uint32_t* src = (const uint32_t*)rgba;
+            for (size_t i = 0; i < size; ++i)
+            {
+                codes[i] = QoiCode(src[i], prev);
+                prev = src[i];
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        ImageQoiSaver::ImageQoiSaver(const ImageSaverParam& param)
+            : ImageSaver(param)
+            , _toRgba(NULL)
+            , _convert(NULL)
+            , _encodeCodes(Base::QoiEncodeCodes)
+            , _channels(3)
+        {
+            switch (_param.format)
+            {
+            case SimdPixelFormatGray8: _toRgba = Base::GrayToBgra; break;
+            case SimdPixelFormatBgr24: _toRgba = Base::RgbToBgra; break;
+            case SimdPixelFormatBgra32: _convert = Base::BgraToRgba; _channels = 4; break;
+            case SimdPixelFormatRgb24: _toRgba = Base::BgrToBgra; break;
+            case SimdPixelFormatRgba32: _channels = 4; break;
+            default: break;
+            }
+        }
+
+        bool ImageQoiSaver::ToStream(const uint8_t* src, size_t stride)
+        {
+            size_t width = _param.width, height = _param.height;
+            if (_toRgba || _convert)
+                _buffer.Resize(width * 4);
+            _codes.Resize(width);
+
+            _stream.Reserve(QoiHeaderSize + QoiPaddingSize + width * height * (_channels + 1) / 2);
+            _stream.Write("qoif", 4);
+            _stream.WriteBe32u((uint32_t)width);
+            _stream.WriteBe32u((uint32_t)height);
+            _stream.Write8u(_channels);
+            _stream.Write8u(0);
+
+            uint32_t index[64] = { 0 }, prev = QoiPixelInit;
+            int run = 0;
+            for (size_t row = 0; row < height; ++row, src += stride)
+            {
+                const uint8_t* rgba = src;
+                if (_toRgba)
+                    _toRgba(src, width, 1, stride, _buffer.data, width * 4, 0xFF), rgba = _buffer.data;
+                else if (_convert)
+                    _convert(src, width, 1, stride, _buffer.data, width * 4), rgba = _buffer.data;
+                _encodeCodes(rgba, width, prev, _codes.data);
+
+                _stream.Reserve(_stream.Pos() + width * 5 + 1);
+                uint8_t* beg = _stream.Current(), * dst = beg;
+                const uint32_t* pixels = (const uint32_t*)rgba;
+                for (size_t col = 0; col < width; ++col)
+                {
+                    uint32_t px = pixels[col];
+                    if (px == prev)
+                    {
+                        if (++run == QoiRunMax)
+                        {
+                            *dst++ = QoiOpRun | (run - 1);
+                            run = 0;
+                        }
+                        continue;
+                    }
+                    if (run)
+                    {
+                        *dst++ = QoiOpRun | (run - 1);
+                        run = 0;
+                    }
+                    uint32_t code = _codes[col], hash = code >> 16;
+                    if (index[hash] == px)
+                        *dst++ = QoiOpIndex | hash;
+                    else
+                    {
+                        index[hash] = px;
+                        code &= 0xFFFF;
+                        if (code > 0xFF)
+                        {
+                            dst[0] = uint8_t(code >> 8);
+                            dst[1] = uint8_t(code);
+                            dst += 2;
+                        }
+                        else if (code > QoiCodeRgba)
+                            *dst++ = uint8_t(code);
+                        else if (code == QoiCodeRgb)
+                        {
+                            dst[0] = QoiOpRgb;
+                            dst[1] = uint8_t(px);
+                            dst[2] = uint8_t(px >> 8);
+                            dst[3] = uint8_t(px >> 16);
+                            dst += 4;
+                        }
+                        else
+                        {
+                            dst[0] = QoiOpRgba;
+                            memcpy(dst + 1, &px, 4);
+                            dst += 5;
+                        }
+                    }
+                    prev = px;
+                }
+                _stream.Seek(_stream.Pos() + (dst - beg));
+            }
+            if (run)
+                _stream.Write8u(QoiOpRun | (run - 1));
+            _stream.Write8u(0, QoiPaddingSize - 1);
+            _stream.Write8u(1);
+            return true;
+        }
+    }
+}
@@ -0,0 +1,53 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdImageSave.h"
+#include "Simd/SimdImageRaw.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        ImageRawSaver::ImageRawSaver(const ImageSaverParam& param)
+            : ImageSaver(param)
+        {
+        }
+
+        bool ImageRawSaver::ToStream(const uint8_t* src, size_t stride)
+        {
+            size_t size = _param.width * ImageRawPixelSize(_param.format);
+            ImageRawHeader header;
+            header.Init(_param.width, _param.height, _param.format);
+            _stream.Reserve(header.offset + size_t(header.stride) * header.height);
+            _stream.Write(&header, sizeof(header));
+            _stream.Write8u(0, header.offset - sizeof(header));
+            for (size_t row = 0; row < _param.height; ++row, src += stride)
+            {
+                _stream.Write(src, size);
+                _stream.Write8u(0, header.stride - size);
+            }
+            return true;
+        }
+    }
+}
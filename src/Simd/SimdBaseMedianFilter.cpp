@@ -22,6 +22,7 @@
 * SOFTWARE.
 */
 #include "Simd/SimdMath.h"
+#include "Simd/SimdMedianFilter.h"
 
 namespace Simd
 {
@@ -390,5 +391,28 @@ namespace Simd
                 }
             }
         }
+
+        //-----------------------------------------------------------------------------------------
+
+        struct MedianHist16
+        {
+            static SIMD_INLINE void Add(const uint16_t* src, uint16_t* dst)
+            {
+                for (size_t i = 0; i < 16; ++i)
+                    dst[i] += src[i];
+            }
+
+            static SIMD_INLINE void Update(const uint16_t* add, const uint16_t* sub, uint16_t* dst)
+            {
+                for (size_t i = 0; i < 16; ++i)
+                    dst[i] += add[i] - sub[i];
+            }
+        };
+
+        void MedianFilterSquare(const uint8_t* src, size_t srcStride, size_t width, size_t height,
+            size_t channelCount, size_t radius, uint8_t* dst, size_t dstStride)
+        {
+            MedianFilterSquare<MedianHist16>(src, srcStride, width, height, channelCount, radius, dst, dstStride);
+        }
     }
 }
@@ -0,0 +1,327 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdBase.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdMorphology.h"
+
+#include <cmath>
+
+namespace Simd
+{
+    MorphologyParam::MorphologyParam(size_t w, size_t h, size_t c, SimdMorphologyOperationType o, SimdMorphologyElementType e, size_t sx, size_t sy, size_t a)
+        : width(w)
+        , height(h)
+        , channels(c)
+        , operation(o)
+        , element(e)
+        , sizeX(sx)
+        , sizeY(sy)
+        , align(a)
+    {
+    }
+
+    bool MorphologyParam::Valid() const
+    {
+        return
+            height > 0 &&
+            width > 0 &&
+            channels > 0 && channels <= 4 &&
+            operation >= SimdMorphologyErode && operation <= SimdMorphologyGradient &&
+            (element == SimdMorphologyElementRect || element == SimdMorphologyElementCross || element == SimdMorphologyElementEllipse) &&
+            sizeX > 0 && sizeY > 0 &&
+            align > 0;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    Morphology::Morphology(const MorphologyParam& param)
+        : _param(param)
+    {
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        static void Min8u(const uint8_t* a, const uint8_t* b, size_t size, uint8_t* dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = MinU8(a[i], b[i]);
+        }
+
+        static void Max8u(const uint8_t* a, const uint8_t* b, size_t size, uint8_t* dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = MaxU8(a[i], b[i]);
+        }
+
+        static void Sub8u(const uint8_t* a, const uint8_t* b, size_t size, uint8_t* dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = SaturatedSubtractionU8(a[i], b[i]);
+        }
+
+        template<bool dilate> SIMD_INLINE uint8_t MinMax(uint8_t a, uint8_t b)
+        {
+            return dilate ? (a > b ? a : b) : (a < b ? a : b);
+        }
+
+        template<bool dilate> void VanHerkGilWerman(const uint8_t* src, size_t size, size_t block, size_t step, uint8_t* g, uint8_t* h)
+        {
+            for (size_t beg = 0; beg < size; beg += block)
+            {
+                size_t end = Simd::Min(beg + block, size), i;
+                for (i = beg; i < beg + step; ++i)
+                    g[i] = src[i];
+                for (; i < end; ++i)
+                    g[i] = MinMax<dilate>(g[i - step], src[i]);
+                for (i = end - step; i < end; ++i)
+                    h[i] = src[i];
+                for (i = end - step; i-- > beg;)
+                    h[i] = MinMax<dilate>(h[i + step], src[i]);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        MorphologyDefault::MorphologyDefault(const MorphologyParam& param)
+            : Simd::Morphology(param)
+        {
+            const MorphologyParam& p = _param;
+            ptrdiff_t ax = p.sizeX / 2, ay = p.sizeY / 2;
+            if (p.element == SimdMorphologyElementRect || (p.element == SimdMorphologyElementEllipse && (p.sizeX == 1 || p.sizeY == 1)))
+                _rects.push_back(Rect(-ax, -ay, p.sizeX, p.sizeY));
+            else if (p.element == SimdMorphologyElementCross)
+            {
+                _rects.push_back(Rect(-ax, 0, p.sizeX, 1));
+                if (p.sizeY > 1)
+                    _rects.push_back(Rect(0, -ay, 1, p.sizeY));
+            }
+            else
+            {
+                std::vector<ptrdiff_t> beg(p.sizeY), end(p.sizeY);
+                double r2 = double(ay * ay);
+                for (ptrdiff_t i = 0; i < (ptrdiff_t)p.sizeY; ++i)
+                {
+                    ptrdiff_t dy = i - ay, dx = Round(double(ax) * ::sqrt((r2 - dy * dy) / r2));
+                    beg[i] = Simd::Max<ptrdiff_t>(ax - dx, 0);
+                    end[i] = Simd::Min<ptrdiff_t>(ax + dx + 1, p.sizeX);
+                }
+                for (ptrdiff_t i = 0; i < (ptrdiff_t)p.sizeY; ++i)
+                {
+                    bool unique = true;
+                    for (size_t r = 0; r < _rects.size() && unique; ++r)
+                        unique = _rects[r].left != beg[i] - ax || _rects[r].sizeX != size_t(end[i] - beg[i]);
+                    if (!unique)
+                        continue;
+                    ptrdiff_t top = i, bottom = i;
+                    while (top > 0 && beg[top - 1] <= beg[i] && end[top - 1] >= end[i])
+                        top--;
+                    while (bottom < (ptrdiff_t)p.sizeY - 1 && beg[bottom + 1] <= beg[i] && end[bottom + 1] >= end[i])
+                        bottom++;
+                    _rects.push_back(Rect(beg[i] - ax, top - ay, end[i] - beg[i], bottom - top + 1));
+                }
+            }
+            size_t maxX = 1;
+            for (size_t r = 0; r < _rects.size(); ++r)
+                maxX = Simd::Max(maxX, _rects[r].sizeX);
+            _size = p.width * p.channels;
+            _rowStride = AlignHi(_size, p.align);
+            _padStride = AlignHi(_size + (maxX - 1) * p.channels, p.align);
+            if (_rects.size() > 1)
+                _temp0.Resize(_rowStride * p.height);
+            if (p.operation == SimdMorphologyOpen || p.operation == SimdMorphologyClose || p.operation == SimdMorphologyGradient)
+                _temp1.Resize(_rowStride * p.height);
+            _min = Min8u;
+            _max = Max8u;
+            _sub = Sub8u;
+        }
+
+        void MorphologyDefault::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        {
+            const MorphologyParam& p = _param;
+            switch (p.operation)
+            {
+            case SimdMorphologyErode:
+                Apply(false, src, srcStride, dst, dstStride);
+                break;
+            case SimdMorphologyDilate:
+                Apply(true, src, srcStride, dst, dstStride);
+                break;
+            case SimdMorphologyOpen:
+                Apply(false, src, srcStride, _temp1.data, _rowStride);
+                Apply(true, _temp1.data, _rowStride, dst, dstStride);
+                break;
+            case SimdMorphologyClose:
+                Apply(true, src, srcStride, _temp1.data, _rowStride);
+                Apply(false, _temp1.data, _rowStride, dst, dstStride);
+                break;
+            case SimdMorphologyGradient:
+                Apply(true, src, srcStride, dst, dstStride);
+                Apply(false, src, srcStride, _temp1.data, _rowStride);
+                for (size_t y = 0; y < p.height; ++y)
+                    _sub(dst + y * dstStride, _temp1.data + y * _rowStride, _size, dst + y * dstStride);
+                break;
+            default:
+                assert(0);
+            }
+        }
+
+        void MorphologyDefault::Apply(bool dilate, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+        {
+            const MorphologyParam& p = _param;
+            size_t threads = GetThreadNumber();
+            if (_buffers.size() < threads)
+                _buffers.resize(threads);
+            BinaryPtr binary = dilate ? _max : _min;
+            for (size_t r = 0; r < _rects.size(); ++r)
+            {
+                const Rect& rect = _rects[r];
+                uint8_t* out = r ? _temp0.data : dst;
+                size_t outStride = r ? _rowStride : dstStride;
+                size_t bufSize = 3 * _padStride + (2 * rect.sizeY + 1) * _rowStride;
+                Simd::Parallel(0, p.height, [&](size_t thread, size_t begin, size_t end)
+                {
+                    if (_buffers[thread].size < bufSize)
+                        _buffers[thread].Resize(bufSize);
+                    ApplyRect(dilate, rect, src, srcStride, begin, end, _buffers[thread].data, out, outStride);
+                    if (r)
+                    {
+                        for (size_t y = begin; y < end; ++y)
+                            binary(dst + y * dstStride, out + y * outStride, _size, dst + y * dstStride);
+                    }
+                }, threads, Simd::Max<size_t>(rect.sizeY, 16));
+            }
+        }
+
+        void MorphologyDefault::ApplyRect(bool dilate, const Rect& rect, const uint8_t* src, size_t srcStride, size_t begin, size_t end, uint8_t* buf, uint8_t* dst, size_t dstStride) const
+        {
+            size_t sizeY = rect.sizeY, size = end - begin, count = size + sizeY - 1;
+            ptrdiff_t first = begin + rect.top;
+            if (sizeY == 1)
+            {
+                for (size_t y = begin; y < end; ++y)
+                    RowMinMax(dilate, rect, src, srcStride, y + rect.top, buf, dst + y * dstStride);
+                return;
+            }
+            BinaryPtr binary = dilate ? _max : _min;
+            uint8_t* curr = buf + 3 * _padStride, * next = curr + sizeY * _rowStride, * gather = next + sizeY * _rowStride;
+            for (size_t i = 0; i < sizeY; ++i)
+                RowMinMax(dilate, rect, src, srcStride, first + i, buf, curr + i * _rowStride);
+            for (size_t i = sizeY - 1; i-- > 0;)
+                binary(curr + i * _rowStride, curr + (i + 1) * _rowStride, _size, curr + i * _rowStride);
+            for (size_t block = 0; block < size; block += sizeY)
+            {
+                size_t load = Simd::Min(sizeY, count - block - sizeY), rows = Simd::Min(sizeY, size - block);
+                for (size_t i = 0; i < load; ++i)
+                    RowMinMax(dilate, rect, src, srcStride, first + block + sizeY + i, buf, next + i * _rowStride);
+                uint8_t* out = dst + (begin + block) * dstStride;
+                memcpy(out, curr, _size);
+                const uint8_t* prefix = next;
+                for (size_t i = 1; i < rows; ++i)
+                {
+                    if (i > 1)
+                    {
+                        binary(prefix, next + (i - 1) * _rowStride, _size, gather);
+                        prefix = gather;
+                    }
+                    binary(curr + i * _rowStride, prefix, _size, out + i * dstStride);
+                }
+                if (block + sizeY < size)
+                {
+                    for (size_t i = sizeY - 1; i-- > 0;)
+                        binary(next + i * _rowStride, next + (i + 1) * _rowStride, _size, next + i * _rowStride);
+                    Swap(curr, next);
+                }
+            }
+        }
+
+        void MorphologyDefault::RowMinMax(bool dilate, const Rect& rect, const uint8_t* src, size_t srcStride, ptrdiff_t row, uint8_t* buf, uint8_t* dst) const
+        {
+            const MorphologyParam& p = _param;
+            int identity = dilate ? 0 : 255;
+            if (row < 0 || row >= (ptrdiff_t)p.height)
+            {
+                memset(dst, identity, _size);
+                return;
+            }
+            src += row * srcStride;
+            if (rect.sizeX == 1 && rect.left == 0)
+            {
+                memcpy(dst, src, _size);
+                return;
+            }
+            size_t step = p.channels, size = _size + (rect.sizeX - 1) * step;
+            ptrdiff_t width = p.width, pad = width + rect.sizeX - 1;
+            ptrdiff_t beg = Simd::RestrictRange<ptrdiff_t>(-rect.left, 0, pad), end = Simd::RestrictRange<ptrdiff_t>(width - rect.left, 0, pad);
+            uint8_t* ext = buf, * g = buf + _padStride, * h = g + _padStride;
+            if (end > beg)
+            {
+                memset(ext, identity, beg * step);
+                memcpy(ext + beg * step, src + (beg + rect.left) * step, (end - beg) * step);
+                memset(ext + end * step, identity, (pad - end) * step);
+            }
+            else
+                memset(ext, identity, size);
+            if (rect.sizeX == 1)
+            {
+                memcpy(dst, ext, _size);
+                return;
+            }
+            BinaryPtr binary = dilate ? _max : _min;
+            if (rect.sizeX <= 64)
+            {
+                const uint8_t* prev = ext;
+                size_t span = 1;
+                for (; span * 2 <= rect.sizeX; span *= 2)
+                {
+                    size -= span * step;
+                    binary(prev, prev + span * step, size, g);
+                    prev = g;
+                    Swap(g, h);
+                }
+                binary(prev, prev + (rect.sizeX - span) * step, _size, dst);
+            }
+            else
+            {
+                if (dilate)
+                    VanHerkGilWerman<true>(ext, size, rect.sizeX * step, step, g, h);
+                else
+                    VanHerkGilWerman<false>(ext, size, rect.sizeX * step, step, g, h);
+                binary(h, g + (rect.sizeX - 1) * step, _size, dst);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* MorphologyInit(size_t width, size_t height, size_t channels, SimdMorphologyOperationType operation, SimdMorphologyElementType element, size_t sizeX, size_t sizeY)
+        {
+            MorphologyParam param(width, height, channels, operation, element, sizeX, sizeY, sizeof(void*));
+            if (!param.Valid())
+                return NULL;
+            return new MorphologyDefault(param);
+        }
+    }
+}
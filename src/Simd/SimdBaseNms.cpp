@@ -0,0 +1,203 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdNms.h"
+#include "Simd/SimdExp.h"
+
+#include <algorithm>
+
+namespace Simd
+{
+    namespace Base
+    {
+        SIMD_INLINE float Sigmoid(float value)
+        {
+            return 1.0f / (1.0f + ::expf(-value));
+        }
+
+        void NmsDecodeBoxes32f(const float* src, const float* anchors, size_t size, size_t stride, SimdBoxDecodeType type, const float* params, float* dst)
+        {
+            const float* s0 = src + 0 * stride, * s1 = src + 1 * stride, * s2 = src + 2 * stride, * s3 = src + 3 * stride;
+            const float* a0 = anchors + 0 * stride, * a1 = anchors + 1 * stride, * a2 = anchors + 2 * stride, * a3 = anchors + 3 * stride;
+            float* x0 = dst + 0 * stride, * y0 = dst + 1 * stride, * x1 = dst + 2 * stride, * y1 = dst + 3 * stride;
+            for (size_t i = 0; i < size; ++i)
+            {
+                float cx, cy, w, h;
+                switch (type)
+                {
+                case SimdBoxDecodeCenterSize:
+                    cx = a0[i] + s0[i] * params[0] * a2[i];
+                    cy = a1[i] + s1[i] * params[1] * a3[i];
+                    w = a2[i] * ::expf(s2[i] * params[2]);
+                    h = a3[i] * ::expf(s3[i] * params[3]);
+                    break;
+                case SimdBoxDecodeYoloV3:
+                    cx = (Sigmoid(s0[i]) + a0[i]) * params[0];
+                    cy = (Sigmoid(s1[i]) + a1[i]) * params[0];
+                    w = a2[i] * ::expf(s2[i]);
+                    h = a3[i] * ::expf(s3[i]);
+                    break;
+                case SimdBoxDecodeYoloV5:
+                    cx = (Sigmoid(s0[i]) * 2.0f - 0.5f + a0[i]) * params[0];
+                    cy = (Sigmoid(s1[i]) * 2.0f - 0.5f + a1[i]) * params[0];
+                    w = Simd::Square(Sigmoid(s2[i]) * 2.0f) * a2[i];
+                    h = Simd::Square(Sigmoid(s3[i]) * 2.0f) * a3[i];
+                    break;
+                default:
+                    assert(0);
+                    return;
+                }
+                x0[i] = cx - w * 0.5f;
+                y0[i] = cy - h * 0.5f;
+                x1[i] = cx + w * 0.5f;
+                y1[i] = cy + h * 0.5f;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void NmsIou32f(const float* boxes, size_t stride, size_t size, const float* box, float* iou)
+        {
+            const float* x0 = boxes + 0 * stride, * y0 = boxes + 1 * stride, * x1 = boxes + 2 * stride, * y1 = boxes + 3 * stride;
+            float area = (box[2] - box[0]) * (box[3] - box[1]);
+            for (size_t i = 0; i < size; ++i)
+                iou[i] = NmsIou(box[0], box[1], box[2], box[3], area, x0[i], y0[i], x1[i], y1[i], (x1[i] - x0[i]) * (y1[i] - y0[i]));
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        size_t NmsFilter(const float* scores, size_t size, float threshold, uint32_t* idx)
+        {
+            size_t count = 0;
+            for (size_t i = 0; i < size; ++i)
+                if (scores[i] > threshold)
+                    idx[count++] = (uint32_t)i;
+            return count;
+        }
+
+        void NmsSuppress(const NmsBoxes& boxes, size_t curr, size_t begin, size_t end, SimdNmsType type, float threshold, float sigma)
+        {
+            float x0 = boxes.x0[curr], y0 = boxes.y0[curr], x1 = boxes.x1[curr], y1 = boxes.y1[curr], area = boxes.area[curr];
+            int32_t cls = boxes.cls[curr];
+            for (size_t i = begin; i < end; ++i)
+            {
+                if (boxes.cls[i] != cls)
+                    continue;
+                float iou = NmsIou(x0, y0, x1, y1, area, boxes.x0[i], boxes.y0[i], boxes.x1[i], boxes.y1[i], boxes.area[i]);
+                boxes.score[i] = NmsDecay(boxes.score[i], iou, type, threshold, sigma);
+            }
+        }
+
+        SIMD_INLINE void NmsSwap(const NmsBoxes& boxes, size_t a, size_t b)
+        {
+            Simd::Swap(boxes.x0[a], boxes.x0[b]);
+            Simd::Swap(boxes.y0[a], boxes.y0[b]);
+            Simd::Swap(boxes.x1[a], boxes.x1[b]);
+            Simd::Swap(boxes.y1[a], boxes.y1[b]);
+            Simd::Swap(boxes.area[a], boxes.area[b]);
+            Simd::Swap(boxes.score[a], boxes.score[b]);
+            Simd::Swap(boxes.cls[a], boxes.cls[b]);
+            Simd::Swap(boxes.idx[a], boxes.idx[b]);
+        }
+
+        size_t NmsRun(const float* boxes, size_t stride, const float* scores, const uint32_t* classes, size_t size, float scoreThreshold, size_t topK,
+            SimdNmsType type, float iouThreshold, float sigma, size_t keepTopK, uint32_t* indices, float* outScores, NmsFilterPtr filter, NmsSuppressPtr suppress)
+        {
+            if (size == 0 || keepTopK == 0)
+                return 0;
+            if (type == SimdNmsSoftGaussian && !(sigma > 0.0f))
+                return 0;
+            Array32u order(size);
+            size_t count = filter(scores, size, scoreThreshold, order.data);
+            struct Greater
+            {
+                const float* scores;
+                Greater(const float* s) : scores(s) {}
+                bool operator()(uint32_t a, uint32_t b) const { return scores[a] > scores[b] || (scores[a] == scores[b] && a < b); }
+            } greater(scores);
+            if (topK && topK < count)
+            {
+                std::partial_sort(order.data, order.data + topK, order.data + count, greater);
+                count = topK;
+            }
+            else
+                std::sort(order.data, order.data + count, greater);
+
+            Array32f buf(count * 6);
+            Array32i cls(count);
+            NmsBoxes b;
+            b.x0 = buf.data + 0 * count;
+            b.y0 = buf.data + 1 * count;
+            b.x1 = buf.data + 2 * count;
+            b.y1 = buf.data + 3 * count;
+            b.area = buf.data + 4 * count;
+            b.score = buf.data + 5 * count;
+            b.cls = cls.data;
+            b.idx = order.data;
+            for (size_t i = 0; i < count; ++i)
+            {
+                size_t j = order[i];
+                b.x0[i] = boxes[0 * stride + j];
+                b.y0[i] = boxes[1 * stride + j];
+                b.x1[i] = boxes[2 * stride + j];
+                b.y1[i] = boxes[3 * stride + j];
+                b.area[i] = (b.x1[i] - b.x0[i]) * (b.y1[i] - b.y0[i]);
+                b.score[i] = scores[j];
+                b.cls[i] = classes ? (int32_t)classes[j] : 0;
+            }
+
+            size_t kept = 0;
+            for (size_t i = 0; i < count && kept < keepTopK; ++i)
+            {
+                if (type != SimdNmsHard)
+                {
+                    size_t best = i;
+                    for (size_t j = i + 1; j < count; ++j)
+                        if (b.score[j] > b.score[best] || (b.score[j] == b.score[best] && b.idx[j] < b.idx[best]))
+                            best = j;
+                    if (best != i)
+                        NmsSwap(b, i, best);
+                }
+                if (b.score[i] <= scoreThreshold)
+                {
+                    if (type == SimdNmsHard)
+                        continue;
+                    else
+                        break;
+                }
+                indices[kept] = b.idx[i];
+                if (outScores)
+                    outScores[kept] = b.score[i];
+                kept++;
+                suppress(b, i, i + 1, count, type, iouThreshold, sigma);
+            }
+            return kept;
+        }
+
+        size_t Nms32f(const float* boxes, size_t stride, const float* scores, const uint32_t* classes, size_t size, float scoreThreshold, size_t topK,
+            SimdNmsType type, float iouThreshold, float sigma, size_t keepTopK, uint32_t* indices, float* outScores)
+        {
+            return NmsRun(boxes, stride, scores, classes, size, scoreThreshold, topK, type, iouThreshold, sigma, keepTopK, indices, outScores, NmsFilter, NmsSuppress);
+        }
+    }
+}
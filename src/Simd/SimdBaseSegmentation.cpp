@@ -21,7 +21,11 @@
 * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 * SOFTWARE.
 */
-#include "Simd/SimdDefs.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdSegmentation.h"
+#include "Simd/SimdBase.h"
 
 namespace Simd
 {
@@ -191,5 +195,194 @@ namespace Simd
                 }
             }
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        size_t SegmentationRuns(const uint8_t* mask, size_t width, uint8_t index, int32_t* runs)
+        {
+            int32_t* dst = runs;
+            bool in = false;
+            SegmentationRunsBytes(mask, width, index, 0, in, dst);
+            if (in)
+                *dst++ = (int32_t)width;
+            return (dst - runs) / 2;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE uint32_t SegmentationRoot(uint32_t* parent, uint32_t i)
+        {
+            while (parent[i] != i)
+            {
+                parent[i] = parent[parent[i]];
+                i = parent[i];
+            }
+            return i;
+        }
+
+        SIMD_INLINE void SegmentationUnion(uint32_t* parent, uint32_t a, uint32_t b)
+        {
+            a = SegmentationRoot(parent, a);
+            b = SegmentationRoot(parent, b);
+            if (a < b)
+                parent[b] = a;
+            else if (b < a)
+                parent[a] = b;
+        }
+
+        static void SegmentationMergeRows(const int32_t* prev, size_t prevSize, uint32_t prevIdx, 
+            const int32_t* curr, size_t currSize, uint32_t currIdx, int32_t gap, uint32_t* parent)
+        {
+            for (size_t i = 0, j = 0; i < prevSize && j < currSize;)
+            {
+                const int32_t* p = prev + 2 * i, * c = curr + 2 * j;
+                if (p[0] < c[1] + gap && c[0] < p[1] + gap)
+                    SegmentationUnion(parent, prevIdx + (uint32_t)i, currIdx + (uint32_t)j);
+                if (p[1] < c[1])
+                    i++;
+                else
+                    j++;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SegmentationComponentLabeler::SegmentationComponentLabeler()
+        {
+            _runs = SegmentationRuns;
+        }
+
+        size_t SegmentationComponentLabeler::Run(const uint8_t* mask, size_t maskStride, size_t width, size_t height, uint8_t index,
+            SimdSegmentationConnectivityType connectivity, uint32_t* labels, size_t labelsStride, SimdSegmentationComponent** components)
+        {
+            if (components)
+                *components = NULL;
+            if (width == 0 || height == 0)
+                return 0;
+            int32_t gap = connectivity == SimdSegmentationConnectivity8 ? 1 : 0;
+
+            size_t threads = GetThreadNumber();
+            std::vector<Strip> strips(threads);
+            Simd::Parallel(0, height, [&](size_t thread, size_t begin, size_t end)
+            {
+                Strip& strip = strips[thread];
+                strip.begin = begin;
+                strip.end = end;
+                strip.rows.resize(end - begin + 1, 0);
+                Array32i buf(width + 1);
+                for (size_t y = begin, r = 0; y < end; ++y, ++r)
+                {
+                    size_t count = _runs(mask + y * maskStride, width, index, buf.data);
+                    strip.runs.insert(strip.runs.end(), buf.data, buf.data + count * 2);
+                    strip.rows[r + 1] = strip.rows[r] + (uint32_t)count;
+                }
+                strip.parent.resize(strip.rows.back());
+                for (size_t i = 0; i < strip.parent.size(); ++i)
+                    strip.parent[i] = (uint32_t)i;
+                const int32_t* runs = strip.runs.data();
+                const uint32_t* rows = strip.rows.data();
+                for (size_t r = 1; r < end - begin; ++r)
+                    SegmentationMergeRows(runs + rows[r - 1] * 2, rows[r] - rows[r - 1], rows[r - 1],
+                        runs + rows[r] * 2, rows[r + 1] - rows[r], rows[r], gap, strip.parent.data());
+            }, threads, 16);
+
+            std::vector<uint32_t> offsets(threads + 1, 0);
+            for (size_t t = 0; t < threads; ++t)
+                offsets[t + 1] = offsets[t] + (uint32_t)strips[t].parent.size();
+            std::vector<uint32_t> parent(offsets[threads]);
+            for (size_t t = 0; t < threads; ++t)
+                for (size_t i = 0; i < strips[t].parent.size(); ++i)
+                    parent[offsets[t] + i] = strips[t].parent[i] + offsets[t];
+            for (size_t t = 1; t < threads; ++t)
+            {
+                const Strip& a = strips[t - 1], & b = strips[t];
+                if (a.begin == a.end || b.begin == b.end)
+                    continue;
+                const uint32_t* rows = a.rows.data() + a.rows.size() - 2;
+                SegmentationMergeRows(a.runs.data() + rows[0] * 2, rows[1] - rows[0], offsets[t - 1] + rows[0],
+                    b.runs.data(), b.rows[1], offsets[t], gap, parent.data());
+            }
+
+            uint32_t count = 0;
+            for (size_t i = 0; i < parent.size(); ++i)
+                parent[i] = parent[i] == i ? ++count : parent[parent[i]];
+
+            if (labels)
+            {
+                Simd::Parallel(0, threads, [&](size_t, size_t begin, size_t end)
+                {
+                    for (size_t t = begin; t < end; ++t)
+                    {
+                        const Strip& strip = strips[t];
+                        const int32_t* runs = strip.runs.data();
+                        const uint32_t* label = parent.data() + offsets[t];
+                        for (size_t y = strip.begin, r = 0; y < strip.end; ++y, ++r)
+                        {
+                            uint32_t* dst = (uint32_t*)((uint8_t*)labels + y * labelsStride);
+                            int32_t x = 0;
+                            for (uint32_t i = strip.rows[r]; i < strip.rows[r + 1]; ++i)
+                            {
+                                std::fill(dst + x, dst + runs[2 * i + 0], 0);
+                                std::fill(dst + runs[2 * i + 0], dst + runs[2 * i + 1], label[i]);
+                                x = runs[2 * i + 1];
+                            }
+                            std::fill(dst + x, dst + width, 0);
+                        }
+                    }
+                }, threads);
+            }
+
+            if (components && count)
+            {
+                SimdSegmentationComponent* dst = (SimdSegmentationComponent*)Allocate(count * sizeof(SimdSegmentationComponent));
+                std::vector<uint64_t> sums(count * 2, 0);
+                for (size_t c = 0; c < count; ++c)
+                {
+                    dst[c].area = 0;
+                    dst[c].left = width;
+                    dst[c].top = height;
+                    dst[c].right = 0;
+                    dst[c].bottom = 0;
+                }
+                for (size_t t = 0; t < threads; ++t)
+                {
+                    const Strip& strip = strips[t];
+                    const int32_t* runs = strip.runs.data();
+                    const uint32_t* label = parent.data() + offsets[t];
+                    for (size_t y = strip.begin, r = 0; y < strip.end; ++y, ++r)
+                    {
+                        for (uint32_t i = strip.rows[r]; i < strip.rows[r + 1]; ++i)
+                        {
+                            ptrdiff_t begin = runs[2 * i + 0], end = runs[2 * i + 1], size = end - begin;
+                            size_t c = label[i] - 1;
+                            dst[c].area += size;
+                            dst[c].left = Simd::Min(dst[c].left, begin);
+                            dst[c].top = Simd::Min<ptrdiff_t>(dst[c].top, y);
+                            dst[c].right = Simd::Max(dst[c].right, end);
+                            dst[c].bottom = y + 1;
+                            sums[2 * c + 0] += uint64_t(begin + end - 1) * size / 2;
+                            sums[2 * c + 1] += uint64_t(y) * size;
+                        }
+                    }
+                }
+                for (size_t c = 0; c < count; ++c)
+                {
+                    dst[c].x = float(double(sums[2 * c + 0]) / double(dst[c].area));
+                    dst[c].y = float(double(sums[2 * c + 1]) / double(dst[c].area));
+                }
+                *components = dst;
+            }
+
+            return count;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        size_t SegmentationLabelComponents(const uint8_t* mask, size_t maskStride, size_t width, size_t height, uint8_t index,
+            SimdSegmentationConnectivityType connectivity, uint32_t* labels, size_t labelsStride, SimdSegmentationComponent** components)
+        {
+            SegmentationComponentLabeler labeler;
+            return labeler.Run(mask, maskStride, width, height, index, connectivity, labels, labelsStride, components);
+        }
     }
 }
@@ -0,0 +1,268 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetGroupNorm16b.h"
+#include "Simd/SimdSynetAdd16bCommon.h"
+#include "Simd/SimdSynetActivation.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+
+    SynetGroupNorm16b::SynetGroupNorm16b(const GroupNorm16bParam& p)
+        : _param(p)
+    {
+
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        template<class S> float GroupNormSum16b(const uint8_t* src8, size_t size)
+        {
+            const S* src = (const S*)src8;
+            float sum = 0;
+            for (size_t i = 0; i < size; ++i)
+                sum += Convert16b<S, float>(src[i]);
+            return sum;
+        }
+
+        template<class S> float GroupNormSquareSum16b(const uint8_t* src8, size_t size, float mean)
+        {
+            const S* src = (const S*)src8;
+            float sum = 0;
+            for (size_t i = 0; i < size; ++i)
+                sum += Simd::Square(Convert16b<S, float>(src[i]) - mean);
+            return sum;
+        }
+
+        template<class S> void GroupNormChannelSum16b(const uint8_t* src8, size_t channels, size_t spatial, float* sum)
+        {
+            const S* src = (const S*)src8;
+            for (size_t c = 0; c < channels; ++c)
+                sum[c] = 0;
+            for (size_t s = 0; s < spatial; ++s, src += channels)
+            {
+                for (size_t c = 0; c < channels; ++c)
+                    sum[c] += Convert16b<S, float>(src[c]);
+            }
+        }
+
+        template<class S> void GroupNormChannelSquareSum16b(const uint8_t* src8, size_t channels, size_t spatial, const float* mean, float* sum)
+        {
+            const S* src = (const S*)src8;
+            for (size_t c = 0; c < channels; ++c)
+                sum[c] = 0;
+            for (size_t s = 0; s < spatial; ++s, src += channels)
+            {
+                for (size_t c = 0; c < channels; ++c)
+                    sum[c] += Simd::Square(Convert16b<S, float>(src[c]) - mean[c]);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<class S, class D, SimdConvolutionActivationType type> void GroupNorm16b(const uint8_t* src8, size_t channels, size_t spatial,
+            SimdTensorFormatType format, const float* alpha, const float* beta, const float* params, uint8_t* dst8)
+        {
+            const S* src = (const S*)src8;
+            D* dst = (D*)dst8;
+            if (format == SimdTensorFormatNchw)
+            {
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    float _alpha = alpha[c], _beta = beta[c];
+                    for (size_t s = 0; s < spatial; ++s)
+                        dst[s] = Convert16b<float, D>(Activate<type>(Convert16b<S, float>(src[s]) * _alpha + _beta, params, 0));
+                    src += spatial;
+                    dst += spatial;
+                }
+            }
+            else
+            {
+                for (size_t s = 0; s < spatial; ++s)
+                {
+                    for (size_t c = 0; c < channels; ++c)
+                        dst[c] = Convert16b<float, D>(Activate<type>(Convert16b<S, float>(src[c]) * alpha[c] + beta[c], params, 0));
+                    src += channels;
+                    dst += channels;
+                }
+            }
+        }
+
+        template<class S, class D> static SynetGroupNorm16b::NormPtr GetGroupNorm16b(SimdConvolutionActivationType activation)
+        {
+            switch (activation)
+            {
+            case SimdConvolutionActivationIdentity: return GroupNorm16b<S, D, SimdConvolutionActivationIdentity>;
+            case SimdConvolutionActivationSwish: return GroupNorm16b<S, D, SimdConvolutionActivationSwish>;
+            case SimdConvolutionActivationGelu: return GroupNorm16b<S, D, SimdConvolutionActivationGelu>;
+            default:
+                return NULL;
+            }
+        }
+
+        template<class S> static SynetGroupNorm16b::NormPtr GetGroupNorm16b(SimdTensorDataType dType, SimdConvolutionActivationType activation)
+        {
+            switch (dType)
+            {
+            case SimdTensorData32f: return GetGroupNorm16b<S, float>(activation);
+            case SimdTensorData16b: return GetGroupNorm16b<S, uint16_t>(activation);
+            default:
+                return NULL;
+            }
+        }
+
+        static SynetGroupNorm16b::NormPtr GetGroupNorm16b(SimdTensorDataType sType, SimdTensorDataType dType, SimdConvolutionActivationType activation)
+        {
+            switch (sType)
+            {
+            case SimdTensorData32f: return GetGroupNorm16b<float>(dType, activation);
+            case SimdTensorData16b: return GetGroupNorm16b<uint16_t>(dType, activation);
+            default:
+                return NULL;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE void SetGroupNormAlphaBeta(const float* scale, const float* shift, size_t channels, float mean, float norm, float* alpha, float* beta)
+        {
+            for (size_t c = 0; c < channels; ++c)
+            {
+                alpha[c] = (scale ? scale[c] : 1.0f) * norm;
+                beta[c] = (shift ? shift[c] : 0.0f) - mean * alpha[c];
+            }
+        }
+
+        SynetGroupNorm16b::SynetGroupNorm16b(const GroupNorm16bParam& p)
+            : Simd::SynetGroupNorm16b(p)
+            , _threads(Base::GetThreadNumber())
+            , _srcE(p.sType == SimdTensorData32f ? 4 : 2)
+            , _dstE(p.dType == SimdTensorData32f ? 4 : 2)
+        {
+            bool bf16 = p.sType == SimdTensorData16b;
+            _sum = bf16 ? GroupNormSum16b<uint16_t> : GroupNormSum16b<float>;
+            _squareSum = bf16 ? GroupNormSquareSum16b<uint16_t> : GroupNormSquareSum16b<float>;
+            _channelSum = bf16 ? GroupNormChannelSum16b<uint16_t> : GroupNormChannelSum16b<float>;
+            _channelSquareSum = bf16 ? GroupNormChannelSquareSum16b<uint16_t> : GroupNormChannelSquareSum16b<float>;
+            _norm = GetGroupNorm16b(p.sType, p.dType, p.activation);
+        }
+
+        void SynetGroupNorm16b::Forward(const uint8_t* src, const float* scale, const float* shift, const float* params, uint8_t* dst)
+        {
+            const GroupNorm16bParam& p = _param;
+            size_t group = p.channels / p.groups, size = group * p.spatial, bc = p.batch * p.channels;
+            float k = 1.0f / float(size), _params[2] = { params ? params[0] : 1.0f, 0.0f };
+            if (p.format == SimdTensorFormatNchw)
+            {
+                Array32f buf(bc * 2);
+                Simd::Parallel(0, p.batch * p.groups, [&](size_t thread, size_t begin, size_t end)
+                {
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        size_t c = (i % p.groups) * group;
+                        const uint8_t* ps = src + i * size * _srcE;
+                        float mean = _sum(ps, size) * k;
+                        float norm = 1.0f / ::sqrt(_squareSum(ps, size, mean) * k + p.eps);
+                        float* alpha = buf.data + i * group, * beta = alpha + bc;
+                        SetGroupNormAlphaBeta(scale ? scale + c : NULL, shift ? shift + c : NULL, group, mean, norm, alpha, beta);
+                        _norm(ps, group, p.spatial, p.format, alpha, beta, _params, dst + i * size * _dstE);
+                    }
+                }, _threads);
+            }
+            else
+            {
+                size_t blocks = Simd::Min(p.spatial, _threads), block = DivHi(p.spatial, blocks);
+                blocks = DivHi(p.spatial, block);
+                Array32f buf(bc * (3 + blocks));
+                float* mean = buf.data, * alpha = mean + bc, * beta = alpha + bc, * part = beta + bc;
+                Simd::Parallel(0, p.batch * blocks, [&](size_t thread, size_t begin, size_t end)
+                {
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        size_t b = i / blocks, s = (i % blocks) * block, n = Simd::Min(p.spatial, s + block) - s;
+                        _channelSum(src + (b * p.spatial + s) * p.channels * _srcE, p.channels, n, part + i * p.channels);
+                    }
+                }, _threads);
+                for (size_t b = 0; b < p.batch; ++b)
+                {
+                    const float* pp = part + b * blocks * p.channels;
+                    for (size_t g = 0, c = 0; g < p.groups; ++g, c += group)
+                    {
+                        float sum = 0;
+                        for (size_t j = 0; j < blocks; ++j)
+                            for (size_t i = 0; i < group; ++i)
+                                sum += pp[j * p.channels + c + i];
+                        for (size_t i = 0; i < group; ++i)
+                            mean[b * p.channels + c + i] = sum * k;
+                    }
+                }
+                Simd::Parallel(0, p.batch * blocks, [&](size_t thread, size_t begin, size_t end)
+                {
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        size_t b = i / blocks, s = (i % blocks) * block, n = Simd::Min(p.spatial, s + block) - s;
+                        _channelSquareSum(src + (b * p.spatial + s) * p.channels * _srcE, p.channels, n, mean + b * p.channels, part + i * p.channels);
+                    }
+                }, _threads);
+                for (size_t b = 0, o = 0; b < p.batch; ++b, o += p.channels)
+                {
+                    const float* pp = part + b * blocks * p.channels;
+                    for (size_t g = 0, c = 0; g < p.groups; ++g, c += group)
+                    {
+                        float sum = 0;
+                        for (size_t j = 0; j < blocks; ++j)
+                            for (size_t i = 0; i < group; ++i)
+                                sum += pp[j * p.channels + c + i];
+                        float norm = 1.0f / ::sqrt(sum * k + p.eps);
+                        SetGroupNormAlphaBeta(scale ? scale + c : NULL, shift ? shift + c : NULL, group, mean[o + c], norm, alpha + o + c, beta + o + c);
+                    }
+                }
+                Simd::Parallel(0, p.batch * p.spatial, [&](size_t thread, size_t begin, size_t end)
+                {
+                    for (size_t i = begin; i < end;)
+                    {
+                        size_t b = i / p.spatial, n = Simd::Min(end, (b + 1) * p.spatial) - i, o = i * p.channels;
+                        _norm(src + o * _srcE, p.channels, n, p.format, alpha + b * p.channels, beta + b * p.channels, _params, dst + o * _dstE);
+                        i += n;
+                    }
+                }, _threads);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetGroupNorm16bInit(size_t batch, size_t channels, size_t spatial, size_t groups, SimdTensorDataType srcType, SimdTensorDataType dstType, SimdTensorFormatType format, float eps, SimdConvolutionActivationType activation)
+        {
+            GroupNorm16bParam param(batch, channels, spatial, groups, srcType, dstType, format, eps, activation);
+            if (!param.Valid())
+                return NULL;
+            return new SynetGroupNorm16b(param);
+        }
+    }
+#endif
+}
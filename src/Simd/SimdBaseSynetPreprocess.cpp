@@ -0,0 +1,273 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetPreprocess.h"
+#include "Simd/SimdSynetPreprocessCommon.h"
+#include "Simd/SimdBase.h"
+
+#include "Simd/SimdParallel.hpp"
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace Base
+    {
+        static void EstimateIndexAlpha(SimdResizeMethodType method, size_t srcSize, size_t dstSize, int32_t* indices, float* alphas)
+        {
+            if (method == SimdResizeMethodNearest || method == SimdResizeMethodNearestPytorch || srcSize == 1)
+            {
+                float scale = (float)srcSize / dstSize;
+                for (size_t i = 0; i < dstSize; ++i)
+                {
+                    int index = method == SimdResizeMethodNearestPytorch ? int(i * srcSize / dstSize) : (int)::floor((i + 0.5f) * scale);
+                    indices[i] = RestrictRange(index, 0, (int)srcSize - 1);
+                    alphas[i] = 0.0f;
+                }
+            }
+            else
+            {
+                float scale = method == SimdResizeMethodBilinearCaffe ?
+                    (dstSize > 1 ? float(srcSize - 1) / float(dstSize - 1) : 0.0f) : (float)srcSize / dstSize;
+                for (size_t i = 0; i < dstSize; ++i)
+                {
+                    float alpha = method == SimdResizeMethodBilinear ? (float)((i + 0.5f) * scale - 0.5f) : float(i) * scale;
+                    ptrdiff_t index = (ptrdiff_t)::floor(alpha);
+                    alpha -= index;
+                    if (index < 0)
+                    {
+                        index = 0;
+                        alpha = 0;
+                    }
+                    if (index > (ptrdiff_t)srcSize - 2)
+                    {
+                        index = srcSize - 2;
+                        alpha = 1;
+                    }
+                    indices[i] = (int32_t)index;
+                    alphas[i] = alpha;
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static void ResizeRowNearest(const float* src, size_t srcStride, size_t channels, const int32_t* idx, const float*, size_t width, float* dst, size_t dstStride)
+        {
+            for (size_t c = 0; c < channels; ++c)
+            {
+                for (size_t x = 0; x < width; ++x)
+                    dst[x] = src[idx[x]];
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        static void ResizeRowBilinear(const float* src, size_t srcStride, size_t channels, const int32_t* idx, const float* alpha, size_t width, float* dst, size_t dstStride)
+        {
+            for (size_t c = 0; c < channels; ++c)
+            {
+                for (size_t x = 0; x < width; ++x)
+                {
+                    const float* s = src + idx[x];
+                    dst[x] = s[0] + (s[1] - s[0]) * alpha[x];
+                }
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<SimdTensorDataType type> void NormalizeRowNchw(const float* src0, const float* src1, size_t srcStride, float alpha, size_t width, size_t channels,
+            const float* scale, const float* shift, uint8_t* dst, size_t dstStride)
+        {
+            for (size_t c = 0, o = 0; c < channels; ++c, o += dstStride)
+            {
+                for (size_t x = 0; x < width; ++x)
+                    SynetPreprocessNormalize<type>(src0 + x, src1 + x, alpha, scale[c], shift[c], dst, o + x);
+                src0 += srcStride;
+                src1 += srcStride;
+            }
+        }
+
+        template<SimdTensorDataType type> void NormalizeRowNhwc(const float* src0, const float* src1, size_t srcStride, float alpha, size_t width, size_t channels,
+            const float* scale, const float* shift, uint8_t* dst, size_t)
+        {
+            for (size_t x = 0, o = 0; x < width; ++x)
+                for (size_t c = 0, s = x; c < channels; ++c, ++o, s += srcStride)
+                    SynetPreprocessNormalize<type>(src0 + s, src1 + s, alpha, scale[c], shift[c], dst, o);
+        }
+
+        template<SimdTensorDataType type> SynetPreprocessBand::NormalizeRowPtr GetNormalizeRow(SimdTensorFormatType format)
+        {
+            return format == SimdTensorFormatNchw ? NormalizeRowNchw<type> : NormalizeRowNhwc<type>;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SynetPreprocessBand::SynetPreprocessBand(const SynetPreprocessParam& param)
+            : Simd::SynetPreprocess(param)
+            , _threads(Base::GetThreadNumber())
+        {
+            const SynetPreprocessParam& p = _param;
+            _ix.Resize(p.dstW);
+            _ax.Resize(p.dstW);
+            EstimateIndexAlpha(p.method, p.srcW, p.dstW, _ix.data, _ax.data);
+            _iy.Resize(p.dstH);
+            _ay.Resize(p.dstH);
+            EstimateIndexAlpha(p.method, p.srcH, p.dstH, _iy.data, _ay.data);
+            for (size_t c = 0; c < 3; ++c)
+            {
+                _lower[c] = 0.0f;
+                _upper[c] = 255.0f;
+                _scale[c] = 1.0f / p.std[c];
+                _shift[c] = -p.mean[c] / p.std[c];
+            }
+            _rowS = p.channels * p.srcW + SIMD_ALIGN;
+            _dstS = AlignHi(p.dstW, SIMD_ALIGN);
+            _yuvS = p.IsYuv() ? DivHi(7 * p.srcW + SIMD_ALIGN, sizeof(float)) : 0;
+            _size = _rowS + 2 * p.channels * _dstS + _yuvS;
+            _setInput = Base::SynetSetInput;
+            _deinterleaveUv = Base::DeinterleaveUv;
+            _yuv420pToBgr = Base::Yuv420pToBgrV2;
+            _resizeRow = p.IsNearest() || p.srcW == 1 ? ResizeRowNearest : ResizeRowBilinear;
+            switch (p.dstType)
+            {
+            case SimdTensorData32f: _normalizeRow = GetNormalizeRow<SimdTensorData32f>(p.dstFormat); break;
+            case SimdTensorData16b: _normalizeRow = GetNormalizeRow<SimdTensorData16b>(p.dstFormat); break;
+            case SimdTensorData8u: _normalizeRow = GetNormalizeRow<SimdTensorData8u>(p.dstFormat); break;
+            default:
+                assert(0);
+            }
+        }
+
+        void SynetPreprocessBand::Run(const uint8_t* src, size_t srcStride, uint8_t* dst)
+        {
+            assert(!_param.IsYuv());
+            const uint8_t* srcs[3] = { src, NULL, NULL };
+            size_t strides[3] = { srcStride, 0, 0 };
+            Forward(srcs, strides, dst);
+        }
+
+        void SynetPreprocessBand::Run(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, uint8_t* dst)
+        {
+            assert(_param.IsYuv());
+            const uint8_t* srcs[3] = { y, u, v };
+            size_t strides[3] = { yStride, uStride, vStride };
+            Forward(srcs, strides, dst);
+        }
+
+        void SynetPreprocessBand::Forward(const uint8_t* const* src, const size_t* stride, uint8_t* dst)
+        {
+            Array32f buf(_size * _threads);
+            Simd::Parallel(0, _param.dstH, [&](size_t thread, size_t begin, size_t end)
+            {
+                RunBand(src, stride, begin, end, buf.data + thread * _size, dst);
+            }, _threads, 1);
+        }
+
+        void SynetPreprocessBand::RunBand(const uint8_t* const* src, const size_t* stride, size_t yBeg, size_t yEnd, float* buf, uint8_t* dst)
+        {
+            const SynetPreprocessParam& p = _param;
+            size_t C = p.channels, dstRow = p.dstW * (p.dstFormat == SimdTensorFormatNchw ? 1 : C) * p.DstTypeSize();
+            size_t dstStride = p.dstFormat == SimdTensorFormatNchw ? p.dstH * p.dstW : 0;
+            float* rows[2] = { buf + _rowS, buf + _rowS + C * _dstS };
+            ptrdiff_t cached[2] = { -1, -1 }, pair = -1;
+            for (size_t dy = yBeg; dy < yEnd; ++dy)
+            {
+                ptrdiff_t sy0 = _iy[dy], sy1 = Simd::Min<ptrdiff_t>(sy0 + 1, p.srcH - 1);
+                if (cached[0] != sy0 && cached[1] == sy0)
+                {
+                    Simd::Swap(rows[0], rows[1]);
+                    Simd::Swap(cached[0], cached[1]);
+                }
+                if (cached[0] != sy0)
+                {
+                    ResizeRow(src, stride, sy0, buf, pair, rows[0]);
+                    cached[0] = sy0;
+                }
+                const float* row1 = rows[0];
+                if (_ay[dy] != 0.0f)
+                {
+                    if (cached[1] != sy1)
+                    {
+                        ResizeRow(src, stride, sy1, buf, pair, rows[1]);
+                        cached[1] = sy1;
+                    }
+                    row1 = rows[1];
+                }
+                _normalizeRow(rows[0], row1, _dstS, _ay[dy], p.dstW, C, _scale, _shift, dst + dy * dstRow, dstStride);
+            }
+        }
+
+        void SynetPreprocessBand::ResizeRow(const uint8_t* const* src, const size_t* stride, size_t sy, float* buf, ptrdiff_t& pair, float* dst)
+        {
+            const SynetPreprocessParam& p = _param;
+            float* row = buf;
+            if (p.IsYuv())
+            {
+                size_t bgrStride = 3 * p.srcW, uvW = p.srcW / 2;
+                uint8_t* bgr = (uint8_t*)(buf + _size - _yuvS);
+                if (pair != ptrdiff_t(sy & ~1))
+                {
+                    pair = sy & ~1;
+                    const uint8_t* u = src[1] + pair / 2 * stride[1];
+                    const uint8_t* v = src[2] + pair / 2 * stride[2];
+                    if (p.nv12)
+                    {
+                        uint8_t* _u = bgr + 2 * bgrStride, * _v = _u + uvW;
+                        _deinterleaveUv(u, stride[1], uvW, 1, _u, uvW, _v, uvW);
+                        u = _u, v = _v;
+                    }
+                    _yuv420pToBgr(src[0] + pair * stride[0], stride[0], u, stride[1], v, stride[2], p.srcW, 2, bgr, bgrStride, p.yuvType);
+                }
+                _setInput(bgr + (sy & 1) * bgrStride, p.srcW, 1, bgrStride, p.srcFormat, _lower, _upper, row, p.channels, SimdTensorFormatNchw);
+            }
+            else
+                _setInput(src[0] + sy * stride[0], p.srcW, 1, stride[0], p.srcFormat, _lower, _upper, row, p.channels, SimdTensorFormatNchw);
+            _resizeRow(row, p.srcW, p.channels, _ix.data, _ax.data, p.dstW, dst, _dstS);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetPreprocessInit(size_t srcW, size_t srcH, SimdPixelFormatType srcFormat, size_t dstW, size_t dstH, size_t channels,
+            SimdResizeMethodType method, const float* mean, const float* std, SimdTensorFormatType dstFormat, SimdTensorDataType dstType)
+        {
+            SynetPreprocessParam param(srcW, srcH, srcFormat, dstW, dstH, channels, method, mean, std, dstFormat, dstType);
+            if (!param.Valid())
+                return NULL;
+            return new SynetPreprocessBand(param);
+        }
+
+        void* SynetPreprocessYuv420Init(size_t srcW, size_t srcH, SimdYuvType yuvType, SimdBool nv12, SimdBool isRgb, size_t dstW, size_t dstH,
+            SimdResizeMethodType method, const float* mean, const float* std, SimdTensorFormatType dstFormat, SimdTensorDataType dstType)
+        {
+            SynetPreprocessParam param(srcW, srcH, isRgb ? SimdPixelFormatRgb24 : SimdPixelFormatBgr24, dstW, dstH, 3, 
+                method, mean, std, dstFormat, dstType, yuvType, nv12 == SimdTrue);
+            if (!param.IsYuv() || !param.Valid())
+                return NULL;
+            return new SynetPreprocessBand(param);
+        }
+    }
+#endif
+}
@@ -0,0 +1,137 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetTopK.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdBFloat16.h"
+#include "Simd/SimdBase.h"
+
+#include <algorithm>
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace Base
+    {
+        template<bool max> void SynetArgExtremum32f(const float* src, size_t outer, size_t count, size_t inner, int32_t* dst)
+        {
+            for (size_t o = 0; o < outer; ++o)
+            {
+                for (size_t i = 0; i < inner; ++i)
+                    dst[i] = SynetArgExtremum<max>(src + i, count, inner);
+                src += count * inner;
+                dst += inner;
+            }
+        }
+
+        void SynetArgMax32f(const float* src, size_t outer, size_t count, size_t inner, int32_t* dst)
+        {
+            SynetArgExtremum32f<true>(src, outer, count, inner, dst);
+        }
+
+        void SynetArgMin32f(const float* src, size_t outer, size_t count, size_t inner, int32_t* dst)
+        {
+            SynetArgExtremum32f<false>(src, outer, count, inner, dst);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        const size_t SYNET_TOPK_SMALL_MAX = 64;
+
+        template<bool max> void SynetTopKRow(const float* src, size_t count, size_t k, float* val, int32_t* idx)
+        {
+            SynetTopKInit<max>(src, k, val, idx);
+            SynetTopKUpdate<max>(src, k, count, k, val, idx);
+        }
+
+        template<bool max> void SynetTopKLarge(const float* src, size_t count, size_t k, int32_t* idx)
+        {
+            for (size_t i = 0; i < count; ++i)
+                idx[i] = (int32_t)i;
+            std::partial_sort(idx, idx + k, idx + count, [src](int32_t a, int32_t b)
+            {
+                return SynetTopKBetter<max>(src[a], src[b]) || (src[a] == src[b] && a < b);
+            });
+        }
+
+        void SynetTopK(const void* src, SimdTensorDataType type, size_t outer, size_t count, size_t inner, size_t k, SimdBool largest, SimdBool sorted,
+            void* dstVal, int32_t* dstIdx, SynetTopKRowPtr topKRow, SynetTopKConvertPtr convert)
+        {
+            assert(k > 0 && k <= count && (type == SimdTensorData32f || type == SimdTensorData16b));
+            size_t typeSize = type == SimdTensorData32f ? 4 : 2;
+            bool direct = type == SimdTensorData32f && inner == 1, small = k <= SYNET_TOPK_SMALL_MAX;
+            Array32f buf(direct ? 0 : count), val(k);
+            Array32i idx(small ? k : count);
+            for (size_t o = 0; o < outer; ++o)
+            {
+                const uint8_t* ps = (uint8_t*)src + o * count * inner * typeSize;
+                for (size_t i = 0; i < inner; ++i)
+                {
+                    const float* row = buf.data;
+                    if (direct)
+                        row = (float*)ps;
+                    else if (type == SimdTensorData32f)
+                    {
+                        for (size_t c = 0; c < count; ++c)
+                            buf[c] = ((float*)ps)[c * inner + i];
+                    }
+                    else if (inner == 1)
+                        convert((uint16_t*)ps, count, buf.data);
+                    else
+                    {
+                        for (size_t c = 0; c < count; ++c)
+                            buf[c] = BFloat16ToFloat32(((uint16_t*)ps)[c * inner + i]);
+                    }
+                    if (small)
+                        topKRow(row, count, k, val.data, idx.data);
+                    else if (largest)
+                        SynetTopKLarge<true>(row, count, k, idx.data);
+                    else
+                        SynetTopKLarge<false>(row, count, k, idx.data);
+                    if (!sorted)
+                        std::sort(idx.data, idx.data + k);
+                    for (size_t j = 0, d = o * k * inner + i; j < k; ++j, d += inner)
+                    {
+                        if (dstIdx)
+                            dstIdx[d] = idx[j];
+                        if (dstVal)
+                            memcpy((uint8_t*)dstVal + d * typeSize, ps + (idx[j] * inner + i) * typeSize, typeSize);
+                    }
+                }
+            }
+        }
+
+        void SynetTopK32f(const float* src, size_t outer, size_t count, size_t inner, size_t k, SimdBool largest, SimdBool sorted, float* dstVal, int32_t* dstIdx)
+        {
+            SynetTopKRowPtr topKRow = largest ? SynetTopKRow<true> : SynetTopKRow<false>;
+            SynetTopK(src, SimdTensorData32f, outer, count, inner, k, largest, sorted, dstVal, dstIdx, topKRow, NULL);
+        }
+
+        void SynetTopK16b(const uint16_t* src, size_t outer, size_t count, size_t inner, size_t k, SimdBool largest, SimdBool sorted, uint16_t* dstVal, int32_t* dstIdx)
+        {
+            SynetTopKRowPtr topKRow = largest ? SynetTopKRow<true> : SynetTopKRow<false>;
+            SynetTopK(src, SimdTensorData16b, outer, count, inner, k, largest, sorted, dstVal, dstIdx, topKRow, BFloat16ToFloat32);
+        }
+    }
+#endif
+}
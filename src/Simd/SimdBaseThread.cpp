@@ -31,15 +31,21 @@ namespace Simd
     namespace Base
     {
         size_t g_threadNumber = 1;
+        thread_local size_t g_localThreadNumber = 0;
 
         size_t GetThreadNumber()
         {
-            return g_threadNumber;
+            return g_localThreadNumber ? g_localThreadNumber : g_threadNumber;
         }
 
         void SetThreadNumber(size_t threadNumber)
         {
             g_threadNumber = Simd::RestrictRange<size_t>(threadNumber, 1, std::thread::hardware_concurrency());
         }
+
+        void SetLocalThreadNumber(size_t threadNumber)
+        {
+            g_localThreadNumber = threadNumber ? Simd::RestrictRange<size_t>(threadNumber, 1, std::thread::hardware_concurrency()) : 0;
+        }
     }
 }
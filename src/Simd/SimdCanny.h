@@ -0,0 +1,126 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdCanny_h__
+#define __SimdCanny_h__
+
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        const int CANNY_TG22_NUM = 13573;
+        const int CANNY_TG22_DEN = 32768;
+
+        SIMD_INLINE int CannyDirection(int dx, int dy)
+        {
+            int ax = Simd::Abs(dx), ay = Simd::Abs(dy);
+            if (ay * CANNY_TG22_DEN < ax * CANNY_TG22_NUM)
+                return 0;
+            if (ax * CANNY_TG22_DEN < ay * CANNY_TG22_NUM)
+                return 2;
+            return (dx ^ dy) < 0 ? 3 : 1;
+        }
+
+        SIMD_INLINE void CannyGradient(const uint8_t* s0, const uint8_t* s1, const uint8_t* s2, size_t x0, size_t x1, size_t x2, int16_t* dx, int16_t* dy, int16_t* mag)
+        {
+            int _dx = (s0[x2] + 2 * s1[x2] + s2[x2]) - (s0[x0] + 2 * s1[x0] + s2[x0]);
+            int _dy = (s2[x0] + 2 * s2[x1] + s2[x2]) - (s0[x0] + 2 * s0[x1] + s0[x2]);
+            dx[x1] = (int16_t)_dx;
+            dy[x1] = (int16_t)_dy;
+            mag[x1] = (int16_t)(Simd::Abs(_dx) + Simd::Abs(_dy));
+        }
+
+        void CannyGradientRow(const uint8_t* src0, const uint8_t* src1, const uint8_t* src2, size_t width, int16_t* dx, int16_t* dy, int16_t* mag);
+
+        void CannyNonMaxRow(const int16_t* dx, const int16_t* dy, const int16_t* mag0, const int16_t* mag1, const int16_t* mag2, size_t width, int16_t low, int16_t high, uint8_t* map);
+
+        void CannyEdgesRow(const uint8_t* map, size_t width, uint8_t* dst);
+
+        //-------------------------------------------------------------------------------------------------
+
+        class CannyEdgeDetector
+        {
+        public:
+            CannyEdgeDetector();
+
+            void Run(const uint8_t* src, size_t srcStride, size_t width, size_t height, int lowThreshold, int highThreshold, uint8_t* dst, size_t dstStride);
+
+            typedef void (*GradientPtr)(const uint8_t* src0, const uint8_t* src1, const uint8_t* src2, size_t width, int16_t* dx, int16_t* dy, int16_t* mag);
+            typedef void (*NonMaxPtr)(const int16_t* dx, const int16_t* dy, const int16_t* mag0, const int16_t* mag1, const int16_t* mag2, size_t width, int16_t low, int16_t high, uint8_t* map);
+            typedef void (*EdgesPtr)(const uint8_t* map, size_t width, uint8_t* dst);
+
+        protected:
+            GradientPtr _gradient;
+            NonMaxPtr _nonMax;
+            EdgesPtr _edges;
+        };
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        class CannyEdgeDetector : public Base::CannyEdgeDetector
+        {
+        public:
+            CannyEdgeDetector();
+        };
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class CannyEdgeDetector : public Sse41::CannyEdgeDetector
+        {
+        public:
+            CannyEdgeDetector();
+        };
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class CannyEdgeDetector : public Avx2::CannyEdgeDetector
+        {
+        public:
+            CannyEdgeDetector();
+        };
+    }
+#endif
+
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        class CannyEdgeDetector : public Base::CannyEdgeDetector
+        {
+        public:
+            CannyEdgeDetector();
+        };
+    }
+#endif
+}
+
+#endif
@@ -0,0 +1,194 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdCustomFilter_h__
+#define __SimdCustomFilter_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+#include <vector>
+
+namespace Simd
+{
+    struct CustomFilterParam
+    {
+        size_t width;
+        size_t height;
+        size_t channels;
+        SimdFilterChannelType type;
+        size_t sizeX;
+        size_t sizeY;
+        bool separable;
+        SimdFilterBorderType border;
+        size_t align;
+
+        CustomFilterParam(size_t w, size_t h, size_t c, SimdFilterChannelType t, size_t sx, size_t sy, bool s, SimdFilterBorderType b, size_t a);
+        bool Valid() const;
+        size_t ElementSize() const;
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    class CustomFilter : Deletable
+    {
+    public:
+        CustomFilter(const CustomFilterParam& param);
+
+        virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride) = 0;
+
+    protected:
+        CustomFilterParam _param;
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        SIMD_INLINE ptrdiff_t CustomFilterBorder(ptrdiff_t index, ptrdiff_t size, SimdFilterBorderType border)
+        {
+            if (index >= 0 && index < size)
+                return index;
+            switch (border)
+            {
+            case SimdFilterBorderReplicate: 
+                return index < 0 ? 0 : size - 1;
+            case SimdFilterBorderReflect:
+                if (size == 1)
+                    return 0;
+                while (index < 0 || index >= size)
+                    index = index < 0 ? -index : 2 * size - 2 - index;
+                return index;
+            default:
+                return -1;
+            }
+        }
+
+        SIMD_INLINE int CustomFilterRound(float value, float max)
+        {
+            return (int)(Simd::Min(Simd::Max(value, 0.0f), max) + 0.5f);
+        }
+
+        class CustomFilterDefault : public Simd::CustomFilter
+        {
+        public:
+            CustomFilterDefault(const CustomFilterParam& param, const float* kernelX, const float* kernelY);
+
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
+            typedef void (*ToFloatPtr)(const uint8_t* src, size_t size, float* dst);
+            typedef void (*FromFloatPtr)(const float* src, size_t size, uint8_t* dst);
+            typedef void (*RowFilterPtr)(const float* src, size_t size, size_t step, const float* weight, size_t kernel, float* dst);
+            typedef void (*ColFilterPtr)(const float* const* rows, size_t size, const float* weight, size_t kernel, float* dst);
+
+        protected:
+            void LoadRow(const uint8_t* src, size_t srcStride, ptrdiff_t row, float* pad) const;
+            void RunSeparable(const uint8_t* src, size_t srcStride, size_t begin, size_t end, float* buf, uint8_t* dst, size_t dstStride) const;
+            void Run2d(const uint8_t* src, size_t srcStride, size_t begin, size_t end, float* buf, uint8_t* dst, size_t dstStride) const;
+
+            size_t _size, _padStride, _rowStride;
+            Array32f _kernelX, _kernelY;
+            std::vector<Array32f> _buffers;
+            ToFloatPtr _toFloat;
+            FromFloatPtr _fromFloat;
+            RowFilterPtr _rowFilter, _rowFilterAdd;
+            ColFilterPtr _colFilter;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* CustomFilterSeparableInit(size_t width, size_t height, size_t channels, SimdFilterChannelType type, const float* kernelX, size_t sizeX, const float* kernelY, size_t sizeY, SimdFilterBorderType border);
+
+        void* CustomFilter2dInit(size_t width, size_t height, size_t channels, SimdFilterChannelType type, const float* kernel, size_t sizeX, size_t sizeY, SimdFilterBorderType border);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        class CustomFilterDefault : public Base::CustomFilterDefault
+        {
+        public:
+            CustomFilterDefault(const CustomFilterParam& param, const float* kernelX, const float* kernelY);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* CustomFilterSeparableInit(size_t width, size_t height, size_t channels, SimdFilterChannelType type, const float* kernelX, size_t sizeX, const float* kernelY, size_t sizeY, SimdFilterBorderType border);
+
+        void* CustomFilter2dInit(size_t width, size_t height, size_t channels, SimdFilterChannelType type, const float* kernel, size_t sizeX, size_t sizeY, SimdFilterBorderType border);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class CustomFilterDefault : public Sse41::CustomFilterDefault
+        {
+        public:
+            CustomFilterDefault(const CustomFilterParam& param, const float* kernelX, const float* kernelY);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* CustomFilterSeparableInit(size_t width, size_t height, size_t channels, SimdFilterChannelType type, const float* kernelX, size_t sizeX, const float* kernelY, size_t sizeY, SimdFilterBorderType border);
+
+        void* CustomFilter2dInit(size_t width, size_t height, size_t channels, SimdFilterChannelType type, const float* kernel, size_t sizeX, size_t sizeY, SimdFilterBorderType border);
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class CustomFilterDefault : public Avx2::CustomFilterDefault
+        {
+        public:
+            CustomFilterDefault(const CustomFilterParam& param, const float* kernelX, const float* kernelY);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* CustomFilterSeparableInit(size_t width, size_t height, size_t channels, SimdFilterChannelType type, const float* kernelX, size_t sizeX, const float* kernelY, size_t sizeY, SimdFilterBorderType border);
+
+        void* CustomFilter2dInit(size_t width, size_t height, size_t channels, SimdFilterChannelType type, const float* kernel, size_t sizeX, size_t sizeY, SimdFilterBorderType border);
+    }
+#endif
+
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        class CustomFilterDefault : public Base::CustomFilterDefault
+        {
+        public:
+            CustomFilterDefault(const CustomFilterParam& param, const float* kernelX, const float* kernelY);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* CustomFilterSeparableInit(size_t width, size_t height, size_t channels, SimdFilterChannelType type, const float* kernelX, size_t sizeX, const float* kernelY, size_t sizeY, SimdFilterBorderType border);
+
+        void* CustomFilter2dInit(size_t width, size_t height, size_t channels, SimdFilterChannelType type, const float* kernel, size_t sizeX, size_t sizeY, SimdFilterBorderType border);
+    }
+#endif
+}
+
+#endif
@@ -425,6 +425,31 @@ namespace Simd
     */
     template <template<class> class A> void Convert(const Frame<A> & src, Frame<A> & dst);
 
+    /*! @ingroup cpp_frame_functions
+
+        \fn template <template<class> class A> bool SynetPreprocess(const Frame<A>& src, size_t dstW, size_t dstH, SimdResizeMethodType method, const float* mean, const float* std, uint8_t* dst, SimdTensorFormatType format, SimdTensorDataType type, bool isRgb = false);
+
+        \short Resizes frame, converts its color and sets it (normalized) to the 3-channel input of neural network.
+
+        Frames in Frame::Nv12 and Frame::Yuv420p formats are processed directly (without intermediate BGR image).
+
+        \note This function is a C++ wrapper for functions ::SimdSynetPreprocessYuv420Init, ::SimdSynetPreprocessYuv420Run and Simd::SynetPreprocess.
+
+        \param [in] src - an input frame. There are supported following formats: Frame::Nv12, Frame::Yuv420p, Frame::Bgr24, Frame::Bgra32, Frame::Rgb24, Frame::Rgba32.
+        \param [in] dstW - a width of output tensor.
+        \param [in] dstH - a height of output tensor.
+        \param [in] method - a resize method.
+        \param [in] mean - a pointer to array with 3 mean values (in range [0..255]).
+        \param [in] std - a pointer to array with 3 standard deviations (in range [0..255]).
+        \param [out] dst - a pointer to the output tensor.
+        \param [in] format - a format of output tensor. There are supported following tensor formats: ::SimdTensorFormatNchw, ::SimdTensorFormatNhwc.
+        \param [in] type - a type of output tensor. There are supported following types: ::SimdTensorData32f, ::SimdTensorData16b, ::SimdTensorData8u.
+        \param [in] isRgb - is channel order of output tensor is RGB or BGR. Its default value is false.
+        \return false if given parameters are not supported (output tensor is not changed in this case).
+    */
+    template <template<class> class A> bool SynetPreprocess(const Frame<A>& src, size_t dstW, size_t dstH, SimdResizeMethodType method, 
+        const float* mean, const float* std, uint8_t* dst, SimdTensorFormatType format, SimdTensorDataType type, bool isRgb = false);
+
     //-------------------------------------------------------------------------------------------------
 
     // struct Frame implementation:
@@ -1365,6 +1390,25 @@ namespace Simd
             assert(0);
         }
     }
+
+    template <template<class> class A> SIMD_INLINE bool SynetPreprocess(const Frame<A>& src, size_t dstW, size_t dstH, SimdResizeMethodType method,
+        const float* mean, const float* std, uint8_t* dst, SimdTensorFormatType format, SimdTensorDataType type, bool isRgb)
+    {
+        if (src.format == Frame<A>::Nv12 || src.format == Frame<A>::Yuv420p)
+        {
+            bool nv12 = src.format == Frame<A>::Nv12;
+            void* context = SimdSynetPreprocessYuv420Init(src.width, src.height, src.yuvType, nv12 ? SimdTrue : SimdFalse, isRgb ? SimdTrue : SimdFalse,
+                dstW, dstH, method, mean, std, format, type);
+            if (context == NULL)
+                return false;
+            const View<A>& u = src.planes[1], & v = nv12 ? src.planes[1] : src.planes[2];
+            SimdSynetPreprocessYuv420Run(context, src.planes[0].data, src.planes[0].stride, u.data, u.stride, v.data, v.stride, dst);
+            SimdRelease(context);
+            return true;
+        }
+        else
+            return SynetPreprocess(src.planes[0], dstW, dstH, 3, method, mean, std, dst, format, type, isRgb);
+    }
 }
 
 #endif
@@ -38,6 +38,26 @@ namespace Simd
 
     uint8_t* ImageLoadFromFile(const ImageLoadFromMemoryPtr loader, const char* path, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
 
+    typedef uint8_t* (*ImageLoadFromMemoryScaledPtr)(const uint8_t* data, size_t size, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+    uint8_t* ImageLoadFromFileScaled(const ImageLoadFromMemoryScaledPtr loader, const char* path, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+    typedef bool (*ImageLoadBandsFromMemoryPtr)(const uint8_t* data, size_t size, SimdPixelFormatType format, SimdImageBandCallbackPtr callback, void* user);
+
+    SimdBool ImageLoadToBuffer(const ImageLoadBandsFromMemoryPtr loader, const uint8_t* data, size_t size, uint8_t* dst, size_t stride, size_t width, size_t height, SimdPixelFormatType format);
+
+    typedef uint8_t* (*ImageLoadRoiFromMemoryPtr)(const uint8_t* data, size_t size, size_t left, size_t top, size_t right, size_t bottom, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+    typedef uint8_t* (*JpegLoadAsYuvFromMemoryPtr)(const uint8_t* data, size_t size, SimdYuvLayoutType layout, size_t* width, size_t* height, uint8_t** planes, size_t* strides);
+
+    typedef void* (*JpegStreamDecoderInitPtr)(SimdPixelFormatType format, size_t frames);
+
+    typedef void* (*ResizerInitPtr)(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+    size_t ImageLoadBatchFromMemory(const ImageLoadFromMemoryScaledPtr loader, const ResizerInitPtr resizerInit, SimdImageLoadItem* items, size_t count, SimdResizeMethodType method);
+
+    const size_t ImageLoaderBandRows = 32;
+
     //-------------------------------------------------------------------------
 
     struct ImageLoaderParam
@@ -46,8 +66,9 @@ namespace Simd
         size_t size;
         SimdImageFileType file;
         SimdPixelFormatType format;
+        size_t scale;
 
-        ImageLoaderParam(const uint8_t* d, size_t s, SimdPixelFormatType f);
+        ImageLoaderParam(const uint8_t* d, size_t s, SimdPixelFormatType f, size_t sc = 1);
 
         bool Validate();
     };
@@ -76,6 +97,31 @@ namespace Simd
 
         virtual bool FromStream() = 0;
 
+        virtual bool ToBands(SimdImageBandCallbackPtr callback, void* user)
+        {
+            if (!FromStream())
+                return false;
+            for (size_t row = 0; row < _image.height; row += ImageLoaderBandRows)
+            {
+                size_t rows = Simd::Min(ImageLoaderBandRows, _image.height - row);
+                if (!callback(user, _image.Row<uint8_t>(row), _image.stride, _image.width, _image.height, row, rows, (SimdPixelFormatType)_image.format))
+                    return false;
+            }
+            return true;
+        }
+
+        virtual bool FromStreamRoi(size_t left, size_t top, size_t right, size_t bottom)
+        {
+            if (!FromStream() || left >= right || top >= bottom || right > _image.width || bottom > _image.height)
+                return false;
+            Image roi(right - left, bottom - top, _image.format);
+            size_t pixel = _image.PixelSize(), size = roi.width * pixel;
+            for (size_t row = 0; row < roi.height; ++row)
+                memcpy(roi.Row<uint8_t>(row), _image.Row<uint8_t>(top + row) + left * pixel, size);
+            _image.Swap(roi);
+            return true;
+        }
+
         SIMD_INLINE uint8_t* Release(size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format)
         {
             *stride = _image.stride;
@@ -160,20 +206,24 @@ namespace Simd
 
             virtual bool FromStream();
 
+            virtual bool ToBands(SimdImageBandCallbackPtr callback, void* user);
+
             typedef void (*DecodeLinePtr)(const uint8_t* curr, const uint8_t* prev, int width, int srcN, int dstN, uint8_t* dst);
             typedef void (*ExpandPalettePtr)(const uint8_t* src, size_t size, int outN, const uint8_t* palette, uint8_t* dst);
+            typedef void (*Expand16Ptr)(uint8_t* data, size_t size);
             typedef void (*ConverterPtr)(const uint8_t* src, size_t width, size_t height, size_t srcStride, uint8_t* dst, size_t dstStride);
 
         protected:
 
             DecodeLinePtr _decodeLine[7];
             ExpandPalettePtr _expandPalette;
+            Expand16Ptr _expand16;
             ConverterPtr _converter;
             virtual void SetConverter();
 
         private:
             bool _first, _hasTrans, _iPhone;
-            uint32_t _width, _height, _channels, _outN;
+            uint32_t _width, _height, _channels, _outN, _paletteSize;
             uint16_t _tc16[3];
             uint8_t _depth, _color, _interlace, _paletteChannels, _tc[3];
             Array8u _palette, _idat, _buffer;
@@ -197,6 +247,8 @@ namespace Simd
             InputMemoryStream MergedDataStream();
             bool CreateImage(const uint8_t* data, size_t size);
             bool CreateImageRaw(const uint8_t* data, uint32_t size, uint32_t width, uint32_t height);
+            bool UnfilterRows(const uint8_t* data, uint32_t width, uint32_t beg, uint32_t end, uint8_t* dst);
+            void ExpandRows(uint32_t width, uint32_t rows, uint8_t* dst);
             void ExpandPalette();
             void ConvertImage();
         };
@@ -212,12 +264,40 @@ namespace Simd
 
             virtual bool FromStream();
 
+            virtual bool ToBands(SimdImageBandCallbackPtr callback, void* user);
+
+            virtual bool FromStreamRoi(size_t left, size_t top, size_t right, size_t bottom);
+
+            uint8_t* ToYuv(SimdYuvLayoutType layout, size_t* width, size_t* height, uint8_t** planes, size_t* strides);
+            bool DecodeFrame(const uint8_t* data, size_t size, Image& frame);
+
         protected:
             struct JpegContext* _context;
         };
 
         //-------------------------------------------------------------------------------------------------
 
+        class JpegStreamDecoder : public Deletable
+        {
+        public:
+            JpegStreamDecoder(ImageJpegLoader* loader, size_t frames);
+
+            virtual ~JpegStreamDecoder();
+
+            const uint8_t* Decode(const uint8_t* data, size_t size, size_t* stride, size_t* width, size_t* height);
+
+            static bool Valid(SimdPixelFormatType format, size_t frames);
+
+        protected:
+            typedef Simd::View<Simd::Allocator> Image;
+
+            ImageJpegLoader* _loader;
+            Image* _frames;
+            size_t _count, _index;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
         class ImageBmpLoader : public ImageLoader
         {
         public:
@@ -240,7 +320,76 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        class ImageQoiLoader : public ImageLoader
+        {
+        public:
+            ImageQoiLoader(const ImageLoaderParam& param);
+
+            virtual bool FromStream();
+
+        protected:
+            bool ParseHeader();
+            virtual void SetConverters();
+
+            typedef void (*ToAnyPtr)(const uint8_t* src, size_t width, size_t height, size_t srcStride, uint8_t* dst, size_t dstStride);
+            ToAnyPtr _toAny;
+            uint32_t _width, _height;
+            uint8_t _channels;
+            Array8u _buffer;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        class ImageRawLoader : public ImageLoader
+        {
+        public:
+            ImageRawLoader(const ImageLoaderParam& param);
+
+            virtual bool FromStream();
+        };
+
+        class ImageRawMapping : public Deletable
+        {
+        public:
+            ImageRawMapping();
+
+            virtual ~ImageRawMapping();
+
+            bool Open(const char* path);
+
+            SIMD_INLINE const uint8_t* Data() const
+            {
+                return _data;
+            }
+
+        private:
+            const uint8_t* _data;
+            size_t _size;
+#if defined(_WIN32)
+            void* _file;
+            void* _mapping;
+#else
+            int _file;
+#endif
+        };
+
+        void* ImageRawMapFile(const char* path, const uint8_t** data, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        //-------------------------------------------------------------------------------------------------
+
         uint8_t* ImageLoadFromMemory(const uint8_t* data, size_t size, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        uint8_t* ImageLoadFromMemoryScaled(const uint8_t* data, size_t size, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        bool ImageLoadBandsFromMemory(const uint8_t* data, size_t size, SimdPixelFormatType format, SimdImageBandCallbackPtr callback, void* user);
+
+        uint8_t* ImageLoadRoiFromMemory(const uint8_t* data, size_t size, size_t left, size_t top, size_t right, size_t bottom, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        bool ImageLoadInfoFromMemory(const uint8_t* data, size_t size, SimdImageFileType* file, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        uint8_t* JpegLoadAsYuvFromMemory(const uint8_t* data, size_t size, SimdYuvLayoutType layout, size_t* width, size_t* height, uint8_t** planes, size_t* strides);
+
+        void* JpegStreamDecoderInit(SimdPixelFormatType format, size_t frames);
     }
 
 #ifdef SIMD_SSE41_ENABLE    
@@ -305,9 +454,28 @@ namespace Simd
             virtual void SetConverters();
         };
 
+        class ImageQoiLoader : public Base::ImageQoiLoader
+        {
+        public:
+            ImageQoiLoader(const ImageLoaderParam& param);
+
+        protected:
+            virtual void SetConverters();
+        };
+
         //-------------------------------------------------------------------------------------------------
 
         uint8_t* ImageLoadFromMemory(const uint8_t* data, size_t size, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        uint8_t* ImageLoadFromMemoryScaled(const uint8_t* data, size_t size, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        bool ImageLoadBandsFromMemory(const uint8_t* data, size_t size, SimdPixelFormatType format, SimdImageBandCallbackPtr callback, void* user);
+
+        uint8_t* ImageLoadRoiFromMemory(const uint8_t* data, size_t size, size_t left, size_t top, size_t right, size_t bottom, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        uint8_t* JpegLoadAsYuvFromMemory(const uint8_t* data, size_t size, SimdYuvLayoutType layout, size_t* width, size_t* height, uint8_t** planes, size_t* strides);
+
+        void* JpegStreamDecoderInit(SimdPixelFormatType format, size_t frames);
     }
 #endif
 
@@ -350,12 +518,20 @@ namespace Simd
             virtual void SetConverters();
         };
 
+        class ImagePngLoader : public Base::ImagePngLoader
+        {
+        public:
+            ImagePngLoader(const ImageLoaderParam& param);
+        };
+
         class ImageJpegLoader : public Sse41::ImageJpegLoader
         {
         public:
             ImageJpegLoader(const ImageLoaderParam& param);
 
             virtual bool FromStream();
+
+            virtual bool FromStreamRoi(size_t left, size_t top, size_t right, size_t bottom);
         };
 
         class ImageBmpLoader : public Sse41::ImageBmpLoader
@@ -367,9 +543,28 @@ namespace Simd
             virtual void SetConverters();
         };
 
+        class ImageQoiLoader : public Sse41::ImageQoiLoader
+        {
+        public:
+            ImageQoiLoader(const ImageLoaderParam& param);
+
+        protected:
+            virtual void SetConverters();
+        };
+
         //-------------------------------------------------------------------------------------------------
 
         uint8_t* ImageLoadFromMemory(const uint8_t* data, size_t size, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        uint8_t* ImageLoadFromMemoryScaled(const uint8_t* data, size_t size, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        bool ImageLoadBandsFromMemory(const uint8_t* data, size_t size, SimdPixelFormatType format, SimdImageBandCallbackPtr callback, void* user);
+
+        uint8_t* ImageLoadRoiFromMemory(const uint8_t* data, size_t size, size_t left, size_t top, size_t right, size_t bottom, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        uint8_t* JpegLoadAsYuvFromMemory(const uint8_t* data, size_t size, SimdYuvLayoutType layout, size_t* width, size_t* height, uint8_t** planes, size_t* strides);
+
+        void* JpegStreamDecoderInit(SimdPixelFormatType format, size_t frames);
     }
 #endif
 
@@ -412,6 +607,18 @@ namespace Simd
             virtual void SetConverters();
         };
 
+        class ImagePngLoader : public Avx2::ImagePngLoader
+        {
+        public:
+            ImagePngLoader(const ImageLoaderParam& param);
+        };
+
+        class ImageJpegLoader : public Sse41::ImageJpegLoader
+        {
+        public:
+            ImageJpegLoader(const ImageLoaderParam& param);
+        };
+
         class ImageBmpLoader : public Avx2::ImageBmpLoader
         {
         public:
@@ -421,9 +628,28 @@ namespace Simd
             virtual void SetConverters();
         };
 
+        class ImageQoiLoader : public Avx2::ImageQoiLoader
+        {
+        public:
+            ImageQoiLoader(const ImageLoaderParam& param);
+
+        protected:
+            virtual void SetConverters();
+        };
+
         //-------------------------------------------------------------------------------------------------
 
         uint8_t* ImageLoadFromMemory(const uint8_t* data, size_t size, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        uint8_t* ImageLoadFromMemoryScaled(const uint8_t* data, size_t size, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        bool ImageLoadBandsFromMemory(const uint8_t* data, size_t size, SimdPixelFormatType format, SimdImageBandCallbackPtr callback, void* user);
+
+        uint8_t* ImageLoadRoiFromMemory(const uint8_t* data, size_t size, size_t left, size_t top, size_t right, size_t bottom, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        uint8_t* JpegLoadAsYuvFromMemory(const uint8_t* data, size_t size, SimdYuvLayoutType layout, size_t* width, size_t* height, uint8_t** planes, size_t* strides);
+
+        void* JpegStreamDecoderInit(SimdPixelFormatType format, size_t frames);
     }
 #endif
 
@@ -475,9 +701,24 @@ namespace Simd
             virtual void SetConverters();
         };
 
+        class ImageQoiLoader : public Base::ImageQoiLoader
+        {
+        public:
+            ImageQoiLoader(const ImageLoaderParam& param);
+
+        protected:
+            virtual void SetConverters();
+        };
+
         //-------------------------------------------------------------------------------------------------
 
         uint8_t* ImageLoadFromMemory(const uint8_t* data, size_t size, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        uint8_t* ImageLoadFromMemoryScaled(const uint8_t* data, size_t size, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        bool ImageLoadBandsFromMemory(const uint8_t* data, size_t size, SimdPixelFormatType format, SimdImageBandCallbackPtr callback, void* user);
+
+        uint8_t* ImageLoadRoiFromMemory(const uint8_t* data, size_t size, size_t left, size_t top, size_t right, size_t bottom, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
     }
 #endif
 }
@@ -66,7 +66,8 @@ namespace Simd
             int tq;
             int hd, ha;
             int dc_pred;
-            int x, y, w2, h2;
+            int x, y, w2, h2, bw, bh, top;
+            int rx0, ry0, rx1, ry1;
             Array8u bufD, bufL;
             uint8_t* data;
             Array16i bufC;
@@ -77,6 +78,7 @@ namespace Simd
         //-------------------------------------------------------------------------------------------------
 
         typedef void (*IdctBlockPtr)(const int16_t * src, uint8_t* dst, int stride);
+        typedef void (*DequantizeBlocksPtr)(int16_t* data, const uint16_t* dequant, int count);
         typedef uint8_t* (*ResampleRowPtr)(uint8_t* out, const uint8_t* in0, const uint8_t* in1, int w, int hs);
         typedef void (*YuvToRgbRowPtr)(uint8_t* out, const uint8_t* y, const uint8_t* pcb, const uint8_t* pcr, int count, int step);
         typedef void (*YuvToBgrPtr)(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
@@ -92,6 +94,8 @@ namespace Simd
             int img_n, img_out_n;
             JpegHuffman huff_dc[4];
             JpegHuffman huff_ac[4];
+            uint8_t huff_key[2][4][16 + 256];
+            int huff_key_size[2][4];
             uint16_t dequant[4][64];
 
             int img_h_max, img_v_max;
@@ -117,10 +121,23 @@ namespace Simd
 
             int scan_n, order[4];
             int restart_interval, todo;
+            int scale_shift, block_size;
+
+            SimdImageBandCallbackPtr band_callback;
+            void* band_user;
+            SimdPixelFormatType band_format;
+            int band_window, band_units, band_emit, band_done;
+            Array8u band_buf;
+
+            int luma_only;
+
+            int roi, roi_left, roi_top, roi_right, roi_bottom;
+            int roi_mcu_x0, roi_mcu_y0, roi_mcu_x1, roi_mcu_y1, roi_skip;
 
             Array8u out;
 
-            IdctBlockPtr idctBlock;
+            IdctBlockPtr idctBlock, idctBlocks2;
+            DequantizeBlocksPtr dequantizeBlocks;
             ResampleRowPtr resampleRowHv2;
             YuvToRgbRowPtr yuvToRgbRow;
 
@@ -128,7 +145,7 @@ namespace Simd
             YuvToBgraPtr yuv444pToBgra, yuv420pToBgra;
             AnyToAnyPtr rgbaToAny;
 
-            JpegContext(InputMemoryStream* s);
+            JpegContext(InputMemoryStream* s, size_t scale = 1);
             void Reset();
 
             SIMD_INLINE bool NeedRestart() const
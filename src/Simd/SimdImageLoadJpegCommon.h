@@ -0,0 +1,129 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdImageLoadJpegCommon_h__
+#define __SimdImageLoadJpegCommon_h__
+
+#include "Simd/SimdDefs.h"
+
+/*
+* Integer 8x8 JPEG IDCT pass shared by SSE4.1 (one block per __m128i) and AVX-512BW (two blocks per __m256i) decoders.
+* Before use define SIMD_JPEG_IDCT_TYPE (vector type), SIMD_JPEG_IDCT_OP(op) (intrinsic name for given operation) 
+* and SIMD_JPEG_IDCT_ZERO (zero vector). Caller has to declare row0 - row7, tmp and rotation constants rot0_0 - rot3_1.
+*/
+
+#define SIMD_JPEG_IDCT_ROT(out0, out1, x, y, c0, c1) \
+      SIMD_JPEG_IDCT_TYPE c0##lo = SIMD_JPEG_IDCT_OP(unpacklo_epi16)((x), (y)); \
+      SIMD_JPEG_IDCT_TYPE c0##hi = SIMD_JPEG_IDCT_OP(unpackhi_epi16)((x), (y)); \
+      SIMD_JPEG_IDCT_TYPE out0##_l = SIMD_JPEG_IDCT_OP(madd_epi16)(c0##lo, c0); \
+      SIMD_JPEG_IDCT_TYPE out0##_h = SIMD_JPEG_IDCT_OP(madd_epi16)(c0##hi, c0); \
+      SIMD_JPEG_IDCT_TYPE out1##_l = SIMD_JPEG_IDCT_OP(madd_epi16)(c0##lo, c1); \
+      SIMD_JPEG_IDCT_TYPE out1##_h = SIMD_JPEG_IDCT_OP(madd_epi16)(c0##hi, c1)
+
+#define SIMD_JPEG_IDCT_WIDEN(out, in) \
+      SIMD_JPEG_IDCT_TYPE out##_l = SIMD_JPEG_IDCT_OP(srai_epi32)(SIMD_JPEG_IDCT_OP(unpacklo_epi16)(SIMD_JPEG_IDCT_ZERO, (in)), 4); \
+      SIMD_JPEG_IDCT_TYPE out##_h = SIMD_JPEG_IDCT_OP(srai_epi32)(SIMD_JPEG_IDCT_OP(unpackhi_epi16)(SIMD_JPEG_IDCT_ZERO, (in)), 4)
+
+#define SIMD_JPEG_IDCT_WADD(out, a, b) \
+      SIMD_JPEG_IDCT_TYPE out##_l = SIMD_JPEG_IDCT_OP(add_epi32)(a##_l, b##_l); \
+      SIMD_JPEG_IDCT_TYPE out##_h = SIMD_JPEG_IDCT_OP(add_epi32)(a##_h, b##_h)
+
+#define SIMD_JPEG_IDCT_WSUB(out, a, b) \
+      SIMD_JPEG_IDCT_TYPE out##_l = SIMD_JPEG_IDCT_OP(sub_epi32)(a##_l, b##_l); \
+      SIMD_JPEG_IDCT_TYPE out##_h = SIMD_JPEG_IDCT_OP(sub_epi32)(a##_h, b##_h)
+
+#define SIMD_JPEG_IDCT_BFLY32O(out0, out1, a, b, bias, s) \
+      { \
+         SIMD_JPEG_IDCT_TYPE abiased_l = SIMD_JPEG_IDCT_OP(add_epi32)(a##_l, bias); \
+         SIMD_JPEG_IDCT_TYPE abiased_h = SIMD_JPEG_IDCT_OP(add_epi32)(a##_h, bias); \
+         SIMD_JPEG_IDCT_WADD(sum, abiased, b); \
+         SIMD_JPEG_IDCT_WSUB(dif, abiased, b); \
+         out0 = SIMD_JPEG_IDCT_OP(packs_epi32)(SIMD_JPEG_IDCT_OP(srai_epi32)(sum_l, s), SIMD_JPEG_IDCT_OP(srai_epi32)(sum_h, s)); \
+         out1 = SIMD_JPEG_IDCT_OP(packs_epi32)(SIMD_JPEG_IDCT_OP(srai_epi32)(dif_l, s), SIMD_JPEG_IDCT_OP(srai_epi32)(dif_h, s)); \
+      }
+
+#define SIMD_JPEG_IDCT_INTERLEAVE8(a, b) \
+      tmp = a; \
+      a = SIMD_JPEG_IDCT_OP(unpacklo_epi8)(a, b); \
+      b = SIMD_JPEG_IDCT_OP(unpackhi_epi8)(tmp, b)
+
+#define SIMD_JPEG_IDCT_INTERLEAVE16(a, b) \
+      tmp = a; \
+      a = SIMD_JPEG_IDCT_OP(unpacklo_epi16)(a, b); \
+      b = SIMD_JPEG_IDCT_OP(unpackhi_epi16)(tmp, b)
+
+#define SIMD_JPEG_IDCT_PASS(bias, shift) \
+      { \
+         SIMD_JPEG_IDCT_ROT(t2e, t3e, row2, row6, rot0_0, rot0_1); \
+         SIMD_JPEG_IDCT_TYPE sum04 = SIMD_JPEG_IDCT_OP(add_epi16)(row0, row4); \
+         SIMD_JPEG_IDCT_TYPE dif04 = SIMD_JPEG_IDCT_OP(sub_epi16)(row0, row4); \
+         SIMD_JPEG_IDCT_WIDEN(t0e, sum04); \
+         SIMD_JPEG_IDCT_WIDEN(t1e, dif04); \
+         SIMD_JPEG_IDCT_WADD(x0, t0e, t3e); \
+         SIMD_JPEG_IDCT_WSUB(x3, t0e, t3e); \
+         SIMD_JPEG_IDCT_WADD(x1, t1e, t2e); \
+         SIMD_JPEG_IDCT_WSUB(x2, t1e, t2e); \
+         SIMD_JPEG_IDCT_ROT(y0o, y2o, row7, row3, rot2_0, rot2_1); \
+         SIMD_JPEG_IDCT_ROT(y1o, y3o, row5, row1, rot3_0, rot3_1); \
+         SIMD_JPEG_IDCT_TYPE sum17 = SIMD_JPEG_IDCT_OP(add_epi16)(row1, row7); \
+         SIMD_JPEG_IDCT_TYPE sum35 = SIMD_JPEG_IDCT_OP(add_epi16)(row3, row5); \
+         SIMD_JPEG_IDCT_ROT(y4o, y5o, sum17, sum35, rot1_0, rot1_1); \
+         SIMD_JPEG_IDCT_WADD(x4, y0o, y4o); \
+         SIMD_JPEG_IDCT_WADD(x5, y1o, y5o); \
+         SIMD_JPEG_IDCT_WADD(x6, y2o, y5o); \
+         SIMD_JPEG_IDCT_WADD(x7, y3o, y4o); \
+         SIMD_JPEG_IDCT_BFLY32O(row0, row7, x0, x7, bias, shift); \
+         SIMD_JPEG_IDCT_BFLY32O(row1, row6, x1, x6, bias, shift); \
+         SIMD_JPEG_IDCT_BFLY32O(row2, row5, x2, x5, bias, shift); \
+         SIMD_JPEG_IDCT_BFLY32O(row3, row4, x3, x4, bias, shift); \
+      }
+
+#define SIMD_JPEG_IDCT_TRANSPOSE16() \
+      { \
+         SIMD_JPEG_IDCT_INTERLEAVE16(row0, row4); \
+         SIMD_JPEG_IDCT_INTERLEAVE16(row1, row5); \
+         SIMD_JPEG_IDCT_INTERLEAVE16(row2, row6); \
+         SIMD_JPEG_IDCT_INTERLEAVE16(row3, row7); \
+         SIMD_JPEG_IDCT_INTERLEAVE16(row0, row2); \
+         SIMD_JPEG_IDCT_INTERLEAVE16(row1, row3); \
+         SIMD_JPEG_IDCT_INTERLEAVE16(row4, row6); \
+         SIMD_JPEG_IDCT_INTERLEAVE16(row5, row7); \
+         SIMD_JPEG_IDCT_INTERLEAVE16(row0, row1); \
+         SIMD_JPEG_IDCT_INTERLEAVE16(row2, row3); \
+         SIMD_JPEG_IDCT_INTERLEAVE16(row4, row5); \
+         SIMD_JPEG_IDCT_INTERLEAVE16(row6, row7); \
+      }
+
+#define SIMD_JPEG_IDCT_PACK_TRANSPOSE8(p0, p1, p2, p3) \
+      SIMD_JPEG_IDCT_TYPE p0 = SIMD_JPEG_IDCT_OP(packus_epi16)(row0, row1); \
+      SIMD_JPEG_IDCT_TYPE p1 = SIMD_JPEG_IDCT_OP(packus_epi16)(row2, row3); \
+      SIMD_JPEG_IDCT_TYPE p2 = SIMD_JPEG_IDCT_OP(packus_epi16)(row4, row5); \
+      SIMD_JPEG_IDCT_TYPE p3 = SIMD_JPEG_IDCT_OP(packus_epi16)(row6, row7); \
+      SIMD_JPEG_IDCT_INTERLEAVE8(p0, p2); \
+      SIMD_JPEG_IDCT_INTERLEAVE8(p1, p3); \
+      SIMD_JPEG_IDCT_INTERLEAVE8(p0, p1); \
+      SIMD_JPEG_IDCT_INTERLEAVE8(p2, p3); \
+      SIMD_JPEG_IDCT_INTERLEAVE8(p0, p2); \
+      SIMD_JPEG_IDCT_INTERLEAVE8(p1, p3)
+
+#endif
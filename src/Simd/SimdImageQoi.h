@@ -0,0 +1,106 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdImageQoi_h__
+#define __SimdImageQoi_h__
+
+#include "Simd/SimdDefs.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        const uint8_t QoiOpIndex = 0x00;
+        const uint8_t QoiOpDiff = 0x40;
+        const uint8_t QoiOpLuma = 0x80;
+        const uint8_t QoiOpRun = 0xC0;
+        const uint8_t QoiOpRgb = 0xFE;
+        const uint8_t QoiOpRgba = 0xFF;
+        const uint8_t QoiMask = 0xC0;
+
+        const size_t QoiHeaderSize = 14;
+        const size_t QoiPaddingSize = 8;
+        const int QoiRunMax = 62;
+
+        const uint32_t QoiPixelInit = 0xFF000000;
+
+        const uint32_t QoiCodeRgb = 0;
+        const uint32_t QoiCodeRgba = 1;
+
+        SIMD_INLINE uint32_t QoiHash(uint32_t px)
+        {
+            return ((px & 0xFF) * 3 + (px >> 8 & 0xFF) * 5 + (px >> 16 & 0xFF) * 7 + (px >> 24) * 11) & 63;
+        }
+
+        SIMD_INLINE uint32_t QoiCode(uint32_t px, uint32_t prev)
+        {
+            uint32_t code = QoiCodeRgba;
+            if ((px ^ prev) >> 24 == 0)
+            {
+                int vr = int8_t(px - prev);
+                int vg = int8_t((px >> 8) - (prev >> 8));
+                int vb = int8_t((px >> 16) - (prev >> 16));
+                int vgr = vr - vg, vgb = vb - vg;
+                if (vr >= -2 && vr <= 1 && vg >= -2 && vg <= 1 && vb >= -2 && vb <= 1)
+                    code = QoiOpDiff | (vr + 2) << 4 | (vg + 2) << 2 | (vb + 2);
+                else if (vgr >= -8 && vgr <= 7 && vg >= -32 && vg <= 31 && vgb >= -8 && vgb <= 7)
+                    code = (QoiOpLuma | (vg + 32)) << 8 | (vgr + 8) << 4 | (vgb + 8);
+                else
+                    code = QoiCodeRgb;
+            }
+            return QoiHash(px) << 16 | code;
+        }
+
+        void QoiEncodeCodes(const uint8_t* rgba, size_t size, uint32_t prev, uint32_t* codes);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        void QoiEncodeCodes(const uint8_t* rgba, size_t size, uint32_t prev, uint32_t* codes);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        void QoiEncodeCodes(const uint8_t* rgba, size_t size, uint32_t prev, uint32_t* codes);
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        void QoiEncodeCodes(const uint8_t* rgba, size_t size, uint32_t prev, uint32_t* codes);
+    }
+#endif
+
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        void QoiEncodeCodes(const uint8_t* rgba, size_t size, uint32_t prev, uint32_t* codes);
+    }
+#endif
+}
+
+#endif
@@ -0,0 +1,72 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdImageRaw_h__
+#define __SimdImageRaw_h__
+
+#include "Simd/SimdMemory.h"
+
+namespace Simd
+{
+    const size_t ImageRawAlign = 64;
+    const uint8_t ImageRawSignature[8] = { 'S', 'I', 'M', 'D', 'R', 'A', 'W', 0x1A };
+
+    SIMD_INLINE size_t ImageRawPixelSize(uint32_t format)
+    {
+        switch (format)
+        {
+        case SimdPixelFormatGray8: return 1;
+        case SimdPixelFormatBgr24: return 3;
+        case SimdPixelFormatBgra32: return 4;
+        case SimdPixelFormatRgb24: return 3;
+        case SimdPixelFormatRgba32: return 4;
+        default: return 0;
+        }
+    }
+
+    struct ImageRawHeader
+    {
+        uint8_t signature[8];
+        uint32_t format, width, height, stride, offset;
+        uint32_t reserved[9];
+
+        SIMD_INLINE void Init(size_t w, size_t h, SimdPixelFormatType f)
+        {
+            memset(this, 0, sizeof(ImageRawHeader));
+            memcpy(signature, ImageRawSignature, 8);
+            format = f;
+            width = (uint32_t)w;
+            height = (uint32_t)h;
+            stride = (uint32_t)AlignHi(w * ImageRawPixelSize(f), ImageRawAlign);
+            offset = (uint32_t)ImageRawAlign;
+        }
+
+        SIMD_INLINE bool Valid(size_t size) const
+        {
+            return memcmp(signature, ImageRawSignature, 8) == 0 && width > 0 && height > 0 && ImageRawPixelSize(format) > 0 &&
+                stride >= width * ImageRawPixelSize(format) && offset >= sizeof(ImageRawHeader) && offset + size_t(stride) * height <= size;
+        }
+    };
+}
+
+#endif
@@ -34,6 +34,12 @@ namespace Simd
 
     SimdBool ImageSaveToFile(const ImageSaveToMemoryPtr saver, const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, const char* path);
 
+    typedef bool (*ImageSaveToSinkPtr)(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, SimdImageWriteCallbackPtr callback, void* user);
+
+    SimdBool ImageSaveToBuffer(const ImageSaveToSinkPtr saver, const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, uint8_t* dst, size_t capacity, size_t* size);
+
+    size_t ImageSaveBatchToMemory(const ImageSaveToMemoryPtr saver, SimdImageSaveItem* items, size_t count);
+
     //-------------------------------------------------------------------------------------------------
 
     struct ImageSaverParam
@@ -87,7 +93,9 @@ namespace Simd
                 if (width % 2 != 0 || height % 2 != 0)
                     return false;
             }
-            if (file <= SimdImageFileUndefined || file > SimdImageFileBmp)
+            if (file <= SimdImageFileUndefined || file > SimdImageFileRaw)
+                return false;
+            if (file == SimdImageFileJpeg && (quality & ~(0xFF | SimdJpegSampling444 | SimdJpegOptimizeHuffman)))
                 return false;
             return true;
         }
@@ -112,6 +120,8 @@ namespace Simd
 
         virtual bool ToStream(const uint8_t* src, size_t stride) = 0;
 
+        bool ToSink(const uint8_t* src, size_t stride, SimdImageWriteCallbackPtr callback, void* user);
+
         SIMD_INLINE uint8_t* Release(size_t* size)
         {
             return _stream.Release(size);
@@ -179,17 +189,24 @@ namespace Simd
         protected:
             static const int COMPRESSION = 8;
             static const int FILTERS = 5;
+            static const int SEGMENT_MIN = 65536;
             static const int TYPES = 7;
             typedef void (*ConvertPtr)(const uint8_t* src, size_t width, size_t height, size_t srcStride, uint8_t* dst, size_t dstStride);
             typedef uint32_t (*EncodePtr)(const uint8_t* src, size_t stride, size_t n, size_t size, int8_t* dst);
             typedef void (*CompressPtr)(uint8_t* data, int size, int quality, OutputMemoryStream& stream);
+            typedef void (*DeflatePtr)(uint8_t* data, int size, int quality, bool last, OutputMemoryStream& stream);
+            typedef uint32_t (*Adler32Ptr)(uint8_t* data, int size);
             ConvertPtr _convert;
             EncodePtr _encode[TYPES];
             CompressPtr _compress;
+            DeflatePtr _deflate;
+            Adler32Ptr _adler32;
             size_t _channels, _size;
+            int _compression;
             Array8u _filt, _buff;
             Array8i _line;
 
+            void FilterRows(const uint8_t* src, size_t stride, size_t begin, size_t end, int8_t* line);
             void WriteToStream(const uint8_t* zlib, size_t zlen);
         };
 
@@ -223,15 +240,18 @@ namespace Simd
             WriteBlockPtr _writeBlock;
             WriteNv12BlockPtr _writeNv12Block;
             WriteYuv420pBlockPtr _writeYuv420pBlock;
-            bool _subSample;
-            int _quality, _block, _width;
+            bool _optimize;
+            int _sampling, _quality, _block, _cols, _width, _slice, _slices;
             float _fY[64], _fUv[64];
             uint8_t _uY[64], _uUv[64];
+            Array8u _huffman;
 
             virtual void Init();
 
             void InitParams(bool trans);
             void WriteHeader();
+            void OptimizeHuffman(OutputMemoryStream* streams);
+            template<class WriteSlice> void WriteSlices(const WriteSlice& writeSlice);
         };
 
         //-------------------------------------------------------------------------------------------------
@@ -253,8 +273,41 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        class ImageQoiSaver : public ImageSaver
+        {
+        public:
+            ImageQoiSaver(const ImageSaverParam& param);
+
+            virtual bool ToStream(const uint8_t* src, size_t stride);
+
+        protected:
+            typedef void (*ToRgbaPtr)(const uint8_t* src, size_t width, size_t height, size_t srcStride, uint8_t* rgba, size_t rgbaStride, uint8_t alpha);
+            typedef void (*ConvertPtr)(const uint8_t* src, size_t width, size_t height, size_t srcStride, uint8_t* dst, size_t dstStride);
+            typedef void (*EncodeCodesPtr)(const uint8_t* rgba, size_t size, uint32_t prev, uint32_t* codes);
+            ToRgbaPtr _toRgba;
+            ConvertPtr _convert;
+            EncodeCodesPtr _encodeCodes;
+            Array8u _buffer;
+            Array32u _codes;
+            uint8_t _channels;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        class ImageRawSaver : public ImageSaver
+        {
+        public:
+            ImageRawSaver(const ImageSaverParam& param);
+
+            virtual bool ToStream(const uint8_t* src, size_t stride);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
         uint8_t* ImageSaveToMemory(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, size_t* size);
 
+        bool ImageSaveToSink(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, SimdImageWriteCallbackPtr callback, void* user);
+
         uint8_t* Nv12SaveAsJpegToMemory(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, SimdYuvType yuvType, int quality, size_t* size);
 
         uint8_t* Yuv420pSaveAsJpegToMemory(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height, SimdYuvType yuvType, int quality, size_t* size);
@@ -308,10 +361,18 @@ namespace Simd
             ImageBmpSaver(const ImageSaverParam& param);
         };
 
+        class ImageQoiSaver : public Base::ImageQoiSaver
+        {
+        public:
+            ImageQoiSaver(const ImageSaverParam& param);
+        };
+
         //-------------------------------------------------------------------------------------------------
 
         uint8_t* ImageSaveToMemory(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, size_t* size);
 
+        bool ImageSaveToSink(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, SimdImageWriteCallbackPtr callback, void* user);
+
         uint8_t* Nv12SaveAsJpegToMemory(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, SimdYuvType yuvType, int quality, size_t* size);
 
         uint8_t* Yuv420pSaveAsJpegToMemory(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height, SimdYuvType yuvType, int quality, size_t* size);
@@ -366,10 +427,18 @@ namespace Simd
             ImageBmpSaver(const ImageSaverParam& param);
         };
 
+        class ImageQoiSaver : public Sse41::ImageQoiSaver
+        {
+        public:
+            ImageQoiSaver(const ImageSaverParam& param);
+        };
+
         //-------------------------------------------------------------------------------------------------
 
         uint8_t* ImageSaveToMemory(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, size_t* size);
 
+        bool ImageSaveToSink(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, SimdImageWriteCallbackPtr callback, void* user);
+
         uint8_t* Nv12SaveAsJpegToMemory(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, SimdYuvType yuvType, int quality, size_t* size);
 
         uint8_t* Yuv420pSaveAsJpegToMemory(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height, SimdYuvType yuvType, int quality, size_t* size);
@@ -424,10 +493,18 @@ namespace Simd
             ImageBmpSaver(const ImageSaverParam& param);
         };
 
+        class ImageQoiSaver : public Avx2::ImageQoiSaver
+        {
+        public:
+            ImageQoiSaver(const ImageSaverParam& param);
+        };
+
         //-------------------------------------------------------------------------------------------------
 
         uint8_t* ImageSaveToMemory(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, size_t* size);
 
+        bool ImageSaveToSink(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, SimdImageWriteCallbackPtr callback, void* user);
+
         uint8_t* Nv12SaveAsJpegToMemory(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, SimdYuvType yuvType, int quality, size_t* size);
 
         uint8_t* Yuv420pSaveAsJpegToMemory(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height, SimdYuvType yuvType, int quality, size_t* size);
@@ -482,10 +559,18 @@ namespace Simd
             ImageBmpSaver(const ImageSaverParam& param);
         };
 
+        class ImageQoiSaver : public Base::ImageQoiSaver
+        {
+        public:
+            ImageQoiSaver(const ImageSaverParam& param);
+        };
+
         //-------------------------------------------------------------------------------------------------
 
         uint8_t* ImageSaveToMemory(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, size_t* size);
 
+        bool ImageSaveToSink(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, SimdImageWriteCallbackPtr callback, void* user);
+
         uint8_t* Nv12SaveAsJpegToMemory(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, SimdYuvType yuvType, int quality, size_t* size);
 
         uint8_t* Yuv420pSaveAsJpegToMemory(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height, SimdYuvType yuvType, int quality, size_t* size);
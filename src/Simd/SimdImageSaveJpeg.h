@@ -128,6 +128,20 @@ namespace Simd
             }
         }
 
+        SIMD_INLINE void RgbToYuv16x8(const uint8_t* r, const uint8_t* g, const uint8_t* b, int stride, int height, int width, float* y, float* u, float* v)
+        {
+            RgbToYuv(r, g, b, stride, height, width, y, u, v, 8);
+            int offs = width > 8 ? 8 : width - 1;
+            RgbToYuv(r + offs, g + offs, b + offs, stride, height, width - offs, y + 64, u + 64, v + 64, 8);
+        }
+
+        SIMD_INLINE void GrayToY16x8(const uint8_t* g, int stride, int height, int width, float* y)
+        {
+            GrayToY(g, stride, height, width, y, 8);
+            int offs = width > 8 ? 8 : width - 1;
+            GrayToY(g + offs, stride, height, width - offs, y + 64, 8);
+        }
+
         SIMD_INLINE int UvSize(int ySize)
         {
             return (ySize + 1) >> 1;
@@ -117,6 +117,16 @@ namespace Simd
                 ZlibHuff2(bits, stream);
         }
 
+        SIMD_INLINE void ZlibSyncFlush(OutputMemoryStream& stream)
+        {
+            stream.WriteBits(0, 3);
+            stream.FlushBits();
+            stream.Write8u(0x00);
+            stream.Write8u(0x00);
+            stream.Write8u(0xFF);
+            stream.Write8u(0xFF);
+        }
+
         SIMD_INLINE int ZlibCount(const uint8_t* a, const uint8_t* b, int limit)
         {
             limit = Min(limit, 258);
@@ -147,6 +157,90 @@ namespace Simd
                 return uint8_t(b);
             return uint8_t(c);
         }
+
+        SIMD_INLINE uint32_t ZlibHash4(const uint8_t* data)
+        {
+            return (*(uint32_t*)data * 0x9E3779B1) >> 18;
+        }
+
+        const size_t ZlibBlockTokens = 16384;
+
+        void ZlibWriteBlock(const uint32_t* tokens, size_t count, bool last, OutputMemoryStream& stream);
+
+        template<int (*Count)(const uint8_t* a, const uint8_t* b, int limit)> void ZlibDeflate(uint8_t* data, int size, int quality, bool last, OutputMemoryStream& stream)
+        {
+            const int ZHASH = 16384, basket = quality * 2, LAZY = 4;
+            Array32i hashTable(quality ? ZHASH * basket : 0);
+            if (quality)
+                memset(hashTable.data, -1, hashTable.RawSize());
+            Array32u tokens(ZlibBlockTokens);
+            size_t count = 0;
+            int i = 0, j;
+            while (i < size)
+            {
+                int best = 0, dist = 0;
+                if (quality == 0)
+                {
+                    if (i)
+                    {
+                        best = Count(data + i - 1, data + i, size - i);
+                        dist = 1;
+                    }
+                }
+                else if (i < size - 3)
+                {
+                    int* hList = hashTable.data + ZlibHash4(data + i) * basket;
+                    for (j = 0; j < basket && hList[j] != -1; ++j)
+                    {
+                        if (hList[j] > i - 32768)
+                        {
+                            int d = Count(data + hList[j], data + i, size - i);
+                            if (d >= best)
+                            {
+                                best = d;
+                                dist = i - hList[j];
+                            }
+                        }
+                    }
+                    if (j == basket)
+                    {
+                        memcpy(hList, hList + quality, quality * sizeof(int));
+                        memset(hList + quality, -1, quality * sizeof(int));
+                        j = quality;
+                    }
+                    hList[j] = i;
+
+                    if (best >= 3 && quality >= LAZY && i < size - 4)
+                    {
+                        hList = hashTable.data + ZlibHash4(data + i + 1) * basket;
+                        for (j = 0; j < basket && hList[j] != -1; ++j)
+                        {
+                            if (hList[j] > i - 32767 && Count(data + hList[j], data + i + 1, size - i - 1) > best)
+                            {
+                                best = 0;
+                                break;
+                            }
+                        }
+                    }
+                }
+                if (best >= 3)
+                {
+                    tokens[count++] = uint32_t(dist << 16 | best);
+                    i += best;
+                }
+                else
+                    tokens[count++] = data[i++];
+                if (count == ZlibBlockTokens)
+                {
+                    ZlibWriteBlock(tokens.data, count, false, stream);
+                    count = 0;
+                }
+            }
+            ZlibWriteBlock(tokens.data, count, last, stream);
+            if (!last)
+                ZlibSyncFlush(stream);
+            stream.FlushBits();
+        }
     }
 
 #ifdef SIMD_SSE41_ENABLE    
@@ -228,6 +322,22 @@ namespace Simd
 #ifdef SIMD_NEON_ENABLE    
     namespace Neon
     {
+        SIMD_INLINE int ZlibCount(const uint8_t* a, const uint8_t* b, int limit)
+        {
+            limit = Min(limit, 258);
+            int i = 0;
+            int limit16 = limit & (~15);
+            for (; i < limit16; i += 16)
+            {
+                uint64x2_t eq = vreinterpretq_u64_u8(vceqq_u8(vld1q_u8(a + i), vld1q_u8(b + i)));
+                if ((vgetq_lane_u64(eq, 0) & vgetq_lane_u64(eq, 1)) != uint64_t(-1))
+                    break;
+            }
+            for (; i < limit; i += 1)
+                if (a[i] != b[i])
+                    break;
+            return i;
+        }
     }
 #endif// SIMD_NEON_ENABLE
 }
@@ -64,10 +64,13 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReasonForCall, LPVOID lpReserved)
 #include "Simd/SimdEmpty.h"
 #include "Simd/SimdTile.h"
 
+#include "Simd/SimdCustomFilter.h"
 #include "Simd/SimdDescrInt.h"
 #include "Simd/SimdGaussianBlur.h"
 #include "Simd/SimdImageLoad.h"
 #include "Simd/SimdImageSave.h"
+#include "Simd/SimdMorphology.h"
+#include "Simd/SimdNms.h"
 #include "Simd/SimdRecursiveBilateralFilter.h"
 #include "Simd/SimdResizer.h"
 #include "Simd/SimdSynetAdd16b.h"
@@ -77,12 +80,14 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReasonForCall, LPVOID lpReserved)
 #include "Simd/SimdSynetDeconvolution32f.h"
 #include "Simd/SimdSynetDeconvolution16b.h"
 #include "Simd/SimdSynetGridSample.h"
+#include "Simd/SimdSynetGroupNorm16b.h"
 #include "Simd/SimdSynetInnerProduct32f.h"
 #include "Simd/SimdSynetInnerProduct16b.h"
 #include "Simd/SimdSynetMergedConvolution32f.h"
 #include "Simd/SimdSynetMergedConvolution16b.h"
 #include "Simd/SimdSynetMergedConvolution8i.h"
 #include "Simd/SimdSynetPermute.h"
+#include "Simd/SimdSynetPreprocess.h"
 #include "Simd/SimdSynetQuantizedAdd.h"
 #include "Simd/SimdSynetQuantizedConvolution.h"
 #include "Simd/SimdSynetQuantizedInnerProduct.h"
@@ -2439,6 +2444,51 @@ SIMD_API void SimdGaussianBlurRun(const void* filter, const uint8_t* src, size_t
     ((GaussianBlur*)filter)->Run(src, srcStride, dst, dstStride);
 }
 
+SIMD_API void* SimdCustomFilterSeparableInit(size_t width, size_t height, size_t channels, SimdFilterChannelType type,
+    const float* kernelX, size_t sizeX, const float* kernelY, size_t sizeY, SimdFilterBorderType border)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdCustomFilterSeparableInitPtr) (size_t width, size_t height, size_t channels, SimdFilterChannelType type,
+        const float* kernelX, size_t sizeX, const float* kernelY, size_t sizeY, SimdFilterBorderType border);
+    const static SimdCustomFilterSeparableInitPtr simdCustomFilterSeparableInit = SIMD_FUNC4(CustomFilterSeparableInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return simdCustomFilterSeparableInit(width, height, channels, type, kernelX, sizeX, kernelY, sizeY, border);
+}
+
+SIMD_API void* SimdCustomFilter2dInit(size_t width, size_t height, size_t channels, SimdFilterChannelType type,
+    const float* kernel, size_t sizeX, size_t sizeY, SimdFilterBorderType border)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdCustomFilter2dInitPtr) (size_t width, size_t height, size_t channels, SimdFilterChannelType type,
+        const float* kernel, size_t sizeX, size_t sizeY, SimdFilterBorderType border);
+    const static SimdCustomFilter2dInitPtr simdCustomFilter2dInit = SIMD_FUNC4(CustomFilter2dInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return simdCustomFilter2dInit(width, height, channels, type, kernel, sizeX, sizeY, border);
+}
+
+SIMD_API void SimdCustomFilterRun(const void* filter, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+    ((CustomFilter*)filter)->Run(src, srcStride, dst, dstStride);
+}
+
+SIMD_API void* SimdMorphologyInit(size_t width, size_t height, size_t channels, SimdMorphologyOperationType operation,
+    SimdMorphologyElementType element, size_t sizeX, size_t sizeY)
+{
+    SIMD_EMPTY();
+    typedef void* (*SimdMorphologyInitPtr) (size_t width, size_t height, size_t channels, SimdMorphologyOperationType operation,
+        SimdMorphologyElementType element, size_t sizeX, size_t sizeY);
+    const static SimdMorphologyInitPtr simdMorphologyInit = SIMD_FUNC4(MorphologyInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return simdMorphologyInit(width, height, channels, operation, element, sizeX, sizeY);
+}
+
+SIMD_API void SimdMorphologyRun(const void* context, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+    ((Morphology*)context)->Run(src, srcStride, dst, dstStride);
+}
+
 typedef void(*SimdGemm32fPtr) (size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc);
 
 SIMD_API void SimdGemm32fNN(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc)
@@ -2781,6 +2831,30 @@ SIMD_API SimdBool SimdImageSaveToFile(const uint8_t* src, size_t stride, size_t
     return ImageSaveToFile(imageSaveToMemory, src, stride, width, height, format, file, quality, path);
 }
 
+SIMD_API SimdBool SimdImageSaveToBuffer(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, uint8_t* dst, size_t capacity, size_t* size)
+{
+    SIMD_EMPTY();
+    const static Simd::ImageSaveToSinkPtr imageSaveToSink = SIMD_FUNC4(ImageSaveToSink, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return ImageSaveToBuffer(imageSaveToSink, src, stride, width, height, format, file, quality, dst, capacity, size);
+}
+
+SIMD_API SimdBool SimdImageSaveToSink(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, SimdImageWriteCallbackPtr callback, void* user)
+{
+    SIMD_EMPTY();
+    const static Simd::ImageSaveToSinkPtr imageSaveToSink = SIMD_FUNC4(ImageSaveToSink, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return imageSaveToSink(src, stride, width, height, format, file, quality, callback, user) ? SimdTrue : SimdFalse;
+}
+
+SIMD_API size_t SimdImageSaveBatchToMemory(SimdImageSaveItem* items, size_t count)
+{
+    SIMD_EMPTY();
+    const static Simd::ImageSaveToMemoryPtr imageSaveToMemory = SIMD_FUNC4(ImageSaveToMemory, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return ImageSaveBatchToMemory(imageSaveToMemory, items, count);
+}
+
 SIMD_API uint8_t* SimdNv12SaveAsJpegToMemory(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, SimdYuvType yuvType, int quality, size_t* size)
 {
     SIMD_EMPTY();
@@ -2817,6 +2891,89 @@ SIMD_API uint8_t* SimdImageLoadFromFile(const char* path, size_t* stride, size_t
     return ImageLoadFromFile(imageLoadFromMemory, path, stride, width, height, format);
 }
 
+SIMD_API uint8_t* SimdImageLoadFromMemoryScaled(const uint8_t* data, size_t size, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format)
+{
+    SIMD_EMPTY();
+    const static Simd::ImageLoadFromMemoryScaledPtr imageLoadFromMemoryScaled = SIMD_FUNC4(ImageLoadFromMemoryScaled, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return imageLoadFromMemoryScaled(data, size, scale, stride, width, height, format);
+}
+
+SIMD_API uint8_t* SimdImageLoadFromFileScaled(const char* path, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format)
+{
+    SIMD_EMPTY();
+    const static Simd::ImageLoadFromMemoryScaledPtr imageLoadFromMemoryScaled = SIMD_FUNC4(ImageLoadFromMemoryScaled, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return ImageLoadFromFileScaled(imageLoadFromMemoryScaled, path, scale, stride, width, height, format);
+}
+
+SIMD_API SimdBool SimdImageLoadBandsFromMemory(const uint8_t* data, size_t size, SimdPixelFormatType format, SimdImageBandCallbackPtr callback, void* user)
+{
+    SIMD_EMPTY();
+    const static Simd::ImageLoadBandsFromMemoryPtr imageLoadBandsFromMemory = SIMD_FUNC4(ImageLoadBandsFromMemory, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return imageLoadBandsFromMemory(data, size, format, callback, user) ? SimdTrue : SimdFalse;
+}
+
+SIMD_API uint8_t* SimdImageLoadRoiFromMemory(const uint8_t* data, size_t size, size_t left, size_t top, size_t right, size_t bottom, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format)
+{
+    SIMD_EMPTY();
+    const static Simd::ImageLoadRoiFromMemoryPtr imageLoadRoiFromMemory = SIMD_FUNC4(ImageLoadRoiFromMemory, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return imageLoadRoiFromMemory(data, size, left, top, right, bottom, stride, width, height, format);
+}
+
+SIMD_API SimdBool SimdImageLoadInfoFromMemory(const uint8_t* data, size_t size, SimdImageFileType* file, size_t* width, size_t* height, SimdPixelFormatType* format)
+{
+    SIMD_EMPTY();
+    return Base::ImageLoadInfoFromMemory(data, size, file, width, height, format) ? SimdTrue : SimdFalse;
+}
+
+SIMD_API SimdBool SimdImageLoadToBufferFromMemory(const uint8_t* data, size_t size, uint8_t* dst, size_t stride, size_t width, size_t height, SimdPixelFormatType format)
+{
+    SIMD_EMPTY();
+    const static Simd::ImageLoadBandsFromMemoryPtr imageLoadBandsFromMemory = SIMD_FUNC4(ImageLoadBandsFromMemory, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return ImageLoadToBuffer(imageLoadBandsFromMemory, data, size, dst, stride, width, height, format);
+}
+
+SIMD_API size_t SimdImageLoadBatchFromMemory(SimdImageLoadItem* items, size_t count, SimdResizeMethodType method)
+{
+    SIMD_EMPTY();
+    const static Simd::ImageLoadFromMemoryScaledPtr imageLoadFromMemoryScaled = SIMD_FUNC4(ImageLoadFromMemoryScaled, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+    const static Simd::ResizerInitPtr resizerInit = SIMD_FUNC4(ResizerInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return ImageLoadBatchFromMemory(imageLoadFromMemoryScaled, resizerInit, items, count, method);
+}
+
+SIMD_API void* SimdImageRawMapFile(const char* path, const uint8_t** data, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format)
+{
+    SIMD_EMPTY();
+    return Base::ImageRawMapFile(path, data, stride, width, height, format);
+}
+
+SIMD_API uint8_t* SimdJpegLoadAsYuvFromMemory(const uint8_t* data, size_t size, SimdYuvLayoutType layout, size_t* width, size_t* height, uint8_t** planes, size_t* strides)
+{
+    SIMD_EMPTY();
+    const static Simd::JpegLoadAsYuvFromMemoryPtr jpegLoadAsYuvFromMemory = SIMD_FUNC3(JpegLoadAsYuvFromMemory, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return jpegLoadAsYuvFromMemory(data, size, layout, width, height, planes, strides);
+}
+
+SIMD_API void* SimdJpegStreamDecoderInit(SimdPixelFormatType format, size_t frames)
+{
+    SIMD_EMPTY();
+    const static Simd::JpegStreamDecoderInitPtr jpegStreamDecoderInit = SIMD_FUNC3(JpegStreamDecoderInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return jpegStreamDecoderInit(format, frames);
+}
+
+SIMD_API const uint8_t* SimdJpegStreamDecoderDecode(void* context, const uint8_t* data, size_t size, size_t* stride, size_t* width, size_t* height)
+{
+    SIMD_EMPTY();
+    return ((Base::JpegStreamDecoder*)context)->Decode(data, size, stride, width, height);
+}
+
 SIMD_API void SimdInt16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride)
 {
     SIMD_EMPTY();
@@ -3175,6 +3332,15 @@ SIMD_API void SimdMedianFilterSquare5x5(const uint8_t * src, size_t srcStride, s
         Base::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
 }
 
+SIMD_API void SimdMedianFilterSquare(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, size_t radius, uint8_t * dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+    typedef void(*SimdMedianFilterSquarePtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, size_t radius, uint8_t * dst, size_t dstStride);
+    const static SimdMedianFilterSquarePtr simdMedianFilterSquare = SIMD_FUNC4(MedianFilterSquare, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    simdMedianFilterSquare(src, srcStride, width, height, channelCount, Simd::Min<size_t>(radius, 127), dst, dstStride);
+}
+
 SIMD_API void SimdNeuralConvert(const uint8_t * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride, int inversion)
 {
     SIMD_EMPTY();
@@ -3626,6 +3792,35 @@ SIMD_API void SimdNeuralConvolutionForward(const float * src, size_t srcWidth, s
     simdNeuralConvolutionForward(src, srcWidth, srcHeight, srcDepth, weight, kernelX, kernelY, padX, padY, strideX, strideY, dilationX, dilationY, buffer, size, dst, dstWidth, dstHeight, dstDepth, add);
 }
 
+SIMD_API void SimdNmsDecodeBoxes32f(const float * src, const float * anchors, size_t size, size_t stride, SimdBoxDecodeType type, const float * params, float * dst)
+{
+    SIMD_EMPTY();
+    typedef void(*SimdNmsDecodeBoxes32fPtr) (const float * src, const float * anchors, size_t size, size_t stride, SimdBoxDecodeType type, const float * params, float * dst);
+    const static SimdNmsDecodeBoxes32fPtr simdNmsDecodeBoxes32f = SIMD_FUNC3(NmsDecodeBoxes32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    simdNmsDecodeBoxes32f(src, anchors, size, stride, type, params, dst);
+}
+
+SIMD_API void SimdNmsIou32f(const float * boxes, size_t stride, size_t size, const float * box, float * iou)
+{
+    SIMD_EMPTY();
+    typedef void(*SimdNmsIou32fPtr) (const float * boxes, size_t stride, size_t size, const float * box, float * iou);
+    const static SimdNmsIou32fPtr simdNmsIou32f = SIMD_FUNC3(NmsIou32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    simdNmsIou32f(boxes, stride, size, box, iou);
+}
+
+SIMD_API size_t SimdNms32f(const float * boxes, size_t stride, const float * scores, const uint32_t * classes, size_t size, float scoreThreshold, size_t topK,
+    SimdNmsType type, float iouThreshold, float sigma, size_t keepTopK, uint32_t * indices, float * outScores)
+{
+    SIMD_EMPTY();
+    typedef size_t(*SimdNms32fPtr) (const float * boxes, size_t stride, const float * scores, const uint32_t * classes, size_t size, float scoreThreshold, size_t topK,
+        SimdNmsType type, float iouThreshold, float sigma, size_t keepTopK, uint32_t * indices, float * outScores);
+    const static SimdNms32fPtr simdNms32f = SIMD_FUNC3(Nms32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdNms32f(boxes, stride, scores, classes, size, scoreThreshold, topK, type, iouThreshold, sigma, keepTopK, indices, outScores);
+}
+
 SIMD_API void SimdOperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
                size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type)
 {
@@ -4079,6 +4274,17 @@ SIMD_API void SimdSegmentationFillSingleHoles(uint8_t * mask, size_t stride, siz
         Base::SegmentationFillSingleHoles(mask, stride, width, height, index);
 }
 
+SIMD_API size_t SimdSegmentationLabelComponents(const uint8_t * mask, size_t maskStride, size_t width, size_t height, uint8_t index,
+    SimdSegmentationConnectivityType connectivity, uint32_t * labels, size_t labelsStride, SimdSegmentationComponent ** components)
+{
+    SIMD_EMPTY();
+    typedef size_t(*SimdSegmentationLabelComponentsPtr) (const uint8_t * mask, size_t maskStride, size_t width, size_t height, uint8_t index,
+        SimdSegmentationConnectivityType connectivity, uint32_t * labels, size_t labelsStride, SimdSegmentationComponent ** components);
+    const static SimdSegmentationLabelComponentsPtr simdSegmentationLabelComponents = SIMD_FUNC4(SegmentationLabelComponents, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return simdSegmentationLabelComponents(mask, maskStride, width, height, index, connectivity, labels, labelsStride, components);
+}
+
 SIMD_API void SimdSegmentationPropagate2x2(const uint8_t * parent, size_t parentStride, size_t width, size_t height, 
                                            uint8_t * child, size_t childStride, const uint8_t * difference, size_t differenceStride, 
                                            uint8_t currentIndex, uint8_t invalidIndex, uint8_t emptyIndex, uint8_t differenceThreshold)
@@ -4328,6 +4534,15 @@ SIMD_API void SimdSobelDyAbsSum(const uint8_t * src, size_t stride, size_t width
         Base::SobelDyAbsSum(src, stride, width, height, sum);
 }
 
+SIMD_API void SimdCanny(const uint8_t * src, size_t srcStride, size_t width, size_t height, int lowThreshold, int highThreshold, uint8_t * dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+    typedef void(*SimdCannyPtr) (const uint8_t * src, size_t srcStride, size_t width, size_t height, int lowThreshold, int highThreshold, uint8_t * dst, size_t dstStride);
+    const static SimdCannyPtr simdCanny = SIMD_FUNC4(Canny, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    simdCanny(src, srcStride, width, height, lowThreshold, highThreshold, dst, dstStride);
+}
+
 SIMD_API void SimdContourMetrics(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
     SIMD_EMPTY();
@@ -4875,6 +5090,32 @@ SIMD_API void SimdSynetAdd8i(const uint8_t* aData, const float* aScale, const fl
 #endif
 }
 
+SIMD_API void SimdSynetArgMax32f(const float* src, size_t outer, size_t count, size_t inner, int32_t* dst)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void(*SimdSynetArgMax32fPtr) (const float* src, size_t outer, size_t count, size_t inner, int32_t* dst);
+    const static SimdSynetArgMax32fPtr simdSynetArgMax32f = SIMD_FUNC3(SynetArgMax32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    simdSynetArgMax32f(src, outer, count, inner, dst);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API void SimdSynetArgMin32f(const float* src, size_t outer, size_t count, size_t inner, int32_t* dst)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void(*SimdSynetArgMin32fPtr) (const float* src, size_t outer, size_t count, size_t inner, int32_t* dst);
+    const static SimdSynetArgMin32fPtr simdSynetArgMin32f = SIMD_FUNC3(SynetArgMin32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    simdSynetArgMin32f(src, outer, count, inner, dst);
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void SimdSynetChannelSum16b(const uint16_t* src, size_t channels, size_t spatial, SimdTensorFormatType format, float* sum)
 {
     SIMD_EMPTY();
@@ -5348,6 +5589,30 @@ SIMD_API void SimdSynetGridSample2dForward(void* context, const uint8_t* src, co
 #endif
 }
 
+SIMD_API void* SimdSynetGroupNorm16bInit(size_t batch, size_t channels, size_t spatial, size_t groups, SimdTensorDataType srcType, SimdTensorDataType dstType, SimdTensorFormatType format, float eps, SimdConvolutionActivationType activation)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void* (*SimdSynetGroupNorm16bInitPtr) (size_t batch, size_t channels, size_t spatial, size_t groups, SimdTensorDataType srcType, SimdTensorDataType dstType, SimdTensorFormatType format, float eps, SimdConvolutionActivationType activation);
+    const static SimdSynetGroupNorm16bInitPtr simdSynetGroupNorm16bInit = SIMD_FUNC3(SynetGroupNorm16bInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdSynetGroupNorm16bInit(batch, channels, spatial, groups, srcType, dstType, format, eps, activation);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API void SimdSynetGroupNorm16bForward(void* context, const uint8_t* src, const float* scale, const float* shift, const float* params, uint8_t* dst)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    ((SynetGroupNorm16b*)context)->Forward(src, scale, shift, params, dst);
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void SimdSynetHardSigmoid32f(const float* src, size_t size, const float* scale, const float* shift, float* dst)
 {
     SIMD_EMPTY();
@@ -5904,6 +6169,58 @@ SIMD_API void SimdSynetPreluLayerForward(const float * src, const float * slope,
 #endif
 }
 
+SIMD_API void* SimdSynetPreprocessInit(size_t srcW, size_t srcH, SimdPixelFormatType srcFormat, size_t dstW, size_t dstH, size_t channels,
+    SimdResizeMethodType method, const float* mean, const float* std, SimdTensorFormatType dstFormat, SimdTensorDataType dstType)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void* (*SimdSynetPreprocessInitPtr) (size_t srcW, size_t srcH, SimdPixelFormatType srcFormat, size_t dstW, size_t dstH, size_t channels,
+        SimdResizeMethodType method, const float* mean, const float* std, SimdTensorFormatType dstFormat, SimdTensorDataType dstType);
+    const static SimdSynetPreprocessInitPtr simdSynetPreprocessInit = SIMD_FUNC3(SynetPreprocessInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdSynetPreprocessInit(srcW, srcH, srcFormat, dstW, dstH, channels, method, mean, std, dstFormat, dstType);
+#else
+    assert(0);
+    return NULL;
+#endif
+}
+
+SIMD_API void SimdSynetPreprocessRun(const void* context, const uint8_t* src, size_t srcStride, uint8_t* dst)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    ((SynetPreprocess*)context)->Run(src, srcStride, dst);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API void* SimdSynetPreprocessYuv420Init(size_t srcW, size_t srcH, SimdYuvType yuvType, SimdBool nv12, SimdBool isRgb, size_t dstW, size_t dstH,
+    SimdResizeMethodType method, const float* mean, const float* std, SimdTensorFormatType dstFormat, SimdTensorDataType dstType)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void* (*SimdSynetPreprocessYuv420InitPtr) (size_t srcW, size_t srcH, SimdYuvType yuvType, SimdBool nv12, SimdBool isRgb, size_t dstW, size_t dstH,
+        SimdResizeMethodType method, const float* mean, const float* std, SimdTensorFormatType dstFormat, SimdTensorDataType dstType);
+    const static SimdSynetPreprocessYuv420InitPtr simdSynetPreprocessYuv420Init = SIMD_FUNC3(SynetPreprocessYuv420Init, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdSynetPreprocessYuv420Init(srcW, srcH, yuvType, nv12, isRgb, dstW, dstH, method, mean, std, dstFormat, dstType);
+#else
+    assert(0);
+    return NULL;
+#endif
+}
+
+SIMD_API void SimdSynetPreprocessYuv420Run(const void* context, const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, uint8_t* dst)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    ((SynetPreprocess*)context)->Run(y, yStride, u, uStride, v, vStride, dst);
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void* SimdSynetQuantizedAddInit(const size_t* aShape, size_t aCount, SimdTensorDataType aType, const float* aScale, int32_t aZero,
     const size_t* bShape, size_t bCount, SimdTensorDataType bType, const float* bScale, int32_t bZero,
     SimdConvolutionActivationType actType, const float* actParams, SimdTensorDataType dstType, const float* dstScale, int32_t dstZero)
@@ -6426,6 +6743,32 @@ SIMD_API void SimdSynetTiledScale2D32f(const float* src, size_t channels, size_t
 #endif
 }
 
+SIMD_API void SimdSynetTopK32f(const float* src, size_t outer, size_t count, size_t inner, size_t k, SimdBool largest, SimdBool sorted, float* dstVal, int32_t* dstIdx)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void(*SimdSynetTopK32fPtr) (const float* src, size_t outer, size_t count, size_t inner, size_t k, SimdBool largest, SimdBool sorted, float* dstVal, int32_t* dstIdx);
+    const static SimdSynetTopK32fPtr simdSynetTopK32f = SIMD_FUNC3(SynetTopK32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    simdSynetTopK32f(src, outer, count, inner, k, largest, sorted, dstVal, dstIdx);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API void SimdSynetTopK16b(const uint16_t* src, size_t outer, size_t count, size_t inner, size_t k, SimdBool largest, SimdBool sorted, uint16_t* dstVal, int32_t* dstIdx)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void(*SimdSynetTopK16bPtr) (const uint16_t* src, size_t outer, size_t count, size_t inner, size_t k, SimdBool largest, SimdBool sorted, uint16_t* dstVal, int32_t* dstIdx);
+    const static SimdSynetTopK16bPtr simdSynetTopK16b = SIMD_FUNC3(SynetTopK16b, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    simdSynetTopK16b(src, outer, count, inner, k, largest, sorted, dstVal, dstIdx);
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void SimdSynetUnaryOperation32f(const float* src, size_t size, SimdSynetUnaryOperation32fType type, float* dst)
 {
     SIMD_EMPTY();
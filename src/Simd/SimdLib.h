@@ -293,6 +293,77 @@ typedef enum
     SimdDetectionInfoCanInt16 = 8,
 } SimdDetectionInfoFlags;
 
+/*! @ingroup custom_filter
+    Describes channel type of images processed by custom filters (see ::SimdCustomFilterSeparableInit and ::SimdCustomFilter2dInit).
+*/
+typedef enum
+{
+    SimdFilterChannel8u = 0, /*!< 8-bit unsigned integer channel. Result is rounded to nearest and saturated to range [0..255]. */
+    SimdFilterChannel16u, /*!< 16-bit unsigned integer channel. Result is rounded to nearest and saturated to range [0..65535]. */
+    SimdFilterChannel32f, /*!< 32-bit float channel. */
+} SimdFilterChannelType;
+
+/*! @ingroup custom_filter
+    Describes how custom filters (see ::SimdCustomFilterSeparableInit and ::SimdCustomFilter2dInit) extrapolate pixels outside of the image.
+*/
+typedef enum
+{
+    SimdFilterBorderReplicate = 0, /*!< Edge pixels are repeated: aaa|abcd|ddd. */
+    SimdFilterBorderReflect, /*!< Pixels are reflected around edge pixels (without duplication): dcb|abcd|cba. */
+    SimdFilterBorderConstant, /*!< Pixels outside of the image are equal to zero: 000|abcd|000. */
+} SimdFilterBorderType;
+
+/*! @ingroup morphology_filter
+    Describes type of morphological operation (see ::SimdMorphologyInit).
+*/
+typedef enum
+{
+    SimdMorphologyErode = 0, /*!< Erosion: minimum over structuring element. */
+    SimdMorphologyDilate, /*!< Dilation: maximum over structuring element. */
+    SimdMorphologyOpen, /*!< Opening: erosion followed by dilation. */
+    SimdMorphologyClose, /*!< Closing: dilation followed by erosion. */
+    SimdMorphologyGradient, /*!< Morphological gradient: difference between dilation and erosion. */
+} SimdMorphologyOperationType;
+
+/*! @ingroup morphology_filter
+    Describes shape of structuring element of morphological operations (see ::SimdMorphologyInit).
+*/
+typedef enum
+{
+    SimdMorphologyElementRect = 0, /*!< Rectangle sizeX x sizeY. */
+    SimdMorphologyElementCross, /*!< Cross: the central row and the central column of rectangle sizeX x sizeY. */
+    SimdMorphologyElementEllipse, /*!< Ellipse inscribed into rectangle sizeX x sizeY. */
+} SimdMorphologyElementType;
+
+/*! @ingroup nms
+    Describes type of box decoding. It is used in function ::SimdNmsDecodeBoxes32f.
+*/
+typedef enum
+{
+    /*! SSD-like decoding: anchors are (cx, cy, w, h), input is (dx, dy, dw, dh), params are 4 variances:
+        cx = acx + dx * params[0] * aw, cy = acy + dy * params[1] * ah, w = aw * exp(dw * params[2]), h = ah * exp(dh * params[3]). */
+    SimdBoxDecodeCenterSize = 0,
+    /*! YOLOv3-like decoding: anchors are (gx, gy, aw, ah), input is (tx, ty, tw, th), params[0] is a grid stride:
+        cx = (sigmoid(tx) + gx) * params[0], cy = (sigmoid(ty) + gy) * params[0], w = aw * exp(tw), h = ah * exp(th). */
+    SimdBoxDecodeYoloV3,
+    /*! YOLOv5-like decoding: anchors are (gx, gy, aw, ah), input is (tx, ty, tw, th), params[0] is a grid stride:
+        cx = (2 * sigmoid(tx) - 0.5 + gx) * params[0], cy = (2 * sigmoid(ty) - 0.5 + gy) * params[0], w = aw * (2 * sigmoid(tw))^2, h = ah * (2 * sigmoid(th))^2. */
+    SimdBoxDecodeYoloV5,
+} SimdBoxDecodeType;
+
+/*! @ingroup nms
+    Describes type of non-maximum suppression. It is used in function ::SimdNms32f.
+*/
+typedef enum
+{
+    /*! Classic (hard) NMS: boxes with IoU greater than threshold are removed. */
+    SimdNmsHard = 0,
+    /*! Soft-NMS with linear decay: score of boxes with IoU greater than threshold is multiplied by (1 - IoU). */
+    SimdNmsSoftLinear,
+    /*! Soft-NMS with gaussian decay: score of all boxes is multiplied by exp(-IoU^2 / sigma). */
+    SimdNmsSoftGaussian,
+} SimdNmsType;
+
 /*! @ingroup synet_grid_sample
     Describes grid sample interpolation type. It is used in function ::SimdSynetGridSample2dInit.
 */
@@ -340,8 +411,48 @@ typedef enum
     SimdImageFileJpeg,
     /*! A BMP (BitMap Picture) image file format. */
     SimdImageFileBmp,
+    /*! A QOI (Quite OK Image) lossless image file format. */
+    SimdImageFileQoi,
+    /*! A Simd raw image file format: 64-byte header ("SIMDRAW\x1A" signature, then 32-bit little-endian pixel format, width, height, 
+        row stride and offset of pixel data) followed by rows of pixels aligned to 64 bytes. It can be memory-mapped (see ::SimdImageRawMapFile). */
+    SimdImageFileRaw,
 } SimdImageFileType;
 
+/*! @ingroup c_types
+    Describes options of JPEG encoder. They can be combined (by bitwise OR) with compression quality (from 1 to 100) 
+    in parameter quality of functions ::SimdImageSaveToMemory, ::SimdImageSaveToFile, ::SimdImageSaveToBuffer and ::SimdImageSaveToSink.
+    The quality is taken from the low byte: 0 selects default quality 90, values greater than 100 are clamped to 100. 
+    Encoding fails if any other bits besides quality and these options are set.
+*/
+typedef enum
+{
+    /*! Auto choice of chroma subsampling: 4:2:0 for quality lesser or equal to 90, 4:4:4 for greater quality. */
+    SimdJpegSamplingAuto = 0x000,
+    /*! Chroma subsampling 4:2:0 (chroma is reduced twice in both directions). */
+    SimdJpegSampling420 = 0x100,
+    /*! Chroma subsampling 4:2:2 (chroma is reduced twice in horizontal direction). */
+    SimdJpegSampling422 = 0x200,
+    /*! No chroma subsampling (4:4:4). */
+    SimdJpegSampling444 = 0x300,
+    /*! Two-pass encoding: gathers symbol statistics and writes optimal (image specific) Huffman tables. It reduces size of output file at cost of extra encoding time. */
+    SimdJpegOptimizeHuffman = 0x400,
+} SimdJpegOptionType;
+
+/*! @ingroup c_types
+    Describes layouts of planar YUV image. It is used in function ::SimdJpegLoadAsYuvFromMemory.
+*/
+typedef enum
+{
+    /*! 8-bit Y plane and 8-bit U and V planes with 2x2 subsampling. */
+    SimdYuvLayoutYuv420p = 0,
+    /*! 8-bit Y plane and interleaved 16-bit UV plane with 2x2 subsampling. */
+    SimdYuvLayoutNv12,
+    /*! 8-bit Y, U and V planes of full size. */
+    SimdYuvLayoutYuv444p,
+    /*! 8-bit Y plane only. */
+    SimdYuvLayoutGray8,
+} SimdYuvLayoutType;
+
 /*! @ingroup c_types
     Describes types of binary operation between two images performed by function ::SimdOperationBinary8u.
     Images must have the same format (unsigned 8-bit integer for every channel).
@@ -493,6 +604,15 @@ typedef enum
     SimdResizeMethodAreaFast,
 } SimdResizeMethodType;
 
+/*! @ingroup segmentation
+    Describes pixel connectivity used in function ::SimdSegmentationLabelComponents.
+*/
+typedef enum
+{
+    SimdSegmentationConnectivity4 = 4, /*!< Pixels are connected through their edges (4 neighbors). */
+    SimdSegmentationConnectivity8 = 8, /*!< Pixels are connected through their edges and corners (8 neighbors). */
+} SimdSegmentationConnectivityType;
+
 /*! @ingroup synet_types
     Describes Synet calculation compatibility flags. This type used in functions ::SimdSynetAdd8i, ::SimdSynetScaleLayerForward, 
     ::SimdSynetConvert32fTo8u, ::SimdSynetConvert8uTo32f, ::SimdSynetInnerProduct8i, ::SimdSynetScale8iInit,
@@ -733,6 +853,156 @@ typedef struct SimdConvolutionParameters
     SimdConvolutionActivationType activation;
 } SimdConvolutionParameters;
 
+/*! @ingroup image_io
+    Describes callback function which receives decoded image row bands. It is used in ::SimdImageLoadBandsFromMemory.
+
+    \param [in] user - a pointer to user defined data which was passed to ::SimdImageLoadBandsFromMemory.
+    \param [in] band - a pointer to pixels of the first row of current band. This buffer is owned by decoder (not by caller) and is valid only during callback call.
+        The callback has to copy or consume the rows before it returns.
+    \param [in] stride - a row size of current band in bytes.
+    \param [in] width - a width of the whole image.
+    \param [in] height - a height of the whole image.
+    \param [in] row - an index of the first row of current band in the whole image.
+    \param [in] rows - a number of rows in current band.
+    \param [in] format - a pixel format of output image.
+    \return ::SimdTrue to continue decoding or ::SimdFalse to abort it.
+*/
+typedef SimdBool(*SimdImageBandCallbackPtr)(void* user, const uint8_t* band, size_t stride, size_t width, size_t height, size_t row, size_t rows, SimdPixelFormatType format);
+
+/*! @ingroup image_io
+    Describes callback function which receives encoded image file. It is used in ::SimdImageSaveToSink.
+
+    \param [in] user - a pointer to user defined data which was passed to ::SimdImageSaveToSink.
+    \param [in] data - a pointer to the next part of output image file. This buffer is owned by encoder and is valid only during callback call.
+    \param [in] size - a size of the part in bytes.
+    \return ::SimdTrue on success or ::SimdFalse to abort saving.
+*/
+typedef SimdBool(*SimdImageWriteCallbackPtr)(void* user, const uint8_t* data, size_t size);
+
+/*! @ingroup image_io
+    Describes an item of batch image loading. It is used in ::SimdImageLoadBatchFromMemory.
+*/
+typedef struct SimdImageLoadItem
+{
+    /*!
+        A pointer to memory buffer with input image file.
+    */
+    const uint8_t* data;
+    /*!
+        A size of input image file in bytes.
+    */
+    size_t size;
+    /*!
+        A pixel format of output image (input and output parameter). 
+        It can be ::SimdPixelFormatGray8, ::SimdPixelFormatBgr24, ::SimdPixelFormatBgra32, ::SimdPixelFormatRgb24, ::SimdPixelFormatRgba32.
+        Or set ::SimdPixelFormatNone and use pixel format of input image file.
+    */
+    SimdPixelFormatType format;
+    /*!
+        A width of output image (input and output parameter). Set 0 to keep original width (or to keep aspect ratio if height is not 0).
+    */
+    size_t width;
+    /*!
+        A height of output image (input and output parameter). Set 0 to keep original height (or to keep aspect ratio if width is not 0).
+    */
+    size_t height;
+    /*!
+        A row size of output image in bytes (output parameter).
+    */
+    size_t stride;
+    /*!
+        A pointer to pixels data of output image (output parameter). It has to be deleted after use by function ::SimdFree.
+    */
+    uint8_t* image;
+    /*!
+        A result of the loading of the item (output parameter).
+    */
+    SimdBool status;
+} SimdImageLoadItem;
+
+/*! @ingroup image_io
+    Describes an item of batch image saving. It is used in ::SimdImageSaveBatchToMemory.
+*/
+typedef struct SimdImageSaveItem
+{
+    /*!
+        A pointer to pixels data of input image.
+    */
+    const uint8_t* image;
+    /*!
+        A row size of input image in bytes.
+    */
+    size_t stride;
+    /*!
+        A width of input image.
+    */
+    size_t width;
+    /*!
+        A height of input image.
+    */
+    size_t height;
+    /*!
+        A pixel format of input image. 
+        Supported pixel formats: ::SimdPixelFormatGray8, ::SimdPixelFormatBgr24, ::SimdPixelFormatBgra32, ::SimdPixelFormatRgb24, ::SimdPixelFormatRgba32.
+    */
+    SimdPixelFormatType format;
+    /*!
+        A format of output image file.
+    */
+    SimdImageFileType file;
+    /*!
+        A parameter of compression quality (if file format supports it). For JPEG format it can be combined with options ::SimdJpegOptionType.
+    */
+    int quality;
+    /*!
+        A pointer to memory buffer with output image file (output parameter). It has to be deleted after use by function ::SimdFree.
+    */
+    uint8_t* data;
+    /*!
+        A size of output image file in bytes (output parameter).
+    */
+    size_t size;
+    /*!
+        A result of the saving of the item (output parameter).
+    */
+    SimdBool status;
+} SimdImageSaveItem;
+
+/*! @ingroup segmentation
+    Describes statistics of connected component. It is used in ::SimdSegmentationLabelComponents.
+*/
+typedef struct SimdSegmentationComponent
+{
+    /*!
+        A number of pixels in the component.
+    */
+    size_t area;
+    /*!
+        A left side of bounding box of the component.
+    */
+    ptrdiff_t left;
+    /*!
+        A top side of bounding box of the component.
+    */
+    ptrdiff_t top;
+    /*!
+        A right side of bounding box of the component (exclusive).
+    */
+    ptrdiff_t right;
+    /*!
+        A bottom side of bounding box of the component (exclusive).
+    */
+    ptrdiff_t bottom;
+    /*!
+        X coordinate of centroid of the component.
+    */
+    float x;
+    /*!
+        Y coordinate of centroid of the component.
+    */
+    float y;
+} SimdSegmentationComponent;
+
 #if defined(_WIN32) && !defined(SIMD_STATIC)
 #  ifdef SIMD_EXPORTS
 #    define SIMD_API __declspec(dllexport)
@@ -3388,6 +3658,127 @@ extern "C"
     */
     SIMD_API void SimdGaussianBlurRun(const void* filter, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
 
+    /*! @ingroup custom_filter
+
+        \fn void * SimdCustomFilterSeparableInit(size_t width, size_t height, size_t channels, SimdFilterChannelType type, const float* kernelX, size_t sizeX, const float* kernelY, size_t sizeY, SimdFilterBorderType border);
+
+        \short Creates context of image filter with arbitrary separable kernel.
+
+        The filter is applied to every channel independently. Its anchor is placed at the kernel center (sizeX/2, sizeY/2):
+        \verbatim
+        for(y = 0; y < sizeY; ++y)
+            for(x = 0; x < sizeX; ++x)
+                sum += kernelY[y] * kernelX[x] * src[dx + x - sizeX/2, dy + y - sizeY/2];
+        dst[dx, dy] = sum;
+        \endverbatim
+        Box filter of any size is a particular case of this filter (kernelX[x] = 1/sizeX, kernelY[y] = 1/sizeY).
+
+        \param [in] width - a width of input and output image.
+        \param [in] height - a height of input and output image.
+        \param [in] channels - a channel number of input and output image. Its value must be in range [1..4].
+        \param [in] type - a type of image channels.
+        \param [in] kernelX - a pointer to horizontal kernel coefficients. It is copied into the filter context.
+        \param [in] sizeX - a size of horizontal kernel. It must be greater than 0.
+        \param [in] kernelY - a pointer to vertical kernel coefficients. It is copied into the filter context.
+        \param [in] sizeY - a size of vertical kernel. It must be greater than 0.
+        \param [in] border - a type of border extrapolation.
+        \return a pointer to filter context. On error it returns NULL.
+                This pointer is used in functions ::SimdCustomFilterRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void* SimdCustomFilterSeparableInit(size_t width, size_t height, size_t channels, SimdFilterChannelType type,
+        const float* kernelX, size_t sizeX, const float* kernelY, size_t sizeY, SimdFilterBorderType border);
+
+    /*! @ingroup custom_filter
+
+        \fn void * SimdCustomFilter2dInit(size_t width, size_t height, size_t channels, SimdFilterChannelType type, const float* kernel, size_t sizeX, size_t sizeY, SimdFilterBorderType border);
+
+        \short Creates context of image filter with arbitrary (non-separable) 2D kernel.
+
+        The filter is applied to every channel independently. Its anchor is placed at the kernel center (sizeX/2, sizeY/2):
+        \verbatim
+        for(y = 0; y < sizeY; ++y)
+            for(x = 0; x < sizeX; ++x)
+                sum += kernel[y * sizeX + x] * src[dx + x - sizeX/2, dy + y - sizeY/2];
+        dst[dx, dy] = sum;
+        \endverbatim
+
+        \note It is intended for small kernels. Use ::SimdCustomFilterSeparableInit for separable kernels.
+
+        \param [in] width - a width of input and output image.
+        \param [in] height - a height of input and output image.
+        \param [in] channels - a channel number of input and output image. Its value must be in range [1..4].
+        \param [in] type - a type of image channels.
+        \param [in] kernel - a pointer to kernel coefficients (row-major order, sizeX * sizeY values). It is copied into the filter context.
+        \param [in] sizeX - a width of the kernel. It must be greater than 0.
+        \param [in] sizeY - a height of the kernel. It must be greater than 0.
+        \param [in] border - a type of border extrapolation.
+        \return a pointer to filter context. On error it returns NULL.
+                This pointer is used in functions ::SimdCustomFilterRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void* SimdCustomFilter2dInit(size_t width, size_t height, size_t channels, SimdFilterChannelType type,
+        const float* kernel, size_t sizeX, size_t sizeY, SimdFilterBorderType border);
+
+    /*! @ingroup custom_filter
+
+        \fn void SimdCustomFilterRun(const void* filter, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
+        \short Performs image filtering with custom kernel.
+
+        \note Input and output images must not overlap. Image rows are processed in parallel (see ::SimdSetThreadNumber).
+            Integer outputs are saturated and rounded half up. AVX2 and AVX-512BW implementations use FMA, 
+            so their integer outputs can differ from other implementations by 1 at rounding boundaries.
+
+        \param [in] filter - a filter context. It must be created by function ::SimdCustomFilterSeparableInit or ::SimdCustomFilter2dInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the original input image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [out] dst - a pointer to pixels data of the filtered output image.
+        \param [in] dstStride - a row size (in bytes) of the output image.
+    */
+    SIMD_API void SimdCustomFilterRun(const void* filter, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
+    /*! @ingroup morphology_filter
+
+        \fn void * SimdMorphologyInit(size_t width, size_t height, size_t channels, SimdMorphologyOperationType operation, SimdMorphologyElementType element, size_t sizeX, size_t sizeY);
+
+        \short Creates context of morphological operation (erosion, dilation, opening, closing or gradient) for 8-bit images.
+
+        The operation is applied to every channel independently. The anchor of structuring element is placed at its center (sizeX/2, sizeY/2).
+        Pixels outside of the image are ignored (so erosion and dilation near edges use only the part of structuring element lying inside the image).
+        Rectangular elements are processed with using of van Herk/Gil-Werman algorithm, its cost does not depend on element size.
+        Cross and elliptical elements are decomposed into union of rectangles.
+
+        \param [in] width - a width of input and output image.
+        \param [in] height - a height of input and output image.
+        \param [in] channels - a channel number of input and output image. Its value must be in range [1..4].
+        \param [in] operation - a type of morphological operation.
+        \param [in] element - a shape of structuring element.
+        \param [in] sizeX - a width of structuring element. It must be greater than 0.
+        \param [in] sizeY - a height of structuring element. It must be greater than 0.
+        \return a pointer to operation context. On error it returns NULL.
+                This pointer is used in functions ::SimdMorphologyRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void* SimdMorphologyInit(size_t width, size_t height, size_t channels, SimdMorphologyOperationType operation,
+        SimdMorphologyElementType element, size_t sizeX, size_t sizeY);
+
+    /*! @ingroup morphology_filter
+
+        \fn void SimdMorphologyRun(const void* context, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
+        \short Performs morphological operation.
+
+        \note Input and output images must not overlap. Image rows are processed in parallel (see ::SimdSetThreadNumber).
+
+        \param [in] context - an operation context. It must be created by function ::SimdMorphologyInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the original input image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [out] dst - a pointer to pixels data of the output image.
+        \param [in] dstStride - a row size (in bytes) of the output image.
+    */
+    SIMD_API void SimdMorphologyRun(const void* context, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
     /*! @ingroup matrix
 
         \fn void SimdGemm32fNN(size_t M, size_t N, size_t K, const float * alpha, const float * A, size_t lda, const float * B, size_t ldb, const float * beta, float * C, size_t ldc);
@@ -3760,7 +4151,8 @@ extern "C"
         \param [in] format - a pixel format of input image. 
             Supported pixel formats: ::SimdPixelFormatGray8, ::SimdPixelFormatBgr24, ::SimdPixelFormatBgra32, ::SimdPixelFormatRgb24, ::SimdPixelFormatRgba32.
         \param [in] file - a format of output image file. To auto choise format of output file set this parameter to ::SimdImageFileUndefined.
-        \param [in] quality - a parameter of compression quality (if file format supports it).
+        \param [in] quality - a parameter of compression quality (if file format supports it). For PNG format it selects speed/size trade-off: values from 1 to 10 use fast RLE compression, greater values use deeper search of matches.
+            For JPEG format it can be combined with options ::SimdJpegOptionType.
         \param [out] size - a pointer to the size of output image file in bytes.
         \return a pointer to memory buffer with output image file. 
             It has to be deleted after use by function ::SimdFree. On error it returns NULL.
@@ -3782,12 +4174,77 @@ extern "C"
         \param [in] format - a pixel format of input image. 
             Supported pixel formats: ::SimdPixelFormatGray8, ::SimdPixelFormatBgr24, ::SimdPixelFormatBgra32, ::SimdPixelFormatRgb24, ::SimdPixelFormatRgba32.
         \param [in] file - a format of output image file. To auto choise format of output file set this parameter to ::SimdImageFileUndefined.
-        \param [in] quality - a parameter of compression quality (if file format supports it).
+        \param [in] quality - a parameter of compression quality (if file format supports it). For PNG format it selects speed/size trade-off: values from 1 to 10 use fast RLE compression, greater values use deeper search of matches.
+            For JPEG format it can be combined with options ::SimdJpegOptionType.
         \param [in] path - a path to output image file.
         \return result of the operation.
     */
     SIMD_API SimdBool SimdImageSaveToFile(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, const char * path);
 
+    /*! @ingroup image_io
+
+        \fn SimdBool SimdImageSaveToBuffer(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, uint8_t* dst, size_t capacity, size_t* size);
+
+        \short Saves an image to user provided memory buffer in given image file format.
+
+        Unlike ::SimdImageSaveToMemory it does not allocate output buffer: encoder uses internal thread local memory stream 
+        which capacity is reused in subsequent calls in the same thread.
+
+        \param [in] src - a pointer to pixels data of input image.
+        \param [in] stride - a row size of input image in bytes.
+        \param [in] width - a width of input image.
+        \param [in] height - a height of input image.
+        \param [in] format - a pixel format of input image. 
+            Supported pixel formats: ::SimdPixelFormatGray8, ::SimdPixelFormatBgr24, ::SimdPixelFormatBgra32, ::SimdPixelFormatRgb24, ::SimdPixelFormatRgba32.
+        \param [in] file - a format of output image file. To auto choise format of output file set this parameter to ::SimdImageFileUndefined.
+        \param [in] quality - a parameter of compression quality (if file format supports it). For JPEG format it can be combined with options ::SimdJpegOptionType.
+        \param [out] dst - a pointer to output memory buffer.
+        \param [in] capacity - a size of output memory buffer in bytes.
+        \param [out] size - a pointer to the size of output image file in bytes. 
+            If capacity of output buffer is not enough it contains required size of the buffer. On encoding error it is set to 0.
+        \return result of the operation. It is ::SimdFalse on encoding error or if output buffer is too small.
+    */
+    SIMD_API SimdBool SimdImageSaveToBuffer(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, uint8_t* dst, size_t capacity, size_t* size);
+
+    /*! @ingroup image_io
+
+        \fn SimdBool SimdImageSaveToSink(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, SimdImageWriteCallbackPtr callback, void* user);
+
+        \short Saves an image in given image file format and passes output file to user callback.
+
+        Encoder uses internal thread local memory stream which capacity is reused in subsequent calls in the same thread, 
+        so there is no allocation of output buffer in steady state.
+
+        \param [in] src - a pointer to pixels data of input image.
+        \param [in] stride - a row size of input image in bytes.
+        \param [in] width - a width of input image.
+        \param [in] height - a height of input image.
+        \param [in] format - a pixel format of input image. 
+            Supported pixel formats: ::SimdPixelFormatGray8, ::SimdPixelFormatBgr24, ::SimdPixelFormatBgra32, ::SimdPixelFormatRgb24, ::SimdPixelFormatRgba32.
+        \param [in] file - a format of output image file. To auto choise format of output file set this parameter to ::SimdImageFileUndefined.
+        \param [in] quality - a parameter of compression quality (if file format supports it). For JPEG format it can be combined with options ::SimdJpegOptionType.
+        \param [in] callback - a pointer to callback function which receives output image file (see ::SimdImageWriteCallbackPtr).
+        \param [in] user - a pointer to user defined data which is passed to callback.
+        \return result of the operation. It is ::SimdFalse on encoding error or if callback returns ::SimdFalse.
+    */
+    SIMD_API SimdBool SimdImageSaveToSink(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, SimdImageWriteCallbackPtr callback, void* user);
+
+    /*! @ingroup image_io
+
+        \fn size_t SimdImageSaveBatchToMemory(SimdImageSaveItem* items, size_t count);
+
+        \short Saves a batch of images to memory buffers in given image file formats.
+
+        Items are distributed between worker threads (its number is set by ::SimdSetThreadNumber). 
+        Each item is encoded in single thread so nested parallelism of encoders is disabled.
+
+        \param [in, out] items - a pointer to array of items (see ::SimdImageSaveItem). 
+            Output buffers of items have to be deleted after use by function ::SimdFree.
+        \param [in] count - a number of items.
+        \return a number of successfully saved items.
+    */
+    SIMD_API size_t SimdImageSaveBatchToMemory(SimdImageSaveItem* items, size_t count);
+
     /*! @ingroup image_io
 
         \fn uint8_t* SimdNv12SaveAsJpegToMemory(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, SimdYuvType yuvType, int quality, size_t* size);
@@ -3801,7 +4258,7 @@ extern "C"
         \param [in] width - a width of input image. It must be even number.
         \param [in] height - a height of input image. It must be even number.
         \param [in] yuvType - a type of input YUV image(see descriprion of::SimdYuvType). Now only ::SimdYuvTrect871 (T-REC-T.871 format) is supported.
-        \param [in] quality - a parameter of compression quality.
+        \param [in] quality - a parameter of compression quality. It can be combined with option ::SimdJpegOptimizeHuffman.
         \param [out] size - a pointer to the size of output image file in bytes.
         \return a pointer to memory buffer with output image file.
             It has to be deleted after use by function ::SimdFree. On error it returns NULL.
@@ -3823,7 +4280,7 @@ extern "C"
         \param [in] width - a width of input image. It must be even number.
         \param [in] height - a height of input image. It must be even number.
         \param [in] yuvType - a type of input YUV image(see descriprion of::SimdYuvType). Now only ::SimdYuvTrect871 (T-REC-T.871 format) is supported.
-        \param [in] quality - a parameter of compression quality.
+        \param [in] quality - a parameter of compression quality. It can be combined with option ::SimdJpegOptimizeHuffman.
         \param [out] size - a pointer to the size of output image file in bytes.
         \return a pointer to memory buffer with output image file.
             It has to be deleted after use by function ::SimdFree. On error it returns NULL.
@@ -3872,6 +4329,244 @@ extern "C"
     */
     SIMD_API uint8_t* SimdImageLoadFromFile(const char* path, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType * format);
 
+    /*! @ingroup image_io
+
+        \fn uint8_t* SimdImageLoadFromMemoryScaled(const uint8_t* data, size_t size, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType * format);
+
+        \short Loads an image from memory buffer with reduction of its size.
+
+        JPEG images are decoded directly to reduced size with using of reduced size IDCT (4x4, 2x2 or 1x1 instead of 8x8).
+        It is much faster then decoding of full size image and its subsequent resizing.
+        Output image has size ((width + scale - 1) / scale, (height + scale - 1) / scale), where width and height are sizes of original image.
+        Images in other file formats are loaded in original size.
+
+        \param [in] data - a pointer to memory buffer with input image file.
+        \param [in] size - a size of input image file in bytes.
+        \param [in] scale - a denominator of image size reduction. It can be 1, 2, 4 or 8.
+        \param [out] stride - a pointer to row size of output image in bytes.
+        \param [out] width - a pointer to width of output image.
+        \param [out] height - a pointer to height of output image.
+        \param [in, out] format - a pointer to pixel format of output image.
+            Here you can set desired pixel format (it can be ::SimdPixelFormatGray8, ::SimdPixelFormatBgr24, ::SimdPixelFormatBgra32, ::SimdPixelFormatRgb24, ::SimdPixelFormatRgba32).
+            Or set ::SimdPixelFormatNone and use pixel format of input image file.
+        \return a pointer to pixels data of output image.
+            It has to be deleted after use by function ::SimdFree. On error it returns NULL.
+    */
+    SIMD_API uint8_t* SimdImageLoadFromMemoryScaled(const uint8_t* data, size_t size, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType * format);
+
+    /*! @ingroup image_io
+
+        \fn uint8_t* SimdImageLoadFromFileScaled(const char* path, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType * format);
+
+        \short Loads an image from file with reduction of its size.
+
+        JPEG images are decoded directly to reduced size (see ::SimdImageLoadFromMemoryScaled).
+        Images in other file formats are loaded in original size.
+
+        \param [in] path - a path to input image file.
+        \param [in] scale - a denominator of image size reduction. It can be 1, 2, 4 or 8.
+        \param [out] stride - a pointer to row size of output image in bytes.
+        \param [out] width - a pointer to width of output image.
+        \param [out] height - a pointer to height of output image.
+        \param [in, out] format - a pointer to pixel format of output image.
+            Here you can set desired pixel format (it can be ::SimdPixelFormatGray8, ::SimdPixelFormatBgr24, ::SimdPixelFormatBgra32, ::SimdPixelFormatRgb24, ::SimdPixelFormatRgba32).
+            Or set ::SimdPixelFormatNone and use pixel format of input image file.
+        \return a pointer to pixels data of output image.
+            It has to be deleted after use by function ::SimdFree. On error it returns NULL.
+    */
+    SIMD_API uint8_t* SimdImageLoadFromFileScaled(const char* path, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType * format);
+
+    /*! @ingroup image_io
+
+        \fn SimdBool SimdImageLoadBandsFromMemory(const uint8_t* data, size_t size, SimdPixelFormatType format, SimdImageBandCallbackPtr callback, void* user);
+
+        \short Loads an image from memory buffer by horizontal bands of rows.
+
+        Decoded image is passed to user callback band by band from top to bottom. It allows to process very large images (for example decode, resize and encode them)
+        without allocation of memory for the whole output image. Baseline JPEG images are decoded by MCU rows with using of sliding window instead of full component planes.
+        Not interlaced PNG images are unfiltered, expanded and converted by bands of scanlines. Images in other file formats (and progressive JPEG, interlaced PNG) 
+        are decoded in full and then passed to callback by bands.
+
+        \note Bands are written to a buffer owned by decoder, not to a buffer of caller: JPEG 4:2:0 color conversion writes a margin of rows 
+            around each band, so it can't target exact band of user memory. The callback gets a read-only pointer to the band which is valid only 
+            during the call. Use ::SimdImageLoadToBufferFromMemory to decode an image into caller owned memory.
+
+        \param [in] data - a pointer to memory buffer with input image file.
+        \param [in] size - a size of input image file in bytes.
+        \param [in] format - a desired pixel format of output image. It can be ::SimdPixelFormatGray8, ::SimdPixelFormatBgr24, ::SimdPixelFormatBgra32, ::SimdPixelFormatRgb24, ::SimdPixelFormatRgba32.
+            Or set ::SimdPixelFormatNone and use pixel format of input image file.
+        \param [in] callback - a pointer to callback function which receives decoded bands (see ::SimdImageBandCallbackPtr).
+        \param [in] user - a pointer to user defined data which is passed to callback.
+        \return result of the operation. It is ::SimdFalse on decoding error or if callback has aborted decoding.
+    */
+    SIMD_API SimdBool SimdImageLoadBandsFromMemory(const uint8_t* data, size_t size, SimdPixelFormatType format, SimdImageBandCallbackPtr callback, void* user);
+
+    /*! @ingroup image_io
+
+        \fn uint8_t* SimdImageLoadRoiFromMemory(const uint8_t* data, size_t size, size_t left, size_t top, size_t right, size_t bottom, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        \short Loads a rectangular region of interest (ROI) of an image from memory buffer.
+
+        For JPEG images IDCT and color conversion are performed only for MCUs which intersect the ROI. Entropy decoding stops after the last MCU row of the ROI, 
+        and restart intervals which do not intersect the ROI are skipped without Huffman decoding (if the image has restart markers). 
+        Decoded component buffers hold only the MCU rows of the ROI, but they keep full image width. 
+        Progressive JPEG still keeps DCT coefficients of the whole image.
+        AVX2 implementation decodes JPEG in full and then crops it, so that its result matches its full image decoder.
+        Images in other file formats are decoded in full and then cropped.
+
+        \param [in] data - a pointer to memory buffer with input image file.
+        \param [in] size - a size of input image file in bytes.
+        \param [in] left - a left side of the ROI (inclusive).
+        \param [in] top - a top side of the ROI (inclusive).
+        \param [in] right - a right side of the ROI (exclusive). It must be not greater than image width.
+        \param [in] bottom - a bottom side of the ROI (exclusive). It must be not greater than image height.
+        \param [out] stride - a pointer to row size of output image in bytes.
+        \param [out] width - a pointer to width of output image (it is equal to right - left).
+        \param [out] height - a pointer to height of output image (it is equal to bottom - top).
+        \param [in, out] format - a pointer to pixel format of output image.
+            Here you can set desired pixel format (it can be ::SimdPixelFormatGray8, ::SimdPixelFormatBgr24, ::SimdPixelFormatBgra32, ::SimdPixelFormatRgb24, ::SimdPixelFormatRgba32).
+            Or set ::SimdPixelFormatNone and use pixel format of input image file.
+        \return a pointer to pixels data of output image.
+            It has to be deleted after use by function ::SimdFree. On error (including wrong ROI) it returns NULL.
+    */
+    SIMD_API uint8_t* SimdImageLoadRoiFromMemory(const uint8_t* data, size_t size, size_t left, size_t top, size_t right, size_t bottom, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+    /*! @ingroup image_io
+
+        \fn SimdBool SimdImageLoadInfoFromMemory(const uint8_t* data, size_t size, SimdImageFileType* file, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        \short Gets file format, size and native pixel format of an image in memory buffer. Only image header is parsed.
+
+        \param [in] data - a pointer to memory buffer with input image file.
+        \param [in] size - a size of input image file in bytes.
+        \param [out] file - a pointer to format of input image file. Can be NULL.
+        \param [out] width - a pointer to width of the image. Can be NULL.
+        \param [out] height - a pointer to height of the image. Can be NULL.
+        \param [out] format - a pointer to pixel format of output image which is used by image loading functions for ::SimdPixelFormatNone. Can be NULL.
+        \return result of the operation.
+    */
+    SIMD_API SimdBool SimdImageLoadInfoFromMemory(const uint8_t* data, size_t size, SimdImageFileType* file, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+    /*! @ingroup image_io
+
+        \fn SimdBool SimdImageLoadToBufferFromMemory(const uint8_t* data, size_t size, uint8_t* dst, size_t stride, size_t width, size_t height, SimdPixelFormatType format);
+
+        \short Loads an image from memory buffer to user provided output image.
+
+        Image sizes can be got in advance with using of ::SimdImageLoadInfoFromMemory. The image is decoded by bands (see ::SimdImageLoadBandsFromMemory) 
+        so baseline JPEG and not interlaced PNG images are loaded without allocation of memory for the whole image.
+
+        \param [in] data - a pointer to memory buffer with input image file.
+        \param [in] size - a size of input image file in bytes.
+        \param [out] dst - a pointer to pixels data of output image.
+        \param [in] stride - a row size of output image in bytes.
+        \param [in] width - a width of output image. It must be equal to width of input image.
+        \param [in] height - a height of output image. It must be equal to height of input image.
+        \param [in] format - a pixel format of output image. It can be ::SimdPixelFormatGray8, ::SimdPixelFormatBgr24, ::SimdPixelFormatBgra32, ::SimdPixelFormatRgb24, ::SimdPixelFormatRgba32.
+            Or set ::SimdPixelFormatNone and use pixel format of input image file.
+        \return result of the operation. It is ::SimdFalse on decoding error or if sizes of output image do not match the image file.
+    */
+    SIMD_API SimdBool SimdImageLoadToBufferFromMemory(const uint8_t* data, size_t size, uint8_t* dst, size_t stride, size_t width, size_t height, SimdPixelFormatType format);
+
+    /*! @ingroup image_io
+
+        \fn size_t SimdImageLoadBatchFromMemory(SimdImageLoadItem* items, size_t count, SimdResizeMethodType method);
+
+        \short Loads a batch of images from memory buffers and optionally resizes them to given sizes.
+
+        Items are distributed between worker threads (its number is set by ::SimdSetThreadNumber). 
+        If output size of item differs from size of image file then JPEG image is decoded with the largest DCT downscale (2, 4 or 8, see ::SimdImageLoadFromMemoryScaled) 
+        which keeps the decoded image at least twice as large as the required size in both directions. 
+        After that the image is resized to required size with using of ::SimdResizerInit.
+
+        \param [in, out] items - a pointer to array of items (see ::SimdImageLoadItem). 
+            Output images of items have to be deleted after use by function ::SimdFree.
+        \param [in] count - a number of items.
+        \param [in] method - a method of image resizing (see ::SimdResizeMethodType). Only methods compatible with ::SimdResizeChannelByte are supported.
+        \return a number of successfully loaded items.
+    */
+    SIMD_API size_t SimdImageLoadBatchFromMemory(SimdImageLoadItem* items, size_t count, SimdResizeMethodType method);
+
+    /*! @ingroup image_io
+
+        \fn void* SimdImageRawMapFile(const char* path, const uint8_t** data, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+        \short Maps image file in ::SimdImageFileRaw format to memory (read only) without copying of pixels data.
+
+        Pixels data stays valid until the mapping is released by function ::SimdRelease.
+
+        \param [in] path - a path to input image file (in ::SimdImageFileRaw format).
+        \param [out] data - a pointer to pixels data of the mapped image.
+        \param [out] stride - a pointer to row size of the mapped image in bytes (it is aligned to 64 bytes).
+        \param [out] width - a pointer to width of the mapped image.
+        \param [out] height - a pointer to height of the mapped image.
+        \param [out] format - a pointer to pixel format of the mapped image.
+        \return a pointer to the file mapping context. On error it returns NULL. 
+            It has to be released after use by function ::SimdRelease.
+    */
+    SIMD_API void* SimdImageRawMapFile(const char* path, const uint8_t** data, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format);
+
+    /*! @ingroup image_io
+
+        \fn uint8_t* SimdJpegLoadAsYuvFromMemory(const uint8_t* data, size_t size, SimdYuvLayoutType layout, size_t* width, size_t* height, uint8_t** planes, size_t* strides);
+
+        \short Loads JPEG image from memory buffer to planar YUV image (T-REC-T.871 format, see ::SimdYuvTrect871).
+
+        Y, Cb and Cr planes are taken directly from IDCT output without color conversion. Chroma planes are copied as is if JPEG subsampling matches 
+        requested layout, otherwise they are resampled (averaging for reduction and replication for enlargement). For ::SimdYuvLayoutGray8 IDCT of chroma 
+        components is skipped. Grayscale JPEG images have constant chroma planes (128). RGB and CMYK JPEG images are converted to YUV.
+        All planes are placed in one memory buffer.
+
+        \param [in] data - a pointer to memory buffer with input JPEG image file.
+        \param [in] size - a size of input image file in bytes.
+        \param [in] layout - a layout of output YUV image (see ::SimdYuvLayoutType).
+        \param [out] width - a pointer to width of output image.
+        \param [out] height - a pointer to height of output image.
+        \param [out] planes - a pointer to array of 3 pointers to output planes: Y, U (UV for NV12) and V. Unused planes are set to NULL.
+            Chroma planes with 2x2 subsampling have size ((width + 1) / 2, (height + 1) / 2).
+        \param [out] strides - a pointer to array of 3 row sizes of output planes in bytes.
+        \return a pointer to memory buffer with all planes (it is equal to pointer to Y plane). 
+            It has to be deleted after use by function ::SimdFree. On error it returns NULL.
+    */
+    SIMD_API uint8_t* SimdJpegLoadAsYuvFromMemory(const uint8_t* data, size_t size, SimdYuvLayoutType layout, size_t* width, size_t* height, uint8_t** planes, size_t* strides);
+
+    /*! @ingroup image_io
+
+        \fn void* SimdJpegStreamDecoderInit(SimdPixelFormatType format, size_t frames);
+
+        \short Creates persistent decoder of stream of JPEG frames (for example MJPEG stream of IP camera).
+
+        The decoder keeps its state between frames: Huffman tables are rebuilt only if content of DHT segment is changed, 
+        component buffers are reused while frame sizes are not changed, and frames are decoded into a ring of output images 
+        which are reallocated only at change of frame size.
+
+        \param [in] format - a pixel format of output frames. It can be ::SimdPixelFormatGray8, ::SimdPixelFormatBgr24, ::SimdPixelFormatBgra32, 
+            ::SimdPixelFormatRgb24, ::SimdPixelFormatRgba32 or ::SimdPixelFormatNone (::SimdPixelFormatRgb24 is used).
+        \param [in] frames - a number of output images in the ring. It must be positive. 
+        \return a pointer to decoder context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+            This pointer is used in function ::SimdJpegStreamDecoderDecode.
+    */
+    SIMD_API void* SimdJpegStreamDecoderInit(SimdPixelFormatType format, size_t frames);
+
+    /*! @ingroup image_io
+
+        \fn const uint8_t* SimdJpegStreamDecoderDecode(void* context, const uint8_t* data, size_t size, size_t* stride, size_t* width, size_t* height);
+
+        \short Decodes next JPEG frame of the stream.
+
+        \note This function is used in context of JPEG stream decoder created by function ::SimdJpegStreamDecoderInit.
+
+        \param [in] context - a pointer to JPEG stream decoder context. It must be created by function ::SimdJpegStreamDecoderInit.
+        \param [in] data - a pointer to memory buffer with JPEG frame.
+        \param [in] size - a size of JPEG frame in bytes.
+        \param [out] stride - a pointer to row size of decoded frame in bytes.
+        \param [out] width - a pointer to width of decoded frame.
+        \param [out] height - a pointer to height of decoded frame.
+        \return a pointer to pixels data of decoded frame. It is owned by the decoder and stays valid until the ring of output images 
+            is wrapped around (during next frames - 1 calls of this function) or the decoder is released. On error it returns NULL.
+    */
+    SIMD_API const uint8_t* SimdJpegStreamDecoderDecode(void* context, const uint8_t* data, size_t size, size_t* stride, size_t* width, size_t* height);
+
     /*! @ingroup other_conversion
 
         \fn void SimdInt16ToGray(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * dst, size_t dstStride);
@@ -4210,6 +4905,31 @@ extern "C"
     SIMD_API void SimdMedianFilterSquare5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height,
         size_t channelCount, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup median_filter
+
+        \fn void SimdMedianFilterSquare(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, size_t radius, uint8_t * dst, size_t dstStride);
+
+        \short Performs median filtration of input image (filter window is a square (2*radius + 1)x(2*radius + 1)).
+
+        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+        Pixels outside of the image are replaced by the nearest edge pixels.
+
+        \note The function uses column histograms (constant time per pixel independently of radius), 
+            so it is intended for large windows. Image is processed in parallel vertical strips (see ::SimdSetThreadNumber).
+            This function has a C++ wrappers: Simd::MedianFilterSquare(const View<A>& src, size_t radius, View<A>& dst).
+
+        \param [in] src - a pointer to pixels data of original input image.
+        \param [in] srcStride - a row size of src image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] channelCount - a channel count.
+        \param [in] radius - a radius of filter window. Values greater than 127 are clamped to 127.
+        \param [out] dst - a pointer to pixels data of filtered output image. It must not overlap with input image.
+        \param [in] dstStride - a row size of dst image.
+    */
+    SIMD_API void SimdMedianFilterSquare(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+        size_t channelCount, size_t radius, uint8_t * dst, size_t dstStride);
+
     /*! @ingroup neural
 
         \fn void SimdNeuralConvert(const uint8_t * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride, int inversion);
@@ -4769,6 +5489,66 @@ extern "C"
     */
     SIMD_API void SimdNeuralConvolutionForward(const float * src, size_t srcWidth, size_t srcHeight, size_t srcDepth, const float * weight, size_t kernelX, size_t kernelY, size_t padX, size_t padY, size_t strideX, size_t strideY, size_t dilationX, size_t dilationY, void * buffer, size_t * size, float * dst, size_t dstWidth, size_t dstHeight, size_t dstDepth, int add);
 
+    /*! @ingroup nms
+
+        \fn void SimdNmsDecodeBoxes32f(const float * src, const float * anchors, size_t size, size_t stride, SimdBoxDecodeType type, const float * params, float * dst);
+
+        \short Decodes raw detector outputs to boxes in corner form (x0, y0, x1, y1).
+
+        All arrays have structure-of-arrays layout: 4 planes of size elements with distance stride between planes.
+
+        \param [in] src - a pointer to raw box regressions (4 planes).
+        \param [in] anchors - a pointer to anchors (4 planes). See ::SimdBoxDecodeType for their meaning.
+        \param [in] size - a number of boxes.
+        \param [in] stride - a distance between planes (in elements). It must be not less then size.
+        \param [in] type - a type of decoding.
+        \param [in] params - a pointer to decoding parameters (4 variances for ::SimdBoxDecodeCenterSize, grid stride for YOLO decoding).
+        \param [out] dst - a pointer to output boxes (4 planes: x0, y0, x1, y1). 
+    */
+    SIMD_API void SimdNmsDecodeBoxes32f(const float * src, const float * anchors, size_t size, size_t stride, SimdBoxDecodeType type, const float * params, float * dst);
+
+    /*! @ingroup nms
+
+        \fn void SimdNmsIou32f(const float * boxes, size_t stride, size_t size, const float * box, float * iou);
+
+        \short Calculates IoU (intersection over union) between given box and array of boxes.
+
+        \param [in] boxes - a pointer to boxes in structure-of-arrays layout (4 planes: x0, y0, x1, y1).
+        \param [in] stride - a distance between planes (in elements). It must be not less then size.
+        \param [in] size - a number of boxes.
+        \param [in] box - a pointer to given box (x0, y0, x1, y1).
+        \param [out] iou - a pointer to output array with IoU values. Its size must be equal to size.
+    */
+    SIMD_API void SimdNmsIou32f(const float * boxes, size_t stride, size_t size, const float * box, float * iou);
+
+    /*! @ingroup nms
+
+        \fn size_t SimdNms32f(const float * boxes, size_t stride, const float * scores, const uint32_t * classes, size_t size, float scoreThreshold, size_t topK, SimdNmsType type, float iouThreshold, float sigma, size_t keepTopK, uint32_t * indices, float * outScores);
+
+        \short Performs non-maximum suppression of boxes.
+
+        At first boxes with score greater than scoreThreshold are selected and sorted by descending score (only topK best are kept).
+        Then greedy suppression (hard or soft) is performed. If classes are given then boxes of different classes don't suppress each other (per-class NMS),
+        otherwise class-agnostic NMS is performed.
+
+        \param [in] boxes - a pointer to boxes in structure-of-arrays layout (4 planes: x0, y0, x1, y1).
+        \param [in] stride - a distance between planes (in elements). It must be not less then size.
+        \param [in] scores - a pointer to box scores. Its size is equal to size.
+        \param [in] classes - a pointer to box class indices. Its size is equal to size. Can be NULL (class-agnostic NMS).
+        \param [in] size - a number of boxes.
+        \param [in] scoreThreshold - a score threshold. Boxes with lower or equal score are skipped.
+        \param [in] topK - a maximal number of the best boxes which are used in suppression. 0 means no restriction.
+        \param [in] type - a type of suppression.
+        \param [in] iouThreshold - an IoU threshold (it is used for ::SimdNmsHard and ::SimdNmsSoftLinear).
+        \param [in] sigma - a parameter of gaussian decay (it is used for ::SimdNmsSoftGaussian). It must be greater than 0, otherwise no boxes are kept.
+        \param [in] keepTopK - a maximal number of output boxes (size of output arrays).
+        \param [out] indices - a pointer to indices of kept boxes (in order of selection).
+        \param [out] outScores - a pointer to scores of kept boxes (they can be decayed by soft NMS). Can be NULL.
+        \return a number of kept boxes.
+    */
+    SIMD_API size_t SimdNms32f(const float * boxes, size_t stride, const float * scores, const uint32_t * classes, size_t size, float scoreThreshold, size_t topK,
+        SimdNmsType type, float iouThreshold, float sigma, size_t keepTopK, uint32_t * indices, float * outScores);
+
     /*! @ingroup operation
 
         \fn void SimdOperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type);
@@ -5245,6 +6025,34 @@ extern "C"
     */
     SIMD_API void SimdSegmentationFillSingleHoles(uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t index);
 
+    /*! @ingroup segmentation
+
+        \fn size_t SimdSegmentationLabelComponents(const uint8_t * mask, size_t maskStride, size_t width, size_t height, uint8_t index, SimdSegmentationConnectivityType connectivity, uint32_t * labels, size_t labelsStride, SimdSegmentationComponent ** components);
+
+        \short Labels connected components of mask index and estimates their statistics.
+
+        Pixels of the mask which are equal to given index are grouped into connected components. 
+        The components are numbered from 1 in order of their first pixel (in raster scan order). 
+        Output label image contains number of component for every pixel of the mask or 0 for background pixels.
+        Mask must have 8-bit gray pixel format, label image must have 32-bit integer format. They must have the same width and height.
+
+        \note This function has a C++ wrappers: Simd::SegmentationLabelComponents(const View<A> & mask, uint8_t index, SimdSegmentationConnectivityType connectivity, View<A> & labels, std::vector<SimdSegmentationComponent> & components).
+
+        \param [in] mask - a pointer to pixels data of 8-bit gray mask image.
+        \param [in] maskStride - a row size of the mask image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] index - a mask index of foreground pixels.
+        \param [in] connectivity - a connectivity of pixels (see ::SimdSegmentationConnectivityType).
+        \param [out] labels - a pointer to pixels data of 32-bit output label image. Can be NULL.
+        \param [in] labelsStride - a row size (in bytes) of the label image.
+        \param [out] components - a pointer to output array of component statistics (element i describes component with label i + 1). Can be NULL.
+                    The array has to be deleted after use by function ::SimdFree. It is NULL if there are no components.
+        \return a number of found connected components.
+    */
+    SIMD_API size_t SimdSegmentationLabelComponents(const uint8_t * mask, size_t maskStride, size_t width, size_t height, uint8_t index,
+        SimdSegmentationConnectivityType connectivity, uint32_t * labels, size_t labelsStride, SimdSegmentationComponent ** components);
+
     /*! @ingroup segmentation
 
         \fn void SimdSegmentationPropagate2x2(const uint8_t * parent, size_t parentStride, size_t width, size_t height, uint8_t * child, size_t childStride, const uint8_t * difference, size_t differenceStride, uint8_t currentIndex, uint8_t invalidIndex, uint8_t emptyIndex, uint8_t differenceThreshold);
@@ -5466,6 +6274,40 @@ extern "C"
     */
     SIMD_API void SimdSobelDyAbsSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum);
 
+    /*! @ingroup sobel_filter
+
+        \fn void SimdCanny(const uint8_t * src, size_t srcStride, size_t width, size_t height, int lowThreshold, int highThreshold, uint8_t * dst, size_t dstStride);
+
+        \short Detects edges with using of Canny algorithm.
+
+        All images must have the same width and height. Input and output images must have 8-bit gray format.
+
+        Algorithm:
+        \verbatim
+        dx[x, y] = (src[x+1,y-1] + 2*src[x+1, y] + src[x+1, y+1]) - (src[x-1,y-1] + 2*src[x-1, y] + src[x-1, y+1]);
+        dy[x, y] = (src[x-1,y+1] + 2*src[x, y+1] + src[x+1, y+1]) - (src[x-1,y-1] + 2*src[x, y-1] + src[x+1, y-1]);
+        mag[x, y] = abs(dx[x, y]) + abs(dy[x, y]);
+        \endverbatim
+        Border pixels of the input image are replicated, magnitude outside of the image is equal to 0.
+        The point (x, y) is an edge candidate if mag[x, y] > lowThreshold and it is a local maximum along the gradient direction
+        (one of horizontal, vertical and two diagonal directions, the horizontal one is chosen if abs(dy)*32768 < abs(dx)*13573).
+        The candidate is a strong edge if mag[x, y] > highThreshold. Edges are strong candidates and candidates which are
+        connected (8-connectivity) with strong edges through other candidates. Output image is equal to 255 for edges and 0 otherwise.
+
+        \note This function has a C++ wrapper: Simd::Canny(const View<A>& src, int lowThreshold, int highThreshold, View<A>& dst).
+            Image rows are processed in parallel (see ::SimdSetThreadNumber).
+
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] srcStride - a row size of the input image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] lowThreshold - a lower threshold of gradient magnitude (hysteresis).
+        \param [in] highThreshold - an upper threshold of gradient magnitude (hysteresis). The thresholds are swapped if lowThreshold > highThreshold.
+        \param [out] dst - a pointer to pixels data of the output edge image.
+        \param [in] dstStride - a row size of the output image.
+    */
+    SIMD_API void SimdCanny(const uint8_t * src, size_t srcStride, size_t width, size_t height, int lowThreshold, int highThreshold, uint8_t * dst, size_t dstStride);
+
     /*! @ingroup contour
 
         \fn void SimdContourMetrics(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
@@ -6080,6 +6922,50 @@ extern "C"
     SIMD_API void SimdSynetAdd8i(const uint8_t * aData, const float * aScale, const float* aShift, const uint8_t* bData, const float* bScale, const float* bShift,
         uint8_t* cData, const float* cScale, const float* cShift, size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format, SimdSynetCompatibilityType compatibility);
 
+    /*! @ingroup synet_other
+
+        \fn void SimdSynetArgMax32f(const float* src, size_t outer, size_t count, size_t inner, int32_t* dst);
+
+        \short Finds indices of maximal values along given axis of FP32 tensor (forward propagation of ArgMax layer).
+
+        Algorithm's details:
+        \verbatim
+        for(o = 0; o < outer; ++o)
+            for(i = 0; i < inner; ++i)
+                dst[o*inner + i] = argmax(src[(o*count + c)*inner + i], c = 0..count-1);
+        \endverbatim
+
+        If there are several maximal values then the smallest index is returned. Use outer = height*width, count = channels, inner = 1 for NHWC
+        segmentation map and outer = 1, count = channels, inner = height*width for NCHW one.
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float tensor. Its size is equal to outer * count * inner.
+        \param [in] outer - an outer size of input tensor.
+        \param [in] count - a size of reduced axis.
+        \param [in] inner - an inner size of input tensor.
+        \param [out] dst - a pointer to the output 32-bit integer tensor. Its size is equal to outer * inner.
+    */
+    SIMD_API void SimdSynetArgMax32f(const float* src, size_t outer, size_t count, size_t inner, int32_t* dst);
+
+    /*! @ingroup synet_other
+
+        \fn void SimdSynetArgMin32f(const float* src, size_t outer, size_t count, size_t inner, int32_t* dst);
+
+        \short Finds indices of minimal values along given axis of FP32 tensor (forward propagation of ArgMin layer).
+
+        If there are several minimal values then the smallest index is returned. See also ::SimdSynetArgMax32f.
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float tensor. Its size is equal to outer * count * inner.
+        \param [in] outer - an outer size of input tensor.
+        \param [in] count - a size of reduced axis.
+        \param [in] inner - an inner size of input tensor.
+        \param [out] dst - a pointer to the output 32-bit integer tensor. Its size is equal to outer * inner.
+    */
+    SIMD_API void SimdSynetArgMin32f(const float* src, size_t outer, size_t count, size_t inner, int32_t* dst);
+
     /*! @ingroup synet_other
 
         \fn void SimdSynetChannelSum16b(const uint16_t* src, size_t channels, size_t spatial, SimdTensorFormatType format, float* sum);
@@ -6680,6 +7566,59 @@ extern "C"
     */
     SIMD_API void SimdSynetGridSample2dForward(void* context, const uint8_t* src, const uint8_t* grd, uint8_t* dst);
 
+    /*! @ingroup synet_normalize
+
+        \fn void* SimdSynetGroupNorm16bInit(size_t batch, size_t channels, size_t spatial, size_t groups, SimdTensorDataType srcType, SimdTensorDataType dstType, SimdTensorFormatType format, float eps, SimdConvolutionActivationType activation);
+
+        \short Initilizes group normalization algorithm (GroupNorm and InstanceNorm layers).
+
+        Algorithm's details (example for NCHW tensor format):
+        \verbatim
+        for(b = 0; b < batch; ++b)
+            for(g = 0; g < groups; ++g)
+            {
+                size = channels / groups * spatial;
+                mean = Sum(src[b, g]) / size;
+                norm = 1 / Sqrt(Sum(Square(src[b, g] - mean)) / size + eps);
+                for(c = g * channels / groups; c < (g + 1) * channels / groups; ++c)
+                    for(s = 0; s < spatial; ++s)
+                        dst[b, c, s] = Activate((src[b, c, s] - mean) * norm * scale[c] + shift[c]);
+            }
+        \endverbatim
+
+        \note InstanceNorm corresponds to groups = channels. For NCHW format the work is split over batch and groups,
+            for NHWC format it is split over batch and spatial blocks. The context keeps no intermediate buffers,
+            so ::SimdSynetGroupNorm16bForward may be called concurrently for the same context.
+
+        \param [in] batch - a batch size of input and output tensors.
+        \param [in] channels - a number of channels in input and output tensors.
+        \param [in] spatial - a spatial size (height*width) of input and output tensors.
+        \param [in] groups - a number of groups. Channels must be divisible by groups.
+        \param [in] srcType - a type of input tensor. Can be FP32 of BF16.
+        \param [in] dstType - a type of output tensor. Can be FP32 of BF16.
+        \param [in] format - a format of input and output tensors. It can be ::SimdTensorFormatNchw or ::SimdTensorFormatNhwc.
+        \param [in] eps - an epsilon parameter. It is used to prevent division by zero.
+        \param [in] activation - a type of fused activation function. It can be ::SimdConvolutionActivationIdentity, ::SimdConvolutionActivationSwish or ::SimdConvolutionActivationGelu.
+        \return a pointer to group normalization context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+            This pointer is used in function ::SimdSynetGroupNorm16bForward.
+    */
+    SIMD_API void* SimdSynetGroupNorm16bInit(size_t batch, size_t channels, size_t spatial, size_t groups, SimdTensorDataType srcType, SimdTensorDataType dstType, SimdTensorFormatType format, float eps, SimdConvolutionActivationType activation);
+
+    /*! @ingroup synet_normalize
+
+        \fn void SimdSynetGroupNorm16bForward(void* context, const uint8_t* src, const float* scale, const float* shift, const float* params, uint8_t* dst);
+
+        \short Performs forward propagation of group normalization algorithm.
+
+        \param [in] context - a pointer to group normalization context. It must be created by function ::SimdSynetGroupNorm16bInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to input tensor.
+        \param [in] scale - a pointer to FP32 array with scale coefficients. The size of the array is equal to channels. Can be NULL.
+        \param [in] shift - a pointer to FP32 array with shift coefficients. The size of the array is equal to channels. Can be NULL.
+        \param [in] params - a pointer to parameters of activation function (slope for ::SimdConvolutionActivationSwish). Can be NULL.
+        \param [out] dst - a pointer to output tensor. It can be the same as input tensor if they have the same type.
+    */
+    SIMD_API void SimdSynetGroupNorm16bForward(void* context, const uint8_t* src, const float* scale, const float* shift, const float* params, uint8_t* dst);
+
     /*! @ingroup synet_activation
 
         \fn void SimdSynetHardSigmoid32f(const float * src, size_t size, const float * scale, const float * shift, float * dst);
@@ -7524,6 +8463,106 @@ extern "C"
     */
     SIMD_API void SimdSynetPreluLayerForward(const float * src, const float * slope, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format);
 
+    /*! @ingroup synet_conversion
+
+        \fn void* SimdSynetPreprocessInit(size_t srcW, size_t srcH, SimdPixelFormatType srcFormat, size_t dstW, size_t dstH, size_t channels, SimdResizeMethodType method, const float* mean, const float* std, SimdTensorFormatType dstFormat, SimdTensorDataType dstType);
+
+        \short Initilizes fused image preprocessing algorithm (resize + color conversion + normalization) which sets input tensor of neural network.
+
+        It replaces sequential call of ::SimdResizerRun and ::SimdSynetSetInput. The image is processed by row bands (in several threads if ::SimdSetThreadNumber was called)
+        so intermediate data stay in cache. Output channels have BGR order (swap Bgr24 and Rgb24 (Bgra32 and Rgba32) source formats to get RGB order).
+        Algorithm's details (for NCHW output format):
+        \verbatim
+        for(c = 0; c < channels; ++c)
+            for(y = 0; y < dstH; ++y)
+                for(x = 0; x < dstW; ++x)
+                    dst[(c*dstH + y)*dstW + x] = (Resize(ToBgr(src), c, y, x) - mean[c]) / std[c];
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] srcW - a width of input image (or its region of interest).
+        \param [in] srcH - a height of input image (or its region of interest).
+        \param [in] srcFormat - a pixel format of input image. There are supported following formats: ::SimdPixelFormatGray8, ::SimdPixelFormatBgr24, 
+            ::SimdPixelFormatBgra32, ::SimdPixelFormatRgb24, ::SimdPixelFormatRgba32.
+        \param [in] dstW - a width of output tensor.
+        \param [in] dstH - a height of output tensor.
+        \param [in] channels - a number of channels in the output tensor. It can be 1 or 3.
+        \param [in] method - a resize method. There are supported following methods: ::SimdResizeMethodNearest, ::SimdResizeMethodNearestPytorch,
+            ::SimdResizeMethodBilinear, ::SimdResizeMethodBilinearCaffe, ::SimdResizeMethodBilinearPytorch.
+        \param [in] mean - a pointer to array with per-channel mean values (in range [0..255]). It can be NULL (zero means).
+        \param [in] std - a pointer to array with per-channel standard deviations (in range [0..255]). It can be NULL (unit deviations).
+        \param [in] dstFormat - a format of output tensor. There are supported following tensor formats: ::SimdTensorFormatNchw, ::SimdTensorFormatNhwc.
+        \param [in] dstType - a type of output tensor. There are supported following types: ::SimdTensorData32f, ::SimdTensorData16b, ::SimdTensorData8u.
+            UINT8 output is rounded and saturated, so quantization parameters (scale and zero) have to be folded into mean and std: 
+            mean' = mean - zero * std / scale, std' = std / scale.
+        \return a pointer to preprocessing context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+            This pointer is used in function ::SimdSynetPreprocessRun.
+    */
+    SIMD_API void* SimdSynetPreprocessInit(size_t srcW, size_t srcH, SimdPixelFormatType srcFormat, size_t dstW, size_t dstH, size_t channels,
+        SimdResizeMethodType method, const float* mean, const float* std, SimdTensorFormatType dstFormat, SimdTensorDataType dstType);
+
+    /*! @ingroup synet_conversion
+
+        \fn void SimdSynetPreprocessRun(const void* context, const uint8_t* src, size_t srcStride, uint8_t* dst);
+
+        \short Performs fused image preprocessing (resize + color conversion + normalization).
+
+        \param [in] context - a pointer to preprocessing context. It must be created by function ::SimdSynetPreprocessInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of input image. To process a region of interest pass a pointer to its top-left pixel.
+        \param [in] srcStride - a row size of input image (in bytes).
+        \param [out] dst - a pointer to output tensor. Its size is equal to channels * dstH * dstW elements of type dstType.
+    */
+    SIMD_API void SimdSynetPreprocessRun(const void* context, const uint8_t* src, size_t srcStride, uint8_t* dst);
+
+    /*! @ingroup synet_conversion
+
+        \fn void* SimdSynetPreprocessYuv420Init(size_t srcW, size_t srcH, SimdYuvType yuvType, SimdBool nv12, SimdBool isRgb, size_t dstW, size_t dstH, SimdResizeMethodType method, const float* mean, const float* std, SimdTensorFormatType dstFormat, SimdTensorDataType dstType);
+
+        \short Initilizes fused YUV420P (or NV12) image preprocessing algorithm (YUV to BGR conversion + resize + normalization) which sets input tensor of neural network.
+
+        It replaces sequential call of ::SimdYuv420pToBgrV2 (or ::SimdDeinterleaveUv and ::SimdYuv420pToBgrV2), ::SimdResizerRun and ::SimdSynetSetInput.
+        Only pairs of source rows which are used by resize are converted to BGR, so there are no full size intermediate images. 
+        Chroma is upsampled in the same way as in ::SimdYuv420pToBgrV2.
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] srcW - a width of input image (or its region of interest). It must be even.
+        \param [in] srcH - a height of input image (or its region of interest). It must be even.
+        \param [in] yuvType - a type of input YUV image (see description of ::SimdYuvType).
+        \param [in] nv12 - a flag of NV12 input format (U and V planes are interleaved).
+        \param [in] isRgb - a flag of RGB channel order in output tensor. Otherwise output tensor has BGR order.
+        \param [in] dstW - a width of output tensor.
+        \param [in] dstH - a height of output tensor.
+        \param [in] method - a resize method. There are supported following methods: ::SimdResizeMethodNearest, ::SimdResizeMethodNearestPytorch,
+            ::SimdResizeMethodBilinear, ::SimdResizeMethodBilinearCaffe, ::SimdResizeMethodBilinearPytorch.
+        \param [in] mean - a pointer to array with 3 mean values (in range [0..255]). It can be NULL (zero means).
+        \param [in] std - a pointer to array with 3 standard deviations (in range [0..255]). It can be NULL (unit deviations).
+        \param [in] dstFormat - a format of output tensor. There are supported following tensor formats: ::SimdTensorFormatNchw, ::SimdTensorFormatNhwc.
+        \param [in] dstType - a type of output tensor. There are supported following types: ::SimdTensorData32f, ::SimdTensorData16b, ::SimdTensorData8u.
+        \return a pointer to preprocessing context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+            This pointer is used in function ::SimdSynetPreprocessYuv420Run.
+    */
+    SIMD_API void* SimdSynetPreprocessYuv420Init(size_t srcW, size_t srcH, SimdYuvType yuvType, SimdBool nv12, SimdBool isRgb, size_t dstW, size_t dstH,
+        SimdResizeMethodType method, const float* mean, const float* std, SimdTensorFormatType dstFormat, SimdTensorDataType dstType);
+
+    /*! @ingroup synet_conversion
+
+        \fn void SimdSynetPreprocessYuv420Run(const void* context, const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, uint8_t* dst);
+
+        \short Performs fused YUV420P (or NV12) image preprocessing (YUV to BGR conversion + resize + normalization).
+
+        \param [in] context - a pointer to preprocessing context. It must be created by function ::SimdSynetPreprocessYuv420Init and released by function ::SimdRelease.
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane (or to interleaved UV plane for NV12 format).
+        \param [in] uStride - a row size of the u (or uv) image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane. It is ignored for NV12 format (can be NULL).
+        \param [in] vStride - a row size of the v image.
+        \param [out] dst - a pointer to output tensor. Its size is equal to 3 * dstH * dstW elements of type dstType.
+    */
+    SIMD_API void SimdSynetPreprocessYuv420Run(const void* context, const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, uint8_t* dst);
+
     /*! @ingroup synet_quantized_add
 
         \fn void* SimdSynetQuantizedAddInit(const size_t* aShape, size_t aCount, SimdTensorDataType aType, const float* aScale, int32_t aZero, const size_t* bShape, size_t bCount, SimdTensorDataType bType, const float* bScale, int32_t bZero, SimdConvolutionActivationType actType, const float* actParams, SimdTensorDataType dstType, const float* dstScale, int32_t dstZero);
@@ -8253,6 +9292,51 @@ extern "C"
     */
     SIMD_API void SimdSynetTiledScale2D32f(const float* src, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* ver, const float* hor, float* dst);
 
+    /*! @ingroup synet_other
+
+        \fn void SimdSynetTopK32f(const float* src, size_t outer, size_t count, size_t inner, size_t k, SimdBool largest, SimdBool sorted, float* dstVal, int32_t* dstIdx);
+
+        \short Selects K largest (or smallest) values along given axis of FP32 tensor (forward propagation of TopK layer).
+
+        Input tensor has shape [outer, count, inner], output tensors have shape [outer, k, inner]. 
+        If there are equal values then the element with smaller index is selected first. Input tensor must not contain NaN values.
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float tensor.
+        \param [in] outer - an outer size of input tensor.
+        \param [in] count - a size of selection axis.
+        \param [in] inner - an inner size of input tensor.
+        \param [in] k - a number of selected elements. It must be in range [1..count].
+        \param [in] largest - a flag to select largest (or smallest) elements.
+        \param [in] sorted - a flag to sort output elements by value (largest or smallest first). Otherwise output elements are sorted by index.
+        \param [out] dstVal - a pointer to the output 32-bit float tensor with selected values. It can be NULL.
+        \param [out] dstIdx - a pointer to the output 32-bit integer tensor with indices of selected values. It can be NULL.
+    */
+    SIMD_API void SimdSynetTopK32f(const float* src, size_t outer, size_t count, size_t inner, size_t k, SimdBool largest, SimdBool sorted, float* dstVal, int32_t* dstIdx);
+
+    /*! @ingroup synet_other
+
+        \fn void SimdSynetTopK16b(const uint16_t* src, size_t outer, size_t count, size_t inner, size_t k, SimdBool largest, SimdBool sorted, uint16_t* dstVal, int32_t* dstIdx);
+
+        \short Selects K largest (or smallest) values along given axis of BF16 tensor (forward propagation of TopK layer).
+
+        It works in the same way as ::SimdSynetTopK32f.
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 16-bit brain-float tensor.
+        \param [in] outer - an outer size of input tensor.
+        \param [in] count - a size of selection axis.
+        \param [in] inner - an inner size of input tensor.
+        \param [in] k - a number of selected elements. It must be in range [1..count].
+        \param [in] largest - a flag to select largest (or smallest) elements.
+        \param [in] sorted - a flag to sort output elements by value (largest or smallest first). Otherwise output elements are sorted by index.
+        \param [out] dstVal - a pointer to the output 16-bit brain-float tensor with selected values. It can be NULL.
+        \param [out] dstIdx - a pointer to the output 32-bit integer tensor with indices of selected values. It can be NULL.
+    */
+    SIMD_API void SimdSynetTopK16b(const uint16_t* src, size_t outer, size_t count, size_t inner, size_t k, SimdBool largest, SimdBool sorted, uint16_t* dstVal, int32_t* dstIdx);
+
     /*! @ingroup synet_other
 
         \fn void SimdSynetUnaryOperation32f(const float * src, size_t size, SimdSynetUnaryOperation32fType type, float* dst);
@@ -2649,6 +2649,27 @@ namespace Simd
         SimdMedianFilterSquare5x5(src.data, src.stride, src.width, src.height, src.ChannelCount(), dst.data, dst.stride);
     }
 
+    /*! @ingroup median_filter
+
+        \fn void MedianFilterSquare(const View<A>& src, size_t radius, View<A>& dst)
+
+        \short Performs median filtration of input image (filter window is a square (2*radius + 1)x(2*radius + 1)).
+
+        All images must have the same width, height and format (8-bit gray, 16-bit UV, 24-bit BGR or 32-bit BGRA).
+
+        \note This function is a C++ wrapper for function ::SimdMedianFilterSquare.
+
+        \param [in] src - an original input image.
+        \param [in] radius - a radius of filter window. Values greater than 127 are clamped to 127.
+        \param [out] dst - a filtered output image.
+    */
+    template<template<class> class A> SIMD_INLINE void MedianFilterSquare(const View<A>& src, size_t radius, View<A>& dst)
+    {
+        assert(Compatible(src, dst) && src.ChannelSize() == 1);
+
+        SimdMedianFilterSquare(src.data, src.stride, src.width, src.height, src.ChannelCount(), radius, dst.data, dst.stride);
+    }
+
     /*! @ingroup neural
 
         \fn void NeuralConvert(const View<A> & src, float * dst, size_t stride, bool inversion)
@@ -3215,6 +3236,35 @@ namespace Simd
         SimdSegmentationFillSingleHoles(mask.data, mask.stride, mask.width, mask.height, index);
     }
 
+    /*! @ingroup segmentation
+
+        \fn size_t SegmentationLabelComponents(const View<A> & mask, uint8_t index, SimdSegmentationConnectivityType connectivity, View<A> & labels, std::vector<SimdSegmentationComponent> & components)
+
+        \short Labels connected components of mask index and estimates their statistics.
+
+        Mask must have 8-bit gray pixel format, label image must have 32-bit integer format. They must have the same size.
+
+        \note This function is a C++ wrapper for function ::SimdSegmentationLabelComponents.
+
+        \param [in] mask - a 8-bit gray mask image.
+        \param [in] index - a mask index of foreground pixels.
+        \param [in] connectivity - a connectivity of pixels (see ::SimdSegmentationConnectivityType).
+        \param [out] labels - a 32-bit output label image.
+        \param [out] components - an output statistics of components (element i describes component with label i + 1).
+        \return a number of found connected components.
+    */
+    template<template<class> class A> SIMD_INLINE size_t SegmentationLabelComponents(const View<A> & mask, uint8_t index, SimdSegmentationConnectivityType connectivity, 
+        View<A> & labels, std::vector<SimdSegmentationComponent> & components)
+    {
+        assert(EqualSize(mask, labels) && mask.format == View<A>::Gray8 && labels.format == View<A>::Int32);
+
+        SimdSegmentationComponent * buffer = NULL;
+        size_t count = SimdSegmentationLabelComponents(mask.data, mask.stride, mask.width, mask.height, index, connectivity, (uint32_t*)labels.data, labels.stride, &buffer);
+        components.assign(buffer, buffer + count);
+        SimdFree(buffer);
+        return count;
+    }
+
     /*! @ingroup segmentation
 
         \fn void SegmentationPropagate2x2(const View<A> & parent, View<A> & child, const View<A> & difference, uint8_t currentIndex, uint8_t invalidIndex, uint8_t emptyIndex, uint8_t differenceThreshold)
@@ -3440,6 +3490,29 @@ namespace Simd
         SimdSobelDyAbsSum(src.data, src.stride, src.width, src.height, &sum);
     }
 
+    /*! @ingroup sobel_filter
+
+        \fn void Canny(const View<A>& src, int lowThreshold, int highThreshold, View<A>& dst)
+
+        \short Detects edges with using of Canny algorithm.
+
+        All images must have the same width and height. Input and output images must have 8-bit gray format.
+        Output image is equal to 255 for edges and 0 otherwise.
+
+        \note This function is a C++ wrapper for function ::SimdCanny.
+
+        \param [in] src - an input image.
+        \param [in] lowThreshold - a lower threshold of gradient magnitude (hysteresis).
+        \param [in] highThreshold - an upper threshold of gradient magnitude (hysteresis).
+        \param [out] dst - an output edge image.
+    */
+    template<template<class> class A> SIMD_INLINE void Canny(const View<A>& src, int lowThreshold, int highThreshold, View<A>& dst)
+    {
+        assert(Compatible(src, dst) && src.format == View<A>::Gray8);
+
+        SimdCanny(src.data, src.stride, src.width, src.height, lowThreshold, highThreshold, dst.data, dst.stride);
+    }
+
     /*! @ingroup contour
 
         \fn void ContourMetrics(const View<A>& src, View<A>& dst)
@@ -3920,6 +3993,51 @@ namespace Simd
         SimdStretchGray2x2(src.data, src.width, src.height, src.stride, dst.data, dst.width, dst.height, dst.stride);
     }
 
+    /*! @ingroup synet_conversion
+
+        \fn bool SynetPreprocess(const View<A>& src, size_t dstW, size_t dstH, size_t channels, SimdResizeMethodType method, const float* mean, const float* std, uint8_t* dst, SimdTensorFormatType format, SimdTensorDataType type, bool isRgb = false)
+
+        \short Resizes image, converts its color and sets it (normalized) to the input of neural network of <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        To process a region of interest pass View::Region of the original image.
+
+        \note This function is a C++ wrapper for functions ::SimdSynetPreprocessInit and ::SimdSynetPreprocessRun.
+
+        \param [in] src - an input image. There are supported following image formats: View<A>::Gray8, View<A>::Bgr24, View<A>::Bgra32, View<A>::Rgb24, View<A>::Rgba32.
+        \param [in] dstW - a width of output tensor.
+        \param [in] dstH - a height of output tensor.
+        \param [in] channels - a number of channels in the output tensor. It can be 1 or 3.
+        \param [in] method - a resize method.
+        \param [in] mean - a pointer to array with per-channel mean values (in range [0..255]).
+        \param [in] std - a pointer to array with per-channel standard deviations (in range [0..255]).
+        \param [out] dst - a pointer to the output tensor.
+        \param [in] format - a format of output tensor. There are supported following tensor formats: ::SimdTensorFormatNchw, ::SimdTensorFormatNhwc.
+        \param [in] type - a type of output tensor. There are supported following types: ::SimdTensorData32f, ::SimdTensorData16b, ::SimdTensorData8u.
+        \param [in] isRgb - is channel order of output tensor is RGB or BGR. Its default value is false.
+        \return false if given parameters are not supported (output tensor is not changed in this case).
+    */
+    template<template<class> class A> SIMD_INLINE bool SynetPreprocess(const View<A>& src, size_t dstW, size_t dstH, size_t channels, SimdResizeMethodType method, 
+        const float* mean, const float* std, uint8_t* dst, SimdTensorFormatType format, SimdTensorDataType type, bool isRgb = false)
+    {
+        SimdPixelFormatType srcFormat;
+        switch (src.format)
+        {
+        case View<A>::Gray8: srcFormat = SimdPixelFormatGray8; break;
+        case View<A>::Bgr24: srcFormat = isRgb ? SimdPixelFormatRgb24 : SimdPixelFormatBgr24; break;
+        case View<A>::Bgra32: srcFormat = isRgb ? SimdPixelFormatRgba32 : SimdPixelFormatBgra32; break;
+        case View<A>::Rgb24: srcFormat = isRgb ? SimdPixelFormatBgr24 : SimdPixelFormatRgb24; break;
+        case View<A>::Rgba32: srcFormat = isRgb ? SimdPixelFormatBgra32 : SimdPixelFormatRgba32; break;
+        default:
+            return false;
+        }
+        void* context = SimdSynetPreprocessInit(src.width, src.height, srcFormat, dstW, dstH, channels, method, mean, std, format, type);
+        if (context == NULL)
+            return false;
+        SimdSynetPreprocessRun(context, src.data, src.stride, dst);
+        SimdRelease(context);
+        return true;
+    }
+
     /*! @ingroup synet_conversion
 
         \fn void SynetSetInput(const View<A> & src, const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType format, bool isRgb = false)
@@ -0,0 +1,169 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdMedianFilter_h__
+#define __SimdMedianFilter_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
+
+namespace Simd
+{
+    namespace Base
+    {
+        const size_t MEDIAN_RADIUS_MAX = 127;
+
+        // Constant time median filter (S. Perreault, P. Hebert, 2007): the coarse kernel histogram is slided at every pixel, 
+        // fine 16-bin segments of kernel histogram are updated lazily when the median falls into them.
+        // Hist implements operations over 16 bins: Add(src, dst) - dst += src, Update(add, sub, dst) - dst += add - sub.
+        template<class Hist> class MedianFilterSquareHist
+        {
+        public:
+            MedianFilterSquareHist(const uint8_t* src, size_t srcStride, size_t width, size_t height, size_t channels, size_t radius, uint8_t* dst, size_t dstStride)
+                : _src(src), _dst(dst), _srcStride(srcStride), _dstStride(dstStride), _c(channels), _w(width), _h(height), _r(radius)
+            {
+            }
+
+            void Run(size_t begin, size_t end)
+            {
+                _colBeg = Simd::Max<ptrdiff_t>(begin - _r, 0);
+                _cols = Simd::Min<ptrdiff_t>(end + _r, _w) - _colBeg;
+                size_t cols = _cols * _c;
+                _buffer.Resize(cols * 272 + _c * 272, true);
+                _colCoarse = _buffer.data, _colFine = _colCoarse + cols * 16;
+                _kerCoarse = _colFine + cols * 256, _kerFine = _kerCoarse + _c * 16;
+                _last.resize(_c * 16);
+
+                for (ptrdiff_t k = -_r; k <= _r; ++k)
+                    UpdateCols(NULL, RowPtr(k));
+                size_t rank = (2 * _r + 1) * (2 * _r + 1) / 2;
+                for (ptrdiff_t y = 0; y < _h; ++y)
+                {
+                    uint8_t* dst = _dst + y * _dstStride;
+                    memset(_kerCoarse, 0, _c * 16 * sizeof(uint16_t));
+                    for (ptrdiff_t dx = -_r; dx <= _r; ++dx)
+                        for (size_t c = 0; c < _c; ++c)
+                            Hist::Add(Coarse(begin + dx, c), _kerCoarse + c * 16);
+                    for (size_t i = 0; i < _last.size(); ++i)
+                        _last[i] = PTRDIFF_MIN / 2;
+                    for (ptrdiff_t x = begin; x < (ptrdiff_t)end; ++x)
+                    {
+                        for (size_t c = 0; c < _c; ++c)
+                        {
+                            const uint16_t* coarse = _kerCoarse + c * 16;
+                            size_t sum = 0, b = 0;
+                            while (sum + coarse[b] <= rank)
+                                sum += coarse[b++];
+                            const uint16_t* fine = SyncFine(x, c, b);
+                            size_t f = 0;
+                            while (sum + fine[f] <= rank)
+                                sum += fine[f++];
+                            dst[x * _c + c] = uint8_t(b * 16 + f);
+                        }
+                        ptrdiff_t xa = Simd::Min<ptrdiff_t>(x + _r + 1, _w - 1), xs = Simd::Max<ptrdiff_t>(x - _r, 0);
+                        if (x + 1 < (ptrdiff_t)end && xa != xs)
+                            for (size_t c = 0; c < _c; ++c)
+                                Hist::Update(Coarse(xa, c), Coarse(xs, c), _kerCoarse + c * 16);
+                    }
+                    if (y + 1 < _h)
+                        UpdateCols(RowPtr(y - _r), RowPtr(y + _r + 1));
+                }
+            }
+
+        private:
+            const uint8_t* _src;
+            uint8_t* _dst;
+            size_t _srcStride, _dstStride, _c;
+            ptrdiff_t _w, _h, _r, _colBeg, _cols;
+            Array16u _buffer;
+            uint16_t* _colCoarse, * _colFine, * _kerCoarse, * _kerFine;
+            std::vector<ptrdiff_t> _last;
+
+            SIMD_INLINE const uint8_t* RowPtr(ptrdiff_t y) const
+            {
+                return _src + Simd::RestrictRange<ptrdiff_t>(y, 0, _h - 1) * _srcStride + _colBeg * _c;
+            }
+
+            SIMD_INLINE const uint16_t* Coarse(ptrdiff_t x, size_t c) const
+            {
+                return _colCoarse + ((Simd::RestrictRange<ptrdiff_t>(x, 0, _w - 1) - _colBeg) * _c + c) * 16;
+            }
+
+            SIMD_INLINE const uint16_t* Fine(ptrdiff_t x, size_t c, size_t b) const
+            {
+                return _colFine + ((Simd::RestrictRange<ptrdiff_t>(x, 0, _w - 1) - _colBeg) * _c + c) * 256 + b * 16;
+            }
+
+            void UpdateCols(const uint8_t* sub, const uint8_t* add)
+            {
+                if (sub == add)
+                    return;
+                for (size_t i = 0, n = _cols * _c; i < n; ++i)
+                {
+                    uint16_t* coarse = _colCoarse + i * 16, * fine = _colFine + i * 256;
+                    if (sub)
+                        coarse[sub[i] >> 4]--, fine[sub[i]]--;
+                    coarse[add[i] >> 4]++, fine[add[i]]++;
+                }
+            }
+
+            SIMD_INLINE const uint16_t* SyncFine(ptrdiff_t x, size_t c, size_t b)
+            {
+                uint16_t* fine = _kerFine + c * 256 + b * 16;
+                ptrdiff_t& last = _last[c * 16 + b];
+                if (x - last > 2 * _r + 1)
+                {
+                    memset(fine, 0, 16 * sizeof(uint16_t));
+                    for (ptrdiff_t dx = -_r; dx <= _r; ++dx)
+                        Hist::Add(Fine(x + dx, c, b), fine);
+                }
+                else
+                {
+                    for (ptrdiff_t j = last + 1; j <= x; ++j)
+                    {
+                        ptrdiff_t xa = Simd::Min<ptrdiff_t>(j + _r, _w - 1), xs = Simd::Max<ptrdiff_t>(j - _r - 1, 0);
+                        if (xa != xs)
+                            Hist::Update(Fine(xa, c, b), Fine(xs, c, b), fine);
+                    }
+                }
+                last = x;
+                return fine;
+            }
+        };
+
+        template<class Hist> void MedianFilterSquare(const uint8_t* src, size_t srcStride, size_t width, size_t height,
+            size_t channelCount, size_t radius, uint8_t* dst, size_t dstStride)
+        {
+            assert(channelCount > 0 && channelCount <= 4 && radius <= MEDIAN_RADIUS_MAX);
+
+            Parallel(0, width, [&](size_t, size_t begin, size_t end)
+            {
+                MedianFilterSquareHist<Hist> filter(src, srcStride, width, height, channelCount, radius, dst, dstStride);
+                filter.Run(begin, end);
+            }, GetThreadNumber(), Simd::Max<size_t>(64, 4 * radius));
+        }
+    }
+}
+
+#endif
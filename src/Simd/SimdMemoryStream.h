@@ -278,6 +278,15 @@ namespace Simd
 
         SIMD_INLINE void FillBits()
         {
+#if (defined(SIMD_X64_ENABLE) || defined(SIMD_ARM64_ENABLE)) && !defined(SIMD_BIG_ENDIAN)
+            if (_pos + 8 <= _size)
+            {
+                _bitBuffer |= *(uint64_t*)(_data + _pos) << _bitCount;
+                _pos += (63 - _bitCount) >> 3;
+                _bitCount |= 56;
+                return;
+            }
+#endif
             static const size_t canReadByte = (sizeof(_bitBuffer) - 1) * 8;
             while (_pos < _size && _bitCount <= canReadByte)
             {
@@ -494,6 +503,24 @@ namespace Simd
             return data;
         }
 
+        SIMD_INLINE void Clear()
+        {
+            _pos = 0;
+            _size = 0;
+            _bitBuffer = 0;
+            _bitCount = 0;
+        }
+
+        SIMD_INLINE void Swap(OutputMemoryStream& other)
+        {
+            Simd::Swap(_data, other._data);
+            Simd::Swap(_pos, other._pos);
+            Simd::Swap(_size, other._size);
+            Simd::Swap(_capacity, other._capacity);
+            Simd::Swap(_bitCount, other._bitCount);
+            Simd::Swap(_bitBuffer, other._bitBuffer);
+        }
+
         SIMD_INLINE void Reserve(size_t size)
         {
             if (size > _capacity)
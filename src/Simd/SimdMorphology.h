@@ -0,0 +1,160 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdMorphology_h__
+#define __SimdMorphology_h__
+
+#include "Simd/SimdArray.h"
+
+#include <vector>
+
+namespace Simd
+{
+    struct MorphologyParam
+    {
+        size_t width;
+        size_t height;
+        size_t channels;
+        SimdMorphologyOperationType operation;
+        SimdMorphologyElementType element;
+        size_t sizeX;
+        size_t sizeY;
+        size_t align;
+
+        MorphologyParam(size_t w, size_t h, size_t c, SimdMorphologyOperationType o, SimdMorphologyElementType e, size_t sx, size_t sy, size_t a);
+        bool Valid() const;
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    class Morphology : Deletable
+    {
+    public:
+        Morphology(const MorphologyParam& param);
+
+        virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride) = 0;
+
+    protected:
+        MorphologyParam _param;
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        class MorphologyDefault : public Simd::Morphology
+        {
+        public:
+            MorphologyDefault(const MorphologyParam& param);
+
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+
+            typedef void (*BinaryPtr)(const uint8_t* a, const uint8_t* b, size_t size, uint8_t* dst);
+
+        protected:
+            struct Rect
+            {
+                ptrdiff_t left, top;
+                size_t sizeX, sizeY;
+
+                Rect(ptrdiff_t l, ptrdiff_t t, size_t sx, size_t sy) : left(l), top(t), sizeX(sx), sizeY(sy) {}
+            };
+
+            void Apply(bool dilate, const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
+            void ApplyRect(bool dilate, const Rect& rect, const uint8_t* src, size_t srcStride, size_t begin, size_t end, uint8_t* buf, uint8_t* dst, size_t dstStride) const;
+            void RowMinMax(bool dilate, const Rect& rect, const uint8_t* src, size_t srcStride, ptrdiff_t row, uint8_t* buf, uint8_t* dst) const;
+
+            size_t _size, _rowStride, _padStride;
+            std::vector<Rect> _rects;
+            std::vector<Array8u> _buffers;
+            Array8u _temp0, _temp1;
+            BinaryPtr _min, _max, _sub;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* MorphologyInit(size_t width, size_t height, size_t channels, SimdMorphologyOperationType operation, SimdMorphologyElementType element, size_t sizeX, size_t sizeY);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        class MorphologyDefault : public Base::MorphologyDefault
+        {
+        public:
+            MorphologyDefault(const MorphologyParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* MorphologyInit(size_t width, size_t height, size_t channels, SimdMorphologyOperationType operation, SimdMorphologyElementType element, size_t sizeX, size_t sizeY);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class MorphologyDefault : public Sse41::MorphologyDefault
+        {
+        public:
+            MorphologyDefault(const MorphologyParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* MorphologyInit(size_t width, size_t height, size_t channels, SimdMorphologyOperationType operation, SimdMorphologyElementType element, size_t sizeX, size_t sizeY);
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class MorphologyDefault : public Avx2::MorphologyDefault
+        {
+        public:
+            MorphologyDefault(const MorphologyParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* MorphologyInit(size_t width, size_t height, size_t channels, SimdMorphologyOperationType operation, SimdMorphologyElementType element, size_t sizeX, size_t sizeY);
+    }
+#endif
+
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        class MorphologyDefault : public Base::MorphologyDefault
+        {
+        public:
+            MorphologyDefault(const MorphologyParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* MorphologyInit(size_t width, size_t height, size_t channels, SimdMorphologyOperationType operation, SimdMorphologyElementType element, size_t sizeX, size_t sizeY);
+    }
+#endif
+}
+
+#endif
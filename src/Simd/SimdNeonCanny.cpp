@@ -0,0 +1,142 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdCanny.h"
+
+namespace Simd
+{
+#ifdef SIMD_NEON_ENABLE
+    namespace Neon
+    {
+        SIMD_INLINE int16x8_t LoadU8(const uint8_t* src)
+        {
+            return vreinterpretq_s16_u16(vmovl_u8(vld1_u8(src)));
+        }
+
+        SIMD_INLINE void CannyGradient(const uint8_t* src0, const uint8_t* src1, const uint8_t* src2, size_t x, int16_t* dx, int16_t* dy, int16_t* mag)
+        {
+            int16x8_t s00 = LoadU8(src0 + x - 1), s01 = LoadU8(src0 + x), s02 = LoadU8(src0 + x + 1);
+            int16x8_t s10 = LoadU8(src1 + x - 1), s12 = LoadU8(src1 + x + 1);
+            int16x8_t s20 = LoadU8(src2 + x - 1), s21 = LoadU8(src2 + x), s22 = LoadU8(src2 + x + 1);
+            int16x8_t _dx = vsubq_s16(vaddq_s16(vaddq_s16(s02, s22), vshlq_n_s16(s12, 1)), vaddq_s16(vaddq_s16(s00, s20), vshlq_n_s16(s10, 1)));
+            int16x8_t _dy = vsubq_s16(vaddq_s16(vaddq_s16(s20, s22), vshlq_n_s16(s21, 1)), vaddq_s16(vaddq_s16(s00, s02), vshlq_n_s16(s01, 1)));
+            vst1q_s16(dx + x, _dx);
+            vst1q_s16(dy + x, _dy);
+            vst1q_s16(mag + x, vaddq_s16(vabsq_s16(_dx), vabsq_s16(_dy)));
+        }
+
+        static void CannyGradientRow(const uint8_t* src0, const uint8_t* src1, const uint8_t* src2, size_t width, int16_t* dx, int16_t* dy, int16_t* mag)
+        {
+            if (width < HA + 2)
+            {
+                Base::CannyGradientRow(src0, src1, src2, width, dx, dy, mag);
+                return;
+            }
+            Base::CannyGradient(src0, src1, src2, 0, 0, 1, dx, dy, mag);
+            size_t x = 1;
+            for (; x + HA < width; x += HA)
+                CannyGradient(src0, src1, src2, x, dx, dy, mag);
+            if (x < width - 1)
+                CannyGradient(src0, src1, src2, width - 1 - HA, dx, dy, mag);
+            Base::CannyGradient(src0, src1, src2, width - 2, width - 1, width - 1, dx, dy, mag);
+        }
+
+        SIMD_INLINE uint16x8_t CannyLesser(int16x8_t a, int16x8_t b)
+        {
+            uint32x4_t lo = vcltq_s32(vshll_n_s16(vget_low_s16(a), 15), vmull_n_s16(vget_low_s16(b), Base::CANNY_TG22_NUM));
+            uint32x4_t hi = vcltq_s32(vshll_n_s16(vget_high_s16(a), 15), vmull_n_s16(vget_high_s16(b), Base::CANNY_TG22_NUM));
+            return vcombine_u16(vmovn_u32(lo), vmovn_u32(hi));
+        }
+
+        SIMD_INLINE void CannyNonMax(const int16_t* dx, const int16_t* dy, const int16_t* mag0, const int16_t* mag1, const int16_t* mag2,
+            size_t x, int16x8_t low, int16x8_t high, uint8_t* map)
+        {
+            int16x8_t _dx = vld1q_s16(dx + x);
+            int16x8_t _dy = vld1q_s16(dy + x);
+            int16x8_t m = vld1q_s16(mag1 + x);
+            int16x8_t ax = vabsq_s16(_dx), ay = vabsq_s16(_dy);
+            uint16x8_t hor = CannyLesser(ay, ax);
+            uint16x8_t ver = CannyLesser(ax, ay);
+            uint16x8_t neg = vcltq_s16(veorq_s16(_dx, _dy), vdupq_n_s16(0));
+            uint16x8_t hMax = vandq_u16(vcgtq_s16(m, vld1q_s16(mag1 + x - 1)), vcgeq_s16(m, vld1q_s16(mag1 + x + 1)));
+            uint16x8_t vMax = vandq_u16(vcgtq_s16(m, vld1q_s16(mag0 + x)), vcgeq_s16(m, vld1q_s16(mag2 + x)));
+            uint16x8_t pMax = vandq_u16(vcgtq_s16(m, vld1q_s16(mag0 + x - 1)), vcgtq_s16(m, vld1q_s16(mag2 + x + 1)));
+            uint16x8_t nMax = vandq_u16(vcgtq_s16(m, vld1q_s16(mag0 + x + 1)), vcgtq_s16(m, vld1q_s16(mag2 + x - 1)));
+            uint16x8_t max = vbslq_u16(hor, hMax, vbslq_u16(ver, vMax, vbslq_u16(neg, nMax, pMax)));
+            uint16x8_t weak = vandq_u16(max, vcgtq_s16(m, low));
+            uint16x8_t strong = vandq_u16(weak, vcgtq_s16(m, high));
+            uint16x8_t one = vdupq_n_u16(1);
+            vst1_u8(map + x, vmovn_u16(vaddq_u16(vandq_u16(weak, one), vandq_u16(strong, one))));
+        }
+
+        static void CannyNonMaxRow(const int16_t* dx, const int16_t* dy, const int16_t* mag0, const int16_t* mag1, const int16_t* mag2, size_t width, int16_t low, int16_t high, uint8_t* map)
+        {
+            if (width < HA)
+            {
+                Base::CannyNonMaxRow(dx, dy, mag0, mag1, mag2, width, low, high, map);
+                return;
+            }
+            int16x8_t _low = vdupq_n_s16(low), _high = vdupq_n_s16(high);
+            size_t widthHA = AlignLo(width, HA);
+            for (size_t x = 0; x < widthHA; x += HA)
+                CannyNonMax(dx, dy, mag0, mag1, mag2, x, _low, _high, map);
+            if (widthHA < width)
+                CannyNonMax(dx, dy, mag0, mag1, mag2, width - HA, _low, _high, map);
+        }
+
+        static void CannyEdgesRow(const uint8_t* map, size_t width, uint8_t* dst)
+        {
+            if (width < A)
+            {
+                Base::CannyEdgesRow(map, width, dst);
+                return;
+            }
+            uint8x16_t strong = vdupq_n_u8(2);
+            size_t widthA = AlignLo(width, A);
+            for (size_t x = 0; x < widthA; x += A)
+                vst1q_u8(dst + x, vceqq_u8(vld1q_u8(map + x), strong));
+            if (widthA < width)
+                vst1q_u8(dst + width - A, vceqq_u8(vld1q_u8(map + width - A), strong));
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        CannyEdgeDetector::CannyEdgeDetector()
+        {
+            _gradient = CannyGradientRow;
+            _nonMax = CannyNonMaxRow;
+            _edges = CannyEdgesRow;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void Canny(const uint8_t* src, size_t srcStride, size_t width, size_t height, int lowThreshold, int highThreshold, uint8_t* dst, size_t dstStride)
+        {
+            CannyEdgeDetector detector;
+            detector.Run(src, srcStride, width, height, lowThreshold, highThreshold, dst, dstStride);
+        }
+    }
+#endif
+}
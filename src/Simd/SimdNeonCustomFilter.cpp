@@ -0,0 +1,196 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdCustomFilter.h"
+
+namespace Simd
+{
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        static void ToFloat8u(const uint8_t* src, size_t size, float* dst)
+        {
+            size_t sizeDF = AlignLo(size, DF), i = 0;
+            for (; i < sizeDF; i += DF)
+            {
+                uint16x8_t u16 = vmovl_u8(vld1_u8(src + i));
+                vst1q_f32(dst + i + 0, vcvtq_f32_u32(vmovl_u16(vget_low_u16(u16))));
+                vst1q_f32(dst + i + F, vcvtq_f32_u32(vmovl_u16(vget_high_u16(u16))));
+            }
+            for (; i < size; ++i)
+                dst[i] = float(src[i]);
+        }
+
+        static void ToFloat16u(const uint8_t* src, size_t size, float* dst)
+        {
+            const uint16_t* src16u = (const uint16_t*)src;
+            size_t sizeDF = AlignLo(size, DF), i = 0;
+            for (; i < sizeDF; i += DF)
+            {
+                uint16x8_t u16 = vld1q_u16(src16u + i);
+                vst1q_f32(dst + i + 0, vcvtq_f32_u32(vmovl_u16(vget_low_u16(u16))));
+                vst1q_f32(dst + i + F, vcvtq_f32_u32(vmovl_u16(vget_high_u16(u16))));
+            }
+            for (; i < size; ++i)
+                dst[i] = float(src16u[i]);
+        }
+
+        SIMD_INLINE uint16x8_t ToUint16(const float* src)
+        {
+            return vcombine_u16(vqmovun_s32(Round(vld1q_f32(src + 0))), vqmovun_s32(Round(vld1q_f32(src + F))));
+        }
+
+        static void FromFloat8u(const float* src, size_t size, uint8_t* dst)
+        {
+            size_t sizeDF = AlignLo(size, DF), i = 0;
+            for (; i < sizeDF; i += DF)
+                vst1_u8(dst + i, vqmovn_u16(ToUint16(src + i)));
+            for (; i < size; ++i)
+                dst[i] = (uint8_t)Base::CustomFilterRound(src[i], 255.0f);
+        }
+
+        static void FromFloat16u(const float* src, size_t size, uint8_t* dst)
+        {
+            uint16_t* dst16u = (uint16_t*)dst;
+            size_t sizeDF = AlignLo(size, DF), i = 0;
+            for (; i < sizeDF; i += DF)
+                vst1q_u16(dst16u + i, ToUint16(src + i));
+            for (; i < size; ++i)
+                dst16u[i] = (uint16_t)Base::CustomFilterRound(src[i], 65535.0f);
+        }
+        template<bool add> void RowFilter(const float* src, size_t size, size_t step, const float* weight, size_t kernel, float* dst)
+        {
+            size_t sizeQF = AlignLo(size, QF), sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeQF; i += QF)
+            {
+                float32x4_t s0 = add ? vld1q_f32(dst + i + 0 * F) : vdupq_n_f32(0.0f);
+                float32x4_t s1 = add ? vld1q_f32(dst + i + 1 * F) : vdupq_n_f32(0.0f);
+                float32x4_t s2 = add ? vld1q_f32(dst + i + 2 * F) : vdupq_n_f32(0.0f);
+                float32x4_t s3 = add ? vld1q_f32(dst + i + 3 * F) : vdupq_n_f32(0.0f);
+                for (size_t k = 0; k < kernel; ++k)
+                {
+                    const float* ps = src + i + k * step;
+                    float32x4_t w = vdupq_n_f32(weight[k]);
+                    s0 = vmlaq_f32(s0, w, vld1q_f32(ps + 0 * F));
+                    s1 = vmlaq_f32(s1, w, vld1q_f32(ps + 1 * F));
+                    s2 = vmlaq_f32(s2, w, vld1q_f32(ps + 2 * F));
+                    s3 = vmlaq_f32(s3, w, vld1q_f32(ps + 3 * F));
+                }
+                vst1q_f32(dst + i + 0 * F, s0);
+                vst1q_f32(dst + i + 1 * F, s1);
+                vst1q_f32(dst + i + 2 * F, s2);
+                vst1q_f32(dst + i + 3 * F, s3);
+            }
+            for (; i < sizeF; i += F)
+            {
+                float32x4_t s0 = add ? vld1q_f32(dst + i) : vdupq_n_f32(0.0f);
+                for (size_t k = 0; k < kernel; ++k)
+                    s0 = vmlaq_f32(s0, vdupq_n_f32(weight[k]), vld1q_f32(src + i + k * step));
+                vst1q_f32(dst + i, s0);
+            }
+            for (; i < size; ++i)
+            {
+                float sum = add ? dst[i] : 0.0f;
+                for (size_t k = 0; k < kernel; ++k)
+                    sum += weight[k] * src[i + k * step];
+                dst[i] = sum;
+            }
+        }
+
+        static void ColFilter(const float* const* rows, size_t size, const float* weight, size_t kernel, float* dst)
+        {
+            size_t sizeQF = AlignLo(size, QF), sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeQF; i += QF)
+            {
+                float32x4_t s0 = vdupq_n_f32(0.0f);
+                float32x4_t s1 = vdupq_n_f32(0.0f);
+                float32x4_t s2 = vdupq_n_f32(0.0f);
+                float32x4_t s3 = vdupq_n_f32(0.0f);
+                for (size_t k = 0; k < kernel; ++k)
+                {
+                    const float* ps = rows[k] + i;
+                    float32x4_t w = vdupq_n_f32(weight[k]);
+                    s0 = vmlaq_f32(s0, w, vld1q_f32(ps + 0 * F));
+                    s1 = vmlaq_f32(s1, w, vld1q_f32(ps + 1 * F));
+                    s2 = vmlaq_f32(s2, w, vld1q_f32(ps + 2 * F));
+                    s3 = vmlaq_f32(s3, w, vld1q_f32(ps + 3 * F));
+                }
+                vst1q_f32(dst + i + 0 * F, s0);
+                vst1q_f32(dst + i + 1 * F, s1);
+                vst1q_f32(dst + i + 2 * F, s2);
+                vst1q_f32(dst + i + 3 * F, s3);
+            }
+            for (; i < sizeF; i += F)
+            {
+                float32x4_t s0 = vdupq_n_f32(0.0f);
+                for (size_t k = 0; k < kernel; ++k)
+                    s0 = vmlaq_f32(s0, vdupq_n_f32(weight[k]), vld1q_f32(rows[k] + i));
+                vst1q_f32(dst + i, s0);
+            }
+            for (; i < size; ++i)
+            {
+                float sum = 0.0f;
+                for (size_t k = 0; k < kernel; ++k)
+                    sum += weight[k] * rows[k][i];
+                dst[i] = sum;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        CustomFilterDefault::CustomFilterDefault(const CustomFilterParam& param, const float* kernelX, const float* kernelY)
+            : Base::CustomFilterDefault(param, kernelX, kernelY)
+        {
+            switch (_param.type)
+            {
+            case SimdFilterChannel8u: _toFloat = ToFloat8u, _fromFloat = FromFloat8u; break;
+            case SimdFilterChannel16u: _toFloat = ToFloat16u, _fromFloat = FromFloat16u; break;
+            default: break;
+            }
+            _rowFilter = RowFilter<false>;
+            _rowFilterAdd = RowFilter<true>;
+            _colFilter = ColFilter;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* CustomFilterSeparableInit(size_t width, size_t height, size_t channels, SimdFilterChannelType type, const float* kernelX, size_t sizeX, const float* kernelY, size_t sizeY, SimdFilterBorderType border)
+        {
+            CustomFilterParam param(width, height, channels, type, sizeX, sizeY, true, border, sizeof(void*));
+            if (!param.Valid() || kernelX == NULL || kernelY == NULL)
+                return NULL;
+            return new CustomFilterDefault(param, kernelX, kernelY);
+        }
+
+        void* CustomFilter2dInit(size_t width, size_t height, size_t channels, SimdFilterChannelType type, const float* kernel, size_t sizeX, size_t sizeY, SimdFilterBorderType border)
+        {
+            CustomFilterParam param(width, height, channels, type, sizeX, sizeY, false, border, sizeof(void*));
+            if (!param.Valid() || kernel == NULL)
+                return NULL;
+            return new CustomFilterDefault(param, kernel, NULL);
+        }
+    }
+#endif
+}
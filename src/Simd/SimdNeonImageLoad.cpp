@@ -145,6 +145,29 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        ImageQoiLoader::ImageQoiLoader(const ImageLoaderParam& param)
+            : Base::ImageQoiLoader(param)
+        {
+        }
+
+        void ImageQoiLoader::SetConverters()
+        {
+            Base::ImageQoiLoader::SetConverters();
+            if (_image.width >= A)
+            {
+                switch (_param.format)
+                {
+                case SimdPixelFormatGray8: _toAny = Neon::RgbaToGray; break;
+                case SimdPixelFormatBgr24: _toAny = Neon::BgraToRgb; break;
+                case SimdPixelFormatBgra32: _toAny = Neon::BgraToRgba; break;
+                case SimdPixelFormatRgb24: _toAny = Neon::BgraToBgr; break;
+                default: break;
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
         ImageLoader* CreateImageLoader(const ImageLoaderParam& param)
         {
             switch (param.file)
@@ -156,6 +179,8 @@ namespace Simd
             case SimdImageFilePng: return new Base::ImagePngLoader(param);
             case SimdImageFileJpeg: return new Base::ImageJpegLoader(param);
             case SimdImageFileBmp: return new ImageBmpLoader(param);
+            case SimdImageFileQoi: return new ImageQoiLoader(param);
+            case SimdImageFileRaw: return new Base::ImageRawLoader(param);
             default:
                 return NULL;
             }
@@ -175,6 +200,48 @@ namespace Simd
             }
             return NULL;
         }
+
+        uint8_t* ImageLoadFromMemoryScaled(const uint8_t* data, size_t size, size_t scale, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format)
+        {
+            ImageLoaderParam param(data, size, *format, scale);
+            if (param.Validate())
+            {
+                Holder<ImageLoader> loader(CreateImageLoader(param));
+                if (loader)
+                {
+                    if (loader->FromStream())
+                        return loader->Release(stride, width, height, format);
+                }
+            }
+            return NULL;
+        }
+
+        bool ImageLoadBandsFromMemory(const uint8_t* data, size_t size, SimdPixelFormatType format, SimdImageBandCallbackPtr callback, void* user)
+        {
+            ImageLoaderParam param(data, size, format);
+            if (param.Validate() && callback)
+            {
+                Holder<ImageLoader> loader(CreateImageLoader(param));
+                if (loader)
+                    return loader->ToBands(callback, user);
+            }
+            return false;
+        }
+
+        uint8_t* ImageLoadRoiFromMemory(const uint8_t* data, size_t size, size_t left, size_t top, size_t right, size_t bottom, size_t* stride, size_t* width, size_t* height, SimdPixelFormatType* format)
+        {
+            ImageLoaderParam param(data, size, *format);
+            if (param.Validate())
+            {
+                Holder<ImageLoader> loader(CreateImageLoader(param));
+                if (loader)
+                {
+                    if (loader->FromStreamRoi(left, top, right, bottom))
+                        return loader->Release(stride, width, height, format);
+                }
+            }
+            return NULL;
+        }
     }
 #endif
 }
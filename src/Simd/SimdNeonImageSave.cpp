@@ -125,6 +125,8 @@ namespace Simd
             case SimdImageFilePng: return new ImagePngSaver(param);
             case SimdImageFileJpeg: return new ImageJpegSaver(param);
             case SimdImageFileBmp: return new ImageBmpSaver(param);
+            case SimdImageFileQoi: return new ImageQoiSaver(param);
+            case SimdImageFileRaw: return new Base::ImageRawSaver(param);
             default:
                 return NULL;
             }
@@ -144,6 +146,18 @@ namespace Simd
             }
             return NULL;
         }
+
+        bool ImageSaveToSink(const uint8_t* src, size_t stride, size_t width, size_t height, SimdPixelFormatType format, SimdImageFileType file, int quality, SimdImageWriteCallbackPtr callback, void* user)
+        {
+            ImageSaverParam param(width, height, format, file, quality);
+            if (param.Validate() && callback)
+            {
+                Holder<ImageSaver> saver(CreateImageSaver(param));
+                if (saver)
+                    return saver->ToSink(src, stride, callback, user);
+            }
+            return false;
+        }
     }
 #endif
 }
@@ -73,86 +73,9 @@ namespace Simd
 
         void ZlibCompress(uint8_t* data, int size, int quality, OutputMemoryStream& stream)
         {
-            const int ZHASH = 16384;
-            if (quality < 5)
-                quality = 5;
-            const int basket = quality * 2;
-            Array32i hashTable(ZHASH * basket);
-            memset(hashTable.data, -1, hashTable.RawSize());
-
             stream.Write(uint8_t(0x78));
             stream.Write(uint8_t(0x5e));
-            stream.WriteBits(1, 1);
-            stream.WriteBits(1, 2);
-
-            int i = 0, j;
-            while (i < size - 3)
-            {
-                int h = Base::ZlibHash(data + i) & (ZHASH - 1), best = 3;
-                uint8_t* bestLoc = 0;
-                int* hList = hashTable.data + h * basket;
-                for (j = 0; hList[j] != -1 && j < basket; ++j)
-                {
-                    if (hList[j] > i - 32768)
-                    {
-                        int d = Base::ZlibCount(data + hList[j], data + i, size - i);
-                        if (d >= best)
-                        {
-                            best = d;
-                            bestLoc = data + hList[j];
-                        }
-                    }
-                }
-                if (j == basket)
-                {
-                    memcpy(hList, hList + quality, quality * sizeof(int));
-                    memset(hList + quality, -1, quality * sizeof(int));
-                    j = quality;
-                }
-                hList[j] = i;
-
-                if (bestLoc)
-                {
-                    h = Base::ZlibHash(data + i + 1) & (ZHASH - 1);
-                    int* hList = hashTable.data + h * basket;
-                    for (j = 0; hList[j] != -1 && j < basket; ++j)
-                    {
-                        if (hList[j] > i - 32767)
-                        {
-                            int e = Base::ZlibCount(data + hList[j], data + i + 1, size - i - 1);
-                            if (e > best)
-                            {
-                                bestLoc = NULL;
-                                break;
-                            }
-                        }
-                    }
-                }
-
-                if (bestLoc)
-                {
-                    int d = (int)(data + i - bestLoc);
-                    assert(d <= 32767 && best <= 258);
-                    for (j = 0; best > Base::ZlibLenC[j + 1] - 1; ++j);
-                    Base::ZlibHuff(j + 257, stream);
-                    if (Base::ZlibLenEb[j])
-                        stream.WriteBits(best - Base::ZlibLenC[j], Base::ZlibLenEb[j]);
-                    for (j = 0; d > Base::ZlibDistC[j + 1] - 1; ++j);
-                    stream.WriteBits(Base::ZlibBitRev(j, 5), 5);
-                    if (Base::ZlibDistEb[j])
-                        stream.WriteBits(d - Base::ZlibDistC[j], Base::ZlibDistEb[j]);
-                    i += best;
-                }
-                else
-                {
-                    Base::ZlibHuffB(data[i], stream);
-                    ++i;
-                }
-            }
-            for (; i < size; ++i)
-                Base::ZlibHuffB(data[i], stream);
-            Base::ZlibHuff(256, stream);
-            stream.FlushBits();
+            Base::ZlibDeflate<Neon::ZlibCount>(data, size, quality, true, stream);
             stream.WriteBe32u(ZlibAdler32(data, size));
         }
 
@@ -403,6 +326,8 @@ namespace Simd
             _encode[5] = Neon::EncodeLine5;
             _encode[6] = Neon::EncodeLine6;
             _compress = Neon::ZlibCompress;
+            _deflate = Base::ZlibDeflate<Neon::ZlibCount>;
+            _adler32 = Neon::ZlibAdler32;
         }
     }
 #endif// SIMD_NEON_ENABLE
@@ -0,0 +1,95 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdImageSave.h"
+#include "Simd/SimdImageQoi.h"
+#include "Simd/SimdNeon.h"
+
+namespace Simd
+{
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        SIMD_INLINE uint32x4_t QoiCodes(uint8x16_t px, uint8x16_t pr)
+        {
+            const uint32x4_t zero = vdupq_n_u32(0);
+            uint8x16_t dv = vsubq_u8(px, pr);
+            uint32x4_t dv32 = vreinterpretq_u32_u8(dv);
+            uint32x4_t alphaEq = vceqq_u32(vandq_u32(dv32, vdupq_n_u32(0xFF000000)), zero);
+            uint32x4_t b1 = vreinterpretq_u32_u8(vaddq_u8(dv, vreinterpretq_u8_u32(vdupq_n_u32(0x00020202))));
+            uint32x4_t diffOk = vceqq_u32(vandq_u32(b1, vdupq_n_u32(0x00FCFCFC)), zero);
+            uint32x4_t diff = vorrq_u32(vorrq_u32(vdupq_n_u32(Base::QoiOpDiff), vshlq_n_u32(vandq_u32(b1, vdupq_n_u32(0x3)), 4)),
+                vorrq_u32(vandq_u32(vshrq_n_u32(b1, 6), vdupq_n_u32(0xC)), vandq_u32(vshrq_n_u32(b1, 16), vdupq_n_u32(0x3))));
+            uint32x4_t dg = vandq_u32(vshrq_n_u32(dv32, 8), vdupq_n_u32(0xFF));
+            dg = vorrq_u32(dg, vshlq_n_u32(dg, 16));
+            uint32x4_t lv = vreinterpretq_u32_u8(vaddq_u8(vsubq_u8(dv, vreinterpretq_u8_u32(dg)), vreinterpretq_u8_u32(vdupq_n_u32(0x00082008))));
+            uint32x4_t lumaOk = vceqq_u32(vandq_u32(lv, vdupq_n_u32(0x00F0C0F0)), zero);
+            uint32x4_t luma = vorrq_u32(vorrq_u32(vdupq_n_u32(Base::QoiOpLuma << 8), vandq_u32(lv, vdupq_n_u32(0x3F00))),
+                vorrq_u32(vshlq_n_u32(vandq_u32(lv, vdupq_n_u32(0xF)), 4), vandq_u32(vshrq_n_u32(lv, 16), vdupq_n_u32(0xF))));
+            uint32x4_t code = vandq_u32(luma, lumaOk);
+            code = vbslq_u32(diffOk, diff, code);
+            code = vbslq_u32(alphaEq, code, vdupq_n_u32(Base::QoiCodeRgba));
+            uint8x16_t weighted = vmulq_u8(px, vreinterpretq_u8_u32(vdupq_n_u32(0x0B070503)));
+            uint32x4_t hash = vandq_u32(vpaddlq_u16(vpaddlq_u8(weighted)), vdupq_n_u32(63));
+            return vorrq_u32(code, vshlq_n_u32(hash, 16));
+        }
+
+        void QoiEncodeCodes(const uint8_t* rgba, size_t size, uint32_t prev, uint32_t* codes)
+        {
+            if (size == 0)
+                return;
+            const uint32_t* src = (const uint32_t*)rgba;
+            codes[0] = Base::QoiCode(src[0], prev);
+            size_t i = 1;
+            for (; i + 4 <= size; i += 4)
+            {
+                uint8x16_t px = vld1q_u8(rgba + i * 4);
+                uint8x16_t pr = vld1q_u8(rgba + i * 4 - 4);
+                vst1q_u32(codes + i, QoiCodes(px, pr));
+            }
+            for (; i < size; ++i)
+                codes[i] = Base::QoiCode(src[i], src[i - 1]);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        ImageQoiSaver::ImageQoiSaver(const ImageSaverParam& param)
+            : Base::ImageQoiSaver(param)
+        {
+            _encodeCodes = Neon::QoiEncodeCodes;
+            if (_param.width >= A)
+            {
+                switch (_param.format)
+                {
+                case SimdPixelFormatGray8: _toRgba = Neon::GrayToBgra; break;
+                case SimdPixelFormatBgr24: _toRgba = Neon::RgbToBgra; break;
+                case SimdPixelFormatBgra32: _convert = Neon::BgraToRgba; break;
+                case SimdPixelFormatRgb24: _toRgba = Neon::BgrToBgra; break;
+                default: break;
+                }
+            }
+        }
+    }
+#endif
+}
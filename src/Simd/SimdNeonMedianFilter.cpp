@@ -24,6 +24,7 @@
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdLoadBlock.h"
 #include "Simd/SimdStore.h"
+#include "Simd/SimdMedianFilter.h"
 
 namespace Simd
 {
@@ -647,6 +648,29 @@ namespace Simd
             else
                 MedianFilterSquare5x5<false>(src, srcStride, width, height, channelCount, dst, dstStride);
         }
+
+        //-----------------------------------------------------------------------------------------
+
+        struct MedianHist16
+        {
+            static SIMD_INLINE void Add(const uint16_t* src, uint16_t* dst)
+            {
+                for (size_t i = 0; i < 16; i += HA)
+                    vst1q_u16(dst + i, vaddq_u16(vld1q_u16(dst + i), vld1q_u16(src + i)));
+            }
+
+            static SIMD_INLINE void Update(const uint16_t* add, const uint16_t* sub, uint16_t* dst)
+            {
+                for (size_t i = 0; i < 16; i += HA)
+                    vst1q_u16(dst + i, vaddq_u16(vld1q_u16(dst + i), vsubq_u16(vld1q_u16(add + i), vld1q_u16(sub + i))));
+            }
+        };
+
+        void MedianFilterSquare(const uint8_t* src, size_t srcStride, size_t width, size_t height,
+            size_t channelCount, size_t radius, uint8_t* dst, size_t dstStride)
+        {
+            Base::MedianFilterSquare<MedianHist16>(src, srcStride, width, height, channelCount, radius, dst, dstStride);
+        }
     }
 #endif// SIMD_NEON_ENABLE
 }
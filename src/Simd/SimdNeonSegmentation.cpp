@@ -24,6 +24,7 @@
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdStore.h"
 #include "Simd/SimdCompare.h"
+#include "Simd/SimdSegmentation.h"
 
 namespace Simd
 {
@@ -288,6 +289,40 @@ namespace Simd
                 }
             }
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static size_t SegmentationRuns(const uint8_t* mask, size_t width, uint8_t index, int32_t* runs)
+        {
+            int32_t* dst = runs;
+            bool in = false;
+            uint8x16_t _index = vdupq_n_u8(index);
+            size_t widthA = AlignLo(width, A), x = 0;
+            for (; x < widthA; x += A)
+            {
+                uint64x2_t eq = vreinterpretq_u64_u8(vceqq_u8(vld1q_u8(mask + x), _index));
+                uint64_t lo = vgetq_lane_u64(eq, 0), hi = vgetq_lane_u64(eq, 1);
+                if (in ? (lo & hi) == uint64_t(-1) : (lo | hi) == 0)
+                    continue;
+                Base::SegmentationRunsBytes(mask + x, A, index, (int32_t)x, in, dst);
+            }
+            Base::SegmentationRunsBytes(mask + x, width - x, index, (int32_t)x, in, dst);
+            if (in)
+                *dst++ = (int32_t)width;
+            return (dst - runs) / 2;
+        }
+
+        SegmentationComponentLabeler::SegmentationComponentLabeler()
+        {
+            _runs = SegmentationRuns;
+        }
+
+        size_t SegmentationLabelComponents(const uint8_t* mask, size_t maskStride, size_t width, size_t height, uint8_t index,
+            SimdSegmentationConnectivityType connectivity, uint32_t* labels, size_t labelsStride, SimdSegmentationComponent** components)
+        {
+            SegmentationComponentLabeler labeler;
+            return labeler.Run(mask, maskStride, width, height, index, connectivity, labels, labelsStride, components);
+        }
     }
 #endif//SIMD_NEON_ENABLE
 }
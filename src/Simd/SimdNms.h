@@ -0,0 +1,118 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdNms_h__
+#define __SimdNms_h__
+
+#include "Simd/SimdMath.h"
+#include "Simd/SimdArray.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        struct NmsBoxes
+        {
+            float* x0, * y0, * x1, * y1, * area, * score;
+            int32_t* cls;
+            uint32_t* idx;
+        };
+
+        SIMD_INLINE float NmsIou(float ax0, float ay0, float ax1, float ay1, float aArea, float bx0, float by0, float bx1, float by1, float bArea)
+        {
+            float w = Simd::Max(Simd::Min(ax1, bx1) - Simd::Max(ax0, bx0), 0.0f);
+            float h = Simd::Max(Simd::Min(ay1, by1) - Simd::Max(ay0, by0), 0.0f);
+            float inter = w * h;
+            float uni = aArea + bArea - inter;
+            return uni > 0.0f ? inter / uni : 0.0f;
+        }
+
+        SIMD_INLINE float NmsDecay(float score, float iou, SimdNmsType type, float threshold, float sigma)
+        {
+            switch (type)
+            {
+            case SimdNmsHard: return iou > threshold ? -FLT_MAX : score;
+            case SimdNmsSoftLinear: return iou > threshold ? score * (1.0f - iou) : score;
+            case SimdNmsSoftGaussian: return score * ::expf(-iou * iou / sigma);
+            default: assert(0); return score;
+            }
+        }
+
+        typedef size_t (*NmsFilterPtr)(const float* scores, size_t size, float threshold, uint32_t* idx);
+        typedef void (*NmsSuppressPtr)(const NmsBoxes& boxes, size_t curr, size_t begin, size_t end, SimdNmsType type, float threshold, float sigma);
+
+        size_t NmsFilter(const float* scores, size_t size, float threshold, uint32_t* idx);
+
+        void NmsSuppress(const NmsBoxes& boxes, size_t curr, size_t begin, size_t end, SimdNmsType type, float threshold, float sigma);
+
+        size_t NmsRun(const float* boxes, size_t stride, const float* scores, const uint32_t* classes, size_t size, float scoreThreshold, size_t topK,
+            SimdNmsType type, float iouThreshold, float sigma, size_t keepTopK, uint32_t* indices, float* outScores, NmsFilterPtr filter, NmsSuppressPtr suppress);
+
+        //-------------------------------------------------------------------------------------------------
+
+        void NmsDecodeBoxes32f(const float* src, const float* anchors, size_t size, size_t stride, SimdBoxDecodeType type, const float* params, float* dst);
+
+        void NmsIou32f(const float* boxes, size_t stride, size_t size, const float* box, float* iou);
+
+        size_t Nms32f(const float* boxes, size_t stride, const float* scores, const uint32_t* classes, size_t size, float scoreThreshold, size_t topK,
+            SimdNmsType type, float iouThreshold, float sigma, size_t keepTopK, uint32_t* indices, float* outScores);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        void NmsDecodeBoxes32f(const float* src, const float* anchors, size_t size, size_t stride, SimdBoxDecodeType type, const float* params, float* dst);
+
+        void NmsIou32f(const float* boxes, size_t stride, size_t size, const float* box, float* iou);
+
+        size_t Nms32f(const float* boxes, size_t stride, const float* scores, const uint32_t* classes, size_t size, float scoreThreshold, size_t topK,
+            SimdNmsType type, float iouThreshold, float sigma, size_t keepTopK, uint32_t* indices, float* outScores);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        void NmsDecodeBoxes32f(const float* src, const float* anchors, size_t size, size_t stride, SimdBoxDecodeType type, const float* params, float* dst);
+
+        void NmsIou32f(const float* boxes, size_t stride, size_t size, const float* box, float* iou);
+
+        size_t Nms32f(const float* boxes, size_t stride, const float* scores, const uint32_t* classes, size_t size, float scoreThreshold, size_t topK,
+            SimdNmsType type, float iouThreshold, float sigma, size_t keepTopK, uint32_t* indices, float* outScores);
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        void NmsDecodeBoxes32f(const float* src, const float* anchors, size_t size, size_t stride, SimdBoxDecodeType type, const float* params, float* dst);
+
+        void NmsIou32f(const float* boxes, size_t stride, size_t size, const float* box, float* iou);
+
+        size_t Nms32f(const float* boxes, size_t stride, const float* scores, const uint32_t* classes, size_t size, float scoreThreshold, size_t topK,
+            SimdNmsType type, float iouThreshold, float sigma, size_t keepTopK, uint32_t* indices, float* outScores);
+    }
+#endif
+}
+
+#endif
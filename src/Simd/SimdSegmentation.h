@@ -0,0 +1,130 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSegmentation_h__
+#define __SimdSegmentation_h__
+
+#include "Simd/SimdMath.h"
+
+#include <vector>
+
+namespace Simd
+{
+    namespace Base
+    {
+        SIMD_INLINE void SegmentationRunsBytes(const uint8_t* mask, size_t size, uint8_t index, int32_t x, bool& in, int32_t*& runs)
+        {
+            for (size_t i = 0; i < size; ++i, ++x)
+            {
+                bool on = mask[i] == index;
+                *runs = x;
+                runs += int(on != in);
+                in = on;
+            }
+        }
+
+        template<class T> SIMD_INLINE void SegmentationRunsBits(T bits, size_t size, int32_t x, bool& in, int32_t*& runs)
+        {
+            T edges = bits ^ ((bits << 1) | T(in ? 1 : 0));
+            if (size < sizeof(T) * 8)
+                edges &= (T(1) << size) - 1;
+            for (; edges; edges >>= 1, ++x)
+            {
+                *runs = x;
+                runs += int(edges & 1);
+            }
+            in = ((bits >> (size - 1)) & 1) != 0;
+        }
+
+        size_t SegmentationRuns(const uint8_t* mask, size_t width, uint8_t index, int32_t* runs);
+
+        //-------------------------------------------------------------------------------------------------
+
+        class SegmentationComponentLabeler
+        {
+        public:
+            SegmentationComponentLabeler();
+
+            size_t Run(const uint8_t* mask, size_t maskStride, size_t width, size_t height, uint8_t index,
+                SimdSegmentationConnectivityType connectivity, uint32_t* labels, size_t labelsStride, SimdSegmentationComponent** components);
+
+            typedef size_t(*RunsPtr)(const uint8_t* mask, size_t width, uint8_t index, int32_t* runs);
+
+        protected:
+            struct Strip
+            {
+                size_t begin, end;
+                std::vector<int32_t> runs;
+                std::vector<uint32_t> rows, parent;
+            };
+
+            RunsPtr _runs;
+        };
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        class SegmentationComponentLabeler : public Base::SegmentationComponentLabeler
+        {
+        public:
+            SegmentationComponentLabeler();
+        };
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class SegmentationComponentLabeler : public Sse41::SegmentationComponentLabeler
+        {
+        public:
+            SegmentationComponentLabeler();
+        };
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class SegmentationComponentLabeler : public Avx2::SegmentationComponentLabeler
+        {
+        public:
+            SegmentationComponentLabeler();
+        };
+    }
+#endif
+
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        class SegmentationComponentLabeler : public Base::SegmentationComponentLabeler
+        {
+        public:
+            SegmentationComponentLabeler();
+        };
+    }
+#endif
+}
+
+#endif
@@ -0,0 +1,143 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdCanny.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        SIMD_INLINE __m128i LoadU8(const uint8_t* src)
+        {
+            return _mm_cvtepu8_epi16(_mm_loadl_epi64((__m128i*)src));
+        }
+
+        SIMD_INLINE void CannyGradient(const uint8_t* src0, const uint8_t* src1, const uint8_t* src2, size_t x, int16_t* dx, int16_t* dy, int16_t* mag)
+        {
+            __m128i s00 = LoadU8(src0 + x - 1), s01 = LoadU8(src0 + x), s02 = LoadU8(src0 + x + 1);
+            __m128i s10 = LoadU8(src1 + x - 1), s12 = LoadU8(src1 + x + 1);
+            __m128i s20 = LoadU8(src2 + x - 1), s21 = LoadU8(src2 + x), s22 = LoadU8(src2 + x + 1);
+            __m128i _dx = _mm_sub_epi16(_mm_add_epi16(_mm_add_epi16(s02, s22), _mm_slli_epi16(s12, 1)), _mm_add_epi16(_mm_add_epi16(s00, s20), _mm_slli_epi16(s10, 1)));
+            __m128i _dy = _mm_sub_epi16(_mm_add_epi16(_mm_add_epi16(s20, s22), _mm_slli_epi16(s21, 1)), _mm_add_epi16(_mm_add_epi16(s00, s02), _mm_slli_epi16(s01, 1)));
+            _mm_storeu_si128((__m128i*)(dx + x), _dx);
+            _mm_storeu_si128((__m128i*)(dy + x), _dy);
+            _mm_storeu_si128((__m128i*)(mag + x), _mm_add_epi16(_mm_abs_epi16(_dx), _mm_abs_epi16(_dy)));
+        }
+
+        static void CannyGradientRow(const uint8_t* src0, const uint8_t* src1, const uint8_t* src2, size_t width, int16_t* dx, int16_t* dy, int16_t* mag)
+        {
+            if (width < HA + 2)
+            {
+                Base::CannyGradientRow(src0, src1, src2, width, dx, dy, mag);
+                return;
+            }
+            Base::CannyGradient(src0, src1, src2, 0, 0, 1, dx, dy, mag);
+            size_t x = 1;
+            for (; x + HA < width; x += HA)
+                CannyGradient(src0, src1, src2, x, dx, dy, mag);
+            if (x < width - 1)
+                CannyGradient(src0, src1, src2, width - 1 - HA, dx, dy, mag);
+            Base::CannyGradient(src0, src1, src2, width - 2, width - 1, width - 1, dx, dy, mag);
+        }
+
+        SIMD_INLINE __m128i CannyGreater(__m128i a, __m128i b)
+        {
+            return _mm_cmpgt_epi32(_mm_madd_epi16(a, b), _mm_setzero_si128());
+        }
+
+        SIMD_INLINE void CannyNonMax(const int16_t* dx, const int16_t* dy, const int16_t* mag0, const int16_t* mag1, const int16_t* mag2,
+            size_t x, __m128i low, __m128i high, __m128i kHor, __m128i kVer, uint8_t* map)
+        {
+            __m128i _dx = _mm_loadu_si128((__m128i*)(dx + x));
+            __m128i _dy = _mm_loadu_si128((__m128i*)(dy + x));
+            __m128i m = _mm_loadu_si128((__m128i*)(mag1 + x));
+            __m128i ax = _mm_abs_epi16(_dx), ay = _mm_abs_epi16(_dy);
+            __m128i lo = _mm_unpacklo_epi16(ax, ay), hi = _mm_unpackhi_epi16(ax, ay);
+            __m128i hor = _mm_packs_epi32(CannyGreater(lo, kHor), CannyGreater(hi, kHor));
+            __m128i ver = _mm_packs_epi32(CannyGreater(lo, kVer), CannyGreater(hi, kVer));
+            __m128i neg = _mm_srai_epi16(_mm_xor_si128(_dx, _dy), 15);
+            __m128i hMax = _mm_andnot_si128(_mm_cmpgt_epi16(_mm_loadu_si128((__m128i*)(mag1 + x + 1)), m), _mm_cmpgt_epi16(m, _mm_loadu_si128((__m128i*)(mag1 + x - 1))));
+            __m128i vMax = _mm_andnot_si128(_mm_cmpgt_epi16(_mm_loadu_si128((__m128i*)(mag2 + x)), m), _mm_cmpgt_epi16(m, _mm_loadu_si128((__m128i*)(mag0 + x))));
+            __m128i pMax = _mm_and_si128(_mm_cmpgt_epi16(m, _mm_loadu_si128((__m128i*)(mag0 + x - 1))), _mm_cmpgt_epi16(m, _mm_loadu_si128((__m128i*)(mag2 + x + 1))));
+            __m128i nMax = _mm_and_si128(_mm_cmpgt_epi16(m, _mm_loadu_si128((__m128i*)(mag0 + x + 1))), _mm_cmpgt_epi16(m, _mm_loadu_si128((__m128i*)(mag2 + x - 1))));
+            __m128i max = _mm_blendv_epi8(_mm_blendv_epi8(_mm_blendv_epi8(pMax, nMax, neg), vMax, ver), hMax, hor);
+            __m128i weak = _mm_and_si128(max, _mm_cmpgt_epi16(m, low));
+            __m128i strong = _mm_and_si128(weak, _mm_cmpgt_epi16(m, high));
+            __m128i value = _mm_sub_epi16(_mm_setzero_si128(), _mm_add_epi16(weak, strong));
+            _mm_storel_epi64((__m128i*)(map + x), _mm_packus_epi16(value, _mm_setzero_si128()));
+        }
+
+        static void CannyNonMaxRow(const int16_t* dx, const int16_t* dy, const int16_t* mag0, const int16_t* mag1, const int16_t* mag2, size_t width, int16_t low, int16_t high, uint8_t* map)
+        {
+            if (width < HA)
+            {
+                Base::CannyNonMaxRow(dx, dy, mag0, mag1, mag2, width, low, high, map);
+                return;
+            }
+            __m128i _low = _mm_set1_epi16(low), _high = _mm_set1_epi16(high);
+            __m128i kHor = _mm_unpacklo_epi16(_mm_set1_epi16(Base::CANNY_TG22_NUM), _mm_set1_epi16(-Base::CANNY_TG22_DEN));
+            __m128i kVer = _mm_unpacklo_epi16(_mm_set1_epi16(-Base::CANNY_TG22_DEN), _mm_set1_epi16(Base::CANNY_TG22_NUM));
+            size_t widthHA = AlignLo(width, HA);
+            for (size_t x = 0; x < widthHA; x += HA)
+                CannyNonMax(dx, dy, mag0, mag1, mag2, x, _low, _high, kHor, kVer, map);
+            if (widthHA < width)
+                CannyNonMax(dx, dy, mag0, mag1, mag2, width - HA, _low, _high, kHor, kVer, map);
+        }
+
+        static void CannyEdgesRow(const uint8_t* map, size_t width, uint8_t* dst)
+        {
+            if (width < A)
+            {
+                Base::CannyEdgesRow(map, width, dst);
+                return;
+            }
+            __m128i strong = _mm_set1_epi8(2);
+            size_t widthA = AlignLo(width, A);
+            for (size_t x = 0; x < widthA; x += A)
+                _mm_storeu_si128((__m128i*)(dst + x), _mm_cmpeq_epi8(_mm_loadu_si128((__m128i*)(map + x)), strong));
+            if (widthA < width)
+                _mm_storeu_si128((__m128i*)(dst + width - A), _mm_cmpeq_epi8(_mm_loadu_si128((__m128i*)(map + width - A)), strong));
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        CannyEdgeDetector::CannyEdgeDetector()
+        {
+            _gradient = CannyGradientRow;
+            _nonMax = CannyNonMaxRow;
+            _edges = CannyEdgesRow;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void Canny(const uint8_t* src, size_t srcStride, size_t width, size_t height, int lowThreshold, int highThreshold, uint8_t* dst, size_t dstStride)
+        {
+            CannyEdgeDetector detector;
+            detector.Run(src, srcStride, width, height, lowThreshold, highThreshold, dst, dstStride);
+        }
+    }
+#endif
+}
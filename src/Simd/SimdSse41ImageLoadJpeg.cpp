@@ -23,6 +23,7 @@
 */
 #include "Simd/SimdImageLoad.h"
 #include "Simd/SimdImageLoadJpeg.h"
+#include "Simd/SimdImageLoadJpegCommon.h"
 #include "Simd/SimdArray.h"
 #include "Simd/SimdCpu.h"
 #include "Simd/SimdBase.h"
@@ -39,77 +40,13 @@ namespace Simd
     {
         static void JpegIdctBlock(const int16_t* src, uint8_t* dst, int stride)
         {
-#define jpeg__f2f(x)  ((int) (((x) * 4096 + 0.5)))
+#define SIMD_JPEG_IDCT_TYPE __m128i
+#define SIMD_JPEG_IDCT_OP(op) _mm_##op
+#define SIMD_JPEG_IDCT_ZERO _mm_setzero_si128()
 
             __m128i row0, row1, row2, row3, row4, row5, row6, row7;
             __m128i tmp;
 
-#define dct_rot(out0,out1, x,y,c0,c1) \
-      __m128i c0##lo = _mm_unpacklo_epi16((x),(y)); \
-      __m128i c0##hi = _mm_unpackhi_epi16((x),(y)); \
-      __m128i out0##_l = _mm_madd_epi16(c0##lo, c0); \
-      __m128i out0##_h = _mm_madd_epi16(c0##hi, c0); \
-      __m128i out1##_l = _mm_madd_epi16(c0##lo, c1); \
-      __m128i out1##_h = _mm_madd_epi16(c0##hi, c1)
-
-#define dct_widen(out, in) \
-      __m128i out##_l = _mm_srai_epi32(_mm_unpacklo_epi16(_mm_setzero_si128(), (in)), 4); \
-      __m128i out##_h = _mm_srai_epi32(_mm_unpackhi_epi16(_mm_setzero_si128(), (in)), 4)
-
-#define dct_wadd(out, a, b) \
-      __m128i out##_l = _mm_add_epi32(a##_l, b##_l); \
-      __m128i out##_h = _mm_add_epi32(a##_h, b##_h)
-
-#define dct_wsub(out, a, b) \
-      __m128i out##_l = _mm_sub_epi32(a##_l, b##_l); \
-      __m128i out##_h = _mm_sub_epi32(a##_h, b##_h)
-
-#define dct_bfly32o(out0, out1, a,b,bias,s) \
-      { \
-         __m128i abiased_l = _mm_add_epi32(a##_l, bias); \
-         __m128i abiased_h = _mm_add_epi32(a##_h, bias); \
-         dct_wadd(sum, abiased, b); \
-         dct_wsub(dif, abiased, b); \
-         out0 = _mm_packs_epi32(_mm_srai_epi32(sum_l, s), _mm_srai_epi32(sum_h, s)); \
-         out1 = _mm_packs_epi32(_mm_srai_epi32(dif_l, s), _mm_srai_epi32(dif_h, s)); \
-      }
-
-#define dct_interleave8(a, b) \
-      tmp = a; \
-      a = _mm_unpacklo_epi8(a, b); \
-      b = _mm_unpackhi_epi8(tmp, b)
-
-#define dct_interleave16(a, b) \
-      tmp = a; \
-      a = _mm_unpacklo_epi16(a, b); \
-      b = _mm_unpackhi_epi16(tmp, b)
-
-#define dct_pass(bias,shift) \
-      { \
-         dct_rot(t2e,t3e, row2,row6, rot0_0,rot0_1); \
-         __m128i sum04 = _mm_add_epi16(row0, row4); \
-         __m128i dif04 = _mm_sub_epi16(row0, row4); \
-         dct_widen(t0e, sum04); \
-         dct_widen(t1e, dif04); \
-         dct_wadd(x0, t0e, t3e); \
-         dct_wsub(x3, t0e, t3e); \
-         dct_wadd(x1, t1e, t2e); \
-         dct_wsub(x2, t1e, t2e); \
-         dct_rot(y0o,y2o, row7,row3, rot2_0,rot2_1); \
-         dct_rot(y1o,y3o, row5,row1, rot3_0,rot3_1); \
-         __m128i sum17 = _mm_add_epi16(row1, row7); \
-         __m128i sum35 = _mm_add_epi16(row3, row5); \
-         dct_rot(y4o,y5o, sum17,sum35, rot1_0,rot1_1); \
-         dct_wadd(x4, y0o, y4o); \
-         dct_wadd(x5, y1o, y5o); \
-         dct_wadd(x6, y2o, y5o); \
-         dct_wadd(x7, y3o, y4o); \
-         dct_bfly32o(row0,row7, x0,x7,bias,shift); \
-         dct_bfly32o(row1,row6, x1,x6,bias,shift); \
-         dct_bfly32o(row2,row5, x2,x5,bias,shift); \
-         dct_bfly32o(row3,row4, x3,x4,bias,shift); \
-      }
-
             const __m128i rot0_0 = SetInt16(Base::JpegIdctK00, Base::JpegIdctK00 + Base::JpegIdctK01);
             const __m128i rot0_1 = SetInt16(Base::JpegIdctK00 + Base::JpegIdctK02, Base::JpegIdctK00);
             const __m128i rot1_0 = SetInt16(Base::JpegIdctK03 + Base::JpegIdctK08, Base::JpegIdctK03);
@@ -128,41 +65,11 @@ namespace Simd
             row5 = _mm_load_si128((const __m128i*) (src + 5 * 8));
             row6 = _mm_load_si128((const __m128i*) (src + 6 * 8));
             row7 = _mm_load_si128((const __m128i*) (src + 7 * 8));
-            dct_pass(bias_0, 10);
-
+            SIMD_JPEG_IDCT_PASS(bias_0, 10);
+            SIMD_JPEG_IDCT_TRANSPOSE16();
+            SIMD_JPEG_IDCT_PASS(bias_1, 17);
             {
-                dct_interleave16(row0, row4);
-                dct_interleave16(row1, row5);
-                dct_interleave16(row2, row6);
-                dct_interleave16(row3, row7);
-
-                dct_interleave16(row0, row2);
-                dct_interleave16(row1, row3);
-                dct_interleave16(row4, row6);
-                dct_interleave16(row5, row7);
-
-                dct_interleave16(row0, row1);
-                dct_interleave16(row2, row3);
-                dct_interleave16(row4, row5);
-                dct_interleave16(row6, row7);
-            }
-
-            dct_pass(bias_1, 17);
-            {
-                __m128i p0 = _mm_packus_epi16(row0, row1);
-                __m128i p1 = _mm_packus_epi16(row2, row3);
-                __m128i p2 = _mm_packus_epi16(row4, row5);
-                __m128i p3 = _mm_packus_epi16(row6, row7);
-
-                dct_interleave8(p0, p2);
-                dct_interleave8(p1, p3);
-
-                dct_interleave8(p0, p1);
-                dct_interleave8(p2, p3);
-
-                dct_interleave8(p0, p2);
-                dct_interleave8(p1, p3);
-
+                SIMD_JPEG_IDCT_PACK_TRANSPOSE8(p0, p1, p2, p3);
                 StoreHalf<0>((__m128i*)(dst + 0 * stride), p0);
                 StoreHalf<1>((__m128i*)(dst + 1 * stride), p0);
                 StoreHalf<0>((__m128i*)(dst + 2 * stride), p2);
@@ -173,15 +80,9 @@ namespace Simd
                 StoreHalf<1>((__m128i*)(dst + 7 * stride), p3);
             }
 
-#undef dct_const
-#undef dct_rot
-#undef dct_widen
-#undef dct_wadd
-#undef dct_wsub
-#undef dct_bfly32o
-#undef dct_interleave8
-#undef dct_interleave16
-#undef dct_pass
+#undef SIMD_JPEG_IDCT_TYPE
+#undef SIMD_JPEG_IDCT_OP
+#undef SIMD_JPEG_IDCT_ZERO
         }
 
         //-------------------------------------------------------------------------------------------------
@@ -418,7 +319,8 @@ namespace Simd
         ImageJpegLoader::ImageJpegLoader(const ImageLoaderParam& param)
             : Base::ImageJpegLoader(param)
         {
-            _context->idctBlock = JpegIdctBlock;
+            if (_context->block_size == 8)
+                _context->idctBlock = JpegIdctBlock;
             _context->resampleRowHv2 = JpegResampleRowHv2;
             if (_param.format == SimdPixelFormatGray8)
                 _context->rgbaToAny = Sse41::RgbaToGray;
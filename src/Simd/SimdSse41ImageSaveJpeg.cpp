@@ -285,6 +285,18 @@ namespace Simd
             }
         }
 
+        SIMD_INLINE void SubUvH(const float* src, float* dst)
+        {
+            __m128 _0_5 = _mm_set1_ps(0.5f);
+            for (int yy = 0; yy < 8; yy += 1)
+            {
+                _mm_storeu_ps(dst + 0, _mm_mul_ps(_mm_hadd_ps(_mm_loadu_ps(src + 0), _mm_loadu_ps(src + 4)), _0_5));
+                _mm_storeu_ps(dst + 4, _mm_mul_ps(_mm_hadd_ps(_mm_loadu_ps(src + 64), _mm_loadu_ps(src + 68)), _0_5));
+                src += 8;
+                dst += 8;
+            }
+        }
+
         const __m128i K8_SHUFFLE_UV_U0 = SIMD_MM_SETR_EPI8(0x0, -1, -1, -1, 0x2, -1, -1, -1, 0x4, -1, -1, -1, 0x6, -1, -1, -1);
         const __m128i K8_SHUFFLE_UV_U1 = SIMD_MM_SETR_EPI8(0x8, -1, -1, -1, 0xA, -1, -1, -1, 0xC, -1, -1, -1, 0xE, -1, -1, -1);
         const __m128i K8_SHUFFLE_UV_V0 = SIMD_MM_SETR_EPI8(0x1, -1, -1, -1, 0x3, -1, -1, -1, 0x5, -1, -1, -1, 0x7, -1, -1, -1);
@@ -425,6 +437,73 @@ namespace Simd
             bitBuf.Clear();
         }
 
+        void JpegWriteBlock422(OutputMemoryStream& stream, int width, int height, const uint8_t* red,
+            const uint8_t* green, const uint8_t* blue, int stride, const float* fY, const float* fUv, int dc[3])
+        {
+            bool gray = red == green && red == blue;
+            __m128 k[10];
+            if(!gray)
+                RgbToYuvInit(k);
+            int& DCY = dc[0], & DCU = dc[1], & DCV = dc[2];
+            int width16 = width & (~15);
+            Base::BitBuf bitBuf;
+            for (int y = 0; y < height; y += 8)
+            {
+                int x = 0;
+                SIMD_ALIGNED(16) float Y[128], U[128], V[128];
+                SIMD_ALIGNED(16) float subU[64], subV[64];
+                for (; x < width16; x += 16)
+                {
+                    if (gray)
+                    {
+                        GrayToY(red + x, stride, height - y, Y, 8);
+                        GrayToY(red + x + 8, stride, height - y, Y + 64, 8);
+                    }
+                    else
+                    {
+                        RgbToYuv(red + x, green + x, blue + x, stride, height - y, k, Y, U, V, 8);
+                        RgbToYuv(red + x + 8, green + x + 8, blue + x + 8, stride, height - y, k, Y + 64, U + 64, V + 64, 8);
+                    }
+                    DCY = JpegProcessDu(bitBuf, Y + 0, 8, fY, DCY, Base::HuffmanYdc, Base::HuffmanYac);
+                    DCY = JpegProcessDu(bitBuf, Y + 64, 8, fY, DCY, Base::HuffmanYdc, Base::HuffmanYac);
+                    if (gray)
+                        Base::JpegProcessDuGrayUv(bitBuf);
+                    else
+                    {
+                        SubUvH(U, subU);
+                        SubUvH(V, subV);
+                        DCU = JpegProcessDu(bitBuf, subU, 8, fUv, DCU, Base::HuffmanUVdc, Base::HuffmanUVac);
+                        DCV = JpegProcessDu(bitBuf, subV, 8, fUv, DCV, Base::HuffmanUVdc, Base::HuffmanUVac);
+                    }
+                    if (bitBuf.Full())
+                    {
+                        Base::WriteBits(stream, bitBuf.data, bitBuf.size);
+                        bitBuf.Clear();
+                    }
+                }
+                for (; x < width; x += 16)
+                {
+                    if (gray)
+                        Base::GrayToY16x8(red + x, stride, height - y, width - x, Y);
+                    else
+                        Base::RgbToYuv16x8(red + x, green + x, blue + x, stride, height - y, width - x, Y, U, V);
+                    DCY = JpegProcessDu(bitBuf, Y + 0, 8, fY, DCY, Base::HuffmanYdc, Base::HuffmanYac);
+                    DCY = JpegProcessDu(bitBuf, Y + 64, 8, fY, DCY, Base::HuffmanYdc, Base::HuffmanYac);
+                    if (gray)
+                        Base::JpegProcessDuGrayUv(bitBuf);
+                    else
+                    {
+                        SubUvH(U, subU);
+                        SubUvH(V, subV);
+                        DCU = JpegProcessDu(bitBuf, subU, 8, fUv, DCU, Base::HuffmanUVdc, Base::HuffmanUVac);
+                        DCV = JpegProcessDu(bitBuf, subV, 8, fUv, DCV, Base::HuffmanUVdc, Base::HuffmanUVac);
+                    }
+                }
+            }
+            Base::WriteBits(stream, bitBuf.data, bitBuf.size);
+            bitBuf.Clear();
+        }
+
         void JpegWriteBlockNv12(OutputMemoryStream& stream, int width, int height, const uint8_t* ySrc, int yStride,
             const uint8_t* uvSrc, int uvStride, const float* fY, const float* fUv, int dc[3])
         {
@@ -558,7 +637,12 @@ namespace Simd
                 default:
                     break;
                 }
-                _writeBlock = _subSample ? JpegWriteBlockSubs : JpegWriteBlockFull;
+                if (_sampling == SimdJpegSampling420)
+                    _writeBlock = JpegWriteBlockSubs;
+                else if (_sampling == SimdJpegSampling422)
+                    _writeBlock = JpegWriteBlock422;
+                else
+                    _writeBlock = JpegWriteBlockFull;
             }
             else
             {
@@ -0,0 +1,91 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdImageSave.h"
+#include "Simd/SimdImageQoi.h"
+#include "Simd/SimdSse41.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        SIMD_INLINE __m128i QoiCodes(__m128i px, __m128i pr)
+        {
+            static const __m128i LUMA_SHUFFLE = SIMD_MM_SETR_EPI8(0x1, -1, 0x1, -1, 0x5, -1, 0x5, -1, 0x9, -1, 0x9, -1, 0xD, -1, 0xD, -1);
+            __m128i dv = _mm_sub_epi8(px, pr);
+            __m128i alphaEq = _mm_cmpeq_epi32(_mm_and_si128(dv, _mm_set1_epi32(0xFF000000)), _mm_setzero_si128());
+            __m128i b1 = _mm_add_epi8(dv, _mm_set1_epi32(0x00020202));
+            __m128i diffOk = _mm_cmpeq_epi32(_mm_and_si128(b1, _mm_set1_epi32(0x00FCFCFC)), _mm_setzero_si128());
+            __m128i diff = _mm_or_si128(_mm_or_si128(_mm_set1_epi32(Base::QoiOpDiff), _mm_slli_epi32(_mm_and_si128(b1, _mm_set1_epi32(0x3)), 4)),
+                _mm_or_si128(_mm_and_si128(_mm_srli_epi32(b1, 6), _mm_set1_epi32(0xC)), _mm_and_si128(_mm_srli_epi32(b1, 16), _mm_set1_epi32(0x3))));
+            __m128i lv = _mm_add_epi8(_mm_sub_epi8(dv, _mm_shuffle_epi8(dv, LUMA_SHUFFLE)), _mm_set1_epi32(0x00082008));
+            __m128i lumaOk = _mm_cmpeq_epi32(_mm_and_si128(lv, _mm_set1_epi32(0x00F0C0F0)), _mm_setzero_si128());
+            __m128i luma = _mm_or_si128(_mm_or_si128(_mm_set1_epi32(Base::QoiOpLuma << 8), _mm_and_si128(lv, _mm_set1_epi32(0x3F00))),
+                _mm_or_si128(_mm_slli_epi32(_mm_and_si128(lv, _mm_set1_epi32(0xF)), 4), _mm_and_si128(_mm_srli_epi32(lv, 16), _mm_set1_epi32(0xF))));
+            __m128i code = _mm_and_si128(luma, lumaOk);
+            code = _mm_blendv_epi8(code, diff, diffOk);
+            code = _mm_blendv_epi8(_mm_set1_epi32(Base::QoiCodeRgba), code, alphaEq);
+            __m128i hash = _mm_madd_epi16(_mm_maddubs_epi16(px, _mm_set1_epi32(0x0B070503)), _mm_set1_epi16(1));
+            return _mm_or_si128(code, _mm_slli_epi32(_mm_and_si128(hash, _mm_set1_epi32(63)), 16));
+        }
+
+        void QoiEncodeCodes(const uint8_t* rgba, size_t size, uint32_t prev, uint32_t* codes)
+        {
+            if (size == 0)
+                return;
+            const uint32_t* src = (const uint32_t*)rgba;
+            codes[0] = Base::QoiCode(src[0], prev);
+            size_t i = 1;
+            for (; i + 4 <= size; i += 4)
+            {
+                __m128i px = _mm_loadu_si128((__m128i*)(src + i));
+                __m128i pr = _mm_loadu_si128((__m128i*)(src + i - 1));
+                _mm_storeu_si128((__m128i*)(codes + i), QoiCodes(px, pr));
+            }
+            for (; i < size; ++i)
+                codes[i] = Base::QoiCode(src[i], src[i - 1]);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        ImageQoiSaver::ImageQoiSaver(const ImageSaverParam& param)
+            : Base::ImageQoiSaver(param)
+        {
+            _encodeCodes = Sse41::QoiEncodeCodes;
+            if (_param.width >= A)
+            {
+                switch (_param.format)
+                {
+                case SimdPixelFormatGray8: _toRgba = Sse41::GrayToBgra; break;
+                case SimdPixelFormatBgr24: _toRgba = Sse41::RgbToBgra; break;
+                case SimdPixelFormatBgra32: _convert = Sse41::BgraToRgba; break;
+                case SimdPixelFormatRgb24: _toRgba = Sse41::BgrToBgra; break;
+                default: break;
+                }
+            }
+        }
+    }
+#endif
+}
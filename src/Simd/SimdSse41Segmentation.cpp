@@ -24,6 +24,7 @@
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdStore.h"
 #include "Simd/SimdCompare.h"
+#include "Simd/SimdSegmentation.h"
 
 namespace Simd
 {
@@ -283,6 +284,53 @@ namespace Simd
                 }
             }
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SIMD_INLINE uint64_t SegmentationBits64(const uint8_t* mask, __m128i index)
+        {
+            uint64_t b0 = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((__m128i*)mask + 0), index));
+            uint64_t b1 = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((__m128i*)mask + 1), index));
+            uint64_t b2 = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((__m128i*)mask + 2), index));
+            uint64_t b3 = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((__m128i*)mask + 3), index));
+            return b0 | (b1 << 16) | (b2 << 32) | (b3 << 48);
+        }
+
+        static size_t SegmentationRuns(const uint8_t* mask, size_t width, uint8_t index, int32_t* runs)
+        {
+            int32_t* dst = runs;
+            bool in = false;
+            __m128i _index = _mm_set1_epi8(index);
+            size_t width64 = AlignLo(width, 64), widthA = AlignLo(width, A), x = 0;
+            for (; x < width64; x += 64)
+            {
+                uint64_t bits = SegmentationBits64(mask + x, _index);
+                if (bits != (in ? uint64_t(-1) : 0))
+                    Base::SegmentationRunsBits(bits, 64, (int32_t)x, in, dst);
+            }
+            for (; x < widthA; x += A)
+            {
+                uint32_t bits = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((__m128i*)(mask + x)), _index));
+                if (bits != (in ? 0xFFFF : 0))
+                    Base::SegmentationRunsBits(bits, A, (int32_t)x, in, dst);
+            }
+            Base::SegmentationRunsBytes(mask + x, width - x, index, (int32_t)x, in, dst);
+            if (in)
+                *dst++ = (int32_t)width;
+            return (dst - runs) / 2;
+        }
+
+        SegmentationComponentLabeler::SegmentationComponentLabeler()
+        {
+            _runs = SegmentationRuns;
+        }
+
+        size_t SegmentationLabelComponents(const uint8_t* mask, size_t maskStride, size_t width, size_t height, uint8_t index,
+            SimdSegmentationConnectivityType connectivity, uint32_t* labels, size_t labelsStride, SimdSegmentationComponent** components)
+        {
+            SegmentationComponentLabeler labeler;
+            return labeler.Run(mask, maskStride, width, height, index, connectivity, labels, labelsStride, components);
+        }
     }
 #endif
 }
@@ -0,0 +1,222 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetGroupNorm16b.h"
+#include "Simd/SimdSynetAdd16bCommon.h"
+#include "Simd/SimdSynetConvolution16bCommon.h"
+#include "Simd/SimdExtract.h"
+
+namespace Simd
+{
+#if defined(SIMD_SSE41_ENABLE) && defined(SIMD_SYNET_ENABLE)
+    namespace Sse41
+    {
+        template<class S> float GroupNormSum16b(const uint8_t* src8, size_t size)
+        {
+            const S* src = (const S*)src8;
+            size_t sizeF = AlignLo(size, F), sizeQF = AlignLo(size, QF), i = 0;
+            __m128 sum0 = _mm_setzero_ps(), sum1 = _mm_setzero_ps(), sum2 = _mm_setzero_ps(), sum3 = _mm_setzero_ps();
+            for (; i < sizeQF; i += QF)
+            {
+                sum0 = _mm_add_ps(sum0, LoadSrc(src + i + 0 * F));
+                sum1 = _mm_add_ps(sum1, LoadSrc(src + i + 1 * F));
+                sum2 = _mm_add_ps(sum2, LoadSrc(src + i + 2 * F));
+                sum3 = _mm_add_ps(sum3, LoadSrc(src + i + 3 * F));
+            }
+            for (; i < sizeF; i += F)
+                sum0 = _mm_add_ps(sum0, LoadSrc(src + i));
+            float sum = ExtractSum(_mm_add_ps(_mm_add_ps(sum0, sum1), _mm_add_ps(sum2, sum3)));
+            for (; i < size; ++i)
+                sum += Base::Convert16b<S, float>(src[i]);
+            return sum;
+        }
+
+        SIMD_INLINE __m128 SquareDiffSum(__m128 value, __m128 mean, __m128 sum)
+        {
+            __m128 diff = _mm_sub_ps(value, mean);
+            return _mm_add_ps(_mm_mul_ps(diff, diff), sum);
+        }
+
+        template<class S> float GroupNormSquareSum16b(const uint8_t* src8, size_t size, float mean)
+        {
+            const S* src = (const S*)src8;
+            size_t sizeF = AlignLo(size, F), sizeQF = AlignLo(size, QF), i = 0;
+            __m128 _mean = _mm_set1_ps(mean);
+            __m128 sum0 = _mm_setzero_ps(), sum1 = _mm_setzero_ps(), sum2 = _mm_setzero_ps(), sum3 = _mm_setzero_ps();
+            for (; i < sizeQF; i += QF)
+            {
+                sum0 = SquareDiffSum(LoadSrc(src + i + 0 * F), _mean, sum0);
+                sum1 = SquareDiffSum(LoadSrc(src + i + 1 * F), _mean, sum1);
+                sum2 = SquareDiffSum(LoadSrc(src + i + 2 * F), _mean, sum2);
+                sum3 = SquareDiffSum(LoadSrc(src + i + 3 * F), _mean, sum3);
+            }
+            for (; i < sizeF; i += F)
+                sum0 = SquareDiffSum(LoadSrc(src + i), _mean, sum0);
+            float sum = ExtractSum(_mm_add_ps(_mm_add_ps(sum0, sum1), _mm_add_ps(sum2, sum3)));
+            for (; i < size; ++i)
+                sum += Simd::Square(Base::Convert16b<S, float>(src[i]) - mean);
+            return sum;
+        }
+
+        template<class S> void GroupNormChannelSum16b(const uint8_t* src8, size_t channels, size_t spatial, float* sum)
+        {
+            const S* src = (const S*)src8;
+            size_t channelsF = AlignLo(channels, F);
+            for (size_t c = 0; c < channels; ++c)
+                sum[c] = 0;
+            for (size_t s = 0; s < spatial; ++s, src += channels)
+            {
+                size_t c = 0;
+                for (; c < channelsF; c += F)
+                    _mm_storeu_ps(sum + c, _mm_add_ps(_mm_loadu_ps(sum + c), LoadSrc(src + c)));
+                for (; c < channels; ++c)
+                    sum[c] += Base::Convert16b<S, float>(src[c]);
+            }
+        }
+
+        template<class S> void GroupNormChannelSquareSum16b(const uint8_t* src8, size_t channels, size_t spatial, const float* mean, float* sum)
+        {
+            const S* src = (const S*)src8;
+            size_t channelsF = AlignLo(channels, F);
+            for (size_t c = 0; c < channels; ++c)
+                sum[c] = 0;
+            for (size_t s = 0; s < spatial; ++s, src += channels)
+            {
+                size_t c = 0;
+                for (; c < channelsF; c += F)
+                    _mm_storeu_ps(sum + c, SquareDiffSum(LoadSrc(src + c), _mm_loadu_ps(mean + c), _mm_loadu_ps(sum + c)));
+                for (; c < channels; ++c)
+                    sum[c] += Simd::Square(Base::Convert16b<S, float>(src[c]) - mean[c]);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<class D> SIMD_INLINE void GroupNormStore(D* dst, __m128 value);
+
+        template<> SIMD_INLINE void GroupNormStore(float* dst, __m128 value)
+        {
+            _mm_storeu_ps(dst, value);
+        }
+
+        template<> SIMD_INLINE void GroupNormStore(uint16_t* dst, __m128 value)
+        {
+            _mm_storel_epi64((__m128i*)dst, _mm_packus_epi32(Float32ToBFloat16(value), K_ZERO));
+        }
+
+        template<class S, class D, SimdConvolutionActivationType type> void GroupNorm16b(const uint8_t* src8, size_t channels, size_t spatial,
+            SimdTensorFormatType format, const float* alpha, const float* beta, const float* params, uint8_t* dst8)
+        {
+            const S* src = (const S*)src8;
+            D* dst = (D*)dst8;
+            __m128 _params[2] = { _mm_set1_ps(params[0]), _mm_set1_ps(params[1]) };
+            if (format == SimdTensorFormatNchw)
+            {
+                size_t spatialF = AlignLo(spatial, F);
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    __m128 _alpha = _mm_set1_ps(alpha[c]), _beta = _mm_set1_ps(beta[c]);
+                    size_t s = 0;
+                    for (; s < spatialF; s += F)
+                        GroupNormStore(dst + s, Activate<type>(_mm_add_ps(_mm_mul_ps(LoadSrc(src + s), _alpha), _beta), _params, 0));
+                    for (; s < spatial; ++s)
+                        dst[s] = Base::Convert16b<float, D>(Base::Activate<type>(Base::Convert16b<S, float>(src[s]) * alpha[c] + beta[c], params, 0));
+                    src += spatial;
+                    dst += spatial;
+                }
+            }
+            else
+            {
+                size_t channelsF = AlignLo(channels, F);
+                for (size_t s = 0; s < spatial; ++s)
+                {
+                    size_t c = 0;
+                    for (; c < channelsF; c += F)
+                        GroupNormStore(dst + c, Activate<type>(_mm_add_ps(_mm_mul_ps(LoadSrc(src + c), _mm_loadu_ps(alpha + c)), _mm_loadu_ps(beta + c)), _params, 0));
+                    for (; c < channels; ++c)
+                        dst[c] = Base::Convert16b<float, D>(Base::Activate<type>(Base::Convert16b<S, float>(src[c]) * alpha[c] + beta[c], params, 0));
+                    src += channels;
+                    dst += channels;
+                }
+            }
+        }
+
+        template<class S, class D> static SynetGroupNorm16b::NormPtr GetGroupNorm16b(SimdConvolutionActivationType activation)
+        {
+            switch (activation)
+            {
+            case SimdConvolutionActivationIdentity: return GroupNorm16b<S, D, SimdConvolutionActivationIdentity>;
+            case SimdConvolutionActivationSwish: return GroupNorm16b<S, D, SimdConvolutionActivationSwish>;
+            case SimdConvolutionActivationGelu: return GroupNorm16b<S, D, SimdConvolutionActivationGelu>;
+            default:
+                return NULL;
+            }
+        }
+
+        template<class S> static SynetGroupNorm16b::NormPtr GetGroupNorm16b(SimdTensorDataType dType, SimdConvolutionActivationType activation)
+        {
+            switch (dType)
+            {
+            case SimdTensorData32f: return GetGroupNorm16b<S, float>(activation);
+            case SimdTensorData16b: return GetGroupNorm16b<S, uint16_t>(activation);
+            default:
+                return NULL;
+            }
+        }
+
+        static SynetGroupNorm16b::NormPtr GetGroupNorm16b(SimdTensorDataType sType, SimdTensorDataType dType, SimdConvolutionActivationType activation)
+        {
+            switch (sType)
+            {
+            case SimdTensorData32f: return GetGroupNorm16b<float>(dType, activation);
+            case SimdTensorData16b: return GetGroupNorm16b<uint16_t>(dType, activation);
+            default:
+                return NULL;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SynetGroupNorm16b::SynetGroupNorm16b(const GroupNorm16bParam& p)
+            : Base::SynetGroupNorm16b(p)
+        {
+            bool bf16 = p.sType == SimdTensorData16b;
+            _sum = bf16 ? GroupNormSum16b<uint16_t> : GroupNormSum16b<float>;
+            _squareSum = bf16 ? GroupNormSquareSum16b<uint16_t> : GroupNormSquareSum16b<float>;
+            _channelSum = bf16 ? GroupNormChannelSum16b<uint16_t> : GroupNormChannelSum16b<float>;
+            _channelSquareSum = bf16 ? GroupNormChannelSquareSum16b<uint16_t> : GroupNormChannelSquareSum16b<float>;
+            _norm = GetGroupNorm16b(p.sType, p.dType, p.activation);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetGroupNorm16bInit(size_t batch, size_t channels, size_t spatial, size_t groups, SimdTensorDataType srcType, SimdTensorDataType dstType, SimdTensorFormatType format, float eps, SimdConvolutionActivationType activation)
+        {
+            GroupNorm16bParam param(batch, channels, spatial, groups, srcType, dstType, format, eps, activation);
+            if (!param.Valid())
+                return NULL;
+            return new SynetGroupNorm16b(param);
+        }
+    }
+#endif
+}
@@ -0,0 +1,153 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetGroupNorm16b_h__
+#define __SimdSynetGroupNorm16b_h__
+
+#include "Simd/SimdArray.h"
+
+namespace Simd
+{
+    struct GroupNorm16bParam
+    {
+        size_t batch, channels, spatial, groups;
+        SimdTensorDataType sType, dType;
+        SimdTensorFormatType format;
+        float eps;
+        SimdConvolutionActivationType activation;
+
+        GroupNorm16bParam(size_t b, size_t c, size_t s, size_t g, SimdTensorDataType st, SimdTensorDataType dt, SimdTensorFormatType f, float e, SimdConvolutionActivationType a)
+            : batch(b)
+            , channels(c)
+            , spatial(s)
+            , groups(g)
+            , sType(st)
+            , dType(dt)
+            , format(f)
+            , eps(e)
+            , activation(a)
+        {
+        }
+
+        bool Valid()
+        {
+            return
+                (batch > 0 && channels > 0 && spatial > 0 && groups > 0 && channels % groups == 0 && eps >= 0.0f) &&
+                (format == SimdTensorFormatNhwc || format == SimdTensorFormatNchw) &&
+                (sType == SimdTensorData32f || sType == SimdTensorData16b) &&
+                (dType == SimdTensorData32f || dType == SimdTensorData16b) &&
+                (activation == SimdConvolutionActivationIdentity || activation == SimdConvolutionActivationSwish || activation == SimdConvolutionActivationGelu);
+        }
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    class SynetGroupNorm16b : public Deletable
+    {
+    public:
+        SynetGroupNorm16b(const GroupNorm16bParam& p);
+
+        virtual void Forward(const uint8_t* src, const float* scale, const float* shift, const float* params, uint8_t* dst) = 0;
+
+    protected:
+        GroupNorm16bParam _param;
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        class SynetGroupNorm16b : public Simd::SynetGroupNorm16b
+        {
+        public:
+            SynetGroupNorm16b(const GroupNorm16bParam& p);
+
+            virtual void Forward(const uint8_t* src, const float* scale, const float* shift, const float* params, uint8_t* dst);
+
+            typedef float (*SumPtr)(const uint8_t* src, size_t size);
+            typedef float (*SquareSumPtr)(const uint8_t* src, size_t size, float mean);
+            typedef void (*ChannelSumPtr)(const uint8_t* src, size_t channels, size_t spatial, float* sum);
+            typedef void (*ChannelSquareSumPtr)(const uint8_t* src, size_t channels, size_t spatial, const float* mean, float* sum);
+            typedef void (*NormPtr)(const uint8_t* src, size_t channels, size_t spatial, SimdTensorFormatType format, const float* alpha, const float* beta, const float* params, uint8_t* dst);
+
+        protected:
+            size_t _threads, _srcE, _dstE;
+            SumPtr _sum;
+            SquareSumPtr _squareSum;
+            ChannelSumPtr _channelSum;
+            ChannelSquareSumPtr _channelSquareSum;
+            NormPtr _norm;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetGroupNorm16bInit(size_t batch, size_t channels, size_t spatial, size_t groups, SimdTensorDataType srcType, SimdTensorDataType dstType, SimdTensorFormatType format, float eps, SimdConvolutionActivationType activation);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        class SynetGroupNorm16b : public Base::SynetGroupNorm16b
+        {
+        public:
+            SynetGroupNorm16b(const GroupNorm16bParam& p);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetGroupNorm16bInit(size_t batch, size_t channels, size_t spatial, size_t groups, SimdTensorDataType srcType, SimdTensorDataType dstType, SimdTensorFormatType format, float eps, SimdConvolutionActivationType activation);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class SynetGroupNorm16b : public Sse41::SynetGroupNorm16b
+        {
+        public:
+            SynetGroupNorm16b(const GroupNorm16bParam& p);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetGroupNorm16bInit(size_t batch, size_t channels, size_t spatial, size_t groups, SimdTensorDataType srcType, SimdTensorDataType dstType, SimdTensorFormatType format, float eps, SimdConvolutionActivationType activation);
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class SynetGroupNorm16b : public Avx2::SynetGroupNorm16b
+        {
+        public:
+            SynetGroupNorm16b(const GroupNorm16bParam& p);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetGroupNorm16bInit(size_t batch, size_t channels, size_t spatial, size_t groups, SimdTensorDataType srcType, SimdTensorDataType dstType, SimdTensorFormatType format, float eps, SimdConvolutionActivationType activation);
+    }
+#endif
+}
+
+#endif
@@ -0,0 +1,217 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetPreprocess_h__
+#define __SimdSynetPreprocess_h__
+
+#include "Simd/SimdMath.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdArray.h"
+
+namespace Simd
+{
+    struct SynetPreprocessParam
+    {
+        size_t srcW, srcH, dstW, dstH, channels;
+        SimdPixelFormatType srcFormat;
+        SimdResizeMethodType method;
+        SimdTensorFormatType dstFormat;
+        SimdTensorDataType dstType;
+        SimdYuvType yuvType;
+        bool nv12;
+        float mean[3], std[3];
+
+        SynetPreprocessParam(size_t sw, size_t sh, SimdPixelFormatType sf, size_t dw, size_t dh, size_t c, SimdResizeMethodType m, 
+            const float* mn, const float* sd, SimdTensorFormatType df, SimdTensorDataType dt, SimdYuvType yt = SimdYuvUnknown, bool uv = false)
+            : srcW(sw)
+            , srcH(sh)
+            , dstW(dw)
+            , dstH(dh)
+            , channels(c)
+            , srcFormat(sf)
+            , method(m)
+            , dstFormat(df)
+            , dstType(dt)
+            , yuvType(yt)
+            , nv12(uv)
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                mean[i] = mn && i < c ? mn[i] : 0.0f;
+                std[i] = sd && i < c ? sd[i] : 1.0f;
+            }
+        }
+
+        bool Valid() const
+        {
+            return srcW > 0 && srcH > 0 && dstW > 0 && dstH > 0 && (channels == 1 || channels == 3) &&
+                (srcFormat == SimdPixelFormatGray8 || srcFormat == SimdPixelFormatBgr24 || srcFormat == SimdPixelFormatBgra32 ||
+                    srcFormat == SimdPixelFormatRgb24 || srcFormat == SimdPixelFormatRgba32) &&
+                (IsNearest() || method == SimdResizeMethodBilinear || method == SimdResizeMethodBilinearCaffe || method == SimdResizeMethodBilinearPytorch) &&
+                (dstFormat == SimdTensorFormatNchw || dstFormat == SimdTensorFormatNhwc) &&
+                (dstType == SimdTensorData32f || dstType == SimdTensorData16b || dstType == SimdTensorData8u) &&
+                std[0] != 0.0f && std[1] != 0.0f && std[2] != 0.0f &&
+                (!IsYuv() || (yuvType >= SimdYuvBt601 && yuvType <= SimdYuvTrect871 && srcW % 2 == 0 && srcH % 2 == 0 && channels == 3 && 
+                    (srcFormat == SimdPixelFormatBgr24 || srcFormat == SimdPixelFormatRgb24)));
+        }
+
+        bool IsYuv() const
+        {
+            return yuvType != SimdYuvUnknown;
+        }
+
+        bool IsNearest() const
+        {
+            return method == SimdResizeMethodNearest || method == SimdResizeMethodNearestPytorch;
+        }
+
+        size_t DstTypeSize() const
+        {
+            return dstType == SimdTensorData32f ? 4 : (dstType == SimdTensorData16b ? 2 : 1);
+        }
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    class SynetPreprocess : public Deletable
+    {
+    public:
+        SynetPreprocess(const SynetPreprocessParam& param)
+            : _param(param)
+        {
+        }
+
+        virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst) = 0;
+
+        virtual void Run(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, uint8_t* dst) = 0;
+
+    protected:
+        SynetPreprocessParam _param;
+    };
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace Base
+    {
+        class SynetPreprocessBand : public Simd::SynetPreprocess
+        {
+        public:
+            SynetPreprocessBand(const SynetPreprocessParam& param);
+
+            virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst);
+
+            virtual void Run(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, uint8_t* dst);
+
+            typedef void (*SetInputPtr)(const uint8_t* src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat, 
+                const float* lower, const float* upper, float* dst, size_t channels, SimdTensorFormatType dstFormat);
+            typedef void (*ResizeRowPtr)(const float* src, size_t srcStride, size_t channels, const int32_t* idx, const float* alpha, size_t width, float* dst, size_t dstStride);
+            typedef void (*NormalizeRowPtr)(const float* src0, const float* src1, size_t srcStride, float alpha, size_t width, size_t channels, 
+                const float* scale, const float* shift, uint8_t* dst, size_t dstStride);
+            typedef void (*DeinterleaveUvPtr)(const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* u, size_t uStride, uint8_t* v, size_t vStride);
+            typedef void (*YuvToBgrPtr)(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+                size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        protected:
+            void Forward(const uint8_t* const* src, const size_t* stride, uint8_t* dst);
+            void RunBand(const uint8_t* const* src, const size_t* stride, size_t yBeg, size_t yEnd, float* buf, uint8_t* dst);
+            void ResizeRow(const uint8_t* const* src, const size_t* stride, size_t sy, float* buf, ptrdiff_t& pair, float* dst);
+
+            Array32i _ix, _iy;
+            Array32f _ax, _ay;
+            size_t _threads, _rowS, _dstS, _yuvS, _size;
+            float _lower[3], _upper[3], _scale[3], _shift[3];
+            SetInputPtr _setInput;
+            ResizeRowPtr _resizeRow;
+            NormalizeRowPtr _normalizeRow;
+            DeinterleaveUvPtr _deinterleaveUv;
+            YuvToBgrPtr _yuv420pToBgr;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetPreprocessInit(size_t srcW, size_t srcH, SimdPixelFormatType srcFormat, size_t dstW, size_t dstH, size_t channels,
+            SimdResizeMethodType method, const float* mean, const float* std, SimdTensorFormatType dstFormat, SimdTensorDataType dstType);
+
+        void* SynetPreprocessYuv420Init(size_t srcW, size_t srcH, SimdYuvType yuvType, SimdBool nv12, SimdBool isRgb, size_t dstW, size_t dstH,
+            SimdResizeMethodType method, const float* mean, const float* std, SimdTensorFormatType dstFormat, SimdTensorDataType dstType);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        class SynetPreprocessBand : public Base::SynetPreprocessBand
+        {
+        public:
+            SynetPreprocessBand(const SynetPreprocessParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetPreprocessInit(size_t srcW, size_t srcH, SimdPixelFormatType srcFormat, size_t dstW, size_t dstH, size_t channels,
+            SimdResizeMethodType method, const float* mean, const float* std, SimdTensorFormatType dstFormat, SimdTensorDataType dstType);
+
+        void* SynetPreprocessYuv420Init(size_t srcW, size_t srcH, SimdYuvType yuvType, SimdBool nv12, SimdBool isRgb, size_t dstW, size_t dstH,
+            SimdResizeMethodType method, const float* mean, const float* std, SimdTensorFormatType dstFormat, SimdTensorDataType dstType);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class SynetPreprocessBand : public Sse41::SynetPreprocessBand
+        {
+        public:
+            SynetPreprocessBand(const SynetPreprocessParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetPreprocessInit(size_t srcW, size_t srcH, SimdPixelFormatType srcFormat, size_t dstW, size_t dstH, size_t channels,
+            SimdResizeMethodType method, const float* mean, const float* std, SimdTensorFormatType dstFormat, SimdTensorDataType dstType);
+
+        void* SynetPreprocessYuv420Init(size_t srcW, size_t srcH, SimdYuvType yuvType, SimdBool nv12, SimdBool isRgb, size_t dstW, size_t dstH,
+            SimdResizeMethodType method, const float* mean, const float* std, SimdTensorFormatType dstFormat, SimdTensorDataType dstType);
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class SynetPreprocessBand : public Avx2::SynetPreprocessBand
+        {
+        public:
+            SynetPreprocessBand(const SynetPreprocessParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetPreprocessInit(size_t srcW, size_t srcH, SimdPixelFormatType srcFormat, size_t dstW, size_t dstH, size_t channels,
+            SimdResizeMethodType method, const float* mean, const float* std, SimdTensorFormatType dstFormat, SimdTensorDataType dstType);
+
+        void* SynetPreprocessYuv420Init(size_t srcW, size_t srcH, SimdYuvType yuvType, SimdBool nv12, SimdBool isRgb, size_t dstW, size_t dstH,
+            SimdResizeMethodType method, const float* mean, const float* std, SimdTensorFormatType dstFormat, SimdTensorDataType dstType);
+    }
+#endif
+}
+
+#endif
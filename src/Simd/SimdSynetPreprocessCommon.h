@@ -0,0 +1,59 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetPreprocessCommon_h__
+#define __SimdSynetPreprocessCommon_h__
+
+#include "Simd/SimdMath.h"
+#include "Simd/SimdBFloat16.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        template<SimdTensorDataType type> SIMD_INLINE void SynetPreprocessStore(float value, uint8_t* dst, size_t index);
+
+        template<> SIMD_INLINE void SynetPreprocessStore<SimdTensorData32f>(float value, uint8_t* dst, size_t index)
+        {
+            ((float*)dst)[index] = value;
+        }
+
+        template<> SIMD_INLINE void SynetPreprocessStore<SimdTensorData16b>(float value, uint8_t* dst, size_t index)
+        {
+            ((uint16_t*)dst)[index] = Float32ToBFloat16(value);
+        }
+
+        template<> SIMD_INLINE void SynetPreprocessStore<SimdTensorData8u>(float value, uint8_t* dst, size_t index)
+        {
+            dst[index] = (uint8_t)RestrictRange(Round(value), 0, 255);
+        }
+
+        template<SimdTensorDataType type> SIMD_INLINE void SynetPreprocessNormalize(const float* src0, const float* src1, float alpha, float scale, float shift, uint8_t* dst, size_t index)
+        {
+            float value = src0[0] + (src1[0] - src0[0]) * alpha;
+            SynetPreprocessStore<type>(value * scale + shift, dst, index);
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,89 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetTopK_h__
+#define __SimdSynetTopK_h__
+
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        template<bool max> SIMD_INLINE bool SynetTopKBetter(float a, float b)
+        {
+            return max ? a > b : a < b;
+        }
+
+        template<bool max> SIMD_INLINE int32_t SynetArgExtremum(const float* src, size_t count, size_t stride)
+        {
+            float best = src[0];
+            int32_t index = 0;
+            for (size_t c = 1; c < count; ++c)
+            {
+                float value = src[c * stride];
+                if (SynetTopKBetter<max>(value, best))
+                {
+                    best = value;
+                    index = (int32_t)c;
+                }
+            }
+            return index;
+        }
+
+        template<bool max> SIMD_INLINE void SynetTopKInsert(float value, int32_t index, size_t size, float* val, int32_t* idx)
+        {
+            size_t i = size - 1;
+            for (; i > 0 && SynetTopKBetter<max>(value, val[i - 1]); --i)
+            {
+                val[i] = val[i - 1];
+                idx[i] = idx[i - 1];
+            }
+            val[i] = value;
+            idx[i] = index;
+        }
+
+        template<bool max> SIMD_INLINE void SynetTopKInit(const float* src, size_t k, float* val, int32_t* idx)
+        {
+            for (size_t i = 0; i < k; ++i)
+                SynetTopKInsert<max>(src[i], (int32_t)i, i + 1, val, idx);
+        }
+
+        template<bool max> SIMD_INLINE void SynetTopKUpdate(const float* src, size_t beg, size_t end, size_t k, float* val, int32_t* idx)
+        {
+            for (size_t i = beg; i < end; ++i)
+                if (SynetTopKBetter<max>(src[i], val[k - 1]))
+                    SynetTopKInsert<max>(src[i], (int32_t)i, k, val, idx);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        typedef void (*SynetTopKRowPtr)(const float* src, size_t count, size_t k, float* val, int32_t* idx);
+        typedef void (*SynetTopKConvertPtr)(const uint16_t* src, size_t size, float* dst);
+
+        void SynetTopK(const void* src, SimdTensorDataType type, size_t outer, size_t count, size_t inner, size_t k, SimdBool largest, SimdBool sorted,
+            void* dstVal, int32_t* dstIdx, SynetTopKRowPtr topKRow, SynetTopKConvertPtr convert);
+    }
+}
+
+#endif
@@ -215,16 +215,28 @@ namespace Test
     TEST_ADD_GROUP_A0(Gemm32fNN);
     TEST_ADD_GROUP_A0(Gemm32fNT);
 
+    TEST_ADD_GROUP_0S(ImageCodecBenchmark);
     TEST_ADD_GROUP_A0(ImageSaveToMemory);
+    TEST_ADD_GROUP_A0(ImageSaveToSink);
+    TEST_ADD_GROUP_A0(ImageSaveBatchToMemory);
     TEST_ADD_GROUP_A0(Nv12SaveAsJpegToMemory);
     TEST_ADD_GROUP_A0(Yuv420pSaveAsJpegToMemory);
     TEST_ADD_GROUP_AS(ImageLoadFromMemory);
+    TEST_ADD_GROUP_A0(ImageLoadFromMemoryScaled);
+    TEST_ADD_GROUP_AS(ImageLoadBandsFromMemory);
+    TEST_ADD_GROUP_A0(ImageLoadRoiFromMemory);
+    TEST_ADD_GROUP_A0(ImageLoadToBufferFromMemory);
+    TEST_ADD_GROUP_A0(ImageLoadBatchFromMemory);
+    TEST_ADD_GROUP_A0(ImageRawMapFile);
+    TEST_ADD_GROUP_A0(JpegLoadAsYuvFromMemory);
+    TEST_ADD_GROUP_A0(JpegStreamDecoder);
 
     TEST_ADD_GROUP_A0(MeanFilter3x3);
     TEST_ADD_GROUP_A0(MedianFilterRhomb3x3);
     TEST_ADD_GROUP_A0(MedianFilterRhomb5x5);
     TEST_ADD_GROUP_A0(MedianFilterSquare3x3);
     TEST_ADD_GROUP_A0(MedianFilterSquare5x5);
+    TEST_ADD_GROUP_A0(MedianFilterSquare);
     TEST_ADD_GROUP_A0(GaussianBlur3x3);
     TEST_ADD_GROUP_A0(AbsGradientSaturatedSum);
     TEST_ADD_GROUP_A0(LbpEstimate);
@@ -234,10 +246,13 @@ namespace Test
     TEST_ADD_GROUP_A0(SobelDy);
     TEST_ADD_GROUP_A0(SobelDyAbs);
     TEST_ADD_GROUP_A0(ContourMetrics);
+    TEST_ADD_GROUP_A0(Canny);
     TEST_ADD_GROUP_A0(Laplace);
     TEST_ADD_GROUP_A0(LaplaceAbs);
     TEST_ADD_GROUP_AS(GaussianBlur);
     TEST_ADD_GROUP_A0(RecursiveBilateralFilter);
+    TEST_ADD_GROUP_A0(CustomFilter);
+    TEST_ADD_GROUP_A0(Morphology);
 
     TEST_ADD_GROUP_A0(Histogram);
     TEST_ADD_GROUP_A0(HistogramMasked);
@@ -260,6 +275,10 @@ namespace Test
 
     TEST_ADD_GROUP_0S(Motion);
 
+    TEST_ADD_GROUP_A0(NmsDecodeBoxes32f);
+    TEST_ADD_GROUP_A0(NmsIou32f);
+    TEST_ADD_GROUP_A0(Nms32f);
+
     TEST_ADD_GROUP_A0(NeuralConvert);
     TEST_ADD_GROUP_A0(NeuralProductSum);
     TEST_ADD_GROUP_A0(NeuralAddVectorMultipliedByValue);
@@ -313,6 +332,7 @@ namespace Test
 
     TEST_ADD_GROUP_A0(SegmentationShrinkRegion);
     TEST_ADD_GROUP_A0(SegmentationFillSingleHoles);
+    TEST_ADD_GROUP_A0(SegmentationLabelComponents);
     TEST_ADD_GROUP_A0(SegmentationChangeIndex);
     TEST_ADD_GROUP_A0(SegmentationPropagate2x2);
 
@@ -343,6 +363,8 @@ namespace Test
     TEST_ADD_GROUP_A0(SynetAdd8i);
     TEST_ADD_GROUP_A0(SynetAdd16b);
 
+    TEST_ADD_GROUP_A0(SynetArgMax32f);
+    TEST_ADD_GROUP_A0(SynetArgMin32f);
     TEST_ADD_GROUP_A0(SynetChannelSum16b);
     TEST_ADD_GROUP_A0(SynetEltwiseLayerForward);
     TEST_ADD_GROUP_A0(SynetLrnLayerCrossChannels);
@@ -365,6 +387,8 @@ namespace Test
 
     TEST_ADD_GROUP_A0(SynetConvert32fTo8u);
     TEST_ADD_GROUP_A0(SynetConvert8uTo32f);
+    TEST_ADD_GROUP_A0(SynetPreprocess);
+    TEST_ADD_GROUP_A0(SynetPreprocessYuv420);
     TEST_ADD_GROUP_A0(SynetSetInput);
 
     TEST_ADD_GROUP_A0(SynetConvolution8iForward);
@@ -395,6 +419,7 @@ namespace Test
     TEST_ADD_GROUP_A0(SynetNormalizeLayerForwardV2);
     TEST_ADD_GROUP_A0(SynetNormalizeLayerForwardV3);
     TEST_ADD_GROUP_A0(SynetNormalizeLayerForwardV4);
+    TEST_ADD_GROUP_A0(SynetGroupNorm16b);
 
     TEST_ADD_GROUP_A0(SynetPermute);
 
@@ -423,6 +448,9 @@ namespace Test
 
     TEST_ADD_GROUP_A0(SynetSoftmaxLayerForward);
 
+    TEST_ADD_GROUP_A0(SynetTopK32f);
+    TEST_ADD_GROUP_A0(SynetTopK16b);
+
     TEST_ADD_GROUP_A0(SynetUnaryOperation32f);
 #endif
 
@@ -831,8 +859,10 @@ namespace Test
         std::cout << "    -h=1080       a height of test image for performance testing." << std::endl << std::endl;
         std::cout << "    -w=1920       a width of test image for performance testing." << std::endl << std::endl;
         std::cout << "    -oh=log.html  a file name with test report (in HTML format)." << std::endl << std::endl;
-        std::cout << "    -s=sample.avi a video source (Simd::Motion test)." << std::endl << std::endl;
-        std::cout << "    -o=output.avi an annotated video output (Simd::Motion test)." << std::endl << std::endl;
+        std::cout << "    -s=sample.avi a video source (Simd::Motion test)" << std::endl;
+        std::cout << "                  or a directory with JPEG and PNG images (ImageCodecBenchmark test, default is 'data/image' in project root)." << std::endl << std::endl;
+        std::cout << "    -o=output.avi an annotated video output (Simd::Motion test)" << std::endl;
+        std::cout << "                  or a report in CSV or JSON format (ImageCodecBenchmark test)." << std::endl << std::endl;
         std::cout << "    -wt=1         a thread number used to parallelize algorithms." << std::endl << std::endl;
         std::cout << "    -fe=Abs       an exclude filter to exclude some tests." << std::endl << std::endl;
         std::cout << "    -mt=100       a minimal test execution time (in milliseconds)." << std::endl << std::endl;
@@ -76,6 +76,47 @@ namespace Test
             return path.substr(0, pos);
     }
 
+    String FileNameByPath(const String & path)
+    {
+        size_t pos = path.find_last_of(FolderSeparator());
+        if (pos == std::string::npos)
+            return path;
+        else
+            return path.substr(pos + 1);
+    }
+
+    bool GetFileList(const String & directory, Strings & files)
+    {
+        files.clear();
+#if defined(_WIN32)
+        std::error_code error;
+        std::filesystem::directory_iterator it(directory, error), end;
+        if (error)
+            return false;
+        for (; !error && it != end; it.increment(error))
+        {
+            if (it->is_regular_file())
+                files.push_back(MakePath(directory, it->path().filename().string()));
+        }
+#elif defined(__linux__)
+        DIR * dir = ::opendir(directory.c_str());
+        if (dir == NULL)
+            return false;
+        for (struct dirent * entry = ::readdir(dir); entry != NULL; entry = ::readdir(dir))
+        {
+            String path = MakePath(directory, entry->d_name);
+            struct stat info;
+            if (::stat(path.c_str(), &info) == 0 && S_ISREG(info.st_mode))
+                files.push_back(path);
+        }
+        ::closedir(dir);
+#else
+        return false;
+#endif
+        std::sort(files.begin(), files.end());
+        return true;
+    }
+
     bool CreatePath(const String & path)
     {
 #if defined(_WIN32)
@@ -64,6 +64,10 @@ namespace Test
 
     String DirectoryByPath(const String & path);
 
+    String FileNameByPath(const String & path);
+
+    bool GetFileList(const String & directory, Strings & files);
+
     bool CreatePath(const String & path);
 
     bool CreatePathIfNotExist(const String & path, bool file);
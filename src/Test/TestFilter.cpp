@@ -28,7 +28,9 @@
 #include "Test/TestRandom.h"
 #include "Test/TestOptions.h"
 
+#include "Simd/SimdCustomFilter.h"
 #include "Simd/SimdGaussianBlur.h"
+#include "Simd/SimdMorphology.h"
 #include "Simd/SimdRecursiveBilateralFilter.h"
 
 namespace Test
@@ -293,6 +295,133 @@ namespace Test
         return result;
     }
 
+    //-----------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncMF
+        {
+            typedef void(*FuncPtr)(const uint8_t* src, size_t srcStride, size_t width, size_t height, size_t channelCount, size_t radius, uint8_t* dst, size_t dstStride);
+
+            FuncPtr func;
+            String description;
+
+            FuncMF(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(View::Format format, size_t radius)
+            {
+                description = description + ColorDescription(format) + "[" + ToString(radius) + "]";
+            }
+
+            void Call(const View& src, size_t radius, View& dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.stride, src.width, src.height, View::PixelSize(src.format), radius, dst.data, dst.stride);
+            }
+        };
+
+        void MedianFilterSquareReference(const View& src, size_t radius, View& dst)
+        {
+            ptrdiff_t r = radius, w = src.width, h = src.height, c = View::PixelSize(src.format);
+            std::vector<uint8_t> window((2 * r + 1) * (2 * r + 1));
+            for (ptrdiff_t y = 0; y < h; ++y)
+            {
+                for (ptrdiff_t x = 0; x < w; ++x)
+                {
+                    for (ptrdiff_t i = 0; i < c; ++i)
+                    {
+                        size_t n = 0;
+                        for (ptrdiff_t dy = -r; dy <= r; ++dy)
+                            for (ptrdiff_t dx = -r; dx <= r; ++dx)
+                                window[n++] = src.At<uint8_t>(Simd::RestrictRange<ptrdiff_t>(x + dx, 0, w - 1) * c + i, Simd::RestrictRange<ptrdiff_t>(y + dy, 0, h - 1));
+                        std::nth_element(window.begin(), window.begin() + n / 2, window.end());
+                        dst.At<uint8_t>(x * c + i, y) = window[n / 2];
+                    }
+                }
+            }
+        }
+    }
+
+#define FUNC_MF(function) \
+    FuncMF(function, std::string(#function))
+
+    bool MedianFilterSquareAutoTest(View::Format format, int width, int height, size_t radius, FuncMF f1, FuncMF f2)
+    {
+        bool result = true;
+
+        f1.Update(format, radius);
+        f2.Update(format, radius);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View s(width, height, format, NULL, TEST_ALIGN(width));
+        FillRandom(s);
+
+        View d1(width, height, format, NULL, TEST_ALIGN(width));
+        View d2(width, height, format, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(s, radius, d1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(s, radius, d2));
+
+        result = result && Compare(d1, d2, 0, true, 64);
+
+        if (result && s.Area() * (2 * radius + 1) * (2 * radius + 1) <= 64 * 1024 * 1024)
+        {
+            View d3(width, height, format, NULL, TEST_ALIGN(width));
+            MedianFilterSquareReference(s, radius, d3);
+            result = result && Compare(d1, d3, 0, true, 64, 0, "reference");
+        }
+
+        return result;
+    }
+
+    bool MedianFilterSquareAutoTest(const FuncMF& f1, const FuncMF& f2)
+    {
+        bool result = true;
+
+        for (View::Format format = View::Gray8; format <= View::Bgra32; format = View::Format(format + 1))
+        {
+            result = result && MedianFilterSquareAutoTest(format, W, H, 7, f1, f2);
+            result = result && MedianFilterSquareAutoTest(format, W + O, H - O, 2, f1, f2);
+        }
+        result = result && MedianFilterSquareAutoTest(View::Gray8, W, H, 30, f1, f2);
+        result = result && MedianFilterSquareAutoTest(View::Bgr24, W - O, H + O, 15, f1, f2);
+        result = result && MedianFilterSquareAutoTest(View::Gray8, 5, 3, 4, f1, f2);
+
+        return result;
+    }
+
+    bool MedianFilterSquareAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && MedianFilterSquareAutoTest(FUNC_MF(Simd::Base::MedianFilterSquare), FUNC_MF(SimdMedianFilterSquare));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && MedianFilterSquareAutoTest(FUNC_MF(Simd::Sse41::MedianFilterSquare), FUNC_MF(SimdMedianFilterSquare));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && MedianFilterSquareAutoTest(FUNC_MF(Simd::Avx2::MedianFilterSquare), FUNC_MF(SimdMedianFilterSquare));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw(options))
+            result = result && MedianFilterSquareAutoTest(FUNC_MF(Simd::Avx512bw::MedianFilterSquare), FUNC_MF(SimdMedianFilterSquare));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && TestNeon(options))
+            result = result && MedianFilterSquareAutoTest(FUNC_MF(Simd::Neon::MedianFilterSquare), FUNC_MF(SimdMedianFilterSquare));
+#endif
+
+        return result;
+    }
+
     bool GaussianBlur3x3AutoTest(const Options & options)
     {
         bool result = true;
@@ -608,6 +737,183 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        struct FuncCa
+        {
+            typedef void(*FuncPtr)(const uint8_t* src, size_t srcStride, size_t width, size_t height, int lowThreshold, int highThreshold, uint8_t* dst, size_t dstStride);
+
+            FuncPtr func;
+            String description;
+
+            FuncCa(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(int low, int high)
+            {
+                description = description + "[" + ToString(low) + "-" + ToString(high) + "]";
+            }
+
+            void Call(const View& src, int low, int high, View& dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.stride, src.width, src.height, low, high, dst.data, dst.stride);
+            }
+        };
+
+        void CannyReference(const View& src, int low, int high, View& dst)
+        {
+            if (low > high)
+                std::swap(low, high);
+            ptrdiff_t w = src.width, h = src.height;
+            std::vector<int> dx(w * h), dy(w * h), mag((w + 2) * (h + 2), 0);
+            std::vector<uint8_t> map((w + 2) * (h + 2), 0);
+            for (ptrdiff_t y = 0; y < h; ++y)
+            {
+                for (ptrdiff_t x = 0; x < w; ++x)
+                {
+                    int s[3][3];
+                    for (ptrdiff_t i = 0; i < 3; ++i)
+                        for (ptrdiff_t j = 0; j < 3; ++j)
+                            s[i][j] = src.At<uint8_t>(Simd::RestrictRange<ptrdiff_t>(x + j - 1, 0, w - 1), Simd::RestrictRange<ptrdiff_t>(y + i - 1, 0, h - 1));
+                    dx[y * w + x] = (s[0][2] + 2 * s[1][2] + s[2][2]) - (s[0][0] + 2 * s[1][0] + s[2][0]);
+                    dy[y * w + x] = (s[2][0] + 2 * s[2][1] + s[2][2]) - (s[0][0] + 2 * s[0][1] + s[0][2]);
+                    mag[(y + 1) * (w + 2) + x + 1] = std::abs(dx[y * w + x]) + std::abs(dy[y * w + x]);
+                }
+            }
+            std::vector<uint8_t*> stack;
+            for (ptrdiff_t y = 0; y < h; ++y)
+            {
+                for (ptrdiff_t x = 0; x < w; ++x)
+                {
+                    const int* m = mag.data() + (y + 1) * (w + 2) + x + 1;
+                    int gx = dx[y * w + x], gy = dy[y * w + x], ax = std::abs(gx), ay = std::abs(gy), o = int(w + 2);
+                    bool max;
+                    if (ay * 32768 < ax * 13573)
+                        max = m[0] > m[-1] && m[0] >= m[1];
+                    else if (ax * 32768 < ay * 13573)
+                        max = m[0] > m[-o] && m[0] >= m[o];
+                    else if ((gx < 0) == (gy < 0))
+                        max = m[0] > m[-o - 1] && m[0] > m[o + 1];
+                    else
+                        max = m[0] > m[-o + 1] && m[0] > m[o - 1];
+                    uint8_t* p = map.data() + (y + 1) * (w + 2) + x + 1;
+                    if (max && m[0] > low)
+                    {
+                        *p = m[0] > high ? 2 : 1;
+                        if (*p == 2)
+                            stack.push_back(p);
+                    }
+                }
+            }
+            while (stack.size())
+            {
+                uint8_t* p = stack.back();
+                stack.pop_back();
+                for (ptrdiff_t i = -1; i <= 1; ++i)
+                {
+                    for (ptrdiff_t j = -1; j <= 1; ++j)
+                    {
+                        uint8_t* n = p + i * (w + 2) + j;
+                        if (*n == 1)
+                        {
+                            *n = 2;
+                            stack.push_back(n);
+                        }
+                    }
+                }
+            }
+            for (ptrdiff_t y = 0; y < h; ++y)
+                for (ptrdiff_t x = 0; x < w; ++x)
+                    dst.At<uint8_t>(x, y) = map[(y + 1) * (w + 2) + x + 1] == 2 ? 255 : 0;
+        }
+    }
+
+#define FUNC_CA(function) \
+    FuncCa(function, std::string(#function))
+
+    bool CannyAutoTest(size_t width, size_t height, int low, int high, bool smooth, FuncCa f1, FuncCa f2, size_t threads = 1)
+    {
+        bool result = true;
+
+        f1.Update(low, high);
+        f2.Update(low, high);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "] in " << threads << " threads.");
+
+        View src(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        if (smooth)
+            CreateTestImage(src, 10, 10);
+        else
+            FillRandom(src);
+
+        View dst1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View dst2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View dst3(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+
+        size_t backup = SimdGetThreadNumber();
+        SimdSetThreadNumber(threads);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, low, high, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, low, high, dst2));
+
+        SimdSetThreadNumber(backup);
+
+        CannyReference(src, low, high, dst3);
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+        result = result && Compare(dst1, dst3, 0, true, 64, 0, "reference");
+
+        return result;
+    }
+
+    bool CannyAutoTest(const FuncCa& f1, const FuncCa& f2)
+    {
+        bool result = true;
+
+        result = result && CannyAutoTest(W, H, 50, 150, true, f1, f2);
+        result = result && CannyAutoTest(W + O, H - O, 400, 900, false, f1, f2);
+        result = result && CannyAutoTest(W - O, H + O, 120, 20, true, f1, f2);
+        result = result && CannyAutoTest(1, 1, 0, 0, false, f1, f2);
+        result = result && CannyAutoTest(3, 2, 10, 100, false, f1, f2);
+        result = result && CannyAutoTest(37, 5, 100, 300, false, f1, f2);
+        result = result && CannyAutoTest(W, H, 50, 150, true, f1, f2, 4);
+        result = result && CannyAutoTest(W + O, H - O, 20, 900, false, f1, f2, 3);
+        result = result && CannyAutoTest(65, 97, 30, 600, false, f1, f2, 7);
+
+        return result;
+    }
+
+    bool CannyAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && CannyAutoTest(FUNC_CA(Simd::Base::Canny), FUNC_CA(SimdCanny));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && CannyAutoTest(FUNC_CA(Simd::Sse41::Canny), FUNC_CA(SimdCanny));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && CannyAutoTest(FUNC_CA(Simd::Avx2::Canny), FUNC_CA(SimdCanny));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw(options))
+            result = result && CannyAutoTest(FUNC_CA(Simd::Avx512bw::Canny), FUNC_CA(SimdCanny));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && TestNeon(options))
+            result = result && CannyAutoTest(FUNC_CA(Simd::Neon::Canny), FUNC_CA(SimdCanny));
+#endif
+
+        return result;
+    }
+
     bool LaplaceAutoTest(const Options & options)
     {
         bool result = true;
@@ -796,6 +1102,402 @@ namespace Test
 
     //---------------------------------------------------------------------------------------------
 
+    namespace
+    {
+        struct FuncCF
+        {
+            typedef void* (*FuncSepPtr)(size_t width, size_t height, size_t channels, SimdFilterChannelType type, const float* kernelX, size_t sizeX, const float* kernelY, size_t sizeY, SimdFilterBorderType border);
+            typedef void* (*Func2dPtr)(size_t width, size_t height, size_t channels, SimdFilterChannelType type, const float* kernel, size_t sizeX, size_t sizeY, SimdFilterBorderType border);
+
+            FuncSepPtr funcSep;
+            Func2dPtr func2d;
+            String description;
+
+            FuncCF(const FuncSepPtr& fs, const Func2dPtr& f2, const String& d) : funcSep(fs), func2d(f2), description(d) {}
+
+            void Update(size_t c, SimdFilterChannelType t, size_t sx, size_t sy, bool s, SimdFilterBorderType b)
+            {
+                const char* types[] = { "8u", "16u", "32f" }, * borders[] = { "rep", "ref", "con" };
+                std::stringstream ss;
+                ss << description << "[" << (s ? "s" : "d") << "-" << c << "-" << types[t] << "-" << sx << "x" << sy << "-" << borders[b] << "]";
+                description = ss.str();
+            }
+
+            void Call(const View& src, size_t channels, SimdFilterChannelType type, bool separable, const Buffer32f& kernelX, const Buffer32f& kernelY, SimdFilterBorderType border, View& dst) const
+            {
+                size_t width = src.width * src.ChannelCount() / channels;
+                void* filter = separable ?
+                    funcSep(width, src.height, channels, type, kernelX.data(), kernelX.size(), kernelY.data(), kernelY.size(), border) :
+                    func2d(width, src.height, channels, type, kernelX.data(), kernelX.size() / kernelY.size(), kernelY.size(), border);
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    SimdCustomFilterRun(filter, src.data, src.stride, dst.data, dst.stride);
+                }
+                SimdRelease(filter);
+            }
+        };
+
+        float CustomFilterValue(const View& src, ptrdiff_t x, ptrdiff_t y, SimdFilterChannelType type)
+        {
+            switch (type)
+            {
+            case SimdFilterChannel8u: return src.At<uint8_t>(x, y);
+            case SimdFilterChannel16u: return src.At<uint16_t>(x, y);
+            default: return src.At<float>(x, y);
+            }
+        }
+
+        void CustomFilterReference(const View& src, size_t channels, SimdFilterChannelType type, bool separable, const Buffer32f& kernelX, const Buffer32f& kernelY, SimdFilterBorderType border, View& dst)
+        {
+            ptrdiff_t width = src.width * src.ChannelCount() / channels, height = src.height;
+            ptrdiff_t sizeY = kernelY.size(), sizeX = separable ? kernelX.size() : kernelX.size() / sizeY;
+            for (ptrdiff_t y = 0; y < height; ++y)
+            {
+                for (ptrdiff_t x = 0; x < width; ++x)
+                {
+                    for (size_t c = 0; c < channels; ++c)
+                    {
+                        double sum = 0;
+                        for (ptrdiff_t ky = 0; ky < sizeY; ++ky)
+                        {
+                            ptrdiff_t sy = Simd::Base::CustomFilterBorder(y + ky - sizeY / 2, height, border);
+                            for (ptrdiff_t kx = 0; kx < sizeX; ++kx)
+                            {
+                                ptrdiff_t sx = Simd::Base::CustomFilterBorder(x + kx - sizeX / 2, width, border);
+                                float weight = separable ? kernelX[kx] * kernelY[ky] : kernelX[ky * sizeX + kx];
+                                if (sx >= 0 && sy >= 0)
+                                    sum += weight * CustomFilterValue(src, sx * channels + c, sy, type);
+                            }
+                        }
+                        size_t dx = x * channels + c;
+                        if (type == SimdFilterChannel8u)
+                            dst.At<uint8_t>(dx, y) = (uint8_t)Simd::RestrictRange<int>(Simd::Round(sum), 0, 255);
+                        else if (type == SimdFilterChannel16u)
+                            dst.At<uint16_t>(dx, y) = (uint16_t)Simd::RestrictRange<int>(Simd::Round(sum), 0, 0xFFFF);
+                        else
+                            dst.At<float>(dx, y) = (float)sum;
+                    }
+                }
+            }
+        }
+    }
+
+#define FUNC_CF(funcSep, func2d) \
+    FuncCF(funcSep, func2d, std::string(#funcSep).substr(0, std::string(#funcSep).rfind("::")))
+
+    bool CustomFilterAutoTest(size_t width, size_t height, size_t channels, SimdFilterChannelType type, size_t sizeX, size_t sizeY, 
+        bool separable, SimdFilterBorderType border, FuncCF f1, FuncCF f2)
+    {
+        bool result = true;
+
+        f1.Update(channels, type, sizeX, sizeY, separable, border);
+        f2.Update(channels, type, sizeX, sizeY, separable, border);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View::Format format = type == SimdFilterChannel8u ? View::Gray8 : (type == SimdFilterChannel16u ? View::Int16 : View::Float);
+        View src(width * channels, height, format, NULL, TEST_ALIGN(width));
+        if (type == SimdFilterChannel8u)
+            FillRandom(src);
+        else if (type == SimdFilterChannel16u)
+            FillRandom16u(src, 0, 30000);
+        else
+            FillRandom32f(src, -100.0f, 100.0f);
+
+        Buffer32f kernelX(separable ? sizeX : sizeX * sizeY), kernelY(sizeY);
+        if (sizeX == 1 || sizeY == 1 || (separable && sizeX == sizeY))
+        {
+            for (size_t i = 0; i < kernelX.size(); ++i)
+                kernelX[i] = 1.0f / kernelX.size();
+            for (size_t i = 0; i < kernelY.size(); ++i)
+                kernelY[i] = 1.0f / kernelY.size();
+        }
+        else
+        {
+            FillRandom(kernelX, -0.5f, 1.0f);
+            FillRandom(kernelY, -0.5f, 1.0f);
+        }
+
+        View dst1(src.width, src.height, src.format, NULL, TEST_ALIGN(width));
+        View dst2(src.width, src.height, src.format, NULL, TEST_ALIGN(width));
+        View dst3(src.width, src.height, src.format, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, channels, type, separable, kernelX, kernelY, border, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, channels, type, separable, kernelX, kernelY, border, dst2));
+
+        CustomFilterReference(src, channels, type, separable, kernelX, kernelY, border, dst3);
+
+        if (type == SimdFilterChannel32f)
+        {
+            result = result && Compare(dst1, dst2, 0.001f, true, 64, DifferenceBoth);
+            result = result && Compare(dst1, dst3, 0.001f, true, 64, DifferenceBoth, "reference");
+        }
+        else
+        {
+            //AVX2 and AVX-512BW use FMA, so rounding of integer outputs can differ by 1.
+            int differenceMax = 1;
+            result = result && Compare(dst1, dst2, differenceMax, true, 64);
+            result = result && Compare(dst1, dst3, differenceMax, true, 64, 0, "reference");
+        }
+
+        return result;
+    }
+
+    bool CustomFilterAutoTest(const FuncCF& f1, const FuncCF& f2)
+    {
+        bool result = true;
+
+        const SimdFilterChannelType types[] = { SimdFilterChannel8u, SimdFilterChannel16u, SimdFilterChannel32f };
+        const SimdFilterBorderType borders[] = { SimdFilterBorderReplicate, SimdFilterBorderReflect, SimdFilterBorderConstant };
+        for (size_t t = 0; t < 3; ++t)
+        {
+            for (size_t channels = 1; channels <= 4; ++channels)
+            {
+                result = result && CustomFilterAutoTest(W, H, channels, types[t], 5, 5, true, borders[channels % 3], f1, f2);
+                result = result && CustomFilterAutoTest(W + O, H - O, channels, types[t], 3, 3, false, borders[(channels + 1) % 3], f1, f2);
+            }
+            for (size_t b = 0; b < 3; ++b)
+            {
+                result = result && CustomFilterAutoTest(W + O, H - O, 3, types[t], 7, 4, true, borders[b], f1, f2);
+                result = result && CustomFilterAutoTest(W + O, H - O, 1, types[t], 15, 1, true, borders[b], f1, f2);
+                result = result && CustomFilterAutoTest(W, H, 2, types[t], 4, 5, false, borders[b], f1, f2);
+                result = result && CustomFilterAutoTest(3, 2, 1, types[t], 5, 7, false, borders[b], f1, f2);
+            }
+        }
+
+        return result;
+    }
+
+    bool CustomFilterAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && CustomFilterAutoTest(FUNC_CF(Simd::Base::CustomFilterSeparableInit, Simd::Base::CustomFilter2dInit), FUNC_CF(SimdCustomFilterSeparableInit, SimdCustomFilter2dInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && CustomFilterAutoTest(FUNC_CF(Simd::Sse41::CustomFilterSeparableInit, Simd::Sse41::CustomFilter2dInit), FUNC_CF(SimdCustomFilterSeparableInit, SimdCustomFilter2dInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && CustomFilterAutoTest(FUNC_CF(Simd::Avx2::CustomFilterSeparableInit, Simd::Avx2::CustomFilter2dInit), FUNC_CF(SimdCustomFilterSeparableInit, SimdCustomFilter2dInit));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw(options))
+            result = result && CustomFilterAutoTest(FUNC_CF(Simd::Avx512bw::CustomFilterSeparableInit, Simd::Avx512bw::CustomFilter2dInit), FUNC_CF(SimdCustomFilterSeparableInit, SimdCustomFilter2dInit));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && TestNeon(options))
+            result = result && CustomFilterAutoTest(FUNC_CF(Simd::Neon::CustomFilterSeparableInit, Simd::Neon::CustomFilter2dInit), FUNC_CF(SimdCustomFilterSeparableInit, SimdCustomFilter2dInit));
+#endif
+
+        return result;
+    }
+
+    //---------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncMo
+        {
+            typedef void* (*FuncPtr)(size_t width, size_t height, size_t channels, SimdMorphologyOperationType operation, SimdMorphologyElementType element, size_t sizeX, size_t sizeY);
+
+            FuncPtr func;
+            String description;
+
+            FuncMo(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(size_t c, SimdMorphologyOperationType o, SimdMorphologyElementType e, size_t sx, size_t sy)
+            {
+                const char* operations[] = { "erode", "dilate", "open", "close", "grad" }, * elements[] = { "rect", "cross", "ellipse" };
+                std::stringstream ss;
+                ss << description << "[" << operations[o] << "-" << elements[e] << "-" << c << "-" << sx << "x" << sy << "]";
+                description = ss.str();
+            }
+
+            void Call(const View& src, size_t channels, SimdMorphologyOperationType operation, SimdMorphologyElementType element, size_t sizeX, size_t sizeY, View& dst) const
+            {
+                void* context = func(src.width / channels, src.height, channels, operation, element, sizeX, sizeY);
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    SimdMorphologyRun(context, src.data, src.stride, dst.data, dst.stride);
+                }
+                SimdRelease(context);
+            }
+        };
+
+        void MorphologyMask(SimdMorphologyElementType element, ptrdiff_t sizeX, ptrdiff_t sizeY, Buffer8u& mask)
+        {
+            ptrdiff_t ax = sizeX / 2, ay = sizeY / 2;
+            mask.resize(sizeX * sizeY);
+            for (ptrdiff_t y = 0; y < sizeY; ++y)
+            {
+                ptrdiff_t beg = 0, end = sizeX;
+                if (element == SimdMorphologyElementEllipse && sizeX > 1 && sizeY > 1)
+                {
+                    ptrdiff_t dx = Simd::Round(ax * ::sqrt(double(ay * ay - (y - ay) * (y - ay)) / double(ay * ay)));
+                    beg = std::max<ptrdiff_t>(ax - dx, 0);
+                    end = std::min<ptrdiff_t>(ax + dx + 1, sizeX);
+                }
+                for (ptrdiff_t x = 0; x < sizeX; ++x)
+                {
+                    if (element == SimdMorphologyElementCross)
+                        mask[y * sizeX + x] = (x == ax || y == ay) ? 1 : 0;
+                    else
+                        mask[y * sizeX + x] = (x >= beg && x < end) ? 1 : 0;
+                }
+            }
+        }
+
+        void MorphologyReference(const View& src, size_t channels, bool dilate, const Buffer8u& mask, ptrdiff_t sizeX, ptrdiff_t sizeY, View& dst)
+        {
+            ptrdiff_t width = src.width / channels, height = src.height;
+            for (ptrdiff_t y = 0; y < height; ++y)
+            {
+                for (ptrdiff_t x = 0; x < width; ++x)
+                {
+                    for (size_t c = 0; c < channels; ++c)
+                    {
+                        int value = dilate ? 0 : 255;
+                        for (ptrdiff_t ky = 0; ky < sizeY; ++ky)
+                        {
+                            ptrdiff_t sy = y + ky - sizeY / 2;
+                            for (ptrdiff_t kx = 0; kx < sizeX; ++kx)
+                            {
+                                ptrdiff_t sx = x + kx - sizeX / 2;
+                                if (mask[ky * sizeX + kx] && sx >= 0 && sx < width && sy >= 0 && sy < height)
+                                {
+                                    int s = src.At<uint8_t>(sx * channels + c, sy);
+                                    value = dilate ? std::max(value, s) : std::min(value, s);
+                                }
+                            }
+                        }
+                        dst.At<uint8_t>(x * channels + c, y) = (uint8_t)value;
+                    }
+                }
+            }
+        }
+
+        void MorphologyReference(const View& src, size_t channels, SimdMorphologyOperationType operation, SimdMorphologyElementType element, size_t sizeX, size_t sizeY, View& dst)
+        {
+            Buffer8u mask;
+            MorphologyMask(element, sizeX, sizeY, mask);
+            View tmp(src.width, src.height, src.format);
+            switch (operation)
+            {
+            case SimdMorphologyErode:
+                MorphologyReference(src, channels, false, mask, sizeX, sizeY, dst);
+                break;
+            case SimdMorphologyDilate:
+                MorphologyReference(src, channels, true, mask, sizeX, sizeY, dst);
+                break;
+            case SimdMorphologyOpen:
+                MorphologyReference(src, channels, false, mask, sizeX, sizeY, tmp);
+                MorphologyReference(tmp, channels, true, mask, sizeX, sizeY, dst);
+                break;
+            case SimdMorphologyClose:
+                MorphologyReference(src, channels, true, mask, sizeX, sizeY, tmp);
+                MorphologyReference(tmp, channels, false, mask, sizeX, sizeY, dst);
+                break;
+            default:
+                MorphologyReference(src, channels, true, mask, sizeX, sizeY, dst);
+                MorphologyReference(src, channels, false, mask, sizeX, sizeY, tmp);
+                for (size_t y = 0; y < dst.height; ++y)
+                    for (size_t x = 0; x < dst.width; ++x)
+                        dst.At<uint8_t>(x, y) -= tmp.At<uint8_t>(x, y);
+            }
+        }
+    }
+
+#define FUNC_MO(func) \
+    FuncMo(func, std::string(#func).substr(0, std::string(#func).rfind("Init")))
+
+    bool MorphologyAutoTest(size_t width, size_t height, size_t channels, SimdMorphologyOperationType operation,
+        SimdMorphologyElementType element, size_t sizeX, size_t sizeY, FuncMo f1, FuncMo f2)
+    {
+        bool result = true;
+
+        f1.Update(channels, operation, element, sizeX, sizeY);
+        f2.Update(channels, operation, element, sizeX, sizeY);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View src(width * channels, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        View dst1(src.width, src.height, src.format, NULL, TEST_ALIGN(width));
+        View dst2(src.width, src.height, src.format, NULL, TEST_ALIGN(width));
+        View dst3(src.width, src.height, src.format, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, channels, operation, element, sizeX, sizeY, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, channels, operation, element, sizeX, sizeY, dst2));
+
+        MorphologyReference(src, channels, operation, element, sizeX, sizeY, dst3);
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+        result = result && Compare(dst1, dst3, 0, true, 64, 0, "reference");
+
+        return result;
+    }
+
+    bool MorphologyAutoTest(const FuncMo& f1, const FuncMo& f2)
+    {
+        bool result = true;
+
+        const SimdMorphologyElementType elements[] = { SimdMorphologyElementRect, SimdMorphologyElementCross, SimdMorphologyElementEllipse };
+        for (size_t e = 0; e < 3; ++e)
+        {
+            for (int o = SimdMorphologyErode; o <= SimdMorphologyGradient; ++o)
+                result = result && MorphologyAutoTest(W, H, 1, (SimdMorphologyOperationType)o, elements[e], 5, 5, f1, f2);
+            for (size_t channels = 2; channels <= 4; ++channels)
+                result = result && MorphologyAutoTest(W + O, H - O, channels, SimdMorphologyErode, elements[e], 7, 4, f1, f2);
+            result = result && MorphologyAutoTest(W + O, H - O, 1, SimdMorphologyDilate, elements[e], 31, 21, f1, f2);
+            result = result && MorphologyAutoTest(W, H, 1, SimdMorphologyGradient, elements[e], 1, 9, f1, f2);
+            result = result && MorphologyAutoTest(W, H, 3, SimdMorphologyClose, elements[e], 12, 1, f1, f2);
+            result = result && MorphologyAutoTest(5, 3, 1, SimdMorphologyOpen, elements[e], 9, 11, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool MorphologyAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && MorphologyAutoTest(FUNC_MO(Simd::Base::MorphologyInit), FUNC_MO(SimdMorphologyInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && MorphologyAutoTest(FUNC_MO(Simd::Sse41::MorphologyInit), FUNC_MO(SimdMorphologyInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && MorphologyAutoTest(FUNC_MO(Simd::Avx2::MorphologyInit), FUNC_MO(SimdMorphologyInit));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw(options))
+            result = result && MorphologyAutoTest(FUNC_MO(Simd::Avx512bw::MorphologyInit), FUNC_MO(SimdMorphologyInit));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && TestNeon(options))
+            result = result && MorphologyAutoTest(FUNC_MO(Simd::Neon::MorphologyInit), FUNC_MO(SimdMorphologyInit));
+#endif
+
+        return result;
+    }
+
+    //---------------------------------------------------------------------------------------------
+
     SIMD_INLINE String ToStr(SimdRecursiveBilateralFilterFlags flags)
     {
         std::stringstream ss;
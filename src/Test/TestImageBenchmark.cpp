@@ -0,0 +1,337 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestFile.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestString.h"
+#include "Test/TestRandom.h"
+#include "Test/TestOptions.h"
+#include "Test/TestTable.h"
+
+#include "Simd/SimdImageLoad.h"
+#include "Simd/SimdImageSave.h"
+
+namespace Test
+{
+    namespace
+    {
+        struct CodecIsa
+        {
+            String name;
+            Simd::ImageLoadFromMemoryPtr load;
+            Simd::ImageSaveToMemoryPtr save;
+
+            CodecIsa(const String& n, Simd::ImageLoadFromMemoryPtr l, Simd::ImageSaveToMemoryPtr s) : name(n), load(l), save(s) {}
+        };
+        typedef std::vector<CodecIsa> CodecIsas;
+
+        struct CodecEncoder
+        {
+            String name;
+            SimdImageFileType file;
+            int quality;
+        };
+
+        struct CodecRecord
+        {
+            String image, codec, operation, isa;
+            size_t width, height, size;
+            int quality;
+            double time, relation;
+
+            double Bpp() const { return size * 8.0 / (width * height); }
+            double MPixelPerSecond() const { return width * height / time * 0.000001; }
+            double MBytePerSecond() const { return size / time * 0.000001; }
+        };
+        typedef std::vector<CodecRecord> CodecRecords;
+
+        template<class Function> double CodecTime(Function function)
+        {
+            size_t count = 0;
+            double start = GetTime(), current = start;
+            do
+            {
+                if (!function())
+                    return 0.0;
+                count++;
+                current = GetTime();
+            } while (current - start < MINIMAL_TEST_EXECUTION_TIME);
+            return (current - start) / count;
+        }
+
+        CodecIsas GetCodecIsas(const Options& options)
+        {
+            CodecIsas isas;
+            if (TestBase(options))
+                isas.push_back(CodecIsa("Base", Simd::Base::ImageLoadFromMemory, Simd::Base::ImageSaveToMemory));
+#ifdef SIMD_SSE41_ENABLE
+            if (Simd::Sse41::Enable && TestSse41(options))
+                isas.push_back(CodecIsa("Sse41", Simd::Sse41::ImageLoadFromMemory, Simd::Sse41::ImageSaveToMemory));
+#endif
+#ifdef SIMD_AVX2_ENABLE
+            if (Simd::Avx2::Enable && TestAvx2(options))
+                isas.push_back(CodecIsa("Avx2", Simd::Avx2::ImageLoadFromMemory, Simd::Avx2::ImageSaveToMemory));
+#endif
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable && TestAvx512bw(options))
+                isas.push_back(CodecIsa("Avx512bw", Simd::Avx512bw::ImageLoadFromMemory, Simd::Avx512bw::ImageSaveToMemory));
+#endif
+#ifdef SIMD_NEON_ENABLE
+            if (Simd::Neon::Enable && TestNeon(options))
+                isas.push_back(CodecIsa("Neon", Simd::Neon::ImageLoadFromMemory, Simd::Neon::ImageSaveToMemory));
+#endif
+            isas.push_back(CodecIsa("Simd", SimdImageLoadFromMemory, SimdImageSaveToMemory));
+            return isas;
+        }
+
+        bool CodecBenchmark(const String& name, const uint8_t* data, size_t size, SimdImageFileType file, const CodecIsas& isas, CodecRecords& records)
+        {
+            View src;
+            if (!src.Load(data, size, View::None))
+            {
+                TEST_LOG_SS(Error, "Can't decode image '" << name << "'!");
+                return false;
+            }
+            TEST_LOG_SS(Info, "Benchmark of image codecs at " << name << " [" << src.width << "x" << src.height << "].");
+
+            for (size_t i = 0; i < isas.size(); ++i)
+            {
+                const CodecIsa & isa = isas[i];
+                CodecRecord record;
+                record.image = name;
+                record.codec = ToExtension(file);
+                record.operation = "decode";
+                record.isa = isa.name;
+                record.width = src.width;
+                record.height = src.height;
+                record.size = size;
+                record.quality = 0;
+                record.relation = 1.0;
+                record.time = CodecTime([&]()
+                {
+                    size_t stride, width, height;
+                    SimdPixelFormatType format = SimdPixelFormatNone;
+                    uint8_t * image = isa.load(data, size, &stride, &width, &height, &format);
+                    Simd::Free(image);
+                    return image != NULL;
+                });
+                if (record.time == 0.0)
+                {
+                    TEST_LOG_SS(Error, "Error of " << isa.name << " decoding of image '" << name << "'!");
+                    return false;
+                }
+                records.push_back(record);
+            }
+
+            const CodecEncoder encoders[] = {
+                { "jpg", SimdImageFileJpeg, 85 },
+                { "jpg-opt", SimdImageFileJpeg, 85 | SimdJpegOptimizeHuffman },
+                { "png", SimdImageFilePng, 100 } };
+            for (size_t e = 0; e < 3; ++e)
+            {
+                const CodecEncoder & encoder = encoders[e];
+                size_t sizeBase = 0;
+                for (size_t i = 0; i < isas.size(); ++i)
+                {
+                    const CodecIsa& isa = isas[i];
+                    CodecRecord record;
+                    record.image = name;
+                    record.codec = encoder.name;
+                    record.operation = "encode";
+                    record.isa = isa.name;
+                    record.width = src.width;
+                    record.height = src.height;
+                    record.size = 0;
+                    record.quality = encoder.quality & 0xFF;
+                    record.time = CodecTime([&]()
+                    {
+                        uint8_t* output = isa.save(src.data, src.stride, src.width, src.height,
+                            (SimdPixelFormatType)src.format, encoder.file, encoder.quality, &record.size);
+                        Simd::Free(output);
+                        return output != NULL;
+                    });
+                    if (record.time == 0.0)
+                    {
+                        TEST_LOG_SS(Error, "Error of " << isa.name << " " << encoder.name << " encoding of image '" << name << "'!");
+                        return false;
+                    }
+                    if (i == 0)
+                        sizeBase = record.size;
+                    record.relation = double(record.size) / double(sizeBase);
+                    records.push_back(record);
+                }
+            }
+            return true;
+        }
+
+        String CodecReportText(const CodecRecords& records)
+        {
+            const char* headers[] = { "Image", "Size", "Codec", "Operation", "Isa", "Bytes", "Bpp", "Rel", "Time(ms)", "MP/s", "MB/s" };
+            const size_t cols = sizeof(headers) / sizeof(headers[0]);
+            Table table(cols, records.size());
+            for (size_t c = 0; c < cols; ++c)
+                table.SetHeader(c, headers[c], c == 4 || c == cols - 1, c < 5 ? Table::Left : Table::Right);
+            for (size_t r = 0; r < records.size(); ++r)
+            {
+                const CodecRecord& record = records[r];
+                size_t c = 0;
+                table.SetCell(c++, r, record.image);
+                table.SetCell(c++, r, ToString(record.width) + "x" + ToString(record.height));
+                table.SetCell(c++, r, record.codec);
+                table.SetCell(c++, r, record.operation);
+                table.SetCell(c++, r, record.isa);
+                table.SetCell(c++, r, ToString(record.size));
+                table.SetCell(c++, r, ToString(record.Bpp(), 3, false));
+                table.SetCell(c++, r, ToString(record.relation, 4, false));
+                table.SetCell(c++, r, ToString(record.time * 1000.0, 3, false));
+                table.SetCell(c++, r, ToString(record.MPixelPerSecond(), 1, false));
+                table.SetCell(c++, r, ToString(record.MBytePerSecond(), 1, false));
+                table.SetRowProp(r, r + 1 < records.size() && records[r + 1].image != record.image);
+            }
+            return table.GenerateText();
+        }
+
+        String JsonEscape(const String& src)
+        {
+            String dst;
+            for (size_t i = 0; i < src.size(); ++i)
+            {
+                if (src[i] == '"' || src[i] == '\\')
+                    dst.push_back('\\');
+                dst.push_back(src[i]);
+            }
+            return dst;
+        }
+
+        String CsvField(const String& src)
+        {
+            if (src.find_first_of(",\"\r\n") == String::npos)
+                return src;
+            String dst = "\"";
+            for (size_t i = 0; i < src.size(); ++i)
+            {
+                if (src[i] == '"')
+                    dst.push_back('"');
+                dst.push_back(src[i]);
+            }
+            return dst + "\"";
+        }
+
+        bool CodecReportSave(const CodecRecords& records, const String& path)
+        {
+            String ext = ToLower(ExtensionByPath(path));
+            if (ext != "csv" && ext != "json")
+            {
+                TEST_LOG_SS(Error, "Unknown format of benchmark report '" << path << "'! It must be CSV or JSON.");
+                return false;
+            }
+            std::ofstream ofs(path);
+            if (!ofs.is_open())
+            {
+                TEST_LOG_SS(Error, "Can't open benchmark report file '" << path << "'!");
+                return false;
+            }
+            if (ext == "csv")
+                ofs << "image,width,height,codec,operation,isa,quality,threads,bytes,bpp,relation,time_ms,mpix_s,mbyte_s" << std::endl;
+            else
+                ofs << "{" << std::endl << "  \"threads\": " << SimdGetThreadNumber() << "," << std::endl << "  \"records\": [" << std::endl;
+            for (size_t r = 0; r < records.size(); ++r)
+            {
+                const CodecRecord& record = records[r];
+                if (ext == "csv")
+                {
+                    ofs << CsvField(record.image) << "," << record.width << "," << record.height << "," << CsvField(record.codec) << ",";
+                    ofs << CsvField(record.operation) << "," << CsvField(record.isa) << "," << record.quality << "," << SimdGetThreadNumber() << ",";
+                    ofs << record.size << "," << ToString(record.Bpp(), 4, false) << "," << ToString(record.relation, 4, false) << ",";
+                    ofs << ToString(record.time * 1000.0, 4, false) << "," << ToString(record.MPixelPerSecond(), 2, false) << ",";
+                    ofs << ToString(record.MBytePerSecond(), 2, false) << std::endl;
+                }
+                else
+                {
+                    ofs << "    { \"image\": \"" << JsonEscape(record.image) << "\", \"width\": " << record.width << ", \"height\": " << record.height;
+                    ofs << ", \"codec\": \"" << JsonEscape(record.codec) << "\", \"operation\": \"" << JsonEscape(record.operation) << "\", \"isa\": \"" << JsonEscape(record.isa);
+                    ofs << "\", \"quality\": " << record.quality << ", \"bytes\": " << record.size << ", \"bpp\": " << ToString(record.Bpp(), 4, false);
+                    ofs << ", \"relation\": " << ToString(record.relation, 4, false) << ", \"time_ms\": " << ToString(record.time * 1000.0, 4, false);
+                    ofs << ", \"mpix_s\": " << ToString(record.MPixelPerSecond(), 2, false) << ", \"mbyte_s\": " << ToString(record.MBytePerSecond(), 2, false);
+                    ofs << " }" << (r + 1 < records.size() ? "," : "") << std::endl;
+                }
+            }
+            if (ext == "json")
+                ofs << "  ]" << std::endl << "}" << std::endl;
+            TEST_LOG_SS(Info, "Benchmark report is saved to '" << path << "'.");
+            return true;
+        }
+    }
+
+    bool ImageCodecBenchmarkSpecialTest(const Options& options)
+    {
+        bool result = true;
+
+        CodecIsas isas = GetCodecIsas(options);
+        CodecRecords records;
+
+        String directory = options.source.empty() ? ROOT_PATH + "/data/image" : options.source;
+        Strings paths;
+        if (!GetFileList(directory, paths))
+            TEST_LOG_SS(Warning, "Can't get list of files in '" << directory << "': the directory does not exist or it is not supported on this platform.");
+        size_t images = 0;
+        for (size_t i = 0; i < paths.size() && result; ++i)
+        {
+            String ext = ToLower(ExtensionByPath(paths[i]));
+            SimdImageFileType file = ext == "png" ? SimdImageFilePng : (ext == "jpg" || ext == "jpeg" ? SimdImageFileJpeg : SimdImageFileUndefined);
+            if (file == SimdImageFileUndefined)
+                continue;
+            size_t size = 0;
+            uint8_t* data = NULL;
+            if (!FileLoad(paths[i].c_str(), &data, &size))
+            {
+                TEST_LOG_SS(Error, "Can't load file '" << paths[i] << "'!");
+                result = false;
+            }
+            else
+                result = result && CodecBenchmark(FileNameByPath(paths[i]), data, size, file, isas, records);
+            SimdFree(data);
+            images++;
+        }
+
+        if (result && images == 0)
+        {
+            TEST_LOG_SS(Info, "There are no JPEG or PNG images in '" << directory << "'. Synthetic image is used.");
+            View src(W, H, View::Bgr24);
+            CreateTestImage(src, 10, 10);
+            size_t size = 0;
+            uint8_t* data = SimdImageSaveToMemory(src.data, src.stride, src.width, src.height, (SimdPixelFormatType)src.format, SimdImageFilePng, 100, &size);
+            result = data && CodecBenchmark("synthetic.png", data, size, SimdImageFilePng, isas, records);
+            SimdFree(data);
+        }
+
+        if (result)
+        {
+            TEST_LOG_SS(Info, "Image codecs benchmark (threads " << SimdGetThreadNumber() << "):" << std::endl << CodecReportText(records));
+            if (!options.output.empty())
+                result = CodecReportSave(records, options.output);
+        }
+
+        return result;
+    }
+}
@@ -109,6 +109,8 @@ namespace Test
             ss << suffix << ".png";
         else if (file == SimdImageFileBmp)
             ss << suffix << ".bmp";
+        else if (file == SimdImageFileQoi)
+            ss << suffix << ".qoi";
         if (file == SimdImageFileJpeg)
             ss << "_" << ToString(quality) << suffix << ".jpg";
         const String dir = "_out";
@@ -209,6 +211,107 @@ namespace Test
         return result;
     }
 
+    static bool HasJpegRestartInterval(const uint8_t* data, size_t size)
+    {
+        for (size_t pos = 2; pos + 4 <= size && data[pos] == 0xFF; pos += 2 + (data[pos + 2] << 8 | data[pos + 3]))
+        {
+            if (data[pos + 1] == 0xDD)
+                return true;
+            if (data[pos + 1] == 0xDA)
+                break;
+        }
+        return false;
+    }
+
+    bool ImageSaveToMemorySlicesAutoTest(size_t width, size_t height, View::Format format, SimdImageFileType file, int quality, FuncSM f1)
+    {
+        bool result = true;
+
+        f1.Update(format, file, quality);
+        f1.desc = f1.desc + "[slices]";
+
+        View src;
+        if (!GetTestImage(src, width, height, format, f1.desc, f1.desc, file, quality, NULL, NULL))
+            return false;
+
+        uint8_t* data1 = NULL, * data2 = NULL;
+        size_t size1 = 0, size2 = 0, threads = SimdGetThreadNumber();
+
+        SimdSetThreadNumber(1);
+        f1.Call(src, file, quality, &data1, &size1);
+        SimdSetThreadNumber(4);
+        bool restart = SimdGetThreadNumber() > 1;
+        f1.Call(src, file, quality, &data2, &size2);
+        SimdSetThreadNumber(threads);
+
+        if (file == SimdImageFileJpeg && (HasJpegRestartInterval(data1, size1) || HasJpegRestartInterval(data2, size2) != restart))
+        {
+            TEST_LOG_SS(Error, "JPEG restart interval must be present only in multi-threaded output!");
+            result = false;
+        }
+
+        View dst1, dst2;
+        if (dst1.Load(data1, size1, format) && dst2.Load(data2, size2, format))
+        {
+            result = result && Compare(dst1, dst2, 0, true, 64, 0, "dst1 & dst2");
+            if (file == SimdImageFilePng)
+                result = result && Compare(src, dst2, 0, true, 64, 0, "src & dst2");
+        }
+        else
+        {
+            TEST_LOG_SS(Error, "Can't load images from memory!");
+            result = false;
+        }
+
+        if (data1)
+            Simd::Free(data1);
+        if (data2)
+            Simd::Free(data2);
+
+        return result;
+    }
+
+    bool ImageSaveToMemoryHuffmanAutoTest(size_t width, size_t height, View::Format format, int quality, FuncSM f1)
+    {
+        bool result = true;
+
+        f1.Update(format, SimdImageFileJpeg, quality);
+        f1.desc = f1.desc + "[huffman]";
+
+        View src;
+        if (!GetTestImage(src, width, height, format, f1.desc, f1.desc, SimdImageFileJpeg, quality, NULL, NULL))
+            return false;
+
+        uint8_t* data1 = NULL, * data2 = NULL;
+        size_t size1 = 0, size2 = 0;
+
+        f1.Call(src, SimdImageFileJpeg, quality, &data1, &size1);
+        f1.Call(src, SimdImageFileJpeg, quality | SimdJpegOptimizeHuffman, &data2, &size2);
+
+        View dst1, dst2;
+        if (dst1.Load(data1, size1, format) && dst2.Load(data2, size2, format))
+        {
+            result = result && Compare(dst1, dst2, 0, true, 64, 0, "dst1 & dst2");
+            if (size2 > size1)
+            {
+                TEST_LOG_SS(Error, "Size of JPEG with optimal Huffman tables " << size2 << " is greater than standard " << size1 << " !");
+                result = false;
+            }
+        }
+        else
+        {
+            TEST_LOG_SS(Error, "Can't load images from memory!");
+            result = false;
+        }
+
+        if (data1)
+            Simd::Free(data1);
+        if (data2)
+            Simd::Free(data2);
+
+        return result;
+    }
+
     bool ImageSaveToMemoryAutoTest(const FuncSM & f1, const FuncSM& f2)
     {
         bool result = true;
@@ -216,7 +319,7 @@ namespace Test
         std::vector<View::Format> formats({ View::Gray8, View::Bgr24, View::Bgra32, View::Rgb24, View::Rgba32});
         for (int format = 0; format < (int)formats.size(); format++)
         {
-            for (int file = (int)SimdImageFileBmp; file <= (int)SimdImageFileBmp; file++)
+            for (int file = (int)SimdImageFileBmp; file <= (int)SimdImageFileRaw; file++)
             {
                 if (file == SimdImageFileJpeg)
                 {
@@ -224,10 +327,23 @@ namespace Test
                     //result = result && ImageSaveToMemoryAutoTest(formats[format], (SimdImageFileType)file, 95, f1, f2);
                     //result = result && ImageSaveToMemoryAutoTest(formats[format], (SimdImageFileType)file, 85, f1, f2);
                     result = result && ImageSaveToMemoryAutoTest(formats[format], (SimdImageFileType)file, 10, f1, f2);
+                    result = result && ImageSaveToMemoryAutoTest(formats[format], (SimdImageFileType)file, 65 | SimdJpegSampling422, f1, f2);
+                    result = result && ImageSaveToMemoryAutoTest(formats[format], (SimdImageFileType)file, 95 | SimdJpegSampling420 | SimdJpegOptimizeHuffman, f1, f2);
                 }
                 result = result && ImageSaveToMemoryAutoTest(formats[format], (SimdImageFileType)file, 65, f1, f2);
             }
+            result = result && ImageSaveToMemorySlicesAutoTest(W, H, formats[format], SimdImageFileJpeg, 95, f1);
+            result = result && ImageSaveToMemorySlicesAutoTest(W + O, H - O, formats[format], SimdImageFileJpeg, 65, f1);
+            result = result && ImageSaveToMemorySlicesAutoTest(W + O, H - O, formats[format], SimdImageFileJpeg, 65 | SimdJpegSampling422 | SimdJpegOptimizeHuffman, f1);
+            result = result && ImageSaveToMemoryHuffmanAutoTest(W + O, H - O, formats[format], 95, f1);
+            result = result && ImageSaveToMemoryHuffmanAutoTest(W + O, H - O, formats[format], 65, f1);
+            result = result && ImageSaveToMemoryHuffmanAutoTest(W + O, H - O, formats[format], 65 | SimdJpegSampling422, f1);
+            result = result && ImageSaveToMemorySlicesAutoTest(W, H, formats[format], SimdImageFilePng, 100, f1);
+            result = result && ImageSaveToMemorySlicesAutoTest(W + O, H - O, formats[format], SimdImageFilePng, 100, f1);
+            result = result && ImageSaveToMemorySlicesAutoTest(W, H, formats[format], SimdImageFilePng, 50, f1);
+            result = result && ImageSaveToMemorySlicesAutoTest(W, H, formats[format], SimdImageFilePng, 5, f1);
         }
+        result = result && ImageSaveToMemorySlicesAutoTest(8200, 528, View::Bgr24, SimdImageFileJpeg, 95, f1);
 
         return result;
     }
@@ -264,6 +380,218 @@ namespace Test
 
     //-------------------------------------------------------------------------------------------------
 
+    namespace
+    {
+        struct FuncSS
+        {
+            typedef Simd::ImageSaveToSinkPtr FuncPtr;
+
+            FuncPtr func;
+            String desc;
+
+            FuncSS(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(View::Format format, SimdImageFileType file, int quality)
+            {
+                desc = desc + "[" + ToString(format) + "-" + ToString(file) +
+                    (file == SimdImageFileJpeg ? String("-") + ToString(quality) : String("")) + "]";
+            }
+
+            static SimdBool Write(void* user, const uint8_t* data, size_t size)
+            {
+                std::vector<uint8_t>& dst = *(std::vector<uint8_t>*)user;
+                dst.insert(dst.end(), data, data + size);
+                return SimdTrue;
+            }
+
+            bool Call(const View& src, SimdImageFileType file, int quality, std::vector<uint8_t>& dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                dst.clear();
+                return func(src.data, src.stride, src.width, src.height, (SimdPixelFormatType)src.format, file, quality, Write, &dst);
+            }
+        };
+    }
+
+#define FUNC_SS(func) \
+    FuncSS(func, std::string(#func))
+
+    bool ImageSaveToSinkAutoTest(size_t width, size_t height, View::Format format, SimdImageFileType file, int quality, FuncSS f1, const FuncSM& f2)
+    {
+        bool result = true;
+
+        f1.Update(format, file, quality);
+
+        View src;
+        if (!GetTestImage(src, width, height, format, f1.desc, f2.desc, file, quality, NULL, NULL))
+            return false;
+
+        std::vector<uint8_t> data1;
+        bool saved = false;
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(saved = f1.Call(src, file, quality, data1));
+
+        uint8_t* data2 = NULL;
+        size_t size2 = 0;
+        f2.Call(src, file, quality, &data2, &size2);
+
+        if (!saved || data1.empty())
+        {
+            TEST_LOG_SS(Error, "Error of image saving in " << f1.desc << "!");
+            result = false;
+        }
+        else
+            result = result && Compare(data1.data(), data1.size(), data2, size2, 0, true, 64);
+
+        if (result)
+        {
+            std::vector<uint8_t> data3(size2);
+            size_t size3 = 0;
+            if (!Simd::ImageSaveToBuffer(f1.func, src.data, src.stride, src.width, src.height, (SimdPixelFormatType)src.format, file, quality, data3.data(), data3.size(), &size3) ||
+                size3 != size2 || memcmp(data3.data(), data2, size2) != 0)
+            {
+                TEST_LOG_SS(Error, "Error of image saving to buffer in " << f1.desc << "!");
+                result = false;
+            }
+            if (Simd::ImageSaveToBuffer(f1.func, src.data, src.stride, src.width, src.height, (SimdPixelFormatType)src.format, file, quality, data3.data(), data3.size() - 1, &size3) ||
+                size3 != size2)
+            {
+                TEST_LOG_SS(Error, "Error of image saving to too small buffer in " << f1.desc << "!");
+                result = false;
+            }
+        }
+
+        if (data2)
+            Simd::Free(data2);
+
+        return result;
+    }
+
+    bool ImageSaveToSinkAutoTest(const FuncSS& f1, const FuncSM& f2)
+    {
+        bool result = true;
+
+        std::vector<View::Format> formats = { View::Gray8, View::Bgr24, View::Bgra32, View::Rgb24, View::Rgba32 };
+        for (size_t format = 0; format < formats.size(); format++)
+        {
+            result = result && ImageSaveToSinkAutoTest(W, H, formats[format], SimdImageFilePpmBin, 100, f1, f2);
+            result = result && ImageSaveToSinkAutoTest(W + O, H - O, formats[format], SimdImageFileBmp, 100, f1, f2);
+            result = result && ImageSaveToSinkAutoTest(W + O, H - O, formats[format], SimdImageFileQoi, 100, f1, f2);
+            result = result && ImageSaveToSinkAutoTest(W, H, formats[format], SimdImageFilePng, 100, f1, f2);
+            result = result && ImageSaveToSinkAutoTest(W, H, formats[format], SimdImageFileJpeg, 95, f1, f2);
+            result = result && ImageSaveToSinkAutoTest(W + O, H - O, formats[format], SimdImageFileJpeg, 65, f1, f2);
+        }
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool ImageSaveBatchToMemoryAutoTest(size_t width, size_t height, size_t count, size_t threads)
+    {
+        bool result = true;
+
+        String desc = String("SimdImageSaveBatchToMemory[") + ToString(count) + "-" + ToString(threads) + "]";
+        TEST_LOG_SS(Info, "Test " << desc << " [" << width << ", " << height << "].");
+
+        std::vector<View::Format> formats = { View::Gray8, View::Bgr24, View::Bgra32, View::Rgb24, View::Rgba32 };
+        std::vector<SimdImageFileType> files = { SimdImageFileBmp, SimdImageFileQoi, SimdImageFilePng, SimdImageFileJpeg };
+        std::vector<View> srcs(count);
+        std::vector<SimdImageSaveItem> items(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            srcs[i].Recreate(width + i, height - i, formats[i % formats.size()]);
+            CreateTestImage(srcs[i], 10, 10);
+            SimdImageSaveItem & item = items[i];
+            item.image = srcs[i].data;
+            item.stride = srcs[i].stride;
+            item.width = srcs[i].width;
+            item.height = srcs[i].height;
+            item.format = (SimdPixelFormatType)srcs[i].format;
+            item.file = files[i % files.size()];
+            item.quality = item.file == SimdImageFileJpeg ? 85 : 100;
+            item.data = NULL;
+            item.size = 0;
+            item.status = SimdFalse;
+        }
+        if (count > 1)
+            items[count - 1].format = SimdPixelFormatNone;
+
+        size_t done = 0, backup = SimdGetThreadNumber();
+        SimdSetThreadNumber(threads);
+        {
+            TEST_PERFORMANCE_TEST(desc);
+            done = SimdImageSaveBatchToMemory(items.data(), items.size());
+        }
+        SimdSetThreadNumber(backup);
+
+        if (done != (count > 1 ? count - 1 : count))
+        {
+            TEST_LOG_SS(Error, "Wrong number " << done << " of saved images in " << desc << "!");
+            result = false;
+        }
+        for (size_t i = 0; i < count && result; ++i)
+        {
+            const SimdImageSaveItem& item = items[i];
+            size_t size = 0;
+            uint8_t* data = SimdImageSaveToMemory(item.image, item.stride, item.width, item.height, item.format, item.file, item.quality, &size);
+            if ((data != NULL) != (item.status == SimdTrue))
+            {
+                TEST_LOG_SS(Error, "Wrong status of item " << i << " in " << desc << "!");
+                result = false;
+            }
+            else if (data)
+                result = result && Compare(item.data, item.size, data, size, 0, true, 64);
+            SimdFree(data);
+        }
+        for (size_t i = 0; i < count; ++i)
+            SimdFree(items[i].data);
+
+        return result;
+    }
+
+    bool ImageSaveBatchToMemoryAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        result = result && ImageSaveBatchToMemoryAutoTest(W, H, 1, 4);
+        result = result && ImageSaveBatchToMemoryAutoTest(W, H, 17, 1);
+        result = result && ImageSaveBatchToMemoryAutoTest(W + O, H - O, 17, 4);
+
+        return result;
+    }
+
+    bool ImageSaveToSinkAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && ImageSaveToSinkAutoTest(FUNC_SS(Simd::Base::ImageSaveToSink), FUNC_SM(Simd::Base::ImageSaveToMemory));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && ImageSaveToSinkAutoTest(FUNC_SS(Simd::Sse41::ImageSaveToSink), FUNC_SM(Simd::Sse41::ImageSaveToMemory));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && ImageSaveToSinkAutoTest(FUNC_SS(Simd::Avx2::ImageSaveToSink), FUNC_SM(Simd::Avx2::ImageSaveToMemory));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw(options))
+            result = result && ImageSaveToSinkAutoTest(FUNC_SS(Simd::Avx512bw::ImageSaveToSink), FUNC_SM(Simd::Avx512bw::ImageSaveToMemory));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && TestNeon(options))
+            result = result && ImageSaveToSinkAutoTest(FUNC_SS(Simd::Neon::ImageSaveToSink), FUNC_SM(Simd::Neon::ImageSaveToMemory));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
     namespace
     {
         struct FuncSNJM
@@ -598,7 +926,7 @@ namespace Test
             return format == View::Gray8;
         if (file == SimdImageFilePpmTxt || file == SimdImageFilePpmBin)
             return format != View::Bgra32 && format != View::Rgba32;
-        if (file == SimdImageFileBmp)
+        if (file == SimdImageFileBmp || file == SimdImageFilePng || file == SimdImageFileQoi || file == SimdImageFileRaw)
             return true;
         return false;
     }
@@ -673,7 +1001,7 @@ namespace Test
         std::vector<View::Format> formats = { View::Gray8, View::Bgr24, View::Bgra32, View::Rgb24, View::Rgba32 };
         for (size_t format = 0; format < formats.size(); format++)
         {
-            for (int file = (int)SimdImageFileBmp; file <= (int)SimdImageFileBmp; file++)
+            for (int file = (int)SimdImageFileBmp; file <= (int)SimdImageFileRaw; file++)
             {
                 if (file == SimdImageFileJpeg)
                 {
@@ -683,6 +1011,10 @@ namespace Test
                 }
                 result = result && ImageLoadFromMemoryAutoTest(formats[format], (SimdImageFileType)file, 65, f1, f2);
             }
+            result = result && ImageLoadFromMemoryAutoTest(formats[format], SimdImageFilePng, 100, f1, f2);
+            result = result && ImageLoadFromMemoryAutoTest(formats[format], SimdImageFilePng, 5, f1, f2);
+            result = result && ImageLoadFromMemoryAutoTest(formats[format], SimdImageFileJpeg, 95, f1, f2);
+            result = result && ImageLoadFromMemoryAutoTest(formats[format], SimdImageFileJpeg, 65, f1, f2);
         }
 
         return result;
@@ -705,10 +1037,10 @@ namespace Test
             result = result && ImageLoadFromMemoryAutoTest(FUNC_LM(Simd::Avx2::ImageLoadFromMemory), FUNC_LM(SimdImageLoadFromMemory));
 #endif 
 
-//#ifdef SIMD_AVX512BW_ENABLE
-//        if (Simd::Avx512bw::Enable && TestAvx512bw(options))
-//            result = result && ImageLoadFromMemoryAutoTest(FUNC_LM(Simd::Avx512bw::ImageLoadFromMemory), FUNC_LM(SimdImageLoadFromMemory));
-//#endif 
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw(options))
+            result = result && ImageLoadFromMemoryAutoTest(FUNC_LM(Simd::Avx512bw::ImageLoadFromMemory), FUNC_LM(SimdImageLoadFromMemory));
+#endif 
 
 #ifdef SIMD_NEON_ENABLE
         if (Simd::Neon::Enable && TestNeon(options))
@@ -720,33 +1052,113 @@ namespace Test
 
     //-------------------------------------------------------------------------------------------------
 
-    bool ImageLoadFromMemorySpecialTest(const String & name, View::Format format, const FuncLM& f1, const FuncLM& f2)
+    namespace
+    {
+        struct FuncLMS
+        {
+            typedef Simd::ImageLoadFromMemoryScaledPtr FuncPtr;
+
+            FuncPtr func;
+            String desc;
+
+            FuncLMS(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(View::Format format, int quality, size_t scale)
+            {
+                desc = desc + "[" + ToString(format) + "-" + ToString(quality) + "-1/" + ToString(scale) + "]";
+            }
+
+            void Call(const uint8_t* data, size_t size, size_t scale, View::Format format, View& dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                ((View::Format&)dst.format) = format;
+                *(uint8_t**)&dst.data = func(data, size, scale, (size_t*)&dst.stride, (size_t*)&dst.width, (size_t*)&dst.height, (SimdPixelFormatType*)&dst.format);
+            }
+        };
+    }
+
+#define FUNC_LMS(func) \
+    FuncLMS(func, std::string(#func))
+
+    static View LoadScaledJpegLuma(const uint8_t* data, size_t size, size_t scale, const FuncLMS& f)
+    {
+        size_t stride = 0, width = 0, height = 0;
+        SimdPixelFormatType format = SimdPixelFormatGray8;
+        uint8_t* luma = f.func(data, size, scale, &stride, &width, &height, &format);
+        return luma ? View(width, height, stride, View::Gray8, luma) : View();
+    }
+
+    static bool CheckScaledJpegLuma(const uint8_t* data, size_t size, size_t scale, const FuncLMS& f, double meanMax, int diffMax)
+    {
+        View full = LoadScaledJpegLuma(data, size, 1, f), scaled = LoadScaledJpegLuma(data, size, scale, f);
+        bool result = full.data && scaled.data;
+        if (!result)
+            TEST_LOG_SS(Error, "Can't load luma of JPEG image!");
+        double sum = 0;
+        int max = 0;
+        for (size_t y = 0; y < scaled.height && result; ++y)
+        {
+            size_t y0 = y * scale, y1 = Simd::Min(y0 + scale, full.height);
+            for (size_t x = 0; x < scaled.width; ++x)
+            {
+                size_t x0 = x * scale, x1 = Simd::Min(x0 + scale, full.width);
+                int area = 0, count = int((y1 - y0) * (x1 - x0));
+                for (size_t fy = y0; fy < y1; ++fy)
+                    for (size_t fx = x0; fx < x1; ++fx)
+                        area += full.At<uint8_t>(fx, fy);
+                int diff = std::abs(scaled.At<uint8_t>(x, y) * count - area);
+                sum += double(diff) / count;
+                max = Simd::Max(max, (diff + count / 2) / count);
+            }
+        }
+        double mean = result ? sum / double(scaled.height * scaled.width) : 0.0;
+        if (result && (mean > meanMax || max > diffMax))
+        {
+            TEST_LOG_SS(Error, "Luma scaled 1/" << scale << " differs from area downscale of full size luma: mean " << mean 
+                << " (allowed " << meanMax << "), max " << max << " (allowed " << diffMax << ")!");
+            result = false;
+        }
+        if (full.data)
+            SimdFree(full.data);
+        if (scaled.data)
+            SimdFree(scaled.data);
+        return result;
+    }
+
+    bool ImageLoadFromMemoryScaledAutoTest(size_t width, size_t height, View::Format format, int quality, size_t scale, FuncLMS f1, FuncLMS f2)
     {
         bool result = true;
 
-        String path = ROOT_PATH + "/data/image/" + name;
-        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " at " << path << " for " << ToString(format) << ".");
+        f1.Update(format, quality, scale);
+        f2.Update(format, quality, scale);
 
+        View src;
         size_t size = 0;
         uint8_t* data = NULL;
-        if (!FileLoad(path.c_str(), &data, &size))
+        if (!GetTestImage(src, width, height, format, f1.desc, f2.desc, SimdImageFileJpeg, quality, &data, &size))
             return false;
 
         View dst1, dst2;
 
-        f1.Call(data, size, format, dst1);
-
-        f2.Call(data, size, format, dst2);
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(if (dst1.data) Simd::Free(dst1.data); f1.Call(data, size, scale, format, dst1));
 
-        int differenceMax = ToLower(ExtensionByPath(path)) == "png" ? 1 : 4;
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(if (dst2.data) SimdFree(dst2.data); f2.Call(data, size, scale, format, dst2));
 
-        result = result && Compare(dst1, dst2, differenceMax, true, 64, 0, "dst1 & dst2");
+        if (dst1.width != Simd::DivHi(src.width, scale) || dst1.height != Simd::DivHi(src.height, scale))
+        {
+            TEST_LOG_SS(Error, "Wrong size of scaled image: [" << dst1.width << "x" << dst1.height << "] instead of [" 
+                << Simd::DivHi(src.width, scale) << "x" << Simd::DivHi(src.height, scale) << "]!");
+            result = false;
+        }
 
+        result = result && Compare(dst1, dst2, GetMaxJpegError(quality), true, 64, 0, "dst1 & dst2");
+        if (result && scale > 1)
+            result = CheckScaledJpegLuma(data, size, scale, f1, 0.25, 16);
         if (!result)
         {
-            SimdImageFileType file = SimdImageFilePng;
-            SaveTestImage(dst1, file, 100, "_1");
-            SaveTestImage(dst2, file, 100, "_2");
+            SaveTestImage(dst1, SimdImageFilePng, 100, "_1");
+            SaveTestImage(dst2, SimdImageFilePng, 100, "_2");
+            SaveTestImage(src, SimdImageFilePpmBin, 100, "_error");
         }
 
         if (dst1.data)
@@ -758,27 +1170,951 @@ namespace Test
         return result;
     }
 
-    bool ImageLoadFromMemorySpecialTest(const String& name, const FuncLM& f1, const FuncLM& f2)
+    bool ImageLoadFromMemoryScaledAutoTest(const FuncLMS& f1, const FuncLMS& f2)
     {
         bool result = true;
 
         std::vector<View::Format> formats = { View::Gray8, View::Bgr24, View::Bgra32, View::Rgb24, View::Rgba32 };
         for (size_t format = 0; format < formats.size(); format++)
-            result = result && ImageLoadFromMemorySpecialTest(name, formats[format], f1, f2);
+        {
+            for (size_t scale = 1; scale <= 8; scale *= 2)
+            {
+                result = result && ImageLoadFromMemoryScaledAutoTest(W, H, formats[format], 95, scale, f1, f2);
+                result = result && ImageLoadFromMemoryScaledAutoTest(W + O, H - O, formats[format], 65, scale, f1, f2);
+            }
+        }
 
         return result;
     }
 
-#define SIMD_PNG_TEST
-//#define SIMD_JPEG_TEST
-
-    bool ImageLoadFromMemorySpecialTest(const FuncLM& f1, const FuncLM& f2)
+    bool ImageLoadFromMemoryScaledAutoTest(const Options& options)
     {
         bool result = true;
 
-#if defined(SIMD_PNG_TEST) && 1
-        result = result && ImageLoadFromMemorySpecialTest("png/basn0g01.png", f1, f2);
-        result = result && ImageLoadFromMemorySpecialTest("png/basn0g02.png", f1, f2);
+        if (TestBase(options))
+            result = result && ImageLoadFromMemoryScaledAutoTest(FUNC_LMS(Simd::Base::ImageLoadFromMemoryScaled), FUNC_LMS(SimdImageLoadFromMemoryScaled));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && ImageLoadFromMemoryScaledAutoTest(FUNC_LMS(Simd::Sse41::ImageLoadFromMemoryScaled), FUNC_LMS(SimdImageLoadFromMemoryScaled));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && ImageLoadFromMemoryScaledAutoTest(FUNC_LMS(Simd::Avx2::ImageLoadFromMemoryScaled), FUNC_LMS(SimdImageLoadFromMemoryScaled));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw(options))
+            result = result && ImageLoadFromMemoryScaledAutoTest(FUNC_LMS(Simd::Avx512bw::ImageLoadFromMemoryScaled), FUNC_LMS(SimdImageLoadFromMemoryScaled));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && TestNeon(options))
+            result = result && ImageLoadFromMemoryScaledAutoTest(FUNC_LMS(Simd::Neon::ImageLoadFromMemoryScaled), FUNC_LMS(SimdImageLoadFromMemoryScaled));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncLB
+        {
+            typedef Simd::ImageLoadBandsFromMemoryPtr FuncPtr;
+
+            FuncPtr func;
+            String desc;
+
+            FuncLB(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(View::Format format, SimdImageFileType file, int quality)
+            {
+                desc = desc + "[" + ToString(format) + "-" + ToString(file) +
+                    (file == SimdImageFileJpeg ? String("-") + ToString(quality) : String("")) + "]";
+            }
+
+            struct Bands
+            {
+                View image;
+                size_t next;
+                bool error;
+            };
+
+            static SimdBool Callback(void* user, const uint8_t* band, size_t stride, size_t width, size_t height, size_t row, size_t rows, SimdPixelFormatType format)
+            {
+                Bands& bands = *(Bands*)user;
+                if (bands.image.width != width || bands.image.height != height || bands.image.format != (View::Format)format)
+                    bands.image.Recreate(width, height, (View::Format)format);
+                if (row != bands.next || row + rows > height)
+                {
+                    bands.error = true;
+                    return SimdFalse;
+                }
+                Simd::Copy(View(width, rows, stride, (View::Format)format, (uint8_t*)band), bands.image.Region(0, row, width, row + rows).Ref());
+                bands.next = row + rows;
+                return SimdTrue;
+            }
+
+            bool Call(const uint8_t* data, size_t size, View::Format format, View& dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                Bands bands;
+                bands.next = 0;
+                bands.error = false;
+                if (!func(data, size, (SimdPixelFormatType)format, Callback, &bands) || bands.error || bands.next != bands.image.height)
+                    return false;
+                dst.Swap(bands.image);
+                return true;
+            }
+        };
+    }
+
+#define FUNC_LB(func) \
+    FuncLB(func, std::string(#func))
+
+    bool ImageLoadBandsFromMemoryAutoTest(size_t width, size_t height, View::Format format, SimdImageFileType file, int quality, FuncLB f1, const FuncLM& f2)
+    {
+        bool result = true;
+
+        f1.Update(format, file, quality);
+
+        View src;
+        size_t size = 0;
+        uint8_t* data = NULL;
+        if (!GetTestImage(src, width, height, format, f1.desc, f2.desc, file, quality, &data, &size))
+            return false;
+
+        View dst1, dst2;
+
+        if (!f1.Call(data, size, format, dst1))
+        {
+            TEST_LOG_SS(Error, "Error of image decoding by bands in " << f1.desc << "!");
+            result = false;
+        }
+
+        f2.Call(data, size, format, dst2);
+
+        int differenceMax = file == SimdImageFileJpeg ? GetMaxJpegError(quality) : 1;
+
+        result = result && Compare(dst1, dst2, differenceMax, true, 64, 0, "dst1 & dst2");
+        if (!result && dst1.data)
+        {
+            SaveTestImage(dst1, SimdImageFilePng, 100, "_1");
+            SaveTestImage(src, SimdImageFilePpmBin, 100, "_error");
+        }
+
+        if (dst2.data)
+            Simd::Free(dst2.data);
+        SimdFree(data);
+
+        return result;
+    }
+
+    bool ImageLoadBandsFromMemoryAutoTest(const FuncLB& f1, const FuncLM& f2)
+    {
+        bool result = true;
+
+        std::vector<View::Format> formats = { View::Gray8, View::Bgr24, View::Bgra32, View::Rgb24, View::Rgba32 };
+        for (size_t format = 0; format < formats.size(); format++)
+        {
+            result = result && ImageLoadBandsFromMemoryAutoTest(W, H, formats[format], SimdImageFilePng, 100, f1, f2);
+            result = result && ImageLoadBandsFromMemoryAutoTest(W + O, H - O, formats[format], SimdImageFilePng, 100, f1, f2);
+            result = result && ImageLoadBandsFromMemoryAutoTest(W, H, formats[format], SimdImageFileJpeg, 95, f1, f2);
+            result = result && ImageLoadBandsFromMemoryAutoTest(W + O, H - O, formats[format], SimdImageFileJpeg, 65, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool ImageLoadBandsFromMemoryAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && ImageLoadBandsFromMemoryAutoTest(FUNC_LB(Simd::Base::ImageLoadBandsFromMemory), FUNC_LM(Simd::Base::ImageLoadFromMemory));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && ImageLoadBandsFromMemoryAutoTest(FUNC_LB(Simd::Sse41::ImageLoadBandsFromMemory), FUNC_LM(Simd::Sse41::ImageLoadFromMemory));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && ImageLoadBandsFromMemoryAutoTest(FUNC_LB(Simd::Avx2::ImageLoadBandsFromMemory), FUNC_LM(Simd::Avx2::ImageLoadFromMemory));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw(options))
+            result = result && ImageLoadBandsFromMemoryAutoTest(FUNC_LB(Simd::Avx512bw::ImageLoadBandsFromMemory), FUNC_LM(Simd::Avx512bw::ImageLoadFromMemory));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && TestNeon(options))
+            result = result && ImageLoadBandsFromMemoryAutoTest(FUNC_LB(Simd::Neon::ImageLoadBandsFromMemory), FUNC_LM(Simd::Neon::ImageLoadFromMemory));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncLR
+        {
+            typedef Simd::ImageLoadRoiFromMemoryPtr FuncPtr;
+
+            FuncPtr func;
+            String desc;
+
+            FuncLR(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(View::Format format, SimdImageFileType file, int quality)
+            {
+                desc = desc + "[" + ToString(format) + "-" + ToString(file) +
+                    (file == SimdImageFileJpeg ? String("-") + ToString(quality) : String("")) + "]";
+            }
+
+            void Call(const uint8_t* data, size_t size, const Rect& roi, View::Format format, View& dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                ((View::Format&)dst.format) = format;
+                *(uint8_t**)&dst.data = func(data, size, roi.left, roi.top, roi.right, roi.bottom, 
+                    (size_t*)&dst.stride, (size_t*)&dst.width, (size_t*)&dst.height, (SimdPixelFormatType*)&dst.format);
+            }
+        };
+    }
+
+#define FUNC_LR(func) \
+    FuncLR(func, std::string(#func))
+
+    bool ImageLoadRoiFromMemoryAutoTest(size_t width, size_t height, View::Format format, SimdImageFileType file, int quality, FuncLR f1, const FuncLM& f2, bool restart = false)
+    {
+        bool result = true;
+
+        f1.Update(format, file, quality);
+
+        View src;
+        size_t size = 0, threads = SimdGetThreadNumber();
+        uint8_t* data = NULL;
+        if (restart)
+            SimdSetThreadNumber(4);
+        bool several = SimdGetThreadNumber() > 1;
+        bool loaded = GetTestImage(src, width, height, format, f1.desc, f2.desc, file, quality, &data, &size);
+        SimdSetThreadNumber(threads);
+        if (!loaded)
+            return false;
+
+        if (restart && !HasJpegRestartInterval(data, size))
+        {
+            SimdFree(data);
+            if (several)
+            {
+                TEST_LOG_SS(Error, "Test JPEG image [" << width << "x" << height << "] has no restart intervals!");
+                return false;
+            }
+            TEST_LOG_SS(Info, "Test of JPEG restart intervals is skipped: they are written only with several threads.");
+            return true;
+        }
+
+        View full;
+        f2.Call(data, size, format, full);
+
+        std::vector<Rect> rois;
+        rois.push_back(Rect(0, 0, src.width, src.height));
+        rois.push_back(Rect(src.width / 3, src.height / 4, src.width * 2 / 3, src.height * 3 / 5));
+        rois.push_back(Rect(src.width - 37, src.height - 21, src.width, src.height));
+        rois.push_back(Rect(1, 3, 6, src.height - 5));
+        for (size_t i = 0; i < rois.size() && result; ++i)
+        {
+            View dst;
+            if (i == 1)
+            {
+                TEST_EXECUTE_AT_LEAST_MIN_TIME(if (dst.data) SimdFree(dst.data); f1.Call(data, size, rois[i], format, dst));
+            }
+            else
+                f1.Call(data, size, rois[i], format, dst);
+            if (dst.data == NULL || dst.width != rois[i].Width() || dst.height != rois[i].Height())
+            {
+                TEST_LOG_SS(Error, "Error of ROI [" << rois[i].left << ", " << rois[i].top << ", " << rois[i].right << ", " << rois[i].bottom << "] decoding in " << f1.desc << "!");
+                result = false;
+            }
+            else
+                result = result && Compare(dst, full.Region(rois[i]), 0, true, 64, 0, "roi & full");
+            if (dst.data)
+                SimdFree(dst.data);
+        }
+
+        if (full.data)
+            Simd::Free(full.data);
+        SimdFree(data);
+
+        return result;
+    }
+
+    bool ImageLoadRoiFromMemoryAutoTest(const FuncLR& f1, const FuncLM& f2)
+    {
+        bool result = true;
+
+        std::vector<View::Format> formats = { View::Gray8, View::Bgr24, View::Bgra32, View::Rgb24, View::Rgba32 };
+        for (size_t format = 0; format < formats.size(); format++)
+        {
+            result = result && ImageLoadRoiFromMemoryAutoTest(W, H, formats[format], SimdImageFilePng, 100, f1, f2);
+            result = result && ImageLoadRoiFromMemoryAutoTest(W, H, formats[format], SimdImageFileJpeg, 95, f1, f2);
+            result = result && ImageLoadRoiFromMemoryAutoTest(W + O, H - O, formats[format], SimdImageFileJpeg, 65, f1, f2);
+        }
+
+        //JPEG encoder writes restart intervals only if several threads are used.
+        result = result && ImageLoadRoiFromMemoryAutoTest(W + O, H - O, View::Gray8, SimdImageFileJpeg, 95, f1, f2, true);
+        result = result && ImageLoadRoiFromMemoryAutoTest(W + O, H - O, View::Bgr24, SimdImageFileJpeg, 65, f1, f2, true);
+
+        return result;
+    }
+
+    bool ImageLoadRoiFromMemoryAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && ImageLoadRoiFromMemoryAutoTest(FUNC_LR(Simd::Base::ImageLoadRoiFromMemory), FUNC_LM(Simd::Base::ImageLoadFromMemory));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && ImageLoadRoiFromMemoryAutoTest(FUNC_LR(Simd::Sse41::ImageLoadRoiFromMemory), FUNC_LM(Simd::Sse41::ImageLoadFromMemory));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && ImageLoadRoiFromMemoryAutoTest(FUNC_LR(Simd::Avx2::ImageLoadRoiFromMemory), FUNC_LM(Simd::Avx2::ImageLoadFromMemory));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw(options))
+            result = result && ImageLoadRoiFromMemoryAutoTest(FUNC_LR(Simd::Avx512bw::ImageLoadRoiFromMemory), FUNC_LM(Simd::Avx512bw::ImageLoadFromMemory));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && TestNeon(options))
+            result = result && ImageLoadRoiFromMemoryAutoTest(FUNC_LR(Simd::Neon::ImageLoadRoiFromMemory), FUNC_LM(Simd::Neon::ImageLoadFromMemory));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool ImageLoadToBufferFromMemoryAutoTest(size_t width, size_t height, View::Format format, SimdImageFileType file, int quality)
+    {
+        bool result = true;
+
+        String desc = String("SimdImageLoadToBufferFromMemory[") + ToString(format) + "-" + ToString(file) +
+            (file == SimdImageFileJpeg ? String("-") + ToString(quality) : String("")) + "]";
+
+        View src;
+        size_t size = 0;
+        uint8_t* data = NULL;
+        if (!GetTestImage(src, width, height, format, desc, "SimdImageLoadFromMemory", file, quality, &data, &size))
+            return false;
+
+        SimdImageFileType infoFile = SimdImageFileUndefined;
+        size_t infoWidth = 0, infoHeight = 0;
+        SimdPixelFormatType infoFormat = SimdPixelFormatNone;
+        if (!SimdImageLoadInfoFromMemory(data, size, &infoFile, &infoWidth, &infoHeight, &infoFormat) ||
+            infoFile != file || infoWidth != src.width || infoHeight != src.height)
+        {
+            TEST_LOG_SS(Error, "Error of image info reading for " << desc << "!");
+            result = false;
+        }
+
+        View::Format formats[2] = { format, (View::Format)infoFormat };
+        for (size_t i = 0; i < 2 && result; ++i)
+        {
+            View dst1(infoWidth, infoHeight, formats[i]), dst2;
+            SimdBool loaded = SimdFalse;
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                loaded = SimdImageLoadToBufferFromMemory(data, size, dst1.data, dst1.stride, dst1.width, dst1.height, i ? SimdPixelFormatNone : (SimdPixelFormatType)format);
+            }
+            if (!loaded || !dst2.Load(data, size, i ? View::None : format))
+            {
+                TEST_LOG_SS(Error, "Error of image loading to buffer in " << desc << "!");
+                result = false;
+            }
+            else
+                result = result && Compare(dst1, dst2, 0, true, 64, 0, "dst1 & dst2");
+        }
+        if (result)
+        {
+            View dst(infoWidth + 1, infoHeight, format);
+            if (SimdImageLoadToBufferFromMemory(data, size, dst.data, dst.stride, dst.width, dst.height, (SimdPixelFormatType)format))
+            {
+                TEST_LOG_SS(Error, "Image of wrong size is loaded to buffer in " << desc << "!");
+                result = false;
+            }
+        }
+
+        SimdFree(data);
+
+        return result;
+    }
+
+    bool ImageLoadToBufferFromMemoryAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        std::vector<View::Format> formats = { View::Gray8, View::Bgr24, View::Bgra32, View::Rgb24, View::Rgba32 };
+        for (size_t format = 0; format < formats.size(); format++)
+        {
+            if (SaveLoadCompatible(formats[format], SimdImageFilePgmBin, 100))
+                result = result && ImageLoadToBufferFromMemoryAutoTest(W, H, formats[format], SimdImageFilePgmBin, 100);
+            if (SaveLoadCompatible(formats[format], SimdImageFilePpmTxt, 100))
+                result = result && ImageLoadToBufferFromMemoryAutoTest(W, H, formats[format], SimdImageFilePpmTxt, 100);
+            result = result && ImageLoadToBufferFromMemoryAutoTest(W + O, H - O, formats[format], SimdImageFileBmp, 100);
+            result = result && ImageLoadToBufferFromMemoryAutoTest(W + O, H - O, formats[format], SimdImageFileQoi, 100);
+            result = result && ImageLoadToBufferFromMemoryAutoTest(W, H, formats[format], SimdImageFileRaw, 100);
+            result = result && ImageLoadToBufferFromMemoryAutoTest(W, H, formats[format], SimdImageFilePng, 100);
+            result = result && ImageLoadToBufferFromMemoryAutoTest(W, H, formats[format], SimdImageFileJpeg, 95);
+            result = result && ImageLoadToBufferFromMemoryAutoTest(W + O, H - O, formats[format], SimdImageFileJpeg, 65);
+        }
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool ImageLoadBatchFromMemoryAutoTest(size_t width, size_t height, SimdResizeMethodType method, size_t threads)
+    {
+        bool result = true;
+
+        String desc = String("SimdImageLoadBatchFromMemory[") + ToString(method) + "-" + ToString(threads) + "]";
+        TEST_LOG_SS(Info, "Test " << desc << " [" << width << ", " << height << "].");
+
+        std::vector<View::Format> formats = { View::Gray8, View::Bgr24, View::Bgra32, View::Rgb24, View::Rgba32 };
+        std::vector<SimdImageFileType> files = { SimdImageFilePng, SimdImageFileBmp, SimdImageFileJpeg, SimdImageFileQoi, SimdImageFileRaw };
+        const size_t count = 20;
+        std::vector<uint8_t*> datas(count, NULL);
+        std::vector<size_t> widths(count), heights(count);
+        std::vector<SimdImageLoadItem> items(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            View src(width + i, height - i, formats[i % formats.size()]);
+            CreateTestImage(src, 10, 10);
+            SimdImageFileType file = files[i % files.size()];
+            SimdImageLoadItem& item = items[i];
+            item.size = 0;
+            datas[i] = SimdImageSaveToMemory(src.data, src.stride, src.width, src.height, (SimdPixelFormatType)src.format, file, 85, &item.size);
+            item.data = datas[i];
+            item.format = i % 3 ? (SimdPixelFormatType)src.format : SimdPixelFormatNone;
+            item.width = widths[i] = i < 5 || i % 4 == 0 ? 0 : src.width / (1 + i % 4);
+            item.height = heights[i] = i < 5 || i % 4 == 1 ? 0 : src.height / (1 + i % 3);
+            item.stride = 0;
+            item.image = NULL;
+            item.status = SimdFalse;
+        }
+        items[count - 1].size = 16;
+
+        size_t done = 0, backup = SimdGetThreadNumber();
+        SimdSetThreadNumber(threads);
+        {
+            TEST_PERFORMANCE_TEST(desc);
+            done = SimdImageLoadBatchFromMemory(items.data(), items.size(), method);
+        }
+        SimdSetThreadNumber(backup);
+
+        if (done != count - 1 || items[count - 1].status || items[count - 1].image)
+        {
+            TEST_LOG_SS(Error, "Wrong number " << done << " of loaded images in " << desc << "!");
+            result = false;
+        }
+        for (size_t i = 0; i < count - 1 && result; ++i)
+        {
+            const SimdImageLoadItem& item = items[i];
+            SimdImageFileType file = files[i % files.size()];
+            View dst1(item.width, item.height, item.stride, (View::Format)item.format, item.image), dst2, dst3;
+            if (!item.status || !dst2.Load(item.data, item.size, i % 3 ? (View::Format)item.format : View::None))
+            {
+                TEST_LOG_SS(Error, "Error of loading of item " << i << " in " << desc << "!");
+                result = false;
+            }
+            else if (i < 5)
+                result = result && Compare(dst1, dst2, 0, true, 64, 0, "dst1 & dst2");
+            else
+            {
+                size_t expW = widths[i] ? widths[i] : (dst2.width * heights[i] + dst2.height / 2) / dst2.height;
+                size_t expH = heights[i] ? heights[i] : (dst2.height * widths[i] + dst2.width / 2) / dst2.width;
+                if (item.width != expW || item.height != expH || dst1.format != dst2.format)
+                {
+                    TEST_LOG_SS(Error, "Wrong size " << item.width << "x" << item.height << " of item " << i << " in " << desc << " (expected " << expW << "x" << expH << ")!");
+                    result = false;
+                }
+                else if (file != SimdImageFileJpeg)
+                {
+                    dst3.Recreate(expW, expH, dst2.format);
+                    void* resizer = SimdResizerInit(dst2.width, dst2.height, expW, expH, dst2.ChannelCount(), SimdResizeChannelByte, method);
+                    if (resizer == NULL)
+                        result = false;
+                    else
+                    {
+                        SimdResizerRun(resizer, dst2.data, dst2.stride, dst3.data, dst3.stride);
+                        SimdRelease(resizer);
+                        result = result && Compare(dst1, dst3, 0, true, 64, 0, "dst1 & dst3");
+                    }
+                }
+            }
+        }
+        for (size_t i = 0; i < count; ++i)
+        {
+            SimdFree(items[i].image);
+            SimdFree(datas[i]);
+        }
+
+        return result;
+    }
+
+    bool ImageLoadBatchFromMemoryAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        result = result && ImageLoadBatchFromMemoryAutoTest(W, H, SimdResizeMethodBilinear, 1);
+        result = result && ImageLoadBatchFromMemoryAutoTest(W + O, H - O, SimdResizeMethodBilinear, 4);
+        result = result && ImageLoadBatchFromMemoryAutoTest(W + O, H - O, SimdResizeMethodArea, 4);
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool ImageRawMapFileAutoTest(size_t width, size_t height, View::Format format)
+    {
+        bool result = true;
+
+        String desc = String("SimdImageRawMapFile[") + ToString(format) + "]";
+        TEST_LOG_SS(Info, "Test " << desc << " [" << width << ", " << height << "].");
+
+        View src(width, height, format);
+        CreateTestImage(src, 10, 10);
+
+        const String dir = "_out";
+        String path = MakePath(dir, String("map_") + ToString(format) + "." + ToExtension(SimdImageFileRaw));
+        if (!CreatePathIfNotExist(dir, false) || !src.Save(path, SimdImageFileRaw))
+        {
+            TEST_LOG_SS(Error, "Can't save image to '" << path << "'!");
+            return false;
+        }
+
+        const uint8_t* data = NULL;
+        size_t stride = 0, mapWidth = 0, mapHeight = 0;
+        SimdPixelFormatType mapFormat = SimdPixelFormatNone;
+        void* mapping = NULL;
+        {
+            TEST_PERFORMANCE_TEST(desc);
+            mapping = SimdImageRawMapFile(path.c_str(), &data, &stride, &mapWidth, &mapHeight, &mapFormat);
+        }
+        if (mapping == NULL || mapWidth != width || mapHeight != height || mapFormat != (SimdPixelFormatType)format || stride % 64 != 0)
+        {
+            TEST_LOG_SS(Error, "Error of image mapping in " << desc << "!");
+            result = false;
+        }
+        else
+        {
+            View dst(mapWidth, mapHeight, stride, (View::Format)mapFormat, (void*)data);
+            result = result && Compare(src, dst, 0, true, 64, 0, "src & dst");
+        }
+        SimdRelease(mapping);
+
+        return result;
+    }
+
+    bool ImageRawMapFileAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        std::vector<View::Format> formats = { View::Gray8, View::Bgr24, View::Bgra32, View::Rgb24, View::Rgba32 };
+        for (size_t format = 0; format < formats.size(); format++)
+            result = result && ImageRawMapFileAutoTest(W + O, H - O, formats[format]);
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncLY
+        {
+            typedef Simd::JpegLoadAsYuvFromMemoryPtr FuncPtr;
+
+            FuncPtr func;
+            String desc;
+
+            FuncLY(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(SimdYuvLayoutType layout, int quality)
+            {
+                const char* names[] = { "Yuv420p", "Nv12", "Yuv444p", "Gray8" };
+                desc = desc + "[" + names[layout] + "-" + ToString(quality) + "]";
+            }
+
+            void Call(const uint8_t* data, size_t size, SimdYuvLayoutType layout, View planes[3]) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                size_t width = 0, height = 0, strides[3] = { 0, 0, 0 };
+                uint8_t* ptrs[3] = { NULL, NULL, NULL };
+                uint8_t* buffer = func(data, size, layout, &width, &height, ptrs, strides);
+                if (buffer == NULL)
+                    return;
+                size_t cw = layout == SimdYuvLayoutYuv444p ? width : (width + 1) / 2;
+                size_t ch = layout == SimdYuvLayoutYuv444p ? height : (height + 1) / 2;
+                planes[0].Recreate(width, height, View::Gray8);
+                Simd::Copy(View(width, height, strides[0], View::Gray8, ptrs[0]), planes[0]);
+                for (size_t i = 1; i < 3; ++i)
+                {
+                    if (ptrs[i] == NULL)
+                        continue;
+                    size_t w = layout == SimdYuvLayoutNv12 ? 2 * cw : cw;
+                    planes[i].Recreate(w, ch, View::Gray8);
+                    Simd::Copy(View(w, ch, strides[i], View::Gray8, ptrs[i]), planes[i]);
+                }
+                SimdFree(buffer);
+            }
+        };
+    }
+
+#define FUNC_LY(func) \
+    FuncLY(func, std::string(#func))
+
+    static bool CheckJpegYuvChroma(const uint8_t* data, size_t size, SimdYuvLayoutType layout, const View planes[3], double meanMax, int diffMax)
+    {
+        View bgr;
+        if (!bgr.Load(data, size, View::Bgr24))
+        {
+            TEST_LOG_SS(Error, "Can't load BGR image from JPEG!");
+            return false;
+        }
+        size_t w = bgr.width & (~1), h = bgr.height & (~1);
+        View y(w, h, View::Gray8), u(w / 2, h / 2, View::Gray8), v(w / 2, h / 2, View::Gray8);
+        SimdBgrToYuv420pV2(bgr.data, bgr.stride, w, h, y.data, y.stride, u.data, u.stride, v.data, v.stride, SimdYuvTrect871);
+
+        View u1(w / 2, h / 2, View::Gray8), v1(w / 2, h / 2, View::Gray8);
+        switch (layout)
+        {
+        case SimdYuvLayoutYuv420p:
+            Simd::Copy(planes[1].Region(0, 0, w / 2, h / 2), u1);
+            Simd::Copy(planes[2].Region(0, 0, w / 2, h / 2), v1);
+            break;
+        case SimdYuvLayoutNv12:
+            SimdDeinterleaveUv(planes[1].data, planes[1].stride, w / 2, h / 2, u1.data, u1.stride, v1.data, v1.stride);
+            break;
+        case SimdYuvLayoutYuv444p:
+            Simd::ReduceGray2x2(planes[1].Region(0, 0, w, h), u1);
+            Simd::ReduceGray2x2(planes[2].Region(0, 0, w, h), v1);
+            break;
+        default:
+            return true;
+        }
+
+        double sum = 0;
+        int max = 0;
+        for (size_t row = 0; row < u.height; ++row)
+        {
+            for (size_t col = 0; col < u.width; ++col)
+            {
+                int du = std::abs(u.At<uint8_t>(col, row) - u1.At<uint8_t>(col, row));
+                int dv = std::abs(v.At<uint8_t>(col, row) - v1.At<uint8_t>(col, row));
+                sum += du + dv;
+                max = Simd::Max(max, Simd::Max(du, dv));
+            }
+        }
+        double mean = sum / double(2 * u.height * u.width);
+        if (mean > meanMax || max > diffMax)
+        {
+            TEST_LOG_SS(Error, "U and V planes differ from BGR decode converted to YUV420P: mean " << mean
+                << " (allowed " << meanMax << "), max " << max << " (allowed " << diffMax << ")!");
+            return false;
+        }
+        return true;
+    }
+
+    bool JpegLoadAsYuvFromMemoryAutoTest(size_t width, size_t height, SimdYuvLayoutType layout, int quality, FuncLY f1, FuncLY f2)
+    {
+        bool result = true;
+
+        f1.Update(layout, quality);
+        f2.Update(layout, quality);
+
+        View src;
+        size_t size = 0;
+        uint8_t* data = NULL;
+        if (!GetTestImage(src, width, height, View::Bgr24, f1.desc, f2.desc, SimdImageFileJpeg, quality, &data, &size))
+            return false;
+
+        View dst1[3], dst2[3], gray[3];
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(data, size, layout, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(data, size, layout, dst2));
+
+        if (dst1[0].width != src.width || dst1[0].height != src.height)
+        {
+            TEST_LOG_SS(Error, "Wrong size of YUV image: [" << dst1[0].width << "x" << dst1[0].height << "] instead of [" 
+                << src.width << "x" << src.height << "]!");
+            result = false;
+        }
+
+        int differenceMax = GetMaxJpegError(quality);
+        result = result && Compare(dst1[0], dst2[0], differenceMax, true, 64, 0, "y1 & y2");
+        for (size_t i = 1; i < 3 && result; ++i)
+        {
+            if ((dst1[i].data == NULL) != (dst2[i].data == NULL))
+            {
+                TEST_LOG_SS(Error, "Different set of output planes!");
+                result = false;
+            }
+            else if (dst1[i].data)
+                result = result && Compare(dst1[i], dst2[i], differenceMax, true, 64, 0, "uv1 & uv2");
+        }
+
+        if (result && layout != SimdYuvLayoutGray8)
+        {
+            f1.Call(data, size, SimdYuvLayoutGray8, gray);
+            result = result && Compare(dst1[0], gray[0], 0, true, 64, 0, "y1 & gray");
+            result = result && CheckJpegYuvChroma(data, size, layout, dst1, 1.5, 48);
+        }
+
+        SimdFree(data);
+
+        return result;
+    }
+
+    bool JpegLoadAsYuvFromMemoryAutoTest(const FuncLY& f1, const FuncLY& f2)
+    {
+        bool result = true;
+
+        SimdYuvLayoutType layouts[] = { SimdYuvLayoutYuv420p, SimdYuvLayoutNv12, SimdYuvLayoutYuv444p, SimdYuvLayoutGray8 };
+        for (size_t layout = 0; layout < 4; layout++)
+        {
+            result = result && JpegLoadAsYuvFromMemoryAutoTest(W, H, layouts[layout], 95, f1, f2);
+            result = result && JpegLoadAsYuvFromMemoryAutoTest(W + O, H - O, layouts[layout], 65, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool JpegLoadAsYuvFromMemoryAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && JpegLoadAsYuvFromMemoryAutoTest(FUNC_LY(Simd::Base::JpegLoadAsYuvFromMemory), FUNC_LY(SimdJpegLoadAsYuvFromMemory));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && JpegLoadAsYuvFromMemoryAutoTest(FUNC_LY(Simd::Sse41::JpegLoadAsYuvFromMemory), FUNC_LY(SimdJpegLoadAsYuvFromMemory));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && JpegLoadAsYuvFromMemoryAutoTest(FUNC_LY(Simd::Avx2::JpegLoadAsYuvFromMemory), FUNC_LY(SimdJpegLoadAsYuvFromMemory));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw(options))
+            result = result && JpegLoadAsYuvFromMemoryAutoTest(FUNC_LY(Simd::Avx512bw::JpegLoadAsYuvFromMemory), FUNC_LY(SimdJpegLoadAsYuvFromMemory));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncJS
+        {
+            typedef Simd::JpegStreamDecoderInitPtr FuncPtr;
+
+            FuncPtr func;
+            String desc;
+
+            FuncJS(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(View::Format format)
+            {
+                desc = desc + "[" + ToString(format) + "]";
+            }
+
+            bool Call(const std::vector<uint8_t*>& data, const std::vector<size_t>& size, const std::vector<size_t>& order, View::Format format, std::vector<View>& dst) const
+            {
+                void* decoder = func((SimdPixelFormatType)format, 2);
+                if (decoder == NULL)
+                    return false;
+                bool result = true;
+                dst.resize(order.size());
+                for (size_t i = 0; i < order.size() && result; ++i)
+                {
+                    size_t stride = 0, width = 0, height = 0;
+                    const uint8_t* frame = NULL;
+                    {
+                        TEST_PERFORMANCE_TEST(desc);
+                        frame = SimdJpegStreamDecoderDecode(decoder, data[order[i]], size[order[i]], &stride, &width, &height);
+                    }
+                    if (frame == NULL)
+                        result = false;
+                    else
+                    {
+                        dst[i].Recreate(width, height, format);
+                        Simd::Copy(View(width, height, stride, format, (void*)frame), dst[i]);
+                    }
+                }
+                SimdRelease(decoder);
+                return result;
+            }
+        };
+    }
+
+#define FUNC_JS(func) \
+    FuncJS(func, std::string(#func))
+
+    bool JpegStreamDecoderAutoTest(View::Format format, FuncJS f1, const FuncLM& f2)
+    {
+        bool result = true;
+
+        f1.Update(format);
+
+        View src;
+        std::vector<uint8_t*> data(3, NULL);
+        std::vector<size_t> size(3, 0);
+        if (!GetTestImage(src, W, H, View::Bgr24, f1.desc, f2.desc, SimdImageFileJpeg, 95, &data[0], &size[0]))
+            return false;
+        data[1] = SimdImageSaveToMemory(src.data, src.stride, src.width, src.height, SimdPixelFormatBgr24, SimdImageFileJpeg, 65, &size[1]);
+        data[2] = SimdImageSaveToMemory(src.data, src.stride, src.width / 2 + O, src.height / 2 - O, SimdPixelFormatBgr24, SimdImageFileJpeg, 85, &size[2]);
+
+        std::vector<size_t> order = { 0, 1, 0, 2, 0, 2 };
+        std::vector<View> dst;
+        if (!f1.Call(data, size, order, format, dst))
+        {
+            TEST_LOG_SS(Error, "Error of JPEG stream decoding in " << f1.desc << "!");
+            result = false;
+        }
+
+        for (size_t i = 0; i < order.size() && result; ++i)
+        {
+            View ref;
+            f2.Call(data[order[i]], size[order[i]], format, ref);
+            result = result && Compare(dst[i], ref, GetMaxJpegError(65), true, 64, 0, "dst & ref");
+            if (ref.data)
+                Simd::Free(ref.data);
+            for (size_t j = 0; j < i && result; ++j)
+                if (order[j] == order[i])
+                    result = result && Compare(dst[i], dst[j], 0, true, 64, 0, "repeated frame");
+        }
+
+        for (size_t i = 0; i < data.size(); ++i)
+            SimdFree(data[i]);
+
+        return result;
+    }
+
+    bool JpegStreamDecoderAutoTest(const FuncJS& f1, const FuncLM& f2)
+    {
+        bool result = true;
+
+        std::vector<View::Format> formats = { View::Gray8, View::Bgr24, View::Bgra32, View::Rgb24, View::Rgba32 };
+        for (size_t format = 0; format < formats.size(); format++)
+            result = result && JpegStreamDecoderAutoTest(formats[format], f1, f2);
+
+        return result;
+    }
+
+    bool JpegStreamDecoderAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && JpegStreamDecoderAutoTest(FUNC_JS(Simd::Base::JpegStreamDecoderInit), FUNC_LM(Simd::Base::ImageLoadFromMemory));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && JpegStreamDecoderAutoTest(FUNC_JS(Simd::Sse41::JpegStreamDecoderInit), FUNC_LM(Simd::Sse41::ImageLoadFromMemory));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && JpegStreamDecoderAutoTest(FUNC_JS(Simd::Avx2::JpegStreamDecoderInit), FUNC_LM(Simd::Avx2::ImageLoadFromMemory));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw(options))
+            result = result && JpegStreamDecoderAutoTest(FUNC_JS(Simd::Avx512bw::JpegStreamDecoderInit), FUNC_LM(Simd::Avx512bw::ImageLoadFromMemory));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool ImageLoadFromMemorySpecialTest(const String & name, View::Format format, const FuncLM& f1, const FuncLM& f2)
+    {
+        bool result = true;
+
+        String path = ROOT_PATH + "/data/image/" + name;
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " at " << path << " for " << ToString(format) << ".");
+
+        size_t size = 0;
+        uint8_t* data = NULL;
+        if (!FileLoad(path.c_str(), &data, &size))
+            return false;
+
+        View dst1, dst2;
+
+        f1.Call(data, size, format, dst1);
+
+        f2.Call(data, size, format, dst2);
+
+        int differenceMax = ToLower(ExtensionByPath(path)) == "png" ? 1 : 4;
+
+        result = result && Compare(dst1, dst2, differenceMax, true, 64, 0, "dst1 & dst2");
+
+        if (!result)
+        {
+            SimdImageFileType file = SimdImageFilePng;
+            SaveTestImage(dst1, file, 100, "_1");
+            SaveTestImage(dst2, file, 100, "_2");
+        }
+
+        if (dst1.data)
+            Simd::Free(dst1.data);
+        if (dst2.data)
+            SimdFree(dst2.data);
+        SimdFree(data);
+
+        return result;
+    }
+
+    bool ImageLoadFromMemorySpecialTest(const String& name, const FuncLM& f1, const FuncLM& f2)
+    {
+        bool result = true;
+
+        std::vector<View::Format> formats = { View::Gray8, View::Bgr24, View::Bgra32, View::Rgb24, View::Rgba32 };
+        for (size_t format = 0; format < formats.size(); format++)
+            result = result && ImageLoadFromMemorySpecialTest(name, formats[format], f1, f2);
+
+        return result;
+    }
+
+#define SIMD_PNG_TEST
+//#define SIMD_JPEG_TEST
+
+    bool ImageLoadFromMemorySpecialTest(const FuncLM& f1, const FuncLM& f2)
+    {
+        bool result = true;
+
+#if defined(SIMD_PNG_TEST) && 1
+        result = result && ImageLoadFromMemorySpecialTest("png/basn0g01.png", f1, f2);
+        result = result && ImageLoadFromMemorySpecialTest("png/basn0g02.png", f1, f2);
         result = result && ImageLoadFromMemorySpecialTest("png/basn0g04.png", f1, f2);
         result = result && ImageLoadFromMemorySpecialTest("png/basn0g08.png", f1, f2);
         result = result && ImageLoadFromMemorySpecialTest("png/basn0g16.png", f1, f2);
@@ -905,6 +2241,68 @@ namespace Test
 
         result = result && ImageLoadFromMemorySpecialTest(FUNC_LM(Simd::Base::ImageLoadFromMemory), FUNC_LM(SimdImageLoadFromMemory));
 
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && ImageLoadFromMemorySpecialTest(FUNC_LM(Simd::Avx2::ImageLoadFromMemory), FUNC_LM(Simd::Base::ImageLoadFromMemory));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw(options))
+            result = result && ImageLoadFromMemorySpecialTest(FUNC_LM(Simd::Avx512bw::ImageLoadFromMemory), FUNC_LM(Simd::Base::ImageLoadFromMemory));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool ImageLoadBandsFromMemorySpecialTest(const String& name, View::Format format, FuncLB f1, const FuncLM& f2)
+    {
+        bool result = true;
+
+        String path = ROOT_PATH + "/data/image/" + name;
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " at " << path << " for " << ToString(format) << ".");
+
+        size_t size = 0;
+        uint8_t* data = NULL;
+        if (!FileLoad(path.c_str(), &data, &size))
+            return false;
+
+        View dst1, dst2;
+
+        if (!f1.Call(data, size, format, dst1))
+        {
+            TEST_LOG_SS(Error, "Error of image decoding by bands in " << f1.desc << "!");
+            result = false;
+        }
+
+        f2.Call(data, size, format, dst2);
+
+        int differenceMax = ToLower(ExtensionByPath(path)) == "png" ? 1 : 4;
+
+        result = result && Compare(dst1, dst2, differenceMax, true, 64, 0, "dst1 & dst2");
+
+        if (dst2.data)
+            Simd::Free(dst2.data);
+        SimdFree(data);
+
+        return result;
+    }
+
+    bool ImageLoadBandsFromMemorySpecialTest(const Options& options)
+    {
+        bool result = true;
+
+        std::vector<View::Format> formats = { View::Gray8, View::Bgr24, View::Bgra32, View::Rgb24, View::Rgba32 };
+        std::vector<String> names = { "png/basn0g02.png", "png/basn0g16.png", "png/basn2c16.png", "png/s39n3p04.png",
+            "png/tbrn2c08.png", "png/basn6a08.png", "png/basi3p02.png" };
+        for (size_t name = 0; name < names.size(); name++)
+        {
+            for (size_t format = 0; format < formats.size(); format++)
+                result = result && ImageLoadBandsFromMemorySpecialTest(names[name], formats[format], 
+                    FUNC_LB(Simd::Base::ImageLoadBandsFromMemory), FUNC_LM(Simd::Base::ImageLoadFromMemory));
+        }
+
         return result;
     }
 }
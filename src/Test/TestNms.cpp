@@ -0,0 +1,339 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2025 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestCompare.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestRandom.h"
+#include "Test/TestOptions.h"
+
+#include "Simd/SimdNms.h"
+
+namespace Test
+{
+    static void FillRandomBoxes(Buffer32f & boxes, size_t size, size_t stride, float range, float sizeMin, float sizeMax)
+    {
+        boxes.resize(stride * 4);
+        for (size_t i = 0; i < size; ++i)
+        {
+            float cx = float(Random() * range), cy = float(Random() * range);
+            float w = sizeMin + float(Random() * (sizeMax - sizeMin)), h = sizeMin + float(Random() * (sizeMax - sizeMin));
+            boxes[0 * stride + i] = cx - w * 0.5f;
+            boxes[1 * stride + i] = cy - h * 0.5f;
+            boxes[2 * stride + i] = cx + w * 0.5f;
+            boxes[3 * stride + i] = cy + h * 0.5f;
+        }
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncDB
+        {
+            typedef void(*FuncPtr)(const float* src, const float* anchors, size_t size, size_t stride, SimdBoxDecodeType type, const float* params, float* dst);
+
+            FuncPtr func;
+            String desc;
+
+            FuncDB(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(SimdBoxDecodeType type)
+            {
+                desc = desc + "[" + (type == SimdBoxDecodeCenterSize ? "Cs" : (type == SimdBoxDecodeYoloV3 ? "Y3" : "Y5")) + "]";
+            }
+
+            void Call(const Buffer32f& src, const Buffer32f& anchors, size_t size, size_t stride, SimdBoxDecodeType type, const float* params, Buffer32f& dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(src.data(), anchors.data(), size, stride, type, params, dst.data());
+            }
+        };
+    }
+
+#define FUNC_DB(function) FuncDB(function, #function)
+
+    bool NmsDecodeBoxes32fAutoTest(size_t size, SimdBoxDecodeType type, FuncDB f1, FuncDB f2)
+    {
+        bool result = true;
+
+        f1.Update(type);
+        f2.Update(type);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << size << "].");
+
+        size_t stride = size + 3;
+        Buffer32f src(stride * 4), anchors(stride * 4), dst1(stride * 4, 0.0f), dst2(stride * 4, 0.0f);
+        FillRandom(src.data(), src.size(), -2.0f, 2.0f);
+        for (size_t i = 0; i < size; ++i)
+        {
+            anchors[0 * stride + i] = float(Random(80));
+            anchors[1 * stride + i] = float(Random(80));
+            anchors[2 * stride + i] = 10.0f + float(Random(100));
+            anchors[3 * stride + i] = 10.0f + float(Random(100));
+        }
+        const float params[4] = { type == SimdBoxDecodeCenterSize ? 0.1f : 8.0f, 0.1f, 0.2f, 0.2f };
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, anchors, size, stride, type, params, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, anchors, size, stride, type, params, dst2));
+
+        result = result && Compare(dst1, dst2, EPS, true, 32, DifferenceBoth);
+
+        return result;
+    }
+
+    bool NmsDecodeBoxes32fAutoTest(const FuncDB& f1, const FuncDB& f2)
+    {
+        bool result = true;
+
+        for (int type = SimdBoxDecodeCenterSize; type <= SimdBoxDecodeYoloV5 && result; ++type)
+        {
+            result = result && NmsDecodeBoxes32fAutoTest(8400, (SimdBoxDecodeType)type, f1, f2);
+            result = result && NmsDecodeBoxes32fAutoTest(1917, (SimdBoxDecodeType)type, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool NmsDecodeBoxes32fAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && NmsDecodeBoxes32fAutoTest(FUNC_DB(Simd::Base::NmsDecodeBoxes32f), FUNC_DB(SimdNmsDecodeBoxes32f));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && NmsDecodeBoxes32fAutoTest(FUNC_DB(Simd::Sse41::NmsDecodeBoxes32f), FUNC_DB(SimdNmsDecodeBoxes32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && NmsDecodeBoxes32fAutoTest(FUNC_DB(Simd::Avx2::NmsDecodeBoxes32f), FUNC_DB(SimdNmsDecodeBoxes32f));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw(options))
+            result = result && NmsDecodeBoxes32fAutoTest(FUNC_DB(Simd::Avx512bw::NmsDecodeBoxes32f), FUNC_DB(SimdNmsDecodeBoxes32f));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncIou
+        {
+            typedef void(*FuncPtr)(const float* boxes, size_t stride, size_t size, const float* box, float* iou);
+
+            FuncPtr func;
+            String desc;
+
+            FuncIou(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Call(const Buffer32f& boxes, size_t stride, size_t size, const float* box, Buffer32f& iou) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(boxes.data(), stride, size, box, iou.data());
+            }
+        };
+    }
+
+#define FUNC_IOU(function) FuncIou(function, #function)
+
+    bool NmsIou32fAutoTest(size_t size, const FuncIou& f1, const FuncIou& f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << size << "].");
+
+        size_t stride = size + 1;
+        Buffer32f boxes, iou1(size, 1.0f), iou2(size, 2.0f);
+        FillRandomBoxes(boxes, size, stride, 200.0f, 0.0f, 60.0f);
+        const float box[4] = { 70.0f, 80.0f, 120.0f, 110.0f };
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(boxes, stride, size, box, iou1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(boxes, stride, size, box, iou2));
+
+        result = result && Compare(iou1, iou2, EPS, true, 32, DifferenceAbsolute);
+
+        return result;
+    }
+
+    bool NmsIou32fAutoTest(const FuncIou& f1, const FuncIou& f2)
+    {
+        bool result = true;
+
+        result = result && NmsIou32fAutoTest(W * H, f1, f2);
+        result = result && NmsIou32fAutoTest(W * H - 1, f1, f2);
+
+        return result;
+    }
+
+    bool NmsIou32fAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && NmsIou32fAutoTest(FUNC_IOU(Simd::Base::NmsIou32f), FUNC_IOU(SimdNmsIou32f));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && NmsIou32fAutoTest(FUNC_IOU(Simd::Sse41::NmsIou32f), FUNC_IOU(SimdNmsIou32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && NmsIou32fAutoTest(FUNC_IOU(Simd::Avx2::NmsIou32f), FUNC_IOU(SimdNmsIou32f));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw(options))
+            result = result && NmsIou32fAutoTest(FUNC_IOU(Simd::Avx512bw::NmsIou32f), FUNC_IOU(SimdNmsIou32f));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncNms
+        {
+            typedef size_t(*FuncPtr)(const float* boxes, size_t stride, const float* scores, const uint32_t* classes, size_t size, float scoreThreshold, size_t topK,
+                SimdNmsType type, float iouThreshold, float sigma, size_t keepTopK, uint32_t* indices, float* outScores);
+
+            FuncPtr func;
+            String desc;
+
+            FuncNms(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(SimdNmsType type, bool classes, size_t topK)
+            {
+                desc = desc + "[" + (type == SimdNmsHard ? "H" : (type == SimdNmsSoftLinear ? "L" : "G")) + (classes ? "-c" : "-a") + "-" + ToString(topK) + "]";
+            }
+
+            void Call(const Buffer32f& boxes, size_t stride, const Buffer32f& scores, const Sums& classes, size_t size, float scoreThreshold, size_t topK,
+                SimdNmsType type, float iouThreshold, float sigma, size_t keepTopK, Sums& indices, Buffer32f& outScores, size_t & count) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                count = func(boxes.data(), stride, scores.data(), classes.empty() ? NULL : classes.data(), size, scoreThreshold, topK, 
+                    type, iouThreshold, sigma, keepTopK, indices.data(), outScores.data());
+            }
+        };
+    }
+
+#define FUNC_NMS(function) FuncNms(function, #function)
+
+    bool Nms32fAutoTest(size_t size, SimdNmsType type, bool perClass, size_t topK, FuncNms f1, FuncNms f2)
+    {
+        bool result = true;
+
+        f1.Update(type, perClass, topK);
+        f2.Update(type, perClass, topK);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << size << "].");
+
+        size_t stride = size, keepTopK = 300, count1 = 0, count2 = 0;
+        Buffer32f boxes, scores(size), outScores1(keepTopK, 0.0f), outScores2(keepTopK, 0.0f);
+        Sums classes, indices1(keepTopK, 0), indices2(keepTopK, 0);
+        FillRandomBoxes(boxes, size, stride, 640.0f, 8.0f, 96.0f);
+        FillRandom(scores.data(), size, 0.0f, 1.0f);
+        if (perClass)
+        {
+            classes.resize(size);
+            for (size_t i = 0; i < size; ++i)
+                classes[i] = Random(8);
+        }
+        float scoreThreshold = 0.05f, iouThreshold = 0.45f, sigma = 0.5f;
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(boxes, stride, scores, classes, size, scoreThreshold, topK, type, iouThreshold, sigma, keepTopK, indices1, outScores1, count1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(boxes, stride, scores, classes, size, scoreThreshold, topK, type, iouThreshold, sigma, keepTopK, indices2, outScores2, count2));
+
+        TEST_CHECK_VALUE(count);
+        for (size_t i = 0; i < count1 && result; ++i)
+        {
+            if (indices1[i] != indices2[i])
+            {
+                TEST_LOG_SS(Error, "Error at " << i << ": index " << indices1[i] << " != " << indices2[i] << " !");
+                result = false;
+            }
+        }
+        result = result && Compare(outScores1, outScores2, EPS, true, 32, DifferenceBoth);
+
+        return result;
+    }
+
+    bool Nms32fAutoTest(const FuncNms& f1, const FuncNms& f2)
+    {
+        bool result = true;
+
+        result = result && Nms32fAutoTest(8400, SimdNmsHard, false, 1000, f1, f2);
+        result = result && Nms32fAutoTest(8400, SimdNmsHard, true, 0, f1, f2);
+        result = result && Nms32fAutoTest(1917, SimdNmsSoftLinear, false, 400, f1, f2);
+        result = result && Nms32fAutoTest(1917, SimdNmsSoftGaussian, true, 400, f1, f2);
+
+        const float boxes[4] = { 0.0f, 0.0f, 1.0f, 1.0f }, scores[1] = { 1.0f }, sigmas[2] = { 0.0f, -0.5f };
+        uint32_t indices[1];
+        for (size_t i = 0; i < 2 && result; ++i)
+        {
+            if (f1.func(boxes, 1, scores, NULL, 1, 0.0f, 0, SimdNmsSoftGaussian, 0.0f, sigmas[i], 1, indices, NULL) != 0)
+            {
+                TEST_LOG_SS(Error, f1.desc << " accepts sigma = " << sigmas[i] << " !");
+                result = false;
+            }
+        }
+
+        return result;
+    }
+
+    bool Nms32fAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && Nms32fAutoTest(FUNC_NMS(Simd::Base::Nms32f), FUNC_NMS(SimdNms32f));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && Nms32fAutoTest(FUNC_NMS(Simd::Sse41::Nms32f), FUNC_NMS(SimdNms32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && Nms32fAutoTest(FUNC_NMS(Simd::Avx2::Nms32f), FUNC_NMS(SimdNms32f));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw(options))
+            result = result && Nms32fAutoTest(FUNC_NMS(Simd::Avx512bw::Nms32f), FUNC_NMS(SimdNms32f));
+#endif 
+
+        return result;
+    }
+}
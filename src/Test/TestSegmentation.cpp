@@ -194,6 +194,208 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        typedef std::vector<SimdSegmentationComponent> Components;
+
+        struct FuncLC
+        {
+            typedef size_t(*FuncPtr)(const uint8_t * mask, size_t maskStride, size_t width, size_t height, uint8_t index,
+                SimdSegmentationConnectivityType connectivity, uint32_t * labels, size_t labelsStride, SimdSegmentationComponent ** components);
+            FuncPtr func;
+            String description;
+
+            FuncLC(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(SimdSegmentationConnectivityType connectivity)
+            {
+                description = description + "[" + ToString((int)connectivity) + "]";
+            }
+
+            void Call(const View & mask, uint8_t index, SimdSegmentationConnectivityType connectivity, View & labels, Components & components) const
+            {
+                SimdSegmentationComponent * buffer = NULL;
+                size_t count = 0;
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    count = func(mask.data, mask.stride, mask.width, mask.height, index, connectivity, (uint32_t*)labels.data, labels.stride, &buffer);
+                }
+                components.assign(buffer, buffer + count);
+                SimdFree(buffer);
+            }
+        };
+
+        void SegmentationLabelComponentsReference(const View & mask, uint8_t index, SimdSegmentationConnectivityType connectivity, View & labels, Components & components)
+        {
+            ptrdiff_t w = mask.width, h = mask.height, n = connectivity == SimdSegmentationConnectivity8 ? 8 : 4;
+            const ptrdiff_t dx[8] = { -1, 1, 0, 0, -1, 1, -1, 1 }, dy[8] = { 0, 0, -1, 1, -1, -1, 1, 1 };
+            Simd::Fill(labels, 0);
+            components.clear();
+            std::vector<Point> stack;
+            for (ptrdiff_t y = 0; y < h; ++y)
+            {
+                for (ptrdiff_t x = 0; x < w; ++x)
+                {
+                    if (mask.At<uint8_t>(x, y) != index || labels.At<uint32_t>(x, y))
+                        continue;
+                    uint32_t label = uint32_t(components.size() + 1);
+                    SimdSegmentationComponent c = { 0, x, y, x + 1, y + 1, 0.0f, 0.0f };
+                    double sx = 0, sy = 0;
+                    labels.At<uint32_t>(x, y) = label;
+                    stack.push_back(Point(x, y));
+                    while (stack.size())
+                    {
+                        Point p = stack.back();
+                        stack.pop_back();
+                        c.area++;
+                        sx += double(p.x);
+                        sy += double(p.y);
+                        c.left = std::min(c.left, p.x);
+                        c.top = std::min(c.top, p.y);
+                        c.right = std::max(c.right, p.x + 1);
+                        c.bottom = std::max(c.bottom, p.y + 1);
+                        for (ptrdiff_t i = 0; i < n; ++i)
+                        {
+                            ptrdiff_t nx = p.x + dx[i], ny = p.y + dy[i];
+                            if (nx < 0 || nx >= w || ny < 0 || ny >= h || mask.At<uint8_t>(nx, ny) != index || labels.At<uint32_t>(nx, ny))
+                                continue;
+                            labels.At<uint32_t>(nx, ny) = label;
+                            stack.push_back(Point(nx, ny));
+                        }
+                    }
+                    c.x = float(sx / double(c.area));
+                    c.y = float(sy / double(c.area));
+                    components.push_back(c);
+                }
+            }
+        }
+
+        bool Compare(const Components & a, const Components & b, const String & description)
+        {
+            if (a.size() != b.size())
+            {
+                TEST_LOG_SS(Error, "Fail comparison: " << description << ": numbers of components are different: " << a.size() << " != " << b.size() << ".");
+                return false;
+            }
+            for (size_t i = 0; i < a.size(); ++i)
+            {
+                const SimdSegmentationComponent & ca = a[i], & cb = b[i];
+                if (ca.area != cb.area || ca.left != cb.left || ca.top != cb.top || ca.right != cb.right || ca.bottom != cb.bottom ||
+                    std::abs(ca.x - cb.x) > EPS || std::abs(ca.y - cb.y) > EPS)
+                {
+                    TEST_LOG_SS(Error, "Fail comparison: " << description << ": components " << i << " are different: {" << ca.area << ", [" << ca.left << ", " << ca.top << ", " << ca.right << ", " << ca.bottom
+                        << "], (" << ca.x << ", " << ca.y << ")} != {" << cb.area << ", [" << cb.left << ", " << cb.top << ", " << cb.right << ", " << cb.bottom << "], (" << cb.x << ", " << cb.y << ")}.");
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+
+#define FUNC_LC(func) FuncLC(func, #func)
+
+    bool SegmentationLabelComponentsAutoTest(int width, int height, SimdSegmentationConnectivityType connectivity, bool smooth, FuncLC f1, FuncLC f2, size_t threads = 1)
+    {
+        bool result = true;
+
+        f1.Update(connectivity);
+        f2.Update(connectivity);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " for size [" << width << "," << height << "] in " << threads << " threads.");
+
+        const uint8_t index = 3;
+        View mask(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        if (smooth)
+        {
+            View src(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+            CreateTestImage(src, 10, 10);
+            for (int y = 0; y < height; ++y)
+                for (int x = 0; x < width; ++x)
+                    mask.At<uint8_t>(x, y) = src.At<uint8_t>(x, y) > 128 ? index : 0;
+        }
+        else
+        {
+            FillRandom(mask, 0, index);
+            for (int y = 0; y < height; ++y)
+                for (int x = 0; x < width; ++x)
+                    if ((x + y) % 17 == 0 || (x - y) % 29 == 0)
+                        mask.At<uint8_t>(x, y) = index;
+        }
+
+        View labels1(width, height, View::Int32, NULL, TEST_ALIGN(width));
+        View labels2(width, height, View::Int32, NULL, TEST_ALIGN(width));
+        View labels3(width, height, View::Int32, NULL, TEST_ALIGN(width));
+        Components components1, components2, components3;
+
+        size_t backup = SimdGetThreadNumber();
+        SimdSetThreadNumber(threads);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(mask, index, connectivity, labels1, components1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(mask, index, connectivity, labels2, components2));
+
+        SimdSetThreadNumber(backup);
+
+        SegmentationLabelComponentsReference(mask, index, connectivity, labels3, components3);
+
+        result = result && Compare(labels1, labels2, 0, true, 64);
+        result = result && Compare(labels1, labels3, 0, true, 64, 0, "reference");
+        result = result && Compare(components1, components2, f1.description + " & " + f2.description);
+        result = result && Compare(components1, components3, "reference");
+
+        return result;
+    }
+
+    bool SegmentationLabelComponentsAutoTest(const FuncLC & f1, const FuncLC & f2)
+    {
+        bool result = true;
+
+        for (int c = 4; c <= 8; c += 4)
+        {
+            SimdSegmentationConnectivityType connectivity = (SimdSegmentationConnectivityType)c;
+            result = result && SegmentationLabelComponentsAutoTest(W, H, connectivity, true, f1, f2);
+            result = result && SegmentationLabelComponentsAutoTest(W + O, H - O, connectivity, false, f1, f2);
+            result = result && SegmentationLabelComponentsAutoTest(W - O, H + O, connectivity, false, f1, f2);
+            result = result && SegmentationLabelComponentsAutoTest(1, 1, connectivity, false, f1, f2);
+            result = result && SegmentationLabelComponentsAutoTest(67, 5, connectivity, false, f1, f2);
+            result = result && SegmentationLabelComponentsAutoTest(W, H, connectivity, true, f1, f2, 4);
+            result = result && SegmentationLabelComponentsAutoTest(W + O, H - O, connectivity, false, f1, f2, 3);
+            result = result && SegmentationLabelComponentsAutoTest(67, 101, connectivity, false, f1, f2, 7);
+        }
+
+        return result;
+    }
+
+    bool SegmentationLabelComponentsAutoTest(const Options & options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && SegmentationLabelComponentsAutoTest(FUNC_LC(Simd::Base::SegmentationLabelComponents), FUNC_LC(SimdSegmentationLabelComponents));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && SegmentationLabelComponentsAutoTest(FUNC_LC(Simd::Sse41::SegmentationLabelComponents), FUNC_LC(SimdSegmentationLabelComponents));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && SegmentationLabelComponentsAutoTest(FUNC_LC(Simd::Avx2::SegmentationLabelComponents), FUNC_LC(SimdSegmentationLabelComponents));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw(options))
+            result = result && SegmentationLabelComponentsAutoTest(FUNC_LC(Simd::Avx512bw::SegmentationLabelComponents), FUNC_LC(SimdSegmentationLabelComponents));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && TestNeon(options))
+            result = result && SegmentationLabelComponentsAutoTest(FUNC_LC(Simd::Neon::SegmentationLabelComponents), FUNC_LC(SimdSegmentationLabelComponents));
+#endif
+
+        return result;
+    }
+
     namespace
     {
         struct FuncCI
@@ -104,6 +104,8 @@ namespace Test
         case SimdImageFilePng:          return "Png";
         case SimdImageFileJpeg:         return "Jpeg";
         case SimdImageFileBmp:          return "Bmp";
+        case SimdImageFileQoi:          return "Qoi";
+        case SimdImageFileRaw:          return "Raw";
         default: assert(0);  return "";
         }
     }
@@ -171,6 +173,8 @@ namespace Test
         case SimdImageFilePng:    return "png";
         case SimdImageFileJpeg:   return "jpg";
         case SimdImageFileBmp:    return "bmp";
+        case SimdImageFileQoi:    return "qoi";
+        case SimdImageFileRaw:    return "simd";
         default: assert(0);  return "";
         }
     }
@@ -29,6 +29,7 @@
 #include "Test/TestOptions.h"
 
 #include "Simd/SimdSynet.h"
+#include "Simd/SimdSynetPreprocess.h"
 
 namespace Test
 {
@@ -335,5 +336,331 @@ namespace Test
 
         return result;
     }
+
+    //-------------------------------------------------------------------------------------------------
+
+    String ToString(SimdResizeMethodType method);
+
+    namespace
+    {
+        struct FuncPP
+        {
+            typedef void* (*FuncPtr)(size_t srcW, size_t srcH, SimdPixelFormatType srcFormat, size_t dstW, size_t dstH, size_t channels,
+                SimdResizeMethodType method, const float* mean, const float* std, SimdTensorFormatType dstFormat, SimdTensorDataType dstType);
+
+            FuncPtr func;
+            String desc;
+
+            FuncPP(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t sw, size_t sh, View::Format src, size_t dw, size_t dh, size_t c, SimdResizeMethodType method, SimdTensorFormatType format, SimdTensorDataType type)
+            {
+                desc = desc + "[" + ToString(src) + ":" + ToString(sw) + "x" + ToString(sh) + "-" + ToString(method) + "->" + 
+                    ToString(c) + "x" + ToString(dh) + "x" + ToString(dw) + ":" + ToString(format) + "-" + ToString(type) + "]";
+            }
+
+            void Call(const View& src, size_t dstW, size_t dstH, size_t channels, SimdResizeMethodType method, const float* mean, const float* std,
+                SimdTensorFormatType format, SimdTensorDataType type, uint8_t* dst) const
+            {
+                void* context = func(src.width, src.height, (SimdPixelFormatType)src.format, dstW, dstH, channels, method, mean, std, format, type);
+                if (context)
+                {
+                    {
+                        TEST_PERFORMANCE_TEST(desc);
+                        SimdSynetPreprocessRun(context, src.data, src.stride, dst);
+                    }
+                    SimdRelease(context);
+                }
+            }
+        };
+    }
+
+#define FUNC_PP(function) FuncPP(function, #function)
+
+    static void ToBuffer32f(const Buffer8u& src, SimdTensorDataType type, Buffer32f& dst)
+    {
+        for (size_t i = 0; i < dst.size(); ++i)
+        {
+            switch (type)
+            {
+            case SimdTensorData32f: dst[i] = ((float*)src.data())[i]; break;
+            case SimdTensorData16b: dst[i] = Simd::Base::BFloat16ToFloat32(((uint16_t*)src.data())[i]); break;
+            case SimdTensorData8u: dst[i] = src[i]; break;
+            default: assert(0);
+            }
+        }
+    }
+
+    static bool SynetPreprocessReferenceTest(size_t srcW, size_t srcH, View::Format srcFormat, size_t dstW, size_t dstH, size_t channels,
+        SimdResizeMethodType method, const float* mean, const float* std, SimdTensorFormatType format, SimdTensorDataType type, const FuncPP& f)
+    {
+        void* resizer = SimdResizerInit(srcW, srcH, dstW, dstH, View::PixelSize(srcFormat), SimdResizeChannelByte, method);
+        if (resizer == NULL)
+            return true;
+
+        View src(srcW, srcH, srcFormat);
+        for (size_t y = 0; y < srcH; ++y)
+            for (size_t x = 0; x < src.width * src.PixelSize(); ++x)
+                src.data[y * src.stride + x] = uint8_t(128.0 + 100.0 * ::sin(0.013 * x + 0.7 * (x % src.PixelSize())) * ::cos(0.011 * y));
+
+        size_t size = channels * dstH * dstW, typeSize = type == SimdTensorData32f ? 4 : (type == SimdTensorData16b ? 2 : 1);
+        Buffer8u dst(size * typeSize);
+        void* context = f.func(srcW, srcH, (SimdPixelFormatType)srcFormat, dstW, dstH, channels, method, mean, std, format, type);
+        if (context == NULL)
+        {
+            SimdRelease(resizer);
+            return true;
+        }
+        SimdSynetPreprocessRun(context, src.data, src.stride, dst.data());
+        SimdRelease(context);
+        Buffer32f val(size);
+        ToBuffer32f(dst, type, val);
+
+        View resized(dstW, dstH, srcFormat);
+        SimdResizerRun(resizer, src.data, src.stride, resized.data, resized.stride);
+        SimdRelease(resizer);
+        float lower[3], upper[3];
+        for (size_t c = 0; c < channels; ++c)
+        {
+            lower[c] = -mean[c] / std[c];
+            upper[c] = (255.0f - mean[c]) / std[c];
+        }
+        Buffer32f ref(size);
+        SimdSynetSetInput(resized.data, dstW, dstH, resized.stride, (SimdPixelFormatType)srcFormat, lower, upper, ref.data(), channels, format);
+        if (type == SimdTensorData8u)
+        {
+            for (size_t i = 0; i < size; ++i)
+                ref[i] = Simd::RestrictRange(ref[i], 0.0f, 255.0f);
+        }
+
+        float stdMin = Simd::Min(std[0], Simd::Min(std[1], std[2]));
+        float differenceMax = 1.5f / stdMin + (type == SimdTensorData8u ? 0.5f : (type == SimdTensorData16b ? 0.02f : 0.0f));
+        return Compare(val, ref, differenceMax, true, 64, DifferenceAbsolute, "reference");
+    }
+
+    bool SynetPreprocessAutoTest(size_t srcW, size_t srcH, View::Format srcFormat, size_t dstW, size_t dstH, size_t channels,
+        SimdResizeMethodType method, SimdTensorFormatType format, SimdTensorDataType type, FuncPP f1, FuncPP f2)
+    {
+        bool result = true;
+
+        f1.Update(srcW, srcH, srcFormat, dstW, dstH, channels, method, format, type);
+        f2.Update(srcW, srcH, srcFormat, dstW, dstH, channels, method, format, type);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc);
+
+        View image(srcW + 2, srcH + 2, srcFormat);
+        FillRandom(image);
+        View src = image.Region(1, 1, srcW + 1, srcH + 1);
+
+        float mean[3] = { 104.0f, 117.0f, 123.0f }, std[3] = { 58.4f, 57.1f, 57.4f };
+        if (type == SimdTensorData8u)
+            mean[0] = 12.0f, mean[1] = -8.0f, mean[2] = 20.0f, std[0] = 0.9f, std[1] = 1.1f, std[2] = 1.3f;
+
+        size_t size = channels * dstH * dstW, typeSize = type == SimdTensorData32f ? 4 : (type == SimdTensorData16b ? 2 : 1);
+        Buffer8u dst1(size * typeSize, 0), dst2(size * typeSize, 1);
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dstW, dstH, channels, method, mean, std, format, type, dst1.data()));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dstW, dstH, channels, method, mean, std, format, type, dst2.data()));
+
+        Buffer32f val1(size), val2(size);
+        ToBuffer32f(dst1, type, val1);
+        ToBuffer32f(dst2, type, val2);
+        if (type == SimdTensorData8u)
+            result = result && Compare(val1, val2, 1.0f, true, 64, DifferenceAbsolute);
+        else
+            result = result && Compare(val1, val2, type == SimdTensorData16b ? 0.01f : EPS, true, 64, DifferenceBoth);
+
+        result = result && SynetPreprocessReferenceTest(srcW, srcH, srcFormat, dstW, dstH, channels, method, mean, std, format, type, f1);
+
+        return result;
+    }
+
+    bool SynetPreprocessAutoTest(const FuncPP& f1, const FuncPP& f2)
+    {
+        bool result = true;
+
+        View::Format srcFormat[5] = { View::Gray8, View::Bgr24, View::Bgra32, View::Rgb24, View::Rgba32 };
+        size_t channels[2] = { 1, 3 };
+        SimdTensorFormatType dstFormat[2] = { SimdTensorFormatNchw, SimdTensorFormatNhwc };
+        SimdResizeMethodType method[4] = { SimdResizeMethodNearest, SimdResizeMethodNearestPytorch, SimdResizeMethodBilinearCaffe, SimdResizeMethodBilinearPytorch };
+        SimdTensorDataType dstType[2] = { SimdTensorData16b, SimdTensorData8u };
+
+        for (int s = 0; s < 5; ++s)
+            for (int c = 0; c < 2; ++c)
+                for (int d = 0; d < 2; ++d)
+                    result = result && SynetPreprocessAutoTest(W / 2, H / 2, srcFormat[s], 224, 224, channels[c], SimdResizeMethodBilinear, dstFormat[d], SimdTensorData32f, f1, f2);
+
+        for (int m = 0; m < 4; ++m)
+            result = result && SynetPreprocessAutoTest(W / 2, H / 2, View::Bgr24, 224, 224, 3, method[m], SimdTensorFormatNchw, SimdTensorData32f, f1, f2);
+
+        for (int t = 0; t < 2; ++t)
+            for (int d = 0; d < 2; ++d)
+                result = result && SynetPreprocessAutoTest(W / 2, H / 2, View::Bgr24, 224, 224, 3, SimdResizeMethodBilinear, dstFormat[d], dstType[t], f1, f2);
+
+        result = result && SynetPreprocessAutoTest(W / 5 + O, H / 7 + O, View::Bgra32, 301, 223, 3, SimdResizeMethodBilinear, SimdTensorFormatNhwc, SimdTensorData32f, f1, f2);
+        result = result && SynetPreprocessAutoTest(W / 2 + O, H / 2 - O, View::Rgb24, 223, 111, 3, SimdResizeMethodBilinear, SimdTensorFormatNchw, SimdTensorData8u, f1, f2);
+
+        return result;
+    }
+
+    bool SynetPreprocessAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && SynetPreprocessAutoTest(FUNC_PP(Simd::Base::SynetPreprocessInit), FUNC_PP(SimdSynetPreprocessInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && SynetPreprocessAutoTest(FUNC_PP(Simd::Sse41::SynetPreprocessInit), FUNC_PP(SimdSynetPreprocessInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && SynetPreprocessAutoTest(FUNC_PP(Simd::Avx2::SynetPreprocessInit), FUNC_PP(SimdSynetPreprocessInit));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw(options))
+            result = result && SynetPreprocessAutoTest(FUNC_PP(Simd::Avx512bw::SynetPreprocessInit), FUNC_PP(SimdSynetPreprocessInit));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncPY
+        {
+            typedef void* (*FuncPtr)(size_t srcW, size_t srcH, SimdYuvType yuvType, SimdBool nv12, SimdBool isRgb, size_t dstW, size_t dstH,
+                SimdResizeMethodType method, const float* mean, const float* std, SimdTensorFormatType dstFormat, SimdTensorDataType dstType);
+
+            FuncPtr func;
+            String desc;
+
+            FuncPY(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t sw, size_t sh, SimdYuvType yuvType, bool nv12, bool isRgb, size_t dw, size_t dh, SimdResizeMethodType method, SimdTensorFormatType format, SimdTensorDataType type)
+            {
+                desc = desc + "[" + (nv12 ? "Nv12" : "Yuv420p") + "-" + ToString((int)yuvType) + ":" + ToString(sw) + "x" + ToString(sh) + "-" + ToString(method) + "->" +
+                    (isRgb ? "Rgb:" : "Bgr:") + ToString(dh) + "x" + ToString(dw) + ":" + ToString(format) + "-" + ToString(type) + "]";
+            }
+
+            void Call(const View& y, const View& u, const View& v, SimdYuvType yuvType, bool nv12, bool isRgb, size_t dstW, size_t dstH, SimdResizeMethodType method, 
+                const float* mean, const float* std, SimdTensorFormatType format, SimdTensorDataType type, uint8_t* dst) const
+            {
+                void* context = func(y.width, y.height, yuvType, nv12 ? SimdTrue : SimdFalse, isRgb ? SimdTrue : SimdFalse, dstW, dstH, method, mean, std, format, type);
+                if (context)
+                {
+                    {
+                        TEST_PERFORMANCE_TEST(desc);
+                        SimdSynetPreprocessYuv420Run(context, y.data, y.stride, u.data, u.stride, v.data, v.stride, dst);
+                    }
+                    SimdRelease(context);
+                }
+            }
+        };
+    }
+
+#define FUNC_PY(function) FuncPY(function, #function)
+
+    bool SynetPreprocessYuv420AutoTest(size_t srcW, size_t srcH, SimdYuvType yuvType, bool nv12, bool isRgb, size_t dstW, size_t dstH,
+        SimdResizeMethodType method, SimdTensorFormatType format, SimdTensorDataType type, FuncPY f1, FuncPY f2)
+    {
+        bool result = true;
+
+        srcW = srcW & ~size_t(1), srcH = srcH & ~size_t(1);
+        f1.Update(srcW, srcH, yuvType, nv12, isRgb, dstW, dstH, method, format, type);
+        f2.Update(srcW, srcH, yuvType, nv12, isRgb, dstW, dstH, method, format, type);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc);
+
+        View y(srcW, srcH, View::Gray8), u, v;
+        FillRandom(y);
+        if (nv12)
+        {
+            u.Recreate(srcW / 2, srcH / 2, View::Uv16);
+            FillRandom(u);
+        }
+        else
+        {
+            u.Recreate(srcW / 2, srcH / 2, View::Gray8);
+            v.Recreate(srcW / 2, srcH / 2, View::Gray8);
+            FillRandom(u);
+            FillRandom(v);
+        }
+
+        float mean[3] = { 104.0f, 117.0f, 123.0f }, std[3] = { 58.4f, 57.1f, 57.4f };
+        if (type == SimdTensorData8u)
+            mean[0] = 12.0f, mean[1] = -8.0f, mean[2] = 20.0f, std[0] = 0.9f, std[1] = 1.1f, std[2] = 1.3f;
+
+        size_t size = 3 * dstH * dstW, typeSize = type == SimdTensorData32f ? 4 : (type == SimdTensorData16b ? 2 : 1);
+        Buffer8u dst1(size * typeSize, 0), dst2(size * typeSize, 1);
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, u, v, yuvType, nv12, isRgb, dstW, dstH, method, mean, std, format, type, dst1.data()));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, u, v, yuvType, nv12, isRgb, dstW, dstH, method, mean, std, format, type, dst2.data()));
+
+        Buffer32f val1(size), val2(size);
+        ToBuffer32f(dst1, type, val1);
+        ToBuffer32f(dst2, type, val2);
+        if (type == SimdTensorData8u)
+            result = result && Compare(val1, val2, 1.0f, true, 64, DifferenceAbsolute);
+        else
+            result = result && Compare(val1, val2, type == SimdTensorData16b ? 0.01f : EPS, true, 64, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetPreprocessYuv420AutoTest(const FuncPY& f1, const FuncPY& f2)
+    {
+        bool result = true;
+
+        SimdTensorFormatType dstFormat[2] = { SimdTensorFormatNchw, SimdTensorFormatNhwc };
+        SimdTensorDataType dstType[2] = { SimdTensorData32f, SimdTensorData16b };
+
+        for (int n = 0; n < 2; ++n)
+            for (int d = 0; d < 2; ++d)
+                for (int t = 0; t < 2; ++t)
+                    result = result && SynetPreprocessYuv420AutoTest(W, H, SimdYuvBt601, n != 0, false, 224, 224, SimdResizeMethodBilinear, dstFormat[d], dstType[t], f1, f2);
+
+        result = result && SynetPreprocessYuv420AutoTest(W / 3 * 2 + E, H / 2 + E, SimdYuvTrect871, true, true, 301, 223, SimdResizeMethodBilinearPytorch, SimdTensorFormatNchw, SimdTensorData32f, f1, f2);
+        result = result && SynetPreprocessYuv420AutoTest(W / 2 - E, H / 2 - E, SimdYuvBt709, false, true, 223, 111, SimdResizeMethodNearest, SimdTensorFormatNhwc, SimdTensorData8u, f1, f2);
+        result = result && SynetPreprocessYuv420AutoTest(24, 16, SimdYuvBt2020, true, false, 37, 19, SimdResizeMethodBilinear, SimdTensorFormatNchw, SimdTensorData32f, f1, f2);
+
+        return result;
+    }
+
+    bool SynetPreprocessYuv420AutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && SynetPreprocessYuv420AutoTest(FUNC_PY(Simd::Base::SynetPreprocessYuv420Init), FUNC_PY(SimdSynetPreprocessYuv420Init));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && SynetPreprocessYuv420AutoTest(FUNC_PY(Simd::Sse41::SynetPreprocessYuv420Init), FUNC_PY(SimdSynetPreprocessYuv420Init));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && SynetPreprocessYuv420AutoTest(FUNC_PY(Simd::Avx2::SynetPreprocessYuv420Init), FUNC_PY(SimdSynetPreprocessYuv420Init));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw(options))
+            result = result && SynetPreprocessYuv420AutoTest(FUNC_PY(Simd::Avx512bw::SynetPreprocessYuv420Init), FUNC_PY(SimdSynetPreprocessYuv420Init));
+#endif 
+
+        return result;
+    }
 #endif
 }
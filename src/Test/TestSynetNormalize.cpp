@@ -30,6 +30,7 @@
 #include "Test/TestOptions.h"
 
 #include "Simd/SimdSynet.h"
+#include "Simd/SimdSynetGroupNorm16b.h"
 
 namespace Test
 {
@@ -293,5 +294,145 @@ namespace Test
         return result;
     }
 
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncGN16b
+        {
+            typedef void* (*FuncPtr)(size_t batch, size_t channels, size_t spatial, size_t groups, SimdTensorDataType srcType, SimdTensorDataType dstType, SimdTensorFormatType format, float eps, SimdConvolutionActivationType activation);
+
+            FuncPtr func;
+            String desc;
+
+            FuncGN16b(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t b, size_t c, size_t s, size_t g, SimdTensorDataType st, SimdTensorDataType dt, SimdTensorFormatType f, SimdConvolutionActivationType a)
+            {
+                const char* afs[] = { "-id", "-re", "-lr", "-rr", "-pr", "-el", "-hs", "-mi", "-hi", "-sw", "-ge" };
+                desc = desc + "[" + ToString(b) + "x" + ToString(c) + "x" + ToString(s) + "-" + ToString(g) + "-" + ToChar(st) + ToChar(dt) +
+                    (f == SimdTensorFormatNhwc ? "1" : "0") + afs[a] + "]";
+            }
+
+            void Call(void* context, const uint8_t* src, const float* scale, const float* shift, const float* params, uint8_t* dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                ::SimdSynetGroupNorm16bForward(context, src, scale, shift, params, dst);
+            }
+        };
+    }
+
+#define FUNC_GN16B(function) FuncGN16b(function, #function)
+
+    bool SynetGroupNorm16bAutoTest(size_t batch, size_t channels, size_t spatial, size_t groups, SimdTensorDataType srcType, SimdTensorDataType dstType, 
+        SimdTensorFormatType format, SimdConvolutionActivationType activation, FuncGN16b f1, FuncGN16b f2)
+    {
+        bool result = true;
+
+        f1.Update(batch, channels, spatial, groups, srcType, dstType, format, activation);
+        f2.Update(batch, channels, spatial, groups, srcType, dstType, format, activation);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc);
+
+        Shape shape = ToShape(batch, channels, spatial, 1, format);
+        Tensor32f src32f(shape), dst32f1(shape), dst32f2(shape), scale(Shp(channels)), shift(Shp(channels)), params(Shp(2));
+        Tensor16u src16b(shape), dst16b1(shape), dst16b2(shape);
+
+        srand(0);
+        FillRandom(src32f.Data(), src32f.Size(), -1.0, 3.0f);
+        FillRandom(scale.Data(), scale.Size(), 0.5, 1.5f);
+        FillRandom(shift.Data(), shift.Size(), -1.0, 1.0f);
+        params.Data()[0] = 1.1f;
+        params.Data()[1] = 0.0f;
+
+        SimdFloat32ToBFloat16(src32f.Data(), src32f.Size(), src16b.Data());
+
+        Fill(dst32f1, 1.0f);
+        Fill(dst32f2, 2.0f);
+
+        Fill(dst16b1.Data(), dst16b1.Size(), uint16_t(1));
+        Fill(dst16b2.Data(), dst16b2.Size(), uint16_t(2));
+
+        const uint8_t* src = srcType == SimdTensorData32f ? (uint8_t*)src32f.Data() : (uint8_t*)src16b.Data();
+        uint8_t* dst1 = dstType == SimdTensorData32f ? (uint8_t*)dst32f1.Data() : (uint8_t*)dst16b1.Data();
+        uint8_t* dst2 = dstType == SimdTensorData32f ? (uint8_t*)dst32f2.Data() : (uint8_t*)dst16b2.Data();
+
+        void* context1 = f1.func(batch, channels, spatial, groups, srcType, dstType, format, 0.00001f, activation);
+        void* context2 = f2.func(batch, channels, spatial, groups, srcType, dstType, format, 0.00001f, activation);
+
+        if (context1 == NULL)
+            return true;
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(context1, src, scale.Data(), shift.Data(), params.Data(), dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(context2, src, scale.Data(), shift.Data(), params.Data(), dst2));
+
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+
+        float eps = EPS;
+        if (dstType == SimdTensorData16b)
+        {
+            eps = eps * 7.8f;
+            SimdBFloat16ToFloat32(dst16b1.Data(), dst16b1.Size(), dst32f1.Data());
+            SimdBFloat16ToFloat32(dst16b2.Data(), dst16b2.Size(), dst32f2.Data());
+        }
+        result = result && Compare(dst32f1, dst32f2, eps, true, 64, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetGroupNorm16bAutoTest(const FuncGN16b& f1, const FuncGN16b& f2)
+    {
+        bool result = true;
+
+        const SimdTensorFormatType nchw = SimdTensorFormatNchw, nhwc = SimdTensorFormatNhwc;
+        const SimdTensorDataType f32 = SimdTensorData32f, b16 = SimdTensorData16b;
+        const SimdConvolutionActivationType aId = SimdConvolutionActivationIdentity, aSw = SimdConvolutionActivationSwish, aGe = SimdConvolutionActivationGelu;
+
+#if 1
+        result = result && SynetGroupNorm16bAutoTest(1, 320, 1024, 32, f32, f32, nchw, aSw, f1, f2);
+        result = result && SynetGroupNorm16bAutoTest(1, 320, 1024, 32, f32, f32, nhwc, aSw, f1, f2);
+        result = result && SynetGroupNorm16bAutoTest(1, 320, 1024, 32, b16, b16, nchw, aSw, f1, f2);
+        result = result && SynetGroupNorm16bAutoTest(1, 320, 1024, 32, b16, b16, nhwc, aSw, f1, f2);
+#endif
+#if 1
+        result = result && SynetGroupNorm16bAutoTest(2, 64, 783, 64, f32, b16, nchw, aId, f1, f2);
+        result = result && SynetGroupNorm16bAutoTest(2, 64, 783, 64, b16, f32, nhwc, aId, f1, f2);
+        result = result && SynetGroupNorm16bAutoTest(3, 96, 201, 8, f32, f32, nchw, aGe, f1, f2);
+        result = result && SynetGroupNorm16bAutoTest(3, 99, 201, 3, b16, f32, nhwc, aGe, f1, f2);
+        result = result && SynetGroupNorm16bAutoTest(2, 30, 17, 1, f32, b16, nhwc, aSw, f1, f2);
+#endif
+
+        return result;
+    }
+
+    bool SynetGroupNorm16bAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && SynetGroupNorm16bAutoTest(FUNC_GN16B(Simd::Base::SynetGroupNorm16bInit), FUNC_GN16B(SimdSynetGroupNorm16bInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && SynetGroupNorm16bAutoTest(FUNC_GN16B(Simd::Sse41::SynetGroupNorm16bInit), FUNC_GN16B(SimdSynetGroupNorm16bInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && SynetGroupNorm16bAutoTest(FUNC_GN16B(Simd::Avx2::SynetGroupNorm16bInit), FUNC_GN16B(SimdSynetGroupNorm16bInit));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw(options))
+            result = result && SynetGroupNorm16bAutoTest(FUNC_GN16B(Simd::Avx512bw::SynetGroupNorm16bInit), FUNC_GN16B(SimdSynetGroupNorm16bInit));
+#endif
+
+        return result;
+    }
+
 #endif
 }
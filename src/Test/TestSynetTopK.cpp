@@ -0,0 +1,354 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2024 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestCompare.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestTensor.h"
+#include "Test/TestString.h"
+#include "Test/TestRandom.h"
+#include "Test/TestOptions.h"
+
+#include "Simd/SimdSynetTopK.h"
+
+namespace Test
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace
+    {
+        struct FuncAE
+        {
+            typedef void(*FuncPtr)(const float* src, size_t outer, size_t count, size_t inner, int32_t* dst);
+
+            FuncPtr func;
+            String desc;
+
+            FuncAE(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t outer, size_t count, size_t inner)
+            {
+                desc = desc + "[" + ToString(outer) + "-" + ToString(count) + "-" + ToString(inner) + "]";
+            }
+
+            void Call(const Tensor32f& src, Tensor32i& dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(src.Data(), src.Axis(0), src.Axis(1), src.Axis(2), dst.Data());
+            }
+        };
+    }
+
+#define FUNC_AE(function) FuncAE(function, #function)
+
+    bool SynetArgExtremum32fAutoTest(size_t outer, size_t count, size_t inner, bool ties, FuncAE f1, FuncAE f2)
+    {
+        bool result = true;
+
+        f1.Update(outer, count, inner);
+        f2.Update(outer, count, inner);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << ".");
+
+        Tensor32f src({ outer, count, inner });
+        FillRandom(src.Data(), src.Size(), -10.0f, 10.0f);
+        if (ties)
+        {
+            for (size_t i = 0; i < src.Size(); ++i)
+                src.Data()[i] = ::floorf(src.Data()[i]);
+        }
+
+        Tensor32i dst1({ outer, inner }, SimdTensorFormatUnknown, 1);
+        Tensor32i dst2({ outer, inner }, SimdTensorFormatUnknown, 2);
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool SynetArgExtremum32fAutoTest(const FuncAE& f1, const FuncAE& f2)
+    {
+        bool result = true;
+
+        result = result && SynetArgExtremum32fAutoTest(512 * 512, 21, 1, false, f1, f2);
+        result = result && SynetArgExtremum32fAutoTest(1, 21, 512 * 512, false, f1, f2);
+        result = result && SynetArgExtremum32fAutoTest(1000, 1000, 1, true, f1, f2);
+        result = result && SynetArgExtremum32fAutoTest(7, 19, 1001, true, f1, f2);
+        result = result && SynetArgExtremum32fAutoTest(333, 3, 3, true, f1, f2);
+
+        return result;
+    }
+
+    bool SynetArgMax32fAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && SynetArgExtremum32fAutoTest(FUNC_AE(Simd::Base::SynetArgMax32f), FUNC_AE(SimdSynetArgMax32f));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && SynetArgExtremum32fAutoTest(FUNC_AE(Simd::Sse41::SynetArgMax32f), FUNC_AE(SimdSynetArgMax32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && SynetArgExtremum32fAutoTest(FUNC_AE(Simd::Avx2::SynetArgMax32f), FUNC_AE(SimdSynetArgMax32f));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw(options))
+            result = result && SynetArgExtremum32fAutoTest(FUNC_AE(Simd::Avx512bw::SynetArgMax32f), FUNC_AE(SimdSynetArgMax32f));
+#endif
+
+        return result;
+    }
+
+    bool SynetArgMin32fAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && SynetArgExtremum32fAutoTest(FUNC_AE(Simd::Base::SynetArgMin32f), FUNC_AE(SimdSynetArgMin32f));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && SynetArgExtremum32fAutoTest(FUNC_AE(Simd::Sse41::SynetArgMin32f), FUNC_AE(SimdSynetArgMin32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && SynetArgExtremum32fAutoTest(FUNC_AE(Simd::Avx2::SynetArgMin32f), FUNC_AE(SimdSynetArgMin32f));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw(options))
+            result = result && SynetArgExtremum32fAutoTest(FUNC_AE(Simd::Avx512bw::SynetArgMin32f), FUNC_AE(SimdSynetArgMin32f));
+#endif
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncTK32f
+        {
+            typedef void(*FuncPtr)(const float* src, size_t outer, size_t count, size_t inner, size_t k, SimdBool largest, SimdBool sorted, float* dstVal, int32_t* dstIdx);
+
+            FuncPtr func;
+            String desc;
+
+            FuncTK32f(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t outer, size_t count, size_t inner, size_t k, bool largest, bool sorted)
+            {
+                desc = desc + "[" + ToString(outer) + "-" + ToString(count) + "-" + ToString(inner) + "-" + ToString(k) + "-" + ToString(largest) + "-" + ToString(sorted) + "]";
+            }
+
+            void Call(const Tensor32f& src, size_t k, bool largest, bool sorted, Tensor32f& dstVal, Tensor32i& dstIdx) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(src.Data(), src.Axis(0), src.Axis(1), src.Axis(2), k, largest ? SimdTrue : SimdFalse, sorted ? SimdTrue : SimdFalse, dstVal.Data(), dstIdx.Data());
+            }
+        };
+    }
+
+#define FUNC_TK32F(function) FuncTK32f(function, #function)
+
+    bool SynetTopK32fAutoTest(size_t outer, size_t count, size_t inner, size_t k, bool largest, bool sorted, bool ties, FuncTK32f f1, FuncTK32f f2)
+    {
+        bool result = true;
+
+        f1.Update(outer, count, inner, k, largest, sorted);
+        f2.Update(outer, count, inner, k, largest, sorted);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << ".");
+
+        Tensor32f src({ outer, count, inner });
+        FillRandom(src.Data(), src.Size(), -100.0f, 100.0f);
+        if (ties)
+        {
+            for (size_t i = 0; i < src.Size(); ++i)
+                src.Data()[i] = ::floorf(src.Data()[i]);
+        }
+
+        Tensor32f dstVal1({ outer, k, inner }, SimdTensorFormatUnknown, 1.0f);
+        Tensor32f dstVal2({ outer, k, inner }, SimdTensorFormatUnknown, 2.0f);
+        Tensor32i dstIdx1({ outer, k, inner }, SimdTensorFormatUnknown, 1);
+        Tensor32i dstIdx2({ outer, k, inner }, SimdTensorFormatUnknown, 2);
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, k, largest, sorted, dstVal1, dstIdx1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, k, largest, sorted, dstVal2, dstIdx2));
+
+        result = result && Compare(dstIdx1, dstIdx2, 0, true, 64, "dstIdx");
+        result = result && Compare(dstVal1, dstVal2, 0.0f, true, 64, DifferenceAbsolute, "dstVal");
+
+        return result;
+    }
+
+    bool SynetTopK32fAutoTest(const FuncTK32f& f1, const FuncTK32f& f2)
+    {
+        bool result = true;
+
+        result = result && SynetTopK32fAutoTest(1000, 1000, 1, 5, true, true, false, f1, f2);
+        result = result && SynetTopK32fAutoTest(64, 32000, 1, 1, true, true, false, f1, f2);
+        result = result && SynetTopK32fAutoTest(64, 32000, 1, 50, false, false, false, f1, f2);
+        result = result && SynetTopK32fAutoTest(16, 10000, 1, 100, true, true, true, f1, f2);
+        result = result && SynetTopK32fAutoTest(10, 101, 49, 7, false, true, true, f1, f2);
+        result = result && SynetTopK32fAutoTest(100, 37, 1, 37, true, false, true, f1, f2);
+
+        return result;
+    }
+
+    bool SynetTopK32fAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && SynetTopK32fAutoTest(FUNC_TK32F(Simd::Base::SynetTopK32f), FUNC_TK32F(SimdSynetTopK32f));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && SynetTopK32fAutoTest(FUNC_TK32F(Simd::Sse41::SynetTopK32f), FUNC_TK32F(SimdSynetTopK32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && SynetTopK32fAutoTest(FUNC_TK32F(Simd::Avx2::SynetTopK32f), FUNC_TK32F(SimdSynetTopK32f));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw(options))
+            result = result && SynetTopK32fAutoTest(FUNC_TK32F(Simd::Avx512bw::SynetTopK32f), FUNC_TK32F(SimdSynetTopK32f));
+#endif
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncTK16b
+        {
+            typedef void(*FuncPtr)(const uint16_t* src, size_t outer, size_t count, size_t inner, size_t k, SimdBool largest, SimdBool sorted, uint16_t* dstVal, int32_t* dstIdx);
+
+            FuncPtr func;
+            String desc;
+
+            FuncTK16b(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t outer, size_t count, size_t inner, size_t k, bool largest, bool sorted)
+            {
+                desc = desc + "[" + ToString(outer) + "-" + ToString(count) + "-" + ToString(inner) + "-" + ToString(k) + "-" + ToString(largest) + "-" + ToString(sorted) + "]";
+            }
+
+            void Call(const Tensor16u& src, size_t k, bool largest, bool sorted, Tensor16u& dstVal, Tensor32i& dstIdx) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(src.Data(), src.Axis(0), src.Axis(1), src.Axis(2), k, largest ? SimdTrue : SimdFalse, sorted ? SimdTrue : SimdFalse, dstVal.Data(), dstIdx.Data());
+            }
+        };
+    }
+
+#define FUNC_TK16B(function) FuncTK16b(function, #function)
+
+    bool SynetTopK16bAutoTest(size_t outer, size_t count, size_t inner, size_t k, bool largest, bool sorted, FuncTK16b f1, FuncTK16b f2)
+    {
+        bool result = true;
+
+        f1.Update(outer, count, inner, k, largest, sorted);
+        f2.Update(outer, count, inner, k, largest, sorted);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << ".");
+
+        Tensor32f src32f({ outer, count, inner });
+        Tensor16u src16b({ outer, count, inner });
+        FillRandom(src32f.Data(), src32f.Size(), -100.0f, 100.0f);
+        SimdFloat32ToBFloat16(src32f.Data(), src32f.Size(), src16b.Data());
+
+        Tensor16u dstVal1({ outer, k, inner }, SimdTensorFormatUnknown, 1);
+        Tensor16u dstVal2({ outer, k, inner }, SimdTensorFormatUnknown, 2);
+        Tensor32i dstIdx1({ outer, k, inner }, SimdTensorFormatUnknown, 1);
+        Tensor32i dstIdx2({ outer, k, inner }, SimdTensorFormatUnknown, 2);
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src16b, k, largest, sorted, dstVal1, dstIdx1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src16b, k, largest, sorted, dstVal2, dstIdx2));
+
+        result = result && Compare(dstIdx1, dstIdx2, 0, true, 64, "dstIdx");
+        result = result && Compare(dstVal1, dstVal2, 0, true, 64, "dstVal");
+
+        return result;
+    }
+
+    bool SynetTopK16bAutoTest(const FuncTK16b& f1, const FuncTK16b& f2)
+    {
+        bool result = true;
+
+        result = result && SynetTopK16bAutoTest(1000, 1000, 1, 5, true, true, f1, f2);
+        result = result && SynetTopK16bAutoTest(64, 32000, 1, 50, false, false, f1, f2);
+        result = result && SynetTopK16bAutoTest(16, 10000, 1, 100, true, true, f1, f2);
+        result = result && SynetTopK16bAutoTest(10, 101, 49, 7, false, true, f1, f2);
+
+        return result;
+    }
+
+    bool SynetTopK16bAutoTest(const Options& options)
+    {
+        bool result = true;
+
+        if (TestBase(options))
+            result = result && SynetTopK16bAutoTest(FUNC_TK16B(Simd::Base::SynetTopK16b), FUNC_TK16B(SimdSynetTopK16b));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && TestSse41(options))
+            result = result && SynetTopK16bAutoTest(FUNC_TK16B(Simd::Sse41::SynetTopK16b), FUNC_TK16B(SimdSynetTopK16b));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && TestAvx2(options))
+            result = result && SynetTopK16bAutoTest(FUNC_TK16B(Simd::Avx2::SynetTopK16b), FUNC_TK16B(SimdSynetTopK16b));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && TestAvx512bw(options))
+            result = result && SynetTopK16bAutoTest(FUNC_TK16B(Simd::Avx512bw::SynetTopK16b), FUNC_TK16B(SimdSynetTopK16b));
+#endif
+
+        return result;
+    }
+#endif
+}